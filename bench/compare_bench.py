@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""Compares two pink_perilla_bench JSON reports and flags regressions.
+
+    ./pink_perilla_bench --benchmark_format=json > current.json
+    bench/compare_bench.py bench/baseline.json current.json [--threshold 0.10]
+
+A benchmark regresses when its CPU time per statement or its allocation
+counters grow by more than the threshold, or when its plan gets larger at all.
+Exits with status 1 if anything regressed.
+"""
+
+import argparse
+import json
+import sys
+
+# Counters compared against the relative threshold.
+THRESHOLD_METRICS = ("cpu_time", "allocs", "alloc_bytes")
+# Counters that are deterministic, so any growth is a regression.
+EXACT_METRICS = ("plan_bytes",)
+# Growth per statement ignored whatever the ratio: the benchmark library's own
+# allocations show up as fractions of one per statement.
+ABSOLUTE_SLACK = {"allocs": 1, "alloc_bytes": 64}
+
+
+def load(path):
+    with open(path) as f:
+        report = json.load(f)
+    benchmarks = {}
+    for benchmark in report["benchmarks"]:
+        # With --benchmark_repetitions, compare the medians.
+        if benchmark.get("run_type") == "aggregate":
+            if benchmark.get("aggregate_name") != "median":
+                continue
+        elif benchmark.get("repetitions", 1) > 1:
+            continue
+        benchmarks[benchmark["run_name"]] = benchmark
+    return benchmarks
+
+
+def relative_change(old, new):
+    if old == 0:
+        return 0.0 if new == 0 else float("inf")
+    return (new - old) / old
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="allowed relative growth (default: 0.10)")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+    regressions = 0
+    print(f"{'benchmark':48} {'metric':12} {'baseline':>12} {'current':>12} "
+          f"{'change':>8}")
+    for name, new in sorted(current.items()):
+        old = baseline.get(name)
+        if old is None:
+            print(f"{name:48} (new)")
+            continue
+        for metric in THRESHOLD_METRICS + EXACT_METRICS:
+            if metric not in old or metric not in new:
+                continue
+            old_value, new_value = old[metric], new[metric]
+            change = relative_change(old_value, new_value)
+            limit = 0.0 if metric in EXACT_METRICS else args.threshold
+            regressed = (change > limit and new_value - old_value >=
+                         ABSOLUTE_SLACK.get(metric, 0))
+            regressions += regressed
+            print(f"{name:48} {metric:12} {old_value:12.1f} "
+                  f"{new_value:12.1f} {change:+8.1%}"
+                  f"{'  REGRESSION' if regressed else ''}")
+    for name in sorted(baseline.keys() - current.keys()):
+        print(f"{name:48} (missing)")
+
+    if regressions:
+        print(f"{regressions} regression(s) over {args.threshold:.0%}",
+              file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,3 @@
+-- Derived tables nested 32 deep, as emitted by query builders.
+SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM base WHERE id > 0) WHERE id > 0) WHERE id > 1) WHERE id > 2) WHERE id > 3) WHERE id > 4) WHERE id > 5) WHERE id > 6) WHERE id > 7;
+SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM (SELECT id FROM base WHERE id > 0) WHERE id > 0) WHERE id > 1) WHERE id > 2) WHERE id > 3) WHERE id > 4) WHERE id > 5) WHERE id > 6) WHERE id > 7) WHERE id > 8) WHERE id > 9) WHERE id > 10) WHERE id > 11) WHERE id > 12) WHERE id > 13) WHERE id > 14) WHERE id > 15) WHERE id > 16) WHERE id > 17) WHERE id > 18) WHERE id > 19) WHERE id > 20) WHERE id > 21) WHERE id > 22) WHERE id > 23) WHERE id > 24) WHERE id > 25) WHERE id > 26) WHERE id > 27) WHERE id > 28) WHERE id > 29) WHERE id > 30) WHERE id > 31;
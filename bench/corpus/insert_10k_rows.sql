@@ -0,0 +1,10002 @@
+-- One bulk INSERT of ten thousand rows.
+INSERT INTO events (id, kind, score) VALUES
+(1, 'view', 71),
+(2, 'buy', 246),
+(3, 'scroll', 92),
+(4, 'click', 564),
+(5, 'view', 434),
+(6, 'buy', 60),
+(7, 'scroll', 846),
+(8, 'click', 579),
+(9, 'view', 126),
+(10, 'buy', 970),
+(11, 'scroll', 228),
+(12, 'click', 645),
+(13, 'view', 642),
+(14, 'buy', 596),
+(15, 'scroll', 970),
+(16, 'click', 63),
+(17, 'view', 590),
+(18, 'buy', 599),
+(19, 'scroll', 406),
+(20, 'click', 50),
+(21, 'view', 999),
+(22, 'buy', 226),
+(23, 'scroll', 47),
+(24, 'click', 570),
+(25, 'view', 879),
+(26, 'buy', 136),
+(27, 'scroll', 296),
+(28, 'click', 429),
+(29, 'view', 147),
+(30, 'buy', 553),
+(31, 'scroll', 120),
+(32, 'click', 584),
+(33, 'view', 315),
+(34, 'buy', 573),
+(35, 'scroll', 835),
+(36, 'click', 698),
+(37, 'view', 185),
+(38, 'buy', 105),
+(39, 'scroll', 595),
+(40, 'click', 584),
+(41, 'view', 654),
+(42, 'buy', 192),
+(43, 'scroll', 381),
+(44, 'click', 99),
+(45, 'view', 560),
+(46, 'buy', 729),
+(47, 'scroll', 64),
+(48, 'click', 577),
+(49, 'view', 61),
+(50, 'buy', 633),
+(51, 'scroll', 210),
+(52, 'click', 508),
+(53, 'view', 696),
+(54, 'buy', 544),
+(55, 'scroll', 437),
+(56, 'click', 795),
+(57, 'view', 321),
+(58, 'buy', 476),
+(59, 'scroll', 599),
+(60, 'click', 945),
+(61, 'view', 464),
+(62, 'buy', 370),
+(63, 'scroll', 306),
+(64, 'click', 254),
+(65, 'view', 813),
+(66, 'buy', 184),
+(67, 'scroll', 715),
+(68, 'click', 798),
+(69, 'view', 249),
+(70, 'buy', 83),
+(71, 'scroll', 588),
+(72, 'click', 307),
+(73, 'view', 537),
+(74, 'buy', 506),
+(75, 'scroll', 896),
+(76, 'click', 351),
+(77, 'view', 746),
+(78, 'buy', 459),
+(79, 'scroll', 294),
+(80, 'click', 623),
+(81, 'view', 74),
+(82, 'buy', 120),
+(83, 'scroll', 524),
+(84, 'click', 428),
+(85, 'view', 168),
+(86, 'buy', 775),
+(87, 'scroll', 350),
+(88, 'click', 155),
+(89, 'view', 955),
+(90, 'buy', 500),
+(91, 'scroll', 431),
+(92, 'click', 40),
+(93, 'view', 985),
+(94, 'buy', 684),
+(95, 'scroll', 79),
+(96, 'click', 782),
+(97, 'view', 571),
+(98, 'buy', 586),
+(99, 'scroll', 808),
+(100, 'click', 896),
+(101, 'view', 837),
+(102, 'buy', 321),
+(103, 'scroll', 348),
+(104, 'click', 711),
+(105, 'view', 358),
+(106, 'buy', 608),
+(107, 'scroll', 508),
+(108, 'click', 593),
+(109, 'view', 816),
+(110, 'buy', 467),
+(111, 'scroll', 70),
+(112, 'click', 860),
+(113, 'view', 95),
+(114, 'buy', 967),
+(115, 'scroll', 276),
+(116, 'click', 485),
+(117, 'view', 713),
+(118, 'buy', 680),
+(119, 'scroll', 66),
+(120, 'click', 62),
+(121, 'view', 748),
+(122, 'buy', 718),
+(123, 'scroll', 317),
+(124, 'click', 662),
+(125, 'view', 591),
+(126, 'buy', 697),
+(127, 'scroll', 841),
+(128, 'click', 456),
+(129, 'view', 291),
+(130, 'buy', 733),
+(131, 'scroll', 395),
+(132, 'click', 908),
+(133, 'view', 684),
+(134, 'buy', 355),
+(135, 'scroll', 23),
+(136, 'click', 963),
+(137, 'view', 472),
+(138, 'buy', 363),
+(139, 'scroll', 172),
+(140, 'click', 625),
+(141, 'view', 119),
+(142, 'buy', 505),
+(143, 'scroll', 60),
+(144, 'click', 223),
+(145, 'view', 786),
+(146, 'buy', 294),
+(147, 'scroll', 132),
+(148, 'click', 756),
+(149, 'view', 253),
+(150, 'buy', 407),
+(151, 'scroll', 400),
+(152, 'click', 938),
+(153, 'view', 892),
+(154, 'buy', 508),
+(155, 'scroll', 82),
+(156, 'click', 170),
+(157, 'view', 459),
+(158, 'buy', 411),
+(159, 'scroll', 562),
+(160, 'click', 284),
+(161, 'view', 904),
+(162, 'buy', 140),
+(163, 'scroll', 838),
+(164, 'click', 440),
+(165, 'view', 884),
+(166, 'buy', 563),
+(167, 'scroll', 285),
+(168, 'click', 723),
+(169, 'view', 425),
+(170, 'buy', 367),
+(171, 'scroll', 699),
+(172, 'click', 905),
+(173, 'view', 389),
+(174, 'buy', 980),
+(175, 'scroll', 236),
+(176, 'click', 154),
+(177, 'view', 84),
+(178, 'buy', 180),
+(179, 'scroll', 154),
+(180, 'click', 237),
+(181, 'view', 674),
+(182, 'buy', 238),
+(183, 'scroll', 12),
+(184, 'click', 496),
+(185, 'view', 851),
+(186, 'buy', 603),
+(187, 'scroll', 186),
+(188, 'click', 269),
+(189, 'view', 288),
+(190, 'buy', 4),
+(191, 'scroll', 149),
+(192, 'click', 429),
+(193, 'view', 547),
+(194, 'buy', 378),
+(195, 'scroll', 624),
+(196, 'click', 579),
+(197, 'view', 326),
+(198, 'buy', 975),
+(199, 'scroll', 128),
+(200, 'click', 707),
+(201, 'view', 879),
+(202, 'buy', 527),
+(203, 'scroll', 973),
+(204, 'click', 632),
+(205, 'view', 670),
+(206, 'buy', 692),
+(207, 'scroll', 757),
+(208, 'click', 55),
+(209, 'view', 467),
+(210, 'buy', 921),
+(211, 'scroll', 891),
+(212, 'click', 798),
+(213, 'view', 974),
+(214, 'buy', 895),
+(215, 'scroll', 696),
+(216, 'click', 817),
+(217, 'view', 572),
+(218, 'buy', 401),
+(219, 'scroll', 407),
+(220, 'click', 408),
+(221, 'view', 403),
+(222, 'buy', 106),
+(223, 'scroll', 493),
+(224, 'click', 649),
+(225, 'view', 410),
+(226, 'buy', 63),
+(227, 'scroll', 195),
+(228, 'click', 68),
+(229, 'view', 213),
+(230, 'buy', 451),
+(231, 'scroll', 166),
+(232, 'click', 112),
+(233, 'view', 348),
+(234, 'buy', 615),
+(235, 'scroll', 53),
+(236, 'click', 104),
+(237, 'view', 0),
+(238, 'buy', 580),
+(239, 'scroll', 154),
+(240, 'click', 549),
+(241, 'view', 103),
+(242, 'buy', 971),
+(243, 'scroll', 372),
+(244, 'click', 628),
+(245, 'view', 26),
+(246, 'buy', 72),
+(247, 'scroll', 895),
+(248, 'click', 212),
+(249, 'view', 628),
+(250, 'buy', 385),
+(251, 'scroll', 152),
+(252, 'click', 649),
+(253, 'view', 258),
+(254, 'buy', 978),
+(255, 'scroll', 355),
+(256, 'click', 616),
+(257, 'view', 372),
+(258, 'buy', 485),
+(259, 'scroll', 125),
+(260, 'click', 118),
+(261, 'view', 869),
+(262, 'buy', 499),
+(263, 'scroll', 477),
+(264, 'click', 491),
+(265, 'view', 495),
+(266, 'buy', 319),
+(267, 'scroll', 87),
+(268, 'click', 147),
+(269, 'view', 104),
+(270, 'buy', 767),
+(271, 'scroll', 350),
+(272, 'click', 758),
+(273, 'view', 271),
+(274, 'buy', 490),
+(275, 'scroll', 848),
+(276, 'click', 708),
+(277, 'view', 165),
+(278, 'buy', 528),
+(279, 'scroll', 23),
+(280, 'click', 210),
+(281, 'view', 973),
+(282, 'buy', 974),
+(283, 'scroll', 540),
+(284, 'click', 370),
+(285, 'view', 150),
+(286, 'buy', 706),
+(287, 'scroll', 556),
+(288, 'click', 936),
+(289, 'view', 27),
+(290, 'buy', 776),
+(291, 'scroll', 540),
+(292, 'click', 305),
+(293, 'view', 658),
+(294, 'buy', 884),
+(295, 'scroll', 93),
+(296, 'click', 712),
+(297, 'view', 865),
+(298, 'buy', 267),
+(299, 'scroll', 530),
+(300, 'click', 375),
+(301, 'view', 930),
+(302, 'buy', 171),
+(303, 'scroll', 364),
+(304, 'click', 790),
+(305, 'view', 228),
+(306, 'buy', 545),
+(307, 'scroll', 554),
+(308, 'click', 797),
+(309, 'view', 514),
+(310, 'buy', 337),
+(311, 'scroll', 651),
+(312, 'click', 228),
+(313, 'view', 627),
+(314, 'buy', 830),
+(315, 'scroll', 807),
+(316, 'click', 776),
+(317, 'view', 873),
+(318, 'buy', 199),
+(319, 'scroll', 825),
+(320, 'click', 245),
+(321, 'view', 837),
+(322, 'buy', 410),
+(323, 'scroll', 757),
+(324, 'click', 822),
+(325, 'view', 232),
+(326, 'buy', 204),
+(327, 'scroll', 530),
+(328, 'click', 504),
+(329, 'view', 364),
+(330, 'buy', 748),
+(331, 'scroll', 29),
+(332, 'click', 28),
+(333, 'view', 809),
+(334, 'buy', 286),
+(335, 'scroll', 483),
+(336, 'click', 265),
+(337, 'view', 198),
+(338, 'buy', 709),
+(339, 'scroll', 619),
+(340, 'click', 979),
+(341, 'view', 352),
+(342, 'buy', 457),
+(343, 'scroll', 827),
+(344, 'click', 959),
+(345, 'view', 740),
+(346, 'buy', 357),
+(347, 'scroll', 977),
+(348, 'click', 997),
+(349, 'view', 373),
+(350, 'buy', 82),
+(351, 'scroll', 225),
+(352, 'click', 104),
+(353, 'view', 232),
+(354, 'buy', 481),
+(355, 'scroll', 201),
+(356, 'click', 345),
+(357, 'view', 209),
+(358, 'buy', 494),
+(359, 'scroll', 639),
+(360, 'click', 921),
+(361, 'view', 624),
+(362, 'buy', 860),
+(363, 'scroll', 1),
+(364, 'click', 490),
+(365, 'view', 931),
+(366, 'buy', 668),
+(367, 'scroll', 352),
+(368, 'click', 818),
+(369, 'view', 658),
+(370, 'buy', 86),
+(371, 'scroll', 854),
+(372, 'click', 676),
+(373, 'view', 122),
+(374, 'buy', 931),
+(375, 'scroll', 397),
+(376, 'click', 801),
+(377, 'view', 728),
+(378, 'buy', 768),
+(379, 'scroll', 204),
+(380, 'click', 489),
+(381, 'view', 910),
+(382, 'buy', 182),
+(383, 'scroll', 444),
+(384, 'click', 808),
+(385, 'view', 651),
+(386, 'buy', 340),
+(387, 'scroll', 88),
+(388, 'click', 820),
+(389, 'view', 968),
+(390, 'buy', 994),
+(391, 'scroll', 739),
+(392, 'click', 405),
+(393, 'view', 474),
+(394, 'buy', 411),
+(395, 'scroll', 761),
+(396, 'click', 969),
+(397, 'view', 86),
+(398, 'buy', 742),
+(399, 'scroll', 162),
+(400, 'click', 174),
+(401, 'view', 130),
+(402, 'buy', 28),
+(403, 'scroll', 154),
+(404, 'click', 604),
+(405, 'view', 926),
+(406, 'buy', 476),
+(407, 'scroll', 825),
+(408, 'click', 671),
+(409, 'view', 149),
+(410, 'buy', 626),
+(411, 'scroll', 846),
+(412, 'click', 610),
+(413, 'view', 485),
+(414, 'buy', 673),
+(415, 'scroll', 959),
+(416, 'click', 358),
+(417, 'view', 159),
+(418, 'buy', 561),
+(419, 'scroll', 561),
+(420, 'click', 134),
+(421, 'view', 21),
+(422, 'buy', 14),
+(423, 'scroll', 818),
+(424, 'click', 994),
+(425, 'view', 743),
+(426, 'buy', 665),
+(427, 'scroll', 105),
+(428, 'click', 539),
+(429, 'view', 767),
+(430, 'buy', 956),
+(431, 'scroll', 142),
+(432, 'click', 444),
+(433, 'view', 892),
+(434, 'buy', 199),
+(435, 'scroll', 845),
+(436, 'click', 894),
+(437, 'view', 216),
+(438, 'buy', 28),
+(439, 'scroll', 257),
+(440, 'click', 217),
+(441, 'view', 299),
+(442, 'buy', 513),
+(443, 'scroll', 246),
+(444, 'click', 782),
+(445, 'view', 600),
+(446, 'buy', 333),
+(447, 'scroll', 265),
+(448, 'click', 557),
+(449, 'view', 429),
+(450, 'buy', 854),
+(451, 'scroll', 134),
+(452, 'click', 62),
+(453, 'view', 931),
+(454, 'buy', 757),
+(455, 'scroll', 362),
+(456, 'click', 919),
+(457, 'view', 469),
+(458, 'buy', 678),
+(459, 'scroll', 597),
+(460, 'click', 834),
+(461, 'view', 925),
+(462, 'buy', 529),
+(463, 'scroll', 430),
+(464, 'click', 846),
+(465, 'view', 939),
+(466, 'buy', 899),
+(467, 'scroll', 513),
+(468, 'click', 133),
+(469, 'view', 544),
+(470, 'buy', 155),
+(471, 'scroll', 536),
+(472, 'click', 522),
+(473, 'view', 19),
+(474, 'buy', 893),
+(475, 'scroll', 450),
+(476, 'click', 795),
+(477, 'view', 187),
+(478, 'buy', 623),
+(479, 'scroll', 4),
+(480, 'click', 794),
+(481, 'view', 818),
+(482, 'buy', 153),
+(483, 'scroll', 176),
+(484, 'click', 144),
+(485, 'view', 484),
+(486, 'buy', 633),
+(487, 'scroll', 742),
+(488, 'click', 123),
+(489, 'view', 569),
+(490, 'buy', 63),
+(491, 'scroll', 333),
+(492, 'click', 698),
+(493, 'view', 530),
+(494, 'buy', 543),
+(495, 'scroll', 568),
+(496, 'click', 494),
+(497, 'view', 803),
+(498, 'buy', 795),
+(499, 'scroll', 108),
+(500, 'click', 904),
+(501, 'view', 573),
+(502, 'buy', 58),
+(503, 'scroll', 254),
+(504, 'click', 195),
+(505, 'view', 283),
+(506, 'buy', 43),
+(507, 'scroll', 790),
+(508, 'click', 100),
+(509, 'view', 519),
+(510, 'buy', 463),
+(511, 'scroll', 575),
+(512, 'click', 28),
+(513, 'view', 778),
+(514, 'buy', 915),
+(515, 'scroll', 934),
+(516, 'click', 64),
+(517, 'view', 453),
+(518, 'buy', 333),
+(519, 'scroll', 627),
+(520, 'click', 996),
+(521, 'view', 517),
+(522, 'buy', 620),
+(523, 'scroll', 524),
+(524, 'click', 204),
+(525, 'view', 709),
+(526, 'buy', 283),
+(527, 'scroll', 463),
+(528, 'click', 520),
+(529, 'view', 546),
+(530, 'buy', 826),
+(531, 'scroll', 489),
+(532, 'click', 519),
+(533, 'view', 964),
+(534, 'buy', 253),
+(535, 'scroll', 715),
+(536, 'click', 535),
+(537, 'view', 897),
+(538, 'buy', 897),
+(539, 'scroll', 964),
+(540, 'click', 950),
+(541, 'view', 265),
+(542, 'buy', 944),
+(543, 'scroll', 572),
+(544, 'click', 914),
+(545, 'view', 965),
+(546, 'buy', 207),
+(547, 'scroll', 860),
+(548, 'click', 458),
+(549, 'view', 140),
+(550, 'buy', 426),
+(551, 'scroll', 124),
+(552, 'click', 401),
+(553, 'view', 452),
+(554, 'buy', 323),
+(555, 'scroll', 74),
+(556, 'click', 687),
+(557, 'view', 246),
+(558, 'buy', 438),
+(559, 'scroll', 74),
+(560, 'click', 217),
+(561, 'view', 685),
+(562, 'buy', 310),
+(563, 'scroll', 802),
+(564, 'click', 125),
+(565, 'view', 918),
+(566, 'buy', 795),
+(567, 'scroll', 158),
+(568, 'click', 962),
+(569, 'view', 733),
+(570, 'buy', 658),
+(571, 'scroll', 676),
+(572, 'click', 374),
+(573, 'view', 146),
+(574, 'buy', 259),
+(575, 'scroll', 904),
+(576, 'click', 140),
+(577, 'view', 990),
+(578, 'buy', 478),
+(579, 'scroll', 224),
+(580, 'click', 764),
+(581, 'view', 975),
+(582, 'buy', 96),
+(583, 'scroll', 407),
+(584, 'click', 906),
+(585, 'view', 498),
+(586, 'buy', 166),
+(587, 'scroll', 683),
+(588, 'click', 852),
+(589, 'view', 229),
+(590, 'buy', 165),
+(591, 'scroll', 723),
+(592, 'click', 441),
+(593, 'view', 527),
+(594, 'buy', 413),
+(595, 'scroll', 347),
+(596, 'click', 431),
+(597, 'view', 200),
+(598, 'buy', 365),
+(599, 'scroll', 326),
+(600, 'click', 94),
+(601, 'view', 739),
+(602, 'buy', 374),
+(603, 'scroll', 19),
+(604, 'click', 346),
+(605, 'view', 567),
+(606, 'buy', 469),
+(607, 'scroll', 451),
+(608, 'click', 720),
+(609, 'view', 18),
+(610, 'buy', 393),
+(611, 'scroll', 339),
+(612, 'click', 529),
+(613, 'view', 638),
+(614, 'buy', 302),
+(615, 'scroll', 524),
+(616, 'click', 983),
+(617, 'view', 65),
+(618, 'buy', 115),
+(619, 'scroll', 940),
+(620, 'click', 807),
+(621, 'view', 234),
+(622, 'buy', 995),
+(623, 'scroll', 897),
+(624, 'click', 107),
+(625, 'view', 86),
+(626, 'buy', 271),
+(627, 'scroll', 278),
+(628, 'click', 40),
+(629, 'view', 927),
+(630, 'buy', 797),
+(631, 'scroll', 185),
+(632, 'click', 276),
+(633, 'view', 773),
+(634, 'buy', 132),
+(635, 'scroll', 839),
+(636, 'click', 432),
+(637, 'view', 869),
+(638, 'buy', 933),
+(639, 'scroll', 692),
+(640, 'click', 838),
+(641, 'view', 968),
+(642, 'buy', 264),
+(643, 'scroll', 415),
+(644, 'click', 152),
+(645, 'view', 549),
+(646, 'buy', 941),
+(647, 'scroll', 527),
+(648, 'click', 584),
+(649, 'view', 506),
+(650, 'buy', 717),
+(651, 'scroll', 334),
+(652, 'click', 91),
+(653, 'view', 285),
+(654, 'buy', 58),
+(655, 'scroll', 818),
+(656, 'click', 704),
+(657, 'view', 187),
+(658, 'buy', 435),
+(659, 'scroll', 916),
+(660, 'click', 74),
+(661, 'view', 275),
+(662, 'buy', 960),
+(663, 'scroll', 17),
+(664, 'click', 649),
+(665, 'view', 90),
+(666, 'buy', 820),
+(667, 'scroll', 266),
+(668, 'click', 85),
+(669, 'view', 622),
+(670, 'buy', 876),
+(671, 'scroll', 227),
+(672, 'click', 68),
+(673, 'view', 270),
+(674, 'buy', 883),
+(675, 'scroll', 124),
+(676, 'click', 464),
+(677, 'view', 11),
+(678, 'buy', 347),
+(679, 'scroll', 566),
+(680, 'click', 427),
+(681, 'view', 948),
+(682, 'buy', 937),
+(683, 'scroll', 274),
+(684, 'click', 636),
+(685, 'view', 132),
+(686, 'buy', 44),
+(687, 'scroll', 539),
+(688, 'click', 726),
+(689, 'view', 244),
+(690, 'buy', 960),
+(691, 'scroll', 112),
+(692, 'click', 992),
+(693, 'view', 165),
+(694, 'buy', 268),
+(695, 'scroll', 51),
+(696, 'click', 185),
+(697, 'view', 206),
+(698, 'buy', 954),
+(699, 'scroll', 319),
+(700, 'click', 643),
+(701, 'view', 312),
+(702, 'buy', 543),
+(703, 'scroll', 777),
+(704, 'click', 210),
+(705, 'view', 296),
+(706, 'buy', 456),
+(707, 'scroll', 512),
+(708, 'click', 688),
+(709, 'view', 182),
+(710, 'buy', 277),
+(711, 'scroll', 355),
+(712, 'click', 822),
+(713, 'view', 18),
+(714, 'buy', 256),
+(715, 'scroll', 37),
+(716, 'click', 15),
+(717, 'view', 18),
+(718, 'buy', 750),
+(719, 'scroll', 517),
+(720, 'click', 564),
+(721, 'view', 194),
+(722, 'buy', 526),
+(723, 'scroll', 486),
+(724, 'click', 251),
+(725, 'view', 957),
+(726, 'buy', 457),
+(727, 'scroll', 108),
+(728, 'click', 674),
+(729, 'view', 838),
+(730, 'buy', 665),
+(731, 'scroll', 442),
+(732, 'click', 672),
+(733, 'view', 506),
+(734, 'buy', 559),
+(735, 'scroll', 854),
+(736, 'click', 910),
+(737, 'view', 402),
+(738, 'buy', 993),
+(739, 'scroll', 518),
+(740, 'click', 315),
+(741, 'view', 704),
+(742, 'buy', 220),
+(743, 'scroll', 235),
+(744, 'click', 350),
+(745, 'view', 203),
+(746, 'buy', 852),
+(747, 'scroll', 903),
+(748, 'click', 723),
+(749, 'view', 746),
+(750, 'buy', 651),
+(751, 'scroll', 143),
+(752, 'click', 414),
+(753, 'view', 355),
+(754, 'buy', 55),
+(755, 'scroll', 857),
+(756, 'click', 132),
+(757, 'view', 14),
+(758, 'buy', 72),
+(759, 'scroll', 640),
+(760, 'click', 758),
+(761, 'view', 900),
+(762, 'buy', 261),
+(763, 'scroll', 441),
+(764, 'click', 167),
+(765, 'view', 56),
+(766, 'buy', 86),
+(767, 'scroll', 681),
+(768, 'click', 861),
+(769, 'view', 390),
+(770, 'buy', 891),
+(771, 'scroll', 518),
+(772, 'click', 686),
+(773, 'view', 994),
+(774, 'buy', 288),
+(775, 'scroll', 613),
+(776, 'click', 248),
+(777, 'view', 709),
+(778, 'buy', 300),
+(779, 'scroll', 46),
+(780, 'click', 470),
+(781, 'view', 189),
+(782, 'buy', 161),
+(783, 'scroll', 275),
+(784, 'click', 456),
+(785, 'view', 3),
+(786, 'buy', 269),
+(787, 'scroll', 372),
+(788, 'click', 984),
+(789, 'view', 336),
+(790, 'buy', 995),
+(791, 'scroll', 560),
+(792, 'click', 331),
+(793, 'view', 250),
+(794, 'buy', 35),
+(795, 'scroll', 988),
+(796, 'click', 903),
+(797, 'view', 316),
+(798, 'buy', 223),
+(799, 'scroll', 365),
+(800, 'click', 187),
+(801, 'view', 1),
+(802, 'buy', 343),
+(803, 'scroll', 390),
+(804, 'click', 85),
+(805, 'view', 486),
+(806, 'buy', 285),
+(807, 'scroll', 514),
+(808, 'click', 671),
+(809, 'view', 205),
+(810, 'buy', 254),
+(811, 'scroll', 516),
+(812, 'click', 794),
+(813, 'view', 5),
+(814, 'buy', 93),
+(815, 'scroll', 270),
+(816, 'click', 836),
+(817, 'view', 91),
+(818, 'buy', 147),
+(819, 'scroll', 409),
+(820, 'click', 600),
+(821, 'view', 42),
+(822, 'buy', 403),
+(823, 'scroll', 23),
+(824, 'click', 306),
+(825, 'view', 311),
+(826, 'buy', 644),
+(827, 'scroll', 238),
+(828, 'click', 86),
+(829, 'view', 599),
+(830, 'buy', 980),
+(831, 'scroll', 541),
+(832, 'click', 873),
+(833, 'view', 768),
+(834, 'buy', 158),
+(835, 'scroll', 673),
+(836, 'click', 914),
+(837, 'view', 733),
+(838, 'buy', 802),
+(839, 'scroll', 900),
+(840, 'click', 610),
+(841, 'view', 398),
+(842, 'buy', 782),
+(843, 'scroll', 333),
+(844, 'click', 737),
+(845, 'view', 506),
+(846, 'buy', 153),
+(847, 'scroll', 290),
+(848, 'click', 741),
+(849, 'view', 633),
+(850, 'buy', 658),
+(851, 'scroll', 148),
+(852, 'click', 44),
+(853, 'view', 844),
+(854, 'buy', 855),
+(855, 'scroll', 732),
+(856, 'click', 913),
+(857, 'view', 525),
+(858, 'buy', 642),
+(859, 'scroll', 439),
+(860, 'click', 751),
+(861, 'view', 717),
+(862, 'buy', 831),
+(863, 'scroll', 517),
+(864, 'click', 142),
+(865, 'view', 931),
+(866, 'buy', 536),
+(867, 'scroll', 770),
+(868, 'click', 516),
+(869, 'view', 582),
+(870, 'buy', 854),
+(871, 'scroll', 832),
+(872, 'click', 823),
+(873, 'view', 16),
+(874, 'buy', 846),
+(875, 'scroll', 702),
+(876, 'click', 598),
+(877, 'view', 817),
+(878, 'buy', 914),
+(879, 'scroll', 728),
+(880, 'click', 699),
+(881, 'view', 979),
+(882, 'buy', 709),
+(883, 'scroll', 658),
+(884, 'click', 235),
+(885, 'view', 87),
+(886, 'buy', 31),
+(887, 'scroll', 42),
+(888, 'click', 136),
+(889, 'view', 652),
+(890, 'buy', 369),
+(891, 'scroll', 982),
+(892, 'click', 107),
+(893, 'view', 385),
+(894, 'buy', 855),
+(895, 'scroll', 462),
+(896, 'click', 571),
+(897, 'view', 51),
+(898, 'buy', 642),
+(899, 'scroll', 19),
+(900, 'click', 641),
+(901, 'view', 544),
+(902, 'buy', 697),
+(903, 'scroll', 250),
+(904, 'click', 501),
+(905, 'view', 270),
+(906, 'buy', 3),
+(907, 'scroll', 467),
+(908, 'click', 816),
+(909, 'view', 71),
+(910, 'buy', 766),
+(911, 'scroll', 954),
+(912, 'click', 515),
+(913, 'view', 919),
+(914, 'buy', 548),
+(915, 'scroll', 94),
+(916, 'click', 675),
+(917, 'view', 538),
+(918, 'buy', 67),
+(919, 'scroll', 763),
+(920, 'click', 754),
+(921, 'view', 485),
+(922, 'buy', 258),
+(923, 'scroll', 828),
+(924, 'click', 76),
+(925, 'view', 866),
+(926, 'buy', 271),
+(927, 'scroll', 240),
+(928, 'click', 746),
+(929, 'view', 774),
+(930, 'buy', 210),
+(931, 'scroll', 236),
+(932, 'click', 757),
+(933, 'view', 665),
+(934, 'buy', 999),
+(935, 'scroll', 471),
+(936, 'click', 505),
+(937, 'view', 865),
+(938, 'buy', 391),
+(939, 'scroll', 78),
+(940, 'click', 490),
+(941, 'view', 932),
+(942, 'buy', 700),
+(943, 'scroll', 294),
+(944, 'click', 785),
+(945, 'view', 47),
+(946, 'buy', 631),
+(947, 'scroll', 647),
+(948, 'click', 658),
+(949, 'view', 203),
+(950, 'buy', 79),
+(951, 'scroll', 614),
+(952, 'click', 150),
+(953, 'view', 339),
+(954, 'buy', 260),
+(955, 'scroll', 667),
+(956, 'click', 761),
+(957, 'view', 709),
+(958, 'buy', 311),
+(959, 'scroll', 636),
+(960, 'click', 581),
+(961, 'view', 136),
+(962, 'buy', 12),
+(963, 'scroll', 493),
+(964, 'click', 62),
+(965, 'view', 497),
+(966, 'buy', 275),
+(967, 'scroll', 995),
+(968, 'click', 688),
+(969, 'view', 101),
+(970, 'buy', 708),
+(971, 'scroll', 222),
+(972, 'click', 691),
+(973, 'view', 501),
+(974, 'buy', 297),
+(975, 'scroll', 725),
+(976, 'click', 528),
+(977, 'view', 292),
+(978, 'buy', 475),
+(979, 'scroll', 477),
+(980, 'click', 477),
+(981, 'view', 785),
+(982, 'buy', 121),
+(983, 'scroll', 915),
+(984, 'click', 562),
+(985, 'view', 204),
+(986, 'buy', 319),
+(987, 'scroll', 87),
+(988, 'click', 958),
+(989, 'view', 484),
+(990, 'buy', 17),
+(991, 'scroll', 296),
+(992, 'click', 469),
+(993, 'view', 78),
+(994, 'buy', 839),
+(995, 'scroll', 518),
+(996, 'click', 991),
+(997, 'view', 460),
+(998, 'buy', 275),
+(999, 'scroll', 396),
+(1000, 'click', 214),
+(1001, 'view', 938),
+(1002, 'buy', 968),
+(1003, 'scroll', 952),
+(1004, 'click', 215),
+(1005, 'view', 76),
+(1006, 'buy', 595),
+(1007, 'scroll', 92),
+(1008, 'click', 145),
+(1009, 'view', 765),
+(1010, 'buy', 536),
+(1011, 'scroll', 268),
+(1012, 'click', 975),
+(1013, 'view', 368),
+(1014, 'buy', 135),
+(1015, 'scroll', 617),
+(1016, 'click', 839),
+(1017, 'view', 646),
+(1018, 'buy', 520),
+(1019, 'scroll', 286),
+(1020, 'click', 908),
+(1021, 'view', 115),
+(1022, 'buy', 720),
+(1023, 'scroll', 373),
+(1024, 'click', 236),
+(1025, 'view', 509),
+(1026, 'buy', 919),
+(1027, 'scroll', 897),
+(1028, 'click', 497),
+(1029, 'view', 403),
+(1030, 'buy', 25),
+(1031, 'scroll', 162),
+(1032, 'click', 3),
+(1033, 'view', 972),
+(1034, 'buy', 503),
+(1035, 'scroll', 697),
+(1036, 'click', 461),
+(1037, 'view', 415),
+(1038, 'buy', 309),
+(1039, 'scroll', 744),
+(1040, 'click', 144),
+(1041, 'view', 426),
+(1042, 'buy', 352),
+(1043, 'scroll', 385),
+(1044, 'click', 323),
+(1045, 'view', 123),
+(1046, 'buy', 860),
+(1047, 'scroll', 339),
+(1048, 'click', 1),
+(1049, 'view', 332),
+(1050, 'buy', 768),
+(1051, 'scroll', 346),
+(1052, 'click', 859),
+(1053, 'view', 407),
+(1054, 'buy', 122),
+(1055, 'scroll', 962),
+(1056, 'click', 948),
+(1057, 'view', 200),
+(1058, 'buy', 730),
+(1059, 'scroll', 12),
+(1060, 'click', 923),
+(1061, 'view', 757),
+(1062, 'buy', 296),
+(1063, 'scroll', 259),
+(1064, 'click', 381),
+(1065, 'view', 66),
+(1066, 'buy', 402),
+(1067, 'scroll', 399),
+(1068, 'click', 890),
+(1069, 'view', 603),
+(1070, 'buy', 78),
+(1071, 'scroll', 369),
+(1072, 'click', 947),
+(1073, 'view', 438),
+(1074, 'buy', 773),
+(1075, 'scroll', 281),
+(1076, 'click', 874),
+(1077, 'view', 49),
+(1078, 'buy', 287),
+(1079, 'scroll', 104),
+(1080, 'click', 52),
+(1081, 'view', 854),
+(1082, 'buy', 677),
+(1083, 'scroll', 292),
+(1084, 'click', 650),
+(1085, 'view', 958),
+(1086, 'buy', 152),
+(1087, 'scroll', 255),
+(1088, 'click', 994),
+(1089, 'view', 272),
+(1090, 'buy', 446),
+(1091, 'scroll', 523),
+(1092, 'click', 323),
+(1093, 'view', 194),
+(1094, 'buy', 791),
+(1095, 'scroll', 382),
+(1096, 'click', 803),
+(1097, 'view', 979),
+(1098, 'buy', 438),
+(1099, 'scroll', 905),
+(1100, 'click', 29),
+(1101, 'view', 831),
+(1102, 'buy', 779),
+(1103, 'scroll', 646),
+(1104, 'click', 409),
+(1105, 'view', 935),
+(1106, 'buy', 896),
+(1107, 'scroll', 963),
+(1108, 'click', 567),
+(1109, 'view', 562),
+(1110, 'buy', 208),
+(1111, 'scroll', 736),
+(1112, 'click', 82),
+(1113, 'view', 50),
+(1114, 'buy', 955),
+(1115, 'scroll', 749),
+(1116, 'click', 420),
+(1117, 'view', 461),
+(1118, 'buy', 629),
+(1119, 'scroll', 770),
+(1120, 'click', 141),
+(1121, 'view', 659),
+(1122, 'buy', 890),
+(1123, 'scroll', 293),
+(1124, 'click', 497),
+(1125, 'view', 50),
+(1126, 'buy', 933),
+(1127, 'scroll', 949),
+(1128, 'click', 563),
+(1129, 'view', 130),
+(1130, 'buy', 174),
+(1131, 'scroll', 483),
+(1132, 'click', 424),
+(1133, 'view', 351),
+(1134, 'buy', 288),
+(1135, 'scroll', 304),
+(1136, 'click', 261),
+(1137, 'view', 756),
+(1138, 'buy', 756),
+(1139, 'scroll', 999),
+(1140, 'click', 668),
+(1141, 'view', 266),
+(1142, 'buy', 415),
+(1143, 'scroll', 671),
+(1144, 'click', 244),
+(1145, 'view', 308),
+(1146, 'buy', 494),
+(1147, 'scroll', 570),
+(1148, 'click', 684),
+(1149, 'view', 403),
+(1150, 'buy', 122),
+(1151, 'scroll', 171),
+(1152, 'click', 658),
+(1153, 'view', 165),
+(1154, 'buy', 76),
+(1155, 'scroll', 212),
+(1156, 'click', 512),
+(1157, 'view', 927),
+(1158, 'buy', 831),
+(1159, 'scroll', 509),
+(1160, 'click', 563),
+(1161, 'view', 225),
+(1162, 'buy', 463),
+(1163, 'scroll', 928),
+(1164, 'click', 340),
+(1165, 'view', 777),
+(1166, 'buy', 460),
+(1167, 'scroll', 437),
+(1168, 'click', 142),
+(1169, 'view', 560),
+(1170, 'buy', 197),
+(1171, 'scroll', 249),
+(1172, 'click', 92),
+(1173, 'view', 178),
+(1174, 'buy', 350),
+(1175, 'scroll', 569),
+(1176, 'click', 93),
+(1177, 'view', 326),
+(1178, 'buy', 244),
+(1179, 'scroll', 377),
+(1180, 'click', 264),
+(1181, 'view', 828),
+(1182, 'buy', 583),
+(1183, 'scroll', 206),
+(1184, 'click', 908),
+(1185, 'view', 20),
+(1186, 'buy', 767),
+(1187, 'scroll', 891),
+(1188, 'click', 422),
+(1189, 'view', 392),
+(1190, 'buy', 423),
+(1191, 'scroll', 763),
+(1192, 'click', 536),
+(1193, 'view', 215),
+(1194, 'buy', 385),
+(1195, 'scroll', 276),
+(1196, 'click', 346),
+(1197, 'view', 770),
+(1198, 'buy', 63),
+(1199, 'scroll', 510),
+(1200, 'click', 284),
+(1201, 'view', 588),
+(1202, 'buy', 990),
+(1203, 'scroll', 368),
+(1204, 'click', 128),
+(1205, 'view', 703),
+(1206, 'buy', 515),
+(1207, 'scroll', 541),
+(1208, 'click', 644),
+(1209, 'view', 809),
+(1210, 'buy', 883),
+(1211, 'scroll', 868),
+(1212, 'click', 221),
+(1213, 'view', 94),
+(1214, 'buy', 277),
+(1215, 'scroll', 918),
+(1216, 'click', 254),
+(1217, 'view', 393),
+(1218, 'buy', 409),
+(1219, 'scroll', 661),
+(1220, 'click', 456),
+(1221, 'view', 442),
+(1222, 'buy', 976),
+(1223, 'scroll', 319),
+(1224, 'click', 869),
+(1225, 'view', 833),
+(1226, 'buy', 893),
+(1227, 'scroll', 991),
+(1228, 'click', 22),
+(1229, 'view', 130),
+(1230, 'buy', 33),
+(1231, 'scroll', 435),
+(1232, 'click', 726),
+(1233, 'view', 782),
+(1234, 'buy', 917),
+(1235, 'scroll', 823),
+(1236, 'click', 484),
+(1237, 'view', 991),
+(1238, 'buy', 601),
+(1239, 'scroll', 501),
+(1240, 'click', 0),
+(1241, 'view', 74),
+(1242, 'buy', 400),
+(1243, 'scroll', 952),
+(1244, 'click', 949),
+(1245, 'view', 950),
+(1246, 'buy', 845),
+(1247, 'scroll', 540),
+(1248, 'click', 875),
+(1249, 'view', 479),
+(1250, 'buy', 995),
+(1251, 'scroll', 459),
+(1252, 'click', 254),
+(1253, 'view', 801),
+(1254, 'buy', 111),
+(1255, 'scroll', 229),
+(1256, 'click', 158),
+(1257, 'view', 155),
+(1258, 'buy', 534),
+(1259, 'scroll', 995),
+(1260, 'click', 698),
+(1261, 'view', 111),
+(1262, 'buy', 964),
+(1263, 'scroll', 845),
+(1264, 'click', 739),
+(1265, 'view', 717),
+(1266, 'buy', 662),
+(1267, 'scroll', 866),
+(1268, 'click', 783),
+(1269, 'view', 916),
+(1270, 'buy', 468),
+(1271, 'scroll', 87),
+(1272, 'click', 564),
+(1273, 'view', 795),
+(1274, 'buy', 40),
+(1275, 'scroll', 1),
+(1276, 'click', 801),
+(1277, 'view', 128),
+(1278, 'buy', 238),
+(1279, 'scroll', 583),
+(1280, 'click', 941),
+(1281, 'view', 38),
+(1282, 'buy', 660),
+(1283, 'scroll', 732),
+(1284, 'click', 311),
+(1285, 'view', 985),
+(1286, 'buy', 131),
+(1287, 'scroll', 641),
+(1288, 'click', 257),
+(1289, 'view', 540),
+(1290, 'buy', 651),
+(1291, 'scroll', 447),
+(1292, 'click', 715),
+(1293, 'view', 782),
+(1294, 'buy', 114),
+(1295, 'scroll', 101),
+(1296, 'click', 72),
+(1297, 'view', 307),
+(1298, 'buy', 537),
+(1299, 'scroll', 966),
+(1300, 'click', 596),
+(1301, 'view', 196),
+(1302, 'buy', 397),
+(1303, 'scroll', 267),
+(1304, 'click', 228),
+(1305, 'view', 809),
+(1306, 'buy', 615),
+(1307, 'scroll', 1),
+(1308, 'click', 10),
+(1309, 'view', 550),
+(1310, 'buy', 308),
+(1311, 'scroll', 471),
+(1312, 'click', 285),
+(1313, 'view', 981),
+(1314, 'buy', 323),
+(1315, 'scroll', 660),
+(1316, 'click', 859),
+(1317, 'view', 904),
+(1318, 'buy', 248),
+(1319, 'scroll', 486),
+(1320, 'click', 538),
+(1321, 'view', 240),
+(1322, 'buy', 560),
+(1323, 'scroll', 252),
+(1324, 'click', 29),
+(1325, 'view', 983),
+(1326, 'buy', 421),
+(1327, 'scroll', 721),
+(1328, 'click', 665),
+(1329, 'view', 314),
+(1330, 'buy', 56),
+(1331, 'scroll', 22),
+(1332, 'click', 198),
+(1333, 'view', 510),
+(1334, 'buy', 906),
+(1335, 'scroll', 690),
+(1336, 'click', 662),
+(1337, 'view', 430),
+(1338, 'buy', 83),
+(1339, 'scroll', 263),
+(1340, 'click', 233),
+(1341, 'view', 683),
+(1342, 'buy', 434),
+(1343, 'scroll', 947),
+(1344, 'click', 379),
+(1345, 'view', 232),
+(1346, 'buy', 504),
+(1347, 'scroll', 34),
+(1348, 'click', 712),
+(1349, 'view', 346),
+(1350, 'buy', 735),
+(1351, 'scroll', 430),
+(1352, 'click', 371),
+(1353, 'view', 698),
+(1354, 'buy', 405),
+(1355, 'scroll', 202),
+(1356, 'click', 6),
+(1357, 'view', 816),
+(1358, 'buy', 299),
+(1359, 'scroll', 756),
+(1360, 'click', 865),
+(1361, 'view', 516),
+(1362, 'buy', 69),
+(1363, 'scroll', 210),
+(1364, 'click', 507),
+(1365, 'view', 993),
+(1366, 'buy', 205),
+(1367, 'scroll', 319),
+(1368, 'click', 784),
+(1369, 'view', 839),
+(1370, 'buy', 198),
+(1371, 'scroll', 236),
+(1372, 'click', 476),
+(1373, 'view', 226),
+(1374, 'buy', 271),
+(1375, 'scroll', 778),
+(1376, 'click', 910),
+(1377, 'view', 302),
+(1378, 'buy', 111),
+(1379, 'scroll', 974),
+(1380, 'click', 638),
+(1381, 'view', 507),
+(1382, 'buy', 624),
+(1383, 'scroll', 191),
+(1384, 'click', 917),
+(1385, 'view', 228),
+(1386, 'buy', 496),
+(1387, 'scroll', 427),
+(1388, 'click', 932),
+(1389, 'view', 681),
+(1390, 'buy', 57),
+(1391, 'scroll', 971),
+(1392, 'click', 609),
+(1393, 'view', 149),
+(1394, 'buy', 944),
+(1395, 'scroll', 402),
+(1396, 'click', 55),
+(1397, 'view', 218),
+(1398, 'buy', 24),
+(1399, 'scroll', 997),
+(1400, 'click', 610),
+(1401, 'view', 145),
+(1402, 'buy', 425),
+(1403, 'scroll', 53),
+(1404, 'click', 726),
+(1405, 'view', 61),
+(1406, 'buy', 188),
+(1407, 'scroll', 402),
+(1408, 'click', 460),
+(1409, 'view', 919),
+(1410, 'buy', 729),
+(1411, 'scroll', 904),
+(1412, 'click', 321),
+(1413, 'view', 750),
+(1414, 'buy', 115),
+(1415, 'scroll', 81),
+(1416, 'click', 953),
+(1417, 'view', 169),
+(1418, 'buy', 337),
+(1419, 'scroll', 195),
+(1420, 'click', 189),
+(1421, 'view', 668),
+(1422, 'buy', 958),
+(1423, 'scroll', 537),
+(1424, 'click', 764),
+(1425, 'view', 478),
+(1426, 'buy', 32),
+(1427, 'scroll', 319),
+(1428, 'click', 680),
+(1429, 'view', 742),
+(1430, 'buy', 387),
+(1431, 'scroll', 859),
+(1432, 'click', 382),
+(1433, 'view', 339),
+(1434, 'buy', 453),
+(1435, 'scroll', 173),
+(1436, 'click', 111),
+(1437, 'view', 2),
+(1438, 'buy', 80),
+(1439, 'scroll', 286),
+(1440, 'click', 82),
+(1441, 'view', 359),
+(1442, 'buy', 430),
+(1443, 'scroll', 978),
+(1444, 'click', 906),
+(1445, 'view', 126),
+(1446, 'buy', 574),
+(1447, 'scroll', 987),
+(1448, 'click', 777),
+(1449, 'view', 212),
+(1450, 'buy', 389),
+(1451, 'scroll', 365),
+(1452, 'click', 787),
+(1453, 'view', 841),
+(1454, 'buy', 316),
+(1455, 'scroll', 841),
+(1456, 'click', 823),
+(1457, 'view', 442),
+(1458, 'buy', 89),
+(1459, 'scroll', 50),
+(1460, 'click', 722),
+(1461, 'view', 484),
+(1462, 'buy', 200),
+(1463, 'scroll', 381),
+(1464, 'click', 554),
+(1465, 'view', 941),
+(1466, 'buy', 457),
+(1467, 'scroll', 197),
+(1468, 'click', 331),
+(1469, 'view', 372),
+(1470, 'buy', 755),
+(1471, 'scroll', 918),
+(1472, 'click', 485),
+(1473, 'view', 31),
+(1474, 'buy', 646),
+(1475, 'scroll', 420),
+(1476, 'click', 253),
+(1477, 'view', 831),
+(1478, 'buy', 640),
+(1479, 'scroll', 785),
+(1480, 'click', 414),
+(1481, 'view', 41),
+(1482, 'buy', 384),
+(1483, 'scroll', 35),
+(1484, 'click', 475),
+(1485, 'view', 64),
+(1486, 'buy', 822),
+(1487, 'scroll', 942),
+(1488, 'click', 63),
+(1489, 'view', 263),
+(1490, 'buy', 199),
+(1491, 'scroll', 765),
+(1492, 'click', 64),
+(1493, 'view', 920),
+(1494, 'buy', 620),
+(1495, 'scroll', 347),
+(1496, 'click', 371),
+(1497, 'view', 278),
+(1498, 'buy', 343),
+(1499, 'scroll', 980),
+(1500, 'click', 976),
+(1501, 'view', 631),
+(1502, 'buy', 44),
+(1503, 'scroll', 268),
+(1504, 'click', 764),
+(1505, 'view', 733),
+(1506, 'buy', 706),
+(1507, 'scroll', 324),
+(1508, 'click', 946),
+(1509, 'view', 282),
+(1510, 'buy', 304),
+(1511, 'scroll', 3),
+(1512, 'click', 738),
+(1513, 'view', 773),
+(1514, 'buy', 609),
+(1515, 'scroll', 938),
+(1516, 'click', 824),
+(1517, 'view', 649),
+(1518, 'buy', 969),
+(1519, 'scroll', 965),
+(1520, 'click', 66),
+(1521, 'view', 24),
+(1522, 'buy', 845),
+(1523, 'scroll', 239),
+(1524, 'click', 109),
+(1525, 'view', 486),
+(1526, 'buy', 732),
+(1527, 'scroll', 979),
+(1528, 'click', 476),
+(1529, 'view', 976),
+(1530, 'buy', 794),
+(1531, 'scroll', 395),
+(1532, 'click', 808),
+(1533, 'view', 257),
+(1534, 'buy', 935),
+(1535, 'scroll', 440),
+(1536, 'click', 834),
+(1537, 'view', 505),
+(1538, 'buy', 135),
+(1539, 'scroll', 950),
+(1540, 'click', 508),
+(1541, 'view', 187),
+(1542, 'buy', 8),
+(1543, 'scroll', 821),
+(1544, 'click', 953),
+(1545, 'view', 756),
+(1546, 'buy', 310),
+(1547, 'scroll', 842),
+(1548, 'click', 708),
+(1549, 'view', 791),
+(1550, 'buy', 154),
+(1551, 'scroll', 621),
+(1552, 'click', 241),
+(1553, 'view', 335),
+(1554, 'buy', 881),
+(1555, 'scroll', 327),
+(1556, 'click', 471),
+(1557, 'view', 370),
+(1558, 'buy', 802),
+(1559, 'scroll', 801),
+(1560, 'click', 610),
+(1561, 'view', 80),
+(1562, 'buy', 524),
+(1563, 'scroll', 202),
+(1564, 'click', 401),
+(1565, 'view', 770),
+(1566, 'buy', 163),
+(1567, 'scroll', 253),
+(1568, 'click', 417),
+(1569, 'view', 66),
+(1570, 'buy', 665),
+(1571, 'scroll', 34),
+(1572, 'click', 493),
+(1573, 'view', 565),
+(1574, 'buy', 557),
+(1575, 'scroll', 333),
+(1576, 'click', 164),
+(1577, 'view', 436),
+(1578, 'buy', 904),
+(1579, 'scroll', 107),
+(1580, 'click', 73),
+(1581, 'view', 271),
+(1582, 'buy', 639),
+(1583, 'scroll', 86),
+(1584, 'click', 213),
+(1585, 'view', 98),
+(1586, 'buy', 431),
+(1587, 'scroll', 510),
+(1588, 'click', 726),
+(1589, 'view', 995),
+(1590, 'buy', 457),
+(1591, 'scroll', 177),
+(1592, 'click', 239),
+(1593, 'view', 136),
+(1594, 'buy', 426),
+(1595, 'scroll', 471),
+(1596, 'click', 635),
+(1597, 'view', 912),
+(1598, 'buy', 690),
+(1599, 'scroll', 240),
+(1600, 'click', 765),
+(1601, 'view', 551),
+(1602, 'buy', 867),
+(1603, 'scroll', 792),
+(1604, 'click', 680),
+(1605, 'view', 777),
+(1606, 'buy', 124),
+(1607, 'scroll', 798),
+(1608, 'click', 861),
+(1609, 'view', 300),
+(1610, 'buy', 300),
+(1611, 'scroll', 286),
+(1612, 'click', 580),
+(1613, 'view', 274),
+(1614, 'buy', 381),
+(1615, 'scroll', 260),
+(1616, 'click', 755),
+(1617, 'view', 266),
+(1618, 'buy', 203),
+(1619, 'scroll', 449),
+(1620, 'click', 253),
+(1621, 'view', 190),
+(1622, 'buy', 251),
+(1623, 'scroll', 241),
+(1624, 'click', 157),
+(1625, 'view', 288),
+(1626, 'buy', 905),
+(1627, 'scroll', 929),
+(1628, 'click', 592),
+(1629, 'view', 192),
+(1630, 'buy', 334),
+(1631, 'scroll', 66),
+(1632, 'click', 405),
+(1633, 'view', 257),
+(1634, 'buy', 251),
+(1635, 'scroll', 519),
+(1636, 'click', 538),
+(1637, 'view', 236),
+(1638, 'buy', 665),
+(1639, 'scroll', 827),
+(1640, 'click', 102),
+(1641, 'view', 669),
+(1642, 'buy', 475),
+(1643, 'scroll', 37),
+(1644, 'click', 104),
+(1645, 'view', 4),
+(1646, 'buy', 486),
+(1647, 'scroll', 904),
+(1648, 'click', 838),
+(1649, 'view', 236),
+(1650, 'buy', 860),
+(1651, 'scroll', 459),
+(1652, 'click', 936),
+(1653, 'view', 382),
+(1654, 'buy', 41),
+(1655, 'scroll', 897),
+(1656, 'click', 300),
+(1657, 'view', 238),
+(1658, 'buy', 122),
+(1659, 'scroll', 51),
+(1660, 'click', 194),
+(1661, 'view', 614),
+(1662, 'buy', 996),
+(1663, 'scroll', 847),
+(1664, 'click', 597),
+(1665, 'view', 198),
+(1666, 'buy', 952),
+(1667, 'scroll', 76),
+(1668, 'click', 381),
+(1669, 'view', 524),
+(1670, 'buy', 886),
+(1671, 'scroll', 182),
+(1672, 'click', 459),
+(1673, 'view', 617),
+(1674, 'buy', 266),
+(1675, 'scroll', 793),
+(1676, 'click', 796),
+(1677, 'view', 680),
+(1678, 'buy', 968),
+(1679, 'scroll', 6),
+(1680, 'click', 108),
+(1681, 'view', 652),
+(1682, 'buy', 610),
+(1683, 'scroll', 726),
+(1684, 'click', 634),
+(1685, 'view', 358),
+(1686, 'buy', 222),
+(1687, 'scroll', 38),
+(1688, 'click', 377),
+(1689, 'view', 348),
+(1690, 'buy', 144),
+(1691, 'scroll', 45),
+(1692, 'click', 208),
+(1693, 'view', 261),
+(1694, 'buy', 39),
+(1695, 'scroll', 613),
+(1696, 'click', 749),
+(1697, 'view', 667),
+(1698, 'buy', 935),
+(1699, 'scroll', 208),
+(1700, 'click', 834),
+(1701, 'view', 11),
+(1702, 'buy', 838),
+(1703, 'scroll', 335),
+(1704, 'click', 418),
+(1705, 'view', 694),
+(1706, 'buy', 380),
+(1707, 'scroll', 189),
+(1708, 'click', 635),
+(1709, 'view', 319),
+(1710, 'buy', 79),
+(1711, 'scroll', 208),
+(1712, 'click', 32),
+(1713, 'view', 814),
+(1714, 'buy', 507),
+(1715, 'scroll', 561),
+(1716, 'click', 495),
+(1717, 'view', 64),
+(1718, 'buy', 417),
+(1719, 'scroll', 103),
+(1720, 'click', 814),
+(1721, 'view', 404),
+(1722, 'buy', 679),
+(1723, 'scroll', 563),
+(1724, 'click', 158),
+(1725, 'view', 654),
+(1726, 'buy', 546),
+(1727, 'scroll', 93),
+(1728, 'click', 668),
+(1729, 'view', 167),
+(1730, 'buy', 407),
+(1731, 'scroll', 712),
+(1732, 'click', 277),
+(1733, 'view', 419),
+(1734, 'buy', 290),
+(1735, 'scroll', 683),
+(1736, 'click', 314),
+(1737, 'view', 427),
+(1738, 'buy', 976),
+(1739, 'scroll', 52),
+(1740, 'click', 319),
+(1741, 'view', 763),
+(1742, 'buy', 580),
+(1743, 'scroll', 904),
+(1744, 'click', 365),
+(1745, 'view', 424),
+(1746, 'buy', 426),
+(1747, 'scroll', 18),
+(1748, 'click', 884),
+(1749, 'view', 785),
+(1750, 'buy', 821),
+(1751, 'scroll', 372),
+(1752, 'click', 659),
+(1753, 'view', 201),
+(1754, 'buy', 400),
+(1755, 'scroll', 745),
+(1756, 'click', 414),
+(1757, 'view', 208),
+(1758, 'buy', 964),
+(1759, 'scroll', 6),
+(1760, 'click', 444),
+(1761, 'view', 923),
+(1762, 'buy', 160),
+(1763, 'scroll', 433),
+(1764, 'click', 116),
+(1765, 'view', 840),
+(1766, 'buy', 92),
+(1767, 'scroll', 415),
+(1768, 'click', 591),
+(1769, 'view', 904),
+(1770, 'buy', 373),
+(1771, 'scroll', 471),
+(1772, 'click', 791),
+(1773, 'view', 166),
+(1774, 'buy', 133),
+(1775, 'scroll', 15),
+(1776, 'click', 52),
+(1777, 'view', 564),
+(1778, 'buy', 145),
+(1779, 'scroll', 656),
+(1780, 'click', 825),
+(1781, 'view', 931),
+(1782, 'buy', 406),
+(1783, 'scroll', 91),
+(1784, 'click', 586),
+(1785, 'view', 637),
+(1786, 'buy', 949),
+(1787, 'scroll', 379),
+(1788, 'click', 754),
+(1789, 'view', 516),
+(1790, 'buy', 175),
+(1791, 'scroll', 149),
+(1792, 'click', 356),
+(1793, 'view', 290),
+(1794, 'buy', 165),
+(1795, 'scroll', 533),
+(1796, 'click', 175),
+(1797, 'view', 947),
+(1798, 'buy', 68),
+(1799, 'scroll', 111),
+(1800, 'click', 392),
+(1801, 'view', 502),
+(1802, 'buy', 771),
+(1803, 'scroll', 824),
+(1804, 'click', 811),
+(1805, 'view', 990),
+(1806, 'buy', 824),
+(1807, 'scroll', 202),
+(1808, 'click', 308),
+(1809, 'view', 129),
+(1810, 'buy', 857),
+(1811, 'scroll', 965),
+(1812, 'click', 44),
+(1813, 'view', 998),
+(1814, 'buy', 934),
+(1815, 'scroll', 494),
+(1816, 'click', 322),
+(1817, 'view', 54),
+(1818, 'buy', 622),
+(1819, 'scroll', 948),
+(1820, 'click', 651),
+(1821, 'view', 397),
+(1822, 'buy', 88),
+(1823, 'scroll', 925),
+(1824, 'click', 729),
+(1825, 'view', 635),
+(1826, 'buy', 704),
+(1827, 'scroll', 844),
+(1828, 'click', 912),
+(1829, 'view', 164),
+(1830, 'buy', 655),
+(1831, 'scroll', 804),
+(1832, 'click', 877),
+(1833, 'view', 227),
+(1834, 'buy', 635),
+(1835, 'scroll', 414),
+(1836, 'click', 629),
+(1837, 'view', 866),
+(1838, 'buy', 200),
+(1839, 'scroll', 849),
+(1840, 'click', 484),
+(1841, 'view', 187),
+(1842, 'buy', 578),
+(1843, 'scroll', 223),
+(1844, 'click', 42),
+(1845, 'view', 409),
+(1846, 'buy', 961),
+(1847, 'scroll', 530),
+(1848, 'click', 160),
+(1849, 'view', 392),
+(1850, 'buy', 367),
+(1851, 'scroll', 126),
+(1852, 'click', 153),
+(1853, 'view', 252),
+(1854, 'buy', 993),
+(1855, 'scroll', 742),
+(1856, 'click', 835),
+(1857, 'view', 918),
+(1858, 'buy', 197),
+(1859, 'scroll', 42),
+(1860, 'click', 905),
+(1861, 'view', 575),
+(1862, 'buy', 862),
+(1863, 'scroll', 775),
+(1864, 'click', 688),
+(1865, 'view', 39),
+(1866, 'buy', 683),
+(1867, 'scroll', 858),
+(1868, 'click', 331),
+(1869, 'view', 120),
+(1870, 'buy', 399),
+(1871, 'scroll', 613),
+(1872, 'click', 466),
+(1873, 'view', 563),
+(1874, 'buy', 869),
+(1875, 'scroll', 642),
+(1876, 'click', 796),
+(1877, 'view', 313),
+(1878, 'buy', 664),
+(1879, 'scroll', 430),
+(1880, 'click', 315),
+(1881, 'view', 596),
+(1882, 'buy', 255),
+(1883, 'scroll', 435),
+(1884, 'click', 398),
+(1885, 'view', 674),
+(1886, 'buy', 376),
+(1887, 'scroll', 457),
+(1888, 'click', 515),
+(1889, 'view', 448),
+(1890, 'buy', 183),
+(1891, 'scroll', 23),
+(1892, 'click', 3),
+(1893, 'view', 633),
+(1894, 'buy', 501),
+(1895, 'scroll', 476),
+(1896, 'click', 240),
+(1897, 'view', 457),
+(1898, 'buy', 781),
+(1899, 'scroll', 633),
+(1900, 'click', 798),
+(1901, 'view', 838),
+(1902, 'buy', 469),
+(1903, 'scroll', 856),
+(1904, 'click', 183),
+(1905, 'view', 829),
+(1906, 'buy', 484),
+(1907, 'scroll', 409),
+(1908, 'click', 109),
+(1909, 'view', 68),
+(1910, 'buy', 131),
+(1911, 'scroll', 367),
+(1912, 'click', 440),
+(1913, 'view', 374),
+(1914, 'buy', 93),
+(1915, 'scroll', 821),
+(1916, 'click', 452),
+(1917, 'view', 516),
+(1918, 'buy', 522),
+(1919, 'scroll', 672),
+(1920, 'click', 41),
+(1921, 'view', 41),
+(1922, 'buy', 651),
+(1923, 'scroll', 133),
+(1924, 'click', 84),
+(1925, 'view', 944),
+(1926, 'buy', 751),
+(1927, 'scroll', 321),
+(1928, 'click', 796),
+(1929, 'view', 737),
+(1930, 'buy', 523),
+(1931, 'scroll', 81),
+(1932, 'click', 55),
+(1933, 'view', 770),
+(1934, 'buy', 516),
+(1935, 'scroll', 916),
+(1936, 'click', 386),
+(1937, 'view', 668),
+(1938, 'buy', 973),
+(1939, 'scroll', 803),
+(1940, 'click', 139),
+(1941, 'view', 26),
+(1942, 'buy', 877),
+(1943, 'scroll', 67),
+(1944, 'click', 628),
+(1945, 'view', 749),
+(1946, 'buy', 709),
+(1947, 'scroll', 834),
+(1948, 'click', 112),
+(1949, 'view', 198),
+(1950, 'buy', 134),
+(1951, 'scroll', 906),
+(1952, 'click', 503),
+(1953, 'view', 294),
+(1954, 'buy', 979),
+(1955, 'scroll', 830),
+(1956, 'click', 938),
+(1957, 'view', 814),
+(1958, 'buy', 169),
+(1959, 'scroll', 702),
+(1960, 'click', 807),
+(1961, 'view', 738),
+(1962, 'buy', 952),
+(1963, 'scroll', 226),
+(1964, 'click', 67),
+(1965, 'view', 853),
+(1966, 'buy', 359),
+(1967, 'scroll', 625),
+(1968, 'click', 774),
+(1969, 'view', 258),
+(1970, 'buy', 162),
+(1971, 'scroll', 331),
+(1972, 'click', 918),
+(1973, 'view', 628),
+(1974, 'buy', 281),
+(1975, 'scroll', 926),
+(1976, 'click', 835),
+(1977, 'view', 467),
+(1978, 'buy', 147),
+(1979, 'scroll', 260),
+(1980, 'click', 514),
+(1981, 'view', 987),
+(1982, 'buy', 941),
+(1983, 'scroll', 491),
+(1984, 'click', 213),
+(1985, 'view', 606),
+(1986, 'buy', 269),
+(1987, 'scroll', 630),
+(1988, 'click', 518),
+(1989, 'view', 243),
+(1990, 'buy', 326),
+(1991, 'scroll', 381),
+(1992, 'click', 37),
+(1993, 'view', 203),
+(1994, 'buy', 186),
+(1995, 'scroll', 413),
+(1996, 'click', 165),
+(1997, 'view', 651),
+(1998, 'buy', 958),
+(1999, 'scroll', 284),
+(2000, 'click', 695),
+(2001, 'view', 335),
+(2002, 'buy', 916),
+(2003, 'scroll', 385),
+(2004, 'click', 172),
+(2005, 'view', 811),
+(2006, 'buy', 803),
+(2007, 'scroll', 270),
+(2008, 'click', 117),
+(2009, 'view', 786),
+(2010, 'buy', 543),
+(2011, 'scroll', 49),
+(2012, 'click', 651),
+(2013, 'view', 878),
+(2014, 'buy', 368),
+(2015, 'scroll', 989),
+(2016, 'click', 893),
+(2017, 'view', 463),
+(2018, 'buy', 568),
+(2019, 'scroll', 533),
+(2020, 'click', 593),
+(2021, 'view', 705),
+(2022, 'buy', 903),
+(2023, 'scroll', 917),
+(2024, 'click', 107),
+(2025, 'view', 258),
+(2026, 'buy', 548),
+(2027, 'scroll', 644),
+(2028, 'click', 877),
+(2029, 'view', 403),
+(2030, 'buy', 755),
+(2031, 'scroll', 816),
+(2032, 'click', 380),
+(2033, 'view', 271),
+(2034, 'buy', 384),
+(2035, 'scroll', 377),
+(2036, 'click', 591),
+(2037, 'view', 149),
+(2038, 'buy', 368),
+(2039, 'scroll', 338),
+(2040, 'click', 782),
+(2041, 'view', 83),
+(2042, 'buy', 452),
+(2043, 'scroll', 235),
+(2044, 'click', 180),
+(2045, 'view', 630),
+(2046, 'buy', 761),
+(2047, 'scroll', 980),
+(2048, 'click', 49),
+(2049, 'view', 303),
+(2050, 'buy', 839),
+(2051, 'scroll', 528),
+(2052, 'click', 259),
+(2053, 'view', 317),
+(2054, 'buy', 654),
+(2055, 'scroll', 989),
+(2056, 'click', 891),
+(2057, 'view', 599),
+(2058, 'buy', 950),
+(2059, 'scroll', 679),
+(2060, 'click', 917),
+(2061, 'view', 320),
+(2062, 'buy', 750),
+(2063, 'scroll', 1),
+(2064, 'click', 765),
+(2065, 'view', 34),
+(2066, 'buy', 226),
+(2067, 'scroll', 152),
+(2068, 'click', 297),
+(2069, 'view', 630),
+(2070, 'buy', 640),
+(2071, 'scroll', 442),
+(2072, 'click', 427),
+(2073, 'view', 524),
+(2074, 'buy', 372),
+(2075, 'scroll', 917),
+(2076, 'click', 48),
+(2077, 'view', 135),
+(2078, 'buy', 500),
+(2079, 'scroll', 232),
+(2080, 'click', 627),
+(2081, 'view', 668),
+(2082, 'buy', 46),
+(2083, 'scroll', 22),
+(2084, 'click', 55),
+(2085, 'view', 2),
+(2086, 'buy', 580),
+(2087, 'scroll', 363),
+(2088, 'click', 311),
+(2089, 'view', 108),
+(2090, 'buy', 535),
+(2091, 'scroll', 365),
+(2092, 'click', 546),
+(2093, 'view', 229),
+(2094, 'buy', 423),
+(2095, 'scroll', 597),
+(2096, 'click', 308),
+(2097, 'view', 603),
+(2098, 'buy', 136),
+(2099, 'scroll', 209),
+(2100, 'click', 375),
+(2101, 'view', 638),
+(2102, 'buy', 848),
+(2103, 'scroll', 486),
+(2104, 'click', 162),
+(2105, 'view', 137),
+(2106, 'buy', 14),
+(2107, 'scroll', 959),
+(2108, 'click', 820),
+(2109, 'view', 249),
+(2110, 'buy', 724),
+(2111, 'scroll', 152),
+(2112, 'click', 461),
+(2113, 'view', 98),
+(2114, 'buy', 65),
+(2115, 'scroll', 653),
+(2116, 'click', 148),
+(2117, 'view', 892),
+(2118, 'buy', 681),
+(2119, 'scroll', 800),
+(2120, 'click', 276),
+(2121, 'view', 411),
+(2122, 'buy', 831),
+(2123, 'scroll', 270),
+(2124, 'click', 990),
+(2125, 'view', 11),
+(2126, 'buy', 57),
+(2127, 'scroll', 660),
+(2128, 'click', 840),
+(2129, 'view', 575),
+(2130, 'buy', 914),
+(2131, 'scroll', 358),
+(2132, 'click', 608),
+(2133, 'view', 661),
+(2134, 'buy', 592),
+(2135, 'scroll', 454),
+(2136, 'click', 616),
+(2137, 'view', 959),
+(2138, 'buy', 530),
+(2139, 'scroll', 751),
+(2140, 'click', 504),
+(2141, 'view', 254),
+(2142, 'buy', 169),
+(2143, 'scroll', 925),
+(2144, 'click', 0),
+(2145, 'view', 45),
+(2146, 'buy', 63),
+(2147, 'scroll', 544),
+(2148, 'click', 25),
+(2149, 'view', 415),
+(2150, 'buy', 190),
+(2151, 'scroll', 243),
+(2152, 'click', 163),
+(2153, 'view', 59),
+(2154, 'buy', 933),
+(2155, 'scroll', 797),
+(2156, 'click', 107),
+(2157, 'view', 12),
+(2158, 'buy', 627),
+(2159, 'scroll', 564),
+(2160, 'click', 672),
+(2161, 'view', 963),
+(2162, 'buy', 201),
+(2163, 'scroll', 145),
+(2164, 'click', 423),
+(2165, 'view', 204),
+(2166, 'buy', 530),
+(2167, 'scroll', 622),
+(2168, 'click', 658),
+(2169, 'view', 519),
+(2170, 'buy', 663),
+(2171, 'scroll', 656),
+(2172, 'click', 425),
+(2173, 'view', 832),
+(2174, 'buy', 627),
+(2175, 'scroll', 178),
+(2176, 'click', 520),
+(2177, 'view', 316),
+(2178, 'buy', 65),
+(2179, 'scroll', 307),
+(2180, 'click', 640),
+(2181, 'view', 49),
+(2182, 'buy', 910),
+(2183, 'scroll', 741),
+(2184, 'click', 801),
+(2185, 'view', 489),
+(2186, 'buy', 732),
+(2187, 'scroll', 551),
+(2188, 'click', 6),
+(2189, 'view', 384),
+(2190, 'buy', 864),
+(2191, 'scroll', 447),
+(2192, 'click', 763),
+(2193, 'view', 934),
+(2194, 'buy', 476),
+(2195, 'scroll', 82),
+(2196, 'click', 759),
+(2197, 'view', 671),
+(2198, 'buy', 463),
+(2199, 'scroll', 179),
+(2200, 'click', 231),
+(2201, 'view', 107),
+(2202, 'buy', 267),
+(2203, 'scroll', 237),
+(2204, 'click', 659),
+(2205, 'view', 39),
+(2206, 'buy', 126),
+(2207, 'scroll', 343),
+(2208, 'click', 912),
+(2209, 'view', 767),
+(2210, 'buy', 947),
+(2211, 'scroll', 711),
+(2212, 'click', 965),
+(2213, 'view', 865),
+(2214, 'buy', 269),
+(2215, 'scroll', 728),
+(2216, 'click', 53),
+(2217, 'view', 272),
+(2218, 'buy', 651),
+(2219, 'scroll', 567),
+(2220, 'click', 695),
+(2221, 'view', 446),
+(2222, 'buy', 702),
+(2223, 'scroll', 807),
+(2224, 'click', 939),
+(2225, 'view', 535),
+(2226, 'buy', 995),
+(2227, 'scroll', 271),
+(2228, 'click', 302),
+(2229, 'view', 657),
+(2230, 'buy', 950),
+(2231, 'scroll', 988),
+(2232, 'click', 915),
+(2233, 'view', 222),
+(2234, 'buy', 87),
+(2235, 'scroll', 901),
+(2236, 'click', 519),
+(2237, 'view', 15),
+(2238, 'buy', 173),
+(2239, 'scroll', 266),
+(2240, 'click', 926),
+(2241, 'view', 241),
+(2242, 'buy', 861),
+(2243, 'scroll', 761),
+(2244, 'click', 207),
+(2245, 'view', 967),
+(2246, 'buy', 163),
+(2247, 'scroll', 764),
+(2248, 'click', 936),
+(2249, 'view', 334),
+(2250, 'buy', 196),
+(2251, 'scroll', 901),
+(2252, 'click', 398),
+(2253, 'view', 336),
+(2254, 'buy', 615),
+(2255, 'scroll', 244),
+(2256, 'click', 388),
+(2257, 'view', 929),
+(2258, 'buy', 872),
+(2259, 'scroll', 645),
+(2260, 'click', 943),
+(2261, 'view', 709),
+(2262, 'buy', 681),
+(2263, 'scroll', 861),
+(2264, 'click', 549),
+(2265, 'view', 480),
+(2266, 'buy', 483),
+(2267, 'scroll', 859),
+(2268, 'click', 543),
+(2269, 'view', 714),
+(2270, 'buy', 6),
+(2271, 'scroll', 878),
+(2272, 'click', 27),
+(2273, 'view', 447),
+(2274, 'buy', 978),
+(2275, 'scroll', 742),
+(2276, 'click', 239),
+(2277, 'view', 584),
+(2278, 'buy', 905),
+(2279, 'scroll', 315),
+(2280, 'click', 808),
+(2281, 'view', 217),
+(2282, 'buy', 400),
+(2283, 'scroll', 637),
+(2284, 'click', 599),
+(2285, 'view', 79),
+(2286, 'buy', 578),
+(2287, 'scroll', 932),
+(2288, 'click', 175),
+(2289, 'view', 148),
+(2290, 'buy', 33),
+(2291, 'scroll', 27),
+(2292, 'click', 114),
+(2293, 'view', 109),
+(2294, 'buy', 636),
+(2295, 'scroll', 951),
+(2296, 'click', 165),
+(2297, 'view', 353),
+(2298, 'buy', 145),
+(2299, 'scroll', 717),
+(2300, 'click', 29),
+(2301, 'view', 31),
+(2302, 'buy', 42),
+(2303, 'scroll', 141),
+(2304, 'click', 709),
+(2305, 'view', 658),
+(2306, 'buy', 649),
+(2307, 'scroll', 43),
+(2308, 'click', 713),
+(2309, 'view', 69),
+(2310, 'buy', 754),
+(2311, 'scroll', 47),
+(2312, 'click', 67),
+(2313, 'view', 877),
+(2314, 'buy', 604),
+(2315, 'scroll', 780),
+(2316, 'click', 372),
+(2317, 'view', 204),
+(2318, 'buy', 837),
+(2319, 'scroll', 977),
+(2320, 'click', 839),
+(2321, 'view', 546),
+(2322, 'buy', 912),
+(2323, 'scroll', 680),
+(2324, 'click', 67),
+(2325, 'view', 900),
+(2326, 'buy', 888),
+(2327, 'scroll', 773),
+(2328, 'click', 936),
+(2329, 'view', 728),
+(2330, 'buy', 966),
+(2331, 'scroll', 393),
+(2332, 'click', 109),
+(2333, 'view', 252),
+(2334, 'buy', 210),
+(2335, 'scroll', 208),
+(2336, 'click', 114),
+(2337, 'view', 34),
+(2338, 'buy', 35),
+(2339, 'scroll', 972),
+(2340, 'click', 868),
+(2341, 'view', 932),
+(2342, 'buy', 831),
+(2343, 'scroll', 771),
+(2344, 'click', 649),
+(2345, 'view', 89),
+(2346, 'buy', 844),
+(2347, 'scroll', 769),
+(2348, 'click', 646),
+(2349, 'view', 647),
+(2350, 'buy', 294),
+(2351, 'scroll', 488),
+(2352, 'click', 102),
+(2353, 'view', 135),
+(2354, 'buy', 100),
+(2355, 'scroll', 810),
+(2356, 'click', 775),
+(2357, 'view', 661),
+(2358, 'buy', 209),
+(2359, 'scroll', 301),
+(2360, 'click', 326),
+(2361, 'view', 344),
+(2362, 'buy', 433),
+(2363, 'scroll', 267),
+(2364, 'click', 21),
+(2365, 'view', 359),
+(2366, 'buy', 262),
+(2367, 'scroll', 952),
+(2368, 'click', 289),
+(2369, 'view', 49),
+(2370, 'buy', 732),
+(2371, 'scroll', 778),
+(2372, 'click', 376),
+(2373, 'view', 932),
+(2374, 'buy', 328),
+(2375, 'scroll', 787),
+(2376, 'click', 987),
+(2377, 'view', 616),
+(2378, 'buy', 515),
+(2379, 'scroll', 487),
+(2380, 'click', 871),
+(2381, 'view', 294),
+(2382, 'buy', 633),
+(2383, 'scroll', 763),
+(2384, 'click', 31),
+(2385, 'view', 807),
+(2386, 'buy', 422),
+(2387, 'scroll', 31),
+(2388, 'click', 446),
+(2389, 'view', 531),
+(2390, 'buy', 791),
+(2391, 'scroll', 100),
+(2392, 'click', 355),
+(2393, 'view', 480),
+(2394, 'buy', 721),
+(2395, 'scroll', 49),
+(2396, 'click', 550),
+(2397, 'view', 579),
+(2398, 'buy', 221),
+(2399, 'scroll', 731),
+(2400, 'click', 882),
+(2401, 'view', 847),
+(2402, 'buy', 93),
+(2403, 'scroll', 588),
+(2404, 'click', 839),
+(2405, 'view', 294),
+(2406, 'buy', 174),
+(2407, 'scroll', 446),
+(2408, 'click', 1),
+(2409, 'view', 536),
+(2410, 'buy', 206),
+(2411, 'scroll', 295),
+(2412, 'click', 780),
+(2413, 'view', 768),
+(2414, 'buy', 55),
+(2415, 'scroll', 4),
+(2416, 'click', 356),
+(2417, 'view', 502),
+(2418, 'buy', 97),
+(2419, 'scroll', 503),
+(2420, 'click', 711),
+(2421, 'view', 815),
+(2422, 'buy', 845),
+(2423, 'scroll', 188),
+(2424, 'click', 990),
+(2425, 'view', 506),
+(2426, 'buy', 606),
+(2427, 'scroll', 355),
+(2428, 'click', 980),
+(2429, 'view', 851),
+(2430, 'buy', 527),
+(2431, 'scroll', 266),
+(2432, 'click', 591),
+(2433, 'view', 966),
+(2434, 'buy', 162),
+(2435, 'scroll', 290),
+(2436, 'click', 834),
+(2437, 'view', 219),
+(2438, 'buy', 960),
+(2439, 'scroll', 716),
+(2440, 'click', 237),
+(2441, 'view', 510),
+(2442, 'buy', 169),
+(2443, 'scroll', 112),
+(2444, 'click', 961),
+(2445, 'view', 651),
+(2446, 'buy', 785),
+(2447, 'scroll', 82),
+(2448, 'click', 502),
+(2449, 'view', 806),
+(2450, 'buy', 713),
+(2451, 'scroll', 574),
+(2452, 'click', 805),
+(2453, 'view', 107),
+(2454, 'buy', 643),
+(2455, 'scroll', 334),
+(2456, 'click', 364),
+(2457, 'view', 97),
+(2458, 'buy', 410),
+(2459, 'scroll', 950),
+(2460, 'click', 404),
+(2461, 'view', 913),
+(2462, 'buy', 911),
+(2463, 'scroll', 763),
+(2464, 'click', 88),
+(2465, 'view', 432),
+(2466, 'buy', 909),
+(2467, 'scroll', 661),
+(2468, 'click', 25),
+(2469, 'view', 380),
+(2470, 'buy', 211),
+(2471, 'scroll', 310),
+(2472, 'click', 269),
+(2473, 'view', 438),
+(2474, 'buy', 922),
+(2475, 'scroll', 558),
+(2476, 'click', 513),
+(2477, 'view', 175),
+(2478, 'buy', 388),
+(2479, 'scroll', 905),
+(2480, 'click', 645),
+(2481, 'view', 239),
+(2482, 'buy', 966),
+(2483, 'scroll', 471),
+(2484, 'click', 129),
+(2485, 'view', 544),
+(2486, 'buy', 608),
+(2487, 'scroll', 772),
+(2488, 'click', 705),
+(2489, 'view', 771),
+(2490, 'buy', 619),
+(2491, 'scroll', 661),
+(2492, 'click', 34),
+(2493, 'view', 356),
+(2494, 'buy', 595),
+(2495, 'scroll', 334),
+(2496, 'click', 534),
+(2497, 'view', 159),
+(2498, 'buy', 888),
+(2499, 'scroll', 863),
+(2500, 'click', 461),
+(2501, 'view', 677),
+(2502, 'buy', 567),
+(2503, 'scroll', 759),
+(2504, 'click', 331),
+(2505, 'view', 173),
+(2506, 'buy', 474),
+(2507, 'scroll', 449),
+(2508, 'click', 705),
+(2509, 'view', 791),
+(2510, 'buy', 263),
+(2511, 'scroll', 593),
+(2512, 'click', 236),
+(2513, 'view', 129),
+(2514, 'buy', 342),
+(2515, 'scroll', 473),
+(2516, 'click', 658),
+(2517, 'view', 906),
+(2518, 'buy', 713),
+(2519, 'scroll', 243),
+(2520, 'click', 519),
+(2521, 'view', 196),
+(2522, 'buy', 273),
+(2523, 'scroll', 308),
+(2524, 'click', 772),
+(2525, 'view', 720),
+(2526, 'buy', 846),
+(2527, 'scroll', 863),
+(2528, 'click', 632),
+(2529, 'view', 158),
+(2530, 'buy', 740),
+(2531, 'scroll', 159),
+(2532, 'click', 998),
+(2533, 'view', 253),
+(2534, 'buy', 740),
+(2535, 'scroll', 334),
+(2536, 'click', 617),
+(2537, 'view', 534),
+(2538, 'buy', 356),
+(2539, 'scroll', 164),
+(2540, 'click', 241),
+(2541, 'view', 335),
+(2542, 'buy', 978),
+(2543, 'scroll', 193),
+(2544, 'click', 264),
+(2545, 'view', 998),
+(2546, 'buy', 977),
+(2547, 'scroll', 746),
+(2548, 'click', 104),
+(2549, 'view', 168),
+(2550, 'buy', 985),
+(2551, 'scroll', 673),
+(2552, 'click', 104),
+(2553, 'view', 200),
+(2554, 'buy', 393),
+(2555, 'scroll', 154),
+(2556, 'click', 151),
+(2557, 'view', 813),
+(2558, 'buy', 309),
+(2559, 'scroll', 750),
+(2560, 'click', 304),
+(2561, 'view', 445),
+(2562, 'buy', 280),
+(2563, 'scroll', 200),
+(2564, 'click', 111),
+(2565, 'view', 653),
+(2566, 'buy', 933),
+(2567, 'scroll', 109),
+(2568, 'click', 287),
+(2569, 'view', 211),
+(2570, 'buy', 906),
+(2571, 'scroll', 397),
+(2572, 'click', 475),
+(2573, 'view', 34),
+(2574, 'buy', 12),
+(2575, 'scroll', 408),
+(2576, 'click', 874),
+(2577, 'view', 809),
+(2578, 'buy', 447),
+(2579, 'scroll', 710),
+(2580, 'click', 227),
+(2581, 'view', 512),
+(2582, 'buy', 647),
+(2583, 'scroll', 303),
+(2584, 'click', 474),
+(2585, 'view', 22),
+(2586, 'buy', 145),
+(2587, 'scroll', 263),
+(2588, 'click', 618),
+(2589, 'view', 755),
+(2590, 'buy', 414),
+(2591, 'scroll', 5),
+(2592, 'click', 758),
+(2593, 'view', 248),
+(2594, 'buy', 929),
+(2595, 'scroll', 873),
+(2596, 'click', 440),
+(2597, 'view', 717),
+(2598, 'buy', 587),
+(2599, 'scroll', 601),
+(2600, 'click', 767),
+(2601, 'view', 662),
+(2602, 'buy', 431),
+(2603, 'scroll', 866),
+(2604, 'click', 234),
+(2605, 'view', 683),
+(2606, 'buy', 739),
+(2607, 'scroll', 668),
+(2608, 'click', 901),
+(2609, 'view', 898),
+(2610, 'buy', 792),
+(2611, 'scroll', 657),
+(2612, 'click', 716),
+(2613, 'view', 597),
+(2614, 'buy', 872),
+(2615, 'scroll', 234),
+(2616, 'click', 695),
+(2617, 'view', 185),
+(2618, 'buy', 656),
+(2619, 'scroll', 127),
+(2620, 'click', 464),
+(2621, 'view', 442),
+(2622, 'buy', 320),
+(2623, 'scroll', 266),
+(2624, 'click', 643),
+(2625, 'view', 717),
+(2626, 'buy', 100),
+(2627, 'scroll', 916),
+(2628, 'click', 429),
+(2629, 'view', 248),
+(2630, 'buy', 801),
+(2631, 'scroll', 409),
+(2632, 'click', 730),
+(2633, 'view', 729),
+(2634, 'buy', 644),
+(2635, 'scroll', 160),
+(2636, 'click', 256),
+(2637, 'view', 869),
+(2638, 'buy', 433),
+(2639, 'scroll', 494),
+(2640, 'click', 466),
+(2641, 'view', 20),
+(2642, 'buy', 636),
+(2643, 'scroll', 879),
+(2644, 'click', 419),
+(2645, 'view', 530),
+(2646, 'buy', 691),
+(2647, 'scroll', 676),
+(2648, 'click', 952),
+(2649, 'view', 893),
+(2650, 'buy', 187),
+(2651, 'scroll', 915),
+(2652, 'click', 670),
+(2653, 'view', 335),
+(2654, 'buy', 796),
+(2655, 'scroll', 10),
+(2656, 'click', 398),
+(2657, 'view', 851),
+(2658, 'buy', 501),
+(2659, 'scroll', 929),
+(2660, 'click', 998),
+(2661, 'view', 108),
+(2662, 'buy', 39),
+(2663, 'scroll', 257),
+(2664, 'click', 556),
+(2665, 'view', 223),
+(2666, 'buy', 164),
+(2667, 'scroll', 733),
+(2668, 'click', 800),
+(2669, 'view', 974),
+(2670, 'buy', 963),
+(2671, 'scroll', 204),
+(2672, 'click', 531),
+(2673, 'view', 356),
+(2674, 'buy', 103),
+(2675, 'scroll', 867),
+(2676, 'click', 588),
+(2677, 'view', 467),
+(2678, 'buy', 554),
+(2679, 'scroll', 209),
+(2680, 'click', 734),
+(2681, 'view', 487),
+(2682, 'buy', 524),
+(2683, 'scroll', 16),
+(2684, 'click', 654),
+(2685, 'view', 811),
+(2686, 'buy', 848),
+(2687, 'scroll', 378),
+(2688, 'click', 534),
+(2689, 'view', 351),
+(2690, 'buy', 420),
+(2691, 'scroll', 759),
+(2692, 'click', 970),
+(2693, 'view', 467),
+(2694, 'buy', 215),
+(2695, 'scroll', 700),
+(2696, 'click', 188),
+(2697, 'view', 401),
+(2698, 'buy', 526),
+(2699, 'scroll', 781),
+(2700, 'click', 955),
+(2701, 'view', 125),
+(2702, 'buy', 746),
+(2703, 'scroll', 628),
+(2704, 'click', 364),
+(2705, 'view', 652),
+(2706, 'buy', 57),
+(2707, 'scroll', 258),
+(2708, 'click', 280),
+(2709, 'view', 391),
+(2710, 'buy', 409),
+(2711, 'scroll', 62),
+(2712, 'click', 13),
+(2713, 'view', 76),
+(2714, 'buy', 428),
+(2715, 'scroll', 937),
+(2716, 'click', 430),
+(2717, 'view', 643),
+(2718, 'buy', 715),
+(2719, 'scroll', 691),
+(2720, 'click', 360),
+(2721, 'view', 594),
+(2722, 'buy', 271),
+(2723, 'scroll', 111),
+(2724, 'click', 229),
+(2725, 'view', 310),
+(2726, 'buy', 759),
+(2727, 'scroll', 410),
+(2728, 'click', 962),
+(2729, 'view', 976),
+(2730, 'buy', 539),
+(2731, 'scroll', 994),
+(2732, 'click', 224),
+(2733, 'view', 820),
+(2734, 'buy', 983),
+(2735, 'scroll', 401),
+(2736, 'click', 473),
+(2737, 'view', 217),
+(2738, 'buy', 168),
+(2739, 'scroll', 132),
+(2740, 'click', 951),
+(2741, 'view', 795),
+(2742, 'buy', 70),
+(2743, 'scroll', 829),
+(2744, 'click', 817),
+(2745, 'view', 649),
+(2746, 'buy', 197),
+(2747, 'scroll', 480),
+(2748, 'click', 657),
+(2749, 'view', 575),
+(2750, 'buy', 738),
+(2751, 'scroll', 231),
+(2752, 'click', 834),
+(2753, 'view', 986),
+(2754, 'buy', 149),
+(2755, 'scroll', 361),
+(2756, 'click', 682),
+(2757, 'view', 654),
+(2758, 'buy', 850),
+(2759, 'scroll', 838),
+(2760, 'click', 814),
+(2761, 'view', 835),
+(2762, 'buy', 423),
+(2763, 'scroll', 479),
+(2764, 'click', 301),
+(2765, 'view', 778),
+(2766, 'buy', 561),
+(2767, 'scroll', 665),
+(2768, 'click', 128),
+(2769, 'view', 798),
+(2770, 'buy', 853),
+(2771, 'scroll', 480),
+(2772, 'click', 363),
+(2773, 'view', 802),
+(2774, 'buy', 871),
+(2775, 'scroll', 235),
+(2776, 'click', 273),
+(2777, 'view', 721),
+(2778, 'buy', 385),
+(2779, 'scroll', 703),
+(2780, 'click', 259),
+(2781, 'view', 436),
+(2782, 'buy', 695),
+(2783, 'scroll', 190),
+(2784, 'click', 493),
+(2785, 'view', 2),
+(2786, 'buy', 824),
+(2787, 'scroll', 739),
+(2788, 'click', 818),
+(2789, 'view', 287),
+(2790, 'buy', 366),
+(2791, 'scroll', 250),
+(2792, 'click', 670),
+(2793, 'view', 309),
+(2794, 'buy', 328),
+(2795, 'scroll', 491),
+(2796, 'click', 496),
+(2797, 'view', 438),
+(2798, 'buy', 638),
+(2799, 'scroll', 652),
+(2800, 'click', 87),
+(2801, 'view', 675),
+(2802, 'buy', 918),
+(2803, 'scroll', 371),
+(2804, 'click', 156),
+(2805, 'view', 951),
+(2806, 'buy', 310),
+(2807, 'scroll', 874),
+(2808, 'click', 394),
+(2809, 'view', 58),
+(2810, 'buy', 87),
+(2811, 'scroll', 847),
+(2812, 'click', 578),
+(2813, 'view', 927),
+(2814, 'buy', 332),
+(2815, 'scroll', 802),
+(2816, 'click', 965),
+(2817, 'view', 143),
+(2818, 'buy', 543),
+(2819, 'scroll', 851),
+(2820, 'click', 353),
+(2821, 'view', 648),
+(2822, 'buy', 596),
+(2823, 'scroll', 15),
+(2824, 'click', 673),
+(2825, 'view', 11),
+(2826, 'buy', 214),
+(2827, 'scroll', 974),
+(2828, 'click', 73),
+(2829, 'view', 671),
+(2830, 'buy', 300),
+(2831, 'scroll', 256),
+(2832, 'click', 622),
+(2833, 'view', 103),
+(2834, 'buy', 592),
+(2835, 'scroll', 146),
+(2836, 'click', 874),
+(2837, 'view', 239),
+(2838, 'buy', 190),
+(2839, 'scroll', 794),
+(2840, 'click', 462),
+(2841, 'view', 354),
+(2842, 'buy', 803),
+(2843, 'scroll', 156),
+(2844, 'click', 213),
+(2845, 'view', 925),
+(2846, 'buy', 412),
+(2847, 'scroll', 810),
+(2848, 'click', 547),
+(2849, 'view', 171),
+(2850, 'buy', 624),
+(2851, 'scroll', 912),
+(2852, 'click', 704),
+(2853, 'view', 622),
+(2854, 'buy', 800),
+(2855, 'scroll', 92),
+(2856, 'click', 684),
+(2857, 'view', 923),
+(2858, 'buy', 915),
+(2859, 'scroll', 561),
+(2860, 'click', 806),
+(2861, 'view', 651),
+(2862, 'buy', 858),
+(2863, 'scroll', 304),
+(2864, 'click', 202),
+(2865, 'view', 506),
+(2866, 'buy', 709),
+(2867, 'scroll', 218),
+(2868, 'click', 543),
+(2869, 'view', 80),
+(2870, 'buy', 759),
+(2871, 'scroll', 859),
+(2872, 'click', 449),
+(2873, 'view', 687),
+(2874, 'buy', 903),
+(2875, 'scroll', 119),
+(2876, 'click', 568),
+(2877, 'view', 121),
+(2878, 'buy', 270),
+(2879, 'scroll', 429),
+(2880, 'click', 239),
+(2881, 'view', 846),
+(2882, 'buy', 142),
+(2883, 'scroll', 484),
+(2884, 'click', 504),
+(2885, 'view', 570),
+(2886, 'buy', 59),
+(2887, 'scroll', 495),
+(2888, 'click', 478),
+(2889, 'view', 927),
+(2890, 'buy', 147),
+(2891, 'scroll', 717),
+(2892, 'click', 503),
+(2893, 'view', 252),
+(2894, 'buy', 510),
+(2895, 'scroll', 168),
+(2896, 'click', 552),
+(2897, 'view', 613),
+(2898, 'buy', 883),
+(2899, 'scroll', 752),
+(2900, 'click', 6),
+(2901, 'view', 164),
+(2902, 'buy', 860),
+(2903, 'scroll', 328),
+(2904, 'click', 479),
+(2905, 'view', 712),
+(2906, 'buy', 576),
+(2907, 'scroll', 509),
+(2908, 'click', 681),
+(2909, 'view', 303),
+(2910, 'buy', 860),
+(2911, 'scroll', 476),
+(2912, 'click', 383),
+(2913, 'view', 436),
+(2914, 'buy', 428),
+(2915, 'scroll', 983),
+(2916, 'click', 692),
+(2917, 'view', 77),
+(2918, 'buy', 184),
+(2919, 'scroll', 652),
+(2920, 'click', 369),
+(2921, 'view', 651),
+(2922, 'buy', 662),
+(2923, 'scroll', 29),
+(2924, 'click', 21),
+(2925, 'view', 624),
+(2926, 'buy', 46),
+(2927, 'scroll', 698),
+(2928, 'click', 754),
+(2929, 'view', 953),
+(2930, 'buy', 338),
+(2931, 'scroll', 828),
+(2932, 'click', 96),
+(2933, 'view', 522),
+(2934, 'buy', 495),
+(2935, 'scroll', 496),
+(2936, 'click', 775),
+(2937, 'view', 919),
+(2938, 'buy', 147),
+(2939, 'scroll', 34),
+(2940, 'click', 218),
+(2941, 'view', 735),
+(2942, 'buy', 425),
+(2943, 'scroll', 640),
+(2944, 'click', 129),
+(2945, 'view', 346),
+(2946, 'buy', 96),
+(2947, 'scroll', 882),
+(2948, 'click', 674),
+(2949, 'view', 374),
+(2950, 'buy', 349),
+(2951, 'scroll', 485),
+(2952, 'click', 797),
+(2953, 'view', 538),
+(2954, 'buy', 567),
+(2955, 'scroll', 789),
+(2956, 'click', 934),
+(2957, 'view', 215),
+(2958, 'buy', 290),
+(2959, 'scroll', 445),
+(2960, 'click', 350),
+(2961, 'view', 432),
+(2962, 'buy', 257),
+(2963, 'scroll', 567),
+(2964, 'click', 53),
+(2965, 'view', 846),
+(2966, 'buy', 296),
+(2967, 'scroll', 299),
+(2968, 'click', 363),
+(2969, 'view', 847),
+(2970, 'buy', 505),
+(2971, 'scroll', 413),
+(2972, 'click', 341),
+(2973, 'view', 515),
+(2974, 'buy', 278),
+(2975, 'scroll', 893),
+(2976, 'click', 518),
+(2977, 'view', 353),
+(2978, 'buy', 998),
+(2979, 'scroll', 208),
+(2980, 'click', 670),
+(2981, 'view', 504),
+(2982, 'buy', 810),
+(2983, 'scroll', 120),
+(2984, 'click', 338),
+(2985, 'view', 196),
+(2986, 'buy', 324),
+(2987, 'scroll', 730),
+(2988, 'click', 306),
+(2989, 'view', 130),
+(2990, 'buy', 600),
+(2991, 'scroll', 996),
+(2992, 'click', 650),
+(2993, 'view', 89),
+(2994, 'buy', 803),
+(2995, 'scroll', 41),
+(2996, 'click', 408),
+(2997, 'view', 740),
+(2998, 'buy', 567),
+(2999, 'scroll', 906),
+(3000, 'click', 415),
+(3001, 'view', 558),
+(3002, 'buy', 587),
+(3003, 'scroll', 50),
+(3004, 'click', 408),
+(3005, 'view', 307),
+(3006, 'buy', 111),
+(3007, 'scroll', 6),
+(3008, 'click', 47),
+(3009, 'view', 194),
+(3010, 'buy', 841),
+(3011, 'scroll', 943),
+(3012, 'click', 486),
+(3013, 'view', 623),
+(3014, 'buy', 784),
+(3015, 'scroll', 673),
+(3016, 'click', 61),
+(3017, 'view', 807),
+(3018, 'buy', 512),
+(3019, 'scroll', 931),
+(3020, 'click', 556),
+(3021, 'view', 626),
+(3022, 'buy', 385),
+(3023, 'scroll', 631),
+(3024, 'click', 150),
+(3025, 'view', 641),
+(3026, 'buy', 689),
+(3027, 'scroll', 713),
+(3028, 'click', 705),
+(3029, 'view', 610),
+(3030, 'buy', 897),
+(3031, 'scroll', 697),
+(3032, 'click', 84),
+(3033, 'view', 217),
+(3034, 'buy', 40),
+(3035, 'scroll', 683),
+(3036, 'click', 648),
+(3037, 'view', 468),
+(3038, 'buy', 640),
+(3039, 'scroll', 780),
+(3040, 'click', 178),
+(3041, 'view', 103),
+(3042, 'buy', 679),
+(3043, 'scroll', 185),
+(3044, 'click', 890),
+(3045, 'view', 37),
+(3046, 'buy', 431),
+(3047, 'scroll', 793),
+(3048, 'click', 103),
+(3049, 'view', 936),
+(3050, 'buy', 952),
+(3051, 'scroll', 671),
+(3052, 'click', 13),
+(3053, 'view', 377),
+(3054, 'buy', 892),
+(3055, 'scroll', 842),
+(3056, 'click', 142),
+(3057, 'view', 805),
+(3058, 'buy', 316),
+(3059, 'scroll', 575),
+(3060, 'click', 727),
+(3061, 'view', 264),
+(3062, 'buy', 883),
+(3063, 'scroll', 309),
+(3064, 'click', 189),
+(3065, 'view', 431),
+(3066, 'buy', 35),
+(3067, 'scroll', 326),
+(3068, 'click', 20),
+(3069, 'view', 441),
+(3070, 'buy', 579),
+(3071, 'scroll', 657),
+(3072, 'click', 592),
+(3073, 'view', 956),
+(3074, 'buy', 935),
+(3075, 'scroll', 55),
+(3076, 'click', 509),
+(3077, 'view', 581),
+(3078, 'buy', 534),
+(3079, 'scroll', 40),
+(3080, 'click', 844),
+(3081, 'view', 121),
+(3082, 'buy', 792),
+(3083, 'scroll', 829),
+(3084, 'click', 431),
+(3085, 'view', 589),
+(3086, 'buy', 712),
+(3087, 'scroll', 940),
+(3088, 'click', 414),
+(3089, 'view', 457),
+(3090, 'buy', 68),
+(3091, 'scroll', 14),
+(3092, 'click', 696),
+(3093, 'view', 396),
+(3094, 'buy', 608),
+(3095, 'scroll', 606),
+(3096, 'click', 960),
+(3097, 'view', 675),
+(3098, 'buy', 159),
+(3099, 'scroll', 486),
+(3100, 'click', 788),
+(3101, 'view', 422),
+(3102, 'buy', 561),
+(3103, 'scroll', 104),
+(3104, 'click', 84),
+(3105, 'view', 659),
+(3106, 'buy', 483),
+(3107, 'scroll', 217),
+(3108, 'click', 917),
+(3109, 'view', 155),
+(3110, 'buy', 641),
+(3111, 'scroll', 15),
+(3112, 'click', 437),
+(3113, 'view', 4),
+(3114, 'buy', 9),
+(3115, 'scroll', 700),
+(3116, 'click', 685),
+(3117, 'view', 124),
+(3118, 'buy', 989),
+(3119, 'scroll', 879),
+(3120, 'click', 90),
+(3121, 'view', 223),
+(3122, 'buy', 890),
+(3123, 'scroll', 124),
+(3124, 'click', 132),
+(3125, 'view', 483),
+(3126, 'buy', 18),
+(3127, 'scroll', 282),
+(3128, 'click', 736),
+(3129, 'view', 582),
+(3130, 'buy', 248),
+(3131, 'scroll', 461),
+(3132, 'click', 751),
+(3133, 'view', 762),
+(3134, 'buy', 191),
+(3135, 'scroll', 944),
+(3136, 'click', 51),
+(3137, 'view', 374),
+(3138, 'buy', 792),
+(3139, 'scroll', 765),
+(3140, 'click', 730),
+(3141, 'view', 711),
+(3142, 'buy', 876),
+(3143, 'scroll', 148),
+(3144, 'click', 747),
+(3145, 'view', 777),
+(3146, 'buy', 86),
+(3147, 'scroll', 300),
+(3148, 'click', 643),
+(3149, 'view', 570),
+(3150, 'buy', 726),
+(3151, 'scroll', 510),
+(3152, 'click', 471),
+(3153, 'view', 685),
+(3154, 'buy', 954),
+(3155, 'scroll', 911),
+(3156, 'click', 260),
+(3157, 'view', 935),
+(3158, 'buy', 987),
+(3159, 'scroll', 53),
+(3160, 'click', 734),
+(3161, 'view', 32),
+(3162, 'buy', 11),
+(3163, 'scroll', 62),
+(3164, 'click', 15),
+(3165, 'view', 904),
+(3166, 'buy', 666),
+(3167, 'scroll', 703),
+(3168, 'click', 836),
+(3169, 'view', 633),
+(3170, 'buy', 81),
+(3171, 'scroll', 398),
+(3172, 'click', 318),
+(3173, 'view', 319),
+(3174, 'buy', 746),
+(3175, 'scroll', 614),
+(3176, 'click', 169),
+(3177, 'view', 980),
+(3178, 'buy', 881),
+(3179, 'scroll', 854),
+(3180, 'click', 498),
+(3181, 'view', 623),
+(3182, 'buy', 61),
+(3183, 'scroll', 323),
+(3184, 'click', 376),
+(3185, 'view', 971),
+(3186, 'buy', 588),
+(3187, 'scroll', 745),
+(3188, 'click', 449),
+(3189, 'view', 481),
+(3190, 'buy', 693),
+(3191, 'scroll', 170),
+(3192, 'click', 148),
+(3193, 'view', 989),
+(3194, 'buy', 816),
+(3195, 'scroll', 119),
+(3196, 'click', 371),
+(3197, 'view', 976),
+(3198, 'buy', 660),
+(3199, 'scroll', 167),
+(3200, 'click', 644),
+(3201, 'view', 821),
+(3202, 'buy', 427),
+(3203, 'scroll', 488),
+(3204, 'click', 394),
+(3205, 'view', 796),
+(3206, 'buy', 805),
+(3207, 'scroll', 463),
+(3208, 'click', 967),
+(3209, 'view', 278),
+(3210, 'buy', 803),
+(3211, 'scroll', 772),
+(3212, 'click', 580),
+(3213, 'view', 341),
+(3214, 'buy', 299),
+(3215, 'scroll', 286),
+(3216, 'click', 62),
+(3217, 'view', 636),
+(3218, 'buy', 997),
+(3219, 'scroll', 666),
+(3220, 'click', 720),
+(3221, 'view', 821),
+(3222, 'buy', 847),
+(3223, 'scroll', 614),
+(3224, 'click', 340),
+(3225, 'view', 890),
+(3226, 'buy', 620),
+(3227, 'scroll', 743),
+(3228, 'click', 15),
+(3229, 'view', 851),
+(3230, 'buy', 154),
+(3231, 'scroll', 615),
+(3232, 'click', 852),
+(3233, 'view', 316),
+(3234, 'buy', 598),
+(3235, 'scroll', 438),
+(3236, 'click', 999),
+(3237, 'view', 909),
+(3238, 'buy', 252),
+(3239, 'scroll', 385),
+(3240, 'click', 396),
+(3241, 'view', 701),
+(3242, 'buy', 385),
+(3243, 'scroll', 616),
+(3244, 'click', 789),
+(3245, 'view', 917),
+(3246, 'buy', 239),
+(3247, 'scroll', 826),
+(3248, 'click', 462),
+(3249, 'view', 290),
+(3250, 'buy', 705),
+(3251, 'scroll', 1),
+(3252, 'click', 329),
+(3253, 'view', 269),
+(3254, 'buy', 274),
+(3255, 'scroll', 432),
+(3256, 'click', 161),
+(3257, 'view', 600),
+(3258, 'buy', 942),
+(3259, 'scroll', 835),
+(3260, 'click', 781),
+(3261, 'view', 908),
+(3262, 'buy', 801),
+(3263, 'scroll', 43),
+(3264, 'click', 295),
+(3265, 'view', 853),
+(3266, 'buy', 144),
+(3267, 'scroll', 831),
+(3268, 'click', 911),
+(3269, 'view', 888),
+(3270, 'buy', 585),
+(3271, 'scroll', 150),
+(3272, 'click', 280),
+(3273, 'view', 998),
+(3274, 'buy', 871),
+(3275, 'scroll', 816),
+(3276, 'click', 826),
+(3277, 'view', 560),
+(3278, 'buy', 701),
+(3279, 'scroll', 795),
+(3280, 'click', 935),
+(3281, 'view', 511),
+(3282, 'buy', 355),
+(3283, 'scroll', 547),
+(3284, 'click', 87),
+(3285, 'view', 552),
+(3286, 'buy', 566),
+(3287, 'scroll', 496),
+(3288, 'click', 816),
+(3289, 'view', 390),
+(3290, 'buy', 205),
+(3291, 'scroll', 806),
+(3292, 'click', 768),
+(3293, 'view', 739),
+(3294, 'buy', 954),
+(3295, 'scroll', 239),
+(3296, 'click', 316),
+(3297, 'view', 621),
+(3298, 'buy', 58),
+(3299, 'scroll', 693),
+(3300, 'click', 404),
+(3301, 'view', 476),
+(3302, 'buy', 725),
+(3303, 'scroll', 211),
+(3304, 'click', 948),
+(3305, 'view', 260),
+(3306, 'buy', 600),
+(3307, 'scroll', 769),
+(3308, 'click', 9),
+(3309, 'view', 810),
+(3310, 'buy', 394),
+(3311, 'scroll', 470),
+(3312, 'click', 553),
+(3313, 'view', 89),
+(3314, 'buy', 549),
+(3315, 'scroll', 825),
+(3316, 'click', 363),
+(3317, 'view', 790),
+(3318, 'buy', 64),
+(3319, 'scroll', 238),
+(3320, 'click', 407),
+(3321, 'view', 593),
+(3322, 'buy', 533),
+(3323, 'scroll', 918),
+(3324, 'click', 265),
+(3325, 'view', 906),
+(3326, 'buy', 853),
+(3327, 'scroll', 534),
+(3328, 'click', 328),
+(3329, 'view', 488),
+(3330, 'buy', 518),
+(3331, 'scroll', 603),
+(3332, 'click', 206),
+(3333, 'view', 193),
+(3334, 'buy', 217),
+(3335, 'scroll', 196),
+(3336, 'click', 94),
+(3337, 'view', 185),
+(3338, 'buy', 825),
+(3339, 'scroll', 717),
+(3340, 'click', 296),
+(3341, 'view', 371),
+(3342, 'buy', 591),
+(3343, 'scroll', 577),
+(3344, 'click', 367),
+(3345, 'view', 412),
+(3346, 'buy', 798),
+(3347, 'scroll', 529),
+(3348, 'click', 877),
+(3349, 'view', 152),
+(3350, 'buy', 252),
+(3351, 'scroll', 45),
+(3352, 'click', 944),
+(3353, 'view', 505),
+(3354, 'buy', 383),
+(3355, 'scroll', 887),
+(3356, 'click', 108),
+(3357, 'view', 380),
+(3358, 'buy', 647),
+(3359, 'scroll', 474),
+(3360, 'click', 806),
+(3361, 'view', 83),
+(3362, 'buy', 159),
+(3363, 'scroll', 323),
+(3364, 'click', 611),
+(3365, 'view', 31),
+(3366, 'buy', 353),
+(3367, 'scroll', 287),
+(3368, 'click', 531),
+(3369, 'view', 621),
+(3370, 'buy', 21),
+(3371, 'scroll', 96),
+(3372, 'click', 34),
+(3373, 'view', 209),
+(3374, 'buy', 891),
+(3375, 'scroll', 886),
+(3376, 'click', 579),
+(3377, 'view', 497),
+(3378, 'buy', 600),
+(3379, 'scroll', 580),
+(3380, 'click', 218),
+(3381, 'view', 267),
+(3382, 'buy', 947),
+(3383, 'scroll', 797),
+(3384, 'click', 286),
+(3385, 'view', 436),
+(3386, 'buy', 99),
+(3387, 'scroll', 969),
+(3388, 'click', 457),
+(3389, 'view', 785),
+(3390, 'buy', 607),
+(3391, 'scroll', 838),
+(3392, 'click', 623),
+(3393, 'view', 986),
+(3394, 'buy', 134),
+(3395, 'scroll', 260),
+(3396, 'click', 863),
+(3397, 'view', 38),
+(3398, 'buy', 346),
+(3399, 'scroll', 205),
+(3400, 'click', 185),
+(3401, 'view', 387),
+(3402, 'buy', 85),
+(3403, 'scroll', 28),
+(3404, 'click', 52),
+(3405, 'view', 35),
+(3406, 'buy', 570),
+(3407, 'scroll', 378),
+(3408, 'click', 891),
+(3409, 'view', 722),
+(3410, 'buy', 469),
+(3411, 'scroll', 498),
+(3412, 'click', 969),
+(3413, 'view', 865),
+(3414, 'buy', 931),
+(3415, 'scroll', 916),
+(3416, 'click', 65),
+(3417, 'view', 883),
+(3418, 'buy', 612),
+(3419, 'scroll', 655),
+(3420, 'click', 406),
+(3421, 'view', 944),
+(3422, 'buy', 122),
+(3423, 'scroll', 723),
+(3424, 'click', 982),
+(3425, 'view', 92),
+(3426, 'buy', 263),
+(3427, 'scroll', 326),
+(3428, 'click', 578),
+(3429, 'view', 238),
+(3430, 'buy', 656),
+(3431, 'scroll', 91),
+(3432, 'click', 979),
+(3433, 'view', 942),
+(3434, 'buy', 685),
+(3435, 'scroll', 518),
+(3436, 'click', 402),
+(3437, 'view', 187),
+(3438, 'buy', 459),
+(3439, 'scroll', 870),
+(3440, 'click', 163),
+(3441, 'view', 379),
+(3442, 'buy', 988),
+(3443, 'scroll', 240),
+(3444, 'click', 738),
+(3445, 'view', 227),
+(3446, 'buy', 176),
+(3447, 'scroll', 39),
+(3448, 'click', 964),
+(3449, 'view', 262),
+(3450, 'buy', 963),
+(3451, 'scroll', 360),
+(3452, 'click', 60),
+(3453, 'view', 924),
+(3454, 'buy', 566),
+(3455, 'scroll', 926),
+(3456, 'click', 28),
+(3457, 'view', 857),
+(3458, 'buy', 941),
+(3459, 'scroll', 48),
+(3460, 'click', 264),
+(3461, 'view', 805),
+(3462, 'buy', 525),
+(3463, 'scroll', 726),
+(3464, 'click', 757),
+(3465, 'view', 662),
+(3466, 'buy', 779),
+(3467, 'scroll', 495),
+(3468, 'click', 57),
+(3469, 'view', 103),
+(3470, 'buy', 148),
+(3471, 'scroll', 325),
+(3472, 'click', 773),
+(3473, 'view', 5),
+(3474, 'buy', 961),
+(3475, 'scroll', 203),
+(3476, 'click', 693),
+(3477, 'view', 766),
+(3478, 'buy', 305),
+(3479, 'scroll', 603),
+(3480, 'click', 605),
+(3481, 'view', 451),
+(3482, 'buy', 776),
+(3483, 'scroll', 668),
+(3484, 'click', 107),
+(3485, 'view', 482),
+(3486, 'buy', 331),
+(3487, 'scroll', 380),
+(3488, 'click', 263),
+(3489, 'view', 399),
+(3490, 'buy', 127),
+(3491, 'scroll', 383),
+(3492, 'click', 492),
+(3493, 'view', 388),
+(3494, 'buy', 172),
+(3495, 'scroll', 451),
+(3496, 'click', 244),
+(3497, 'view', 826),
+(3498, 'buy', 146),
+(3499, 'scroll', 936),
+(3500, 'click', 693),
+(3501, 'view', 913),
+(3502, 'buy', 12),
+(3503, 'scroll', 479),
+(3504, 'click', 734),
+(3505, 'view', 934),
+(3506, 'buy', 199),
+(3507, 'scroll', 818),
+(3508, 'click', 36),
+(3509, 'view', 160),
+(3510, 'buy', 949),
+(3511, 'scroll', 852),
+(3512, 'click', 225),
+(3513, 'view', 79),
+(3514, 'buy', 956),
+(3515, 'scroll', 633),
+(3516, 'click', 887),
+(3517, 'view', 382),
+(3518, 'buy', 910),
+(3519, 'scroll', 767),
+(3520, 'click', 143),
+(3521, 'view', 796),
+(3522, 'buy', 457),
+(3523, 'scroll', 980),
+(3524, 'click', 99),
+(3525, 'view', 948),
+(3526, 'buy', 951),
+(3527, 'scroll', 394),
+(3528, 'click', 862),
+(3529, 'view', 22),
+(3530, 'buy', 643),
+(3531, 'scroll', 76),
+(3532, 'click', 463),
+(3533, 'view', 995),
+(3534, 'buy', 347),
+(3535, 'scroll', 330),
+(3536, 'click', 842),
+(3537, 'view', 239),
+(3538, 'buy', 488),
+(3539, 'scroll', 118),
+(3540, 'click', 643),
+(3541, 'view', 374),
+(3542, 'buy', 146),
+(3543, 'scroll', 339),
+(3544, 'click', 226),
+(3545, 'view', 753),
+(3546, 'buy', 58),
+(3547, 'scroll', 184),
+(3548, 'click', 730),
+(3549, 'view', 462),
+(3550, 'buy', 566),
+(3551, 'scroll', 910),
+(3552, 'click', 148),
+(3553, 'view', 449),
+(3554, 'buy', 891),
+(3555, 'scroll', 152),
+(3556, 'click', 272),
+(3557, 'view', 428),
+(3558, 'buy', 421),
+(3559, 'scroll', 252),
+(3560, 'click', 159),
+(3561, 'view', 26),
+(3562, 'buy', 277),
+(3563, 'scroll', 584),
+(3564, 'click', 859),
+(3565, 'view', 303),
+(3566, 'buy', 342),
+(3567, 'scroll', 823),
+(3568, 'click', 171),
+(3569, 'view', 266),
+(3570, 'buy', 502),
+(3571, 'scroll', 111),
+(3572, 'click', 325),
+(3573, 'view', 467),
+(3574, 'buy', 924),
+(3575, 'scroll', 494),
+(3576, 'click', 116),
+(3577, 'view', 157),
+(3578, 'buy', 525),
+(3579, 'scroll', 58),
+(3580, 'click', 646),
+(3581, 'view', 916),
+(3582, 'buy', 806),
+(3583, 'scroll', 684),
+(3584, 'click', 947),
+(3585, 'view', 216),
+(3586, 'buy', 573),
+(3587, 'scroll', 488),
+(3588, 'click', 855),
+(3589, 'view', 293),
+(3590, 'buy', 122),
+(3591, 'scroll', 263),
+(3592, 'click', 772),
+(3593, 'view', 206),
+(3594, 'buy', 993),
+(3595, 'scroll', 373),
+(3596, 'click', 442),
+(3597, 'view', 267),
+(3598, 'buy', 244),
+(3599, 'scroll', 947),
+(3600, 'click', 243),
+(3601, 'view', 99),
+(3602, 'buy', 399),
+(3603, 'scroll', 296),
+(3604, 'click', 425),
+(3605, 'view', 917),
+(3606, 'buy', 166),
+(3607, 'scroll', 58),
+(3608, 'click', 852),
+(3609, 'view', 743),
+(3610, 'buy', 300),
+(3611, 'scroll', 147),
+(3612, 'click', 655),
+(3613, 'view', 16),
+(3614, 'buy', 452),
+(3615, 'scroll', 826),
+(3616, 'click', 519),
+(3617, 'view', 349),
+(3618, 'buy', 523),
+(3619, 'scroll', 143),
+(3620, 'click', 453),
+(3621, 'view', 1),
+(3622, 'buy', 808),
+(3623, 'scroll', 852),
+(3624, 'click', 966),
+(3625, 'view', 539),
+(3626, 'buy', 293),
+(3627, 'scroll', 190),
+(3628, 'click', 368),
+(3629, 'view', 445),
+(3630, 'buy', 41),
+(3631, 'scroll', 933),
+(3632, 'click', 418),
+(3633, 'view', 223),
+(3634, 'buy', 283),
+(3635, 'scroll', 585),
+(3636, 'click', 185),
+(3637, 'view', 141),
+(3638, 'buy', 863),
+(3639, 'scroll', 184),
+(3640, 'click', 534),
+(3641, 'view', 788),
+(3642, 'buy', 235),
+(3643, 'scroll', 728),
+(3644, 'click', 179),
+(3645, 'view', 201),
+(3646, 'buy', 615),
+(3647, 'scroll', 81),
+(3648, 'click', 848),
+(3649, 'view', 89),
+(3650, 'buy', 910),
+(3651, 'scroll', 623),
+(3652, 'click', 748),
+(3653, 'view', 507),
+(3654, 'buy', 779),
+(3655, 'scroll', 280),
+(3656, 'click', 179),
+(3657, 'view', 210),
+(3658, 'buy', 140),
+(3659, 'scroll', 627),
+(3660, 'click', 685),
+(3661, 'view', 724),
+(3662, 'buy', 643),
+(3663, 'scroll', 831),
+(3664, 'click', 196),
+(3665, 'view', 596),
+(3666, 'buy', 315),
+(3667, 'scroll', 207),
+(3668, 'click', 10),
+(3669, 'view', 67),
+(3670, 'buy', 708),
+(3671, 'scroll', 750),
+(3672, 'click', 532),
+(3673, 'view', 417),
+(3674, 'buy', 861),
+(3675, 'scroll', 738),
+(3676, 'click', 938),
+(3677, 'view', 56),
+(3678, 'buy', 530),
+(3679, 'scroll', 830),
+(3680, 'click', 355),
+(3681, 'view', 343),
+(3682, 'buy', 288),
+(3683, 'scroll', 862),
+(3684, 'click', 654),
+(3685, 'view', 885),
+(3686, 'buy', 968),
+(3687, 'scroll', 504),
+(3688, 'click', 92),
+(3689, 'view', 15),
+(3690, 'buy', 419),
+(3691, 'scroll', 932),
+(3692, 'click', 781),
+(3693, 'view', 488),
+(3694, 'buy', 136),
+(3695, 'scroll', 892),
+(3696, 'click', 681),
+(3697, 'view', 272),
+(3698, 'buy', 254),
+(3699, 'scroll', 190),
+(3700, 'click', 576),
+(3701, 'view', 851),
+(3702, 'buy', 375),
+(3703, 'scroll', 37),
+(3704, 'click', 167),
+(3705, 'view', 719),
+(3706, 'buy', 380),
+(3707, 'scroll', 588),
+(3708, 'click', 609),
+(3709, 'view', 878),
+(3710, 'buy', 4),
+(3711, 'scroll', 364),
+(3712, 'click', 532),
+(3713, 'view', 954),
+(3714, 'buy', 456),
+(3715, 'scroll', 991),
+(3716, 'click', 528),
+(3717, 'view', 73),
+(3718, 'buy', 123),
+(3719, 'scroll', 365),
+(3720, 'click', 731),
+(3721, 'view', 250),
+(3722, 'buy', 836),
+(3723, 'scroll', 849),
+(3724, 'click', 886),
+(3725, 'view', 934),
+(3726, 'buy', 328),
+(3727, 'scroll', 797),
+(3728, 'click', 728),
+(3729, 'view', 888),
+(3730, 'buy', 390),
+(3731, 'scroll', 590),
+(3732, 'click', 769),
+(3733, 'view', 919),
+(3734, 'buy', 62),
+(3735, 'scroll', 298),
+(3736, 'click', 893),
+(3737, 'view', 110),
+(3738, 'buy', 976),
+(3739, 'scroll', 748),
+(3740, 'click', 506),
+(3741, 'view', 457),
+(3742, 'buy', 525),
+(3743, 'scroll', 26),
+(3744, 'click', 543),
+(3745, 'view', 823),
+(3746, 'buy', 550),
+(3747, 'scroll', 137),
+(3748, 'click', 21),
+(3749, 'view', 249),
+(3750, 'buy', 990),
+(3751, 'scroll', 90),
+(3752, 'click', 229),
+(3753, 'view', 633),
+(3754, 'buy', 186),
+(3755, 'scroll', 171),
+(3756, 'click', 105),
+(3757, 'view', 319),
+(3758, 'buy', 256),
+(3759, 'scroll', 568),
+(3760, 'click', 836),
+(3761, 'view', 978),
+(3762, 'buy', 30),
+(3763, 'scroll', 19),
+(3764, 'click', 98),
+(3765, 'view', 948),
+(3766, 'buy', 715),
+(3767, 'scroll', 756),
+(3768, 'click', 199),
+(3769, 'view', 267),
+(3770, 'buy', 18),
+(3771, 'scroll', 857),
+(3772, 'click', 613),
+(3773, 'view', 652),
+(3774, 'buy', 590),
+(3775, 'scroll', 475),
+(3776, 'click', 535),
+(3777, 'view', 244),
+(3778, 'buy', 719),
+(3779, 'scroll', 454),
+(3780, 'click', 105),
+(3781, 'view', 359),
+(3782, 'buy', 890),
+(3783, 'scroll', 96),
+(3784, 'click', 734),
+(3785, 'view', 183),
+(3786, 'buy', 46),
+(3787, 'scroll', 279),
+(3788, 'click', 126),
+(3789, 'view', 476),
+(3790, 'buy', 505),
+(3791, 'scroll', 599),
+(3792, 'click', 512),
+(3793, 'view', 779),
+(3794, 'buy', 286),
+(3795, 'scroll', 112),
+(3796, 'click', 124),
+(3797, 'view', 124),
+(3798, 'buy', 415),
+(3799, 'scroll', 905),
+(3800, 'click', 140),
+(3801, 'view', 554),
+(3802, 'buy', 606),
+(3803, 'scroll', 232),
+(3804, 'click', 881),
+(3805, 'view', 232),
+(3806, 'buy', 150),
+(3807, 'scroll', 684),
+(3808, 'click', 586),
+(3809, 'view', 473),
+(3810, 'buy', 764),
+(3811, 'scroll', 406),
+(3812, 'click', 168),
+(3813, 'view', 970),
+(3814, 'buy', 845),
+(3815, 'scroll', 18),
+(3816, 'click', 960),
+(3817, 'view', 650),
+(3818, 'buy', 398),
+(3819, 'scroll', 710),
+(3820, 'click', 430),
+(3821, 'view', 611),
+(3822, 'buy', 859),
+(3823, 'scroll', 617),
+(3824, 'click', 538),
+(3825, 'view', 37),
+(3826, 'buy', 405),
+(3827, 'scroll', 993),
+(3828, 'click', 963),
+(3829, 'view', 53),
+(3830, 'buy', 795),
+(3831, 'scroll', 371),
+(3832, 'click', 346),
+(3833, 'view', 410),
+(3834, 'buy', 246),
+(3835, 'scroll', 858),
+(3836, 'click', 343),
+(3837, 'view', 732),
+(3838, 'buy', 446),
+(3839, 'scroll', 863),
+(3840, 'click', 577),
+(3841, 'view', 823),
+(3842, 'buy', 934),
+(3843, 'scroll', 328),
+(3844, 'click', 834),
+(3845, 'view', 410),
+(3846, 'buy', 867),
+(3847, 'scroll', 574),
+(3848, 'click', 54),
+(3849, 'view', 332),
+(3850, 'buy', 529),
+(3851, 'scroll', 150),
+(3852, 'click', 980),
+(3853, 'view', 696),
+(3854, 'buy', 956),
+(3855, 'scroll', 361),
+(3856, 'click', 255),
+(3857, 'view', 891),
+(3858, 'buy', 432),
+(3859, 'scroll', 679),
+(3860, 'click', 647),
+(3861, 'view', 11),
+(3862, 'buy', 373),
+(3863, 'scroll', 111),
+(3864, 'click', 543),
+(3865, 'view', 191),
+(3866, 'buy', 70),
+(3867, 'scroll', 332),
+(3868, 'click', 443),
+(3869, 'view', 205),
+(3870, 'buy', 516),
+(3871, 'scroll', 685),
+(3872, 'click', 21),
+(3873, 'view', 230),
+(3874, 'buy', 142),
+(3875, 'scroll', 430),
+(3876, 'click', 992),
+(3877, 'view', 406),
+(3878, 'buy', 795),
+(3879, 'scroll', 959),
+(3880, 'click', 464),
+(3881, 'view', 648),
+(3882, 'buy', 47),
+(3883, 'scroll', 828),
+(3884, 'click', 905),
+(3885, 'view', 996),
+(3886, 'buy', 905),
+(3887, 'scroll', 41),
+(3888, 'click', 35),
+(3889, 'view', 886),
+(3890, 'buy', 656),
+(3891, 'scroll', 635),
+(3892, 'click', 272),
+(3893, 'view', 939),
+(3894, 'buy', 694),
+(3895, 'scroll', 638),
+(3896, 'click', 279),
+(3897, 'view', 643),
+(3898, 'buy', 555),
+(3899, 'scroll', 825),
+(3900, 'click', 946),
+(3901, 'view', 36),
+(3902, 'buy', 636),
+(3903, 'scroll', 102),
+(3904, 'click', 256),
+(3905, 'view', 124),
+(3906, 'buy', 532),
+(3907, 'scroll', 13),
+(3908, 'click', 444),
+(3909, 'view', 242),
+(3910, 'buy', 973),
+(3911, 'scroll', 40),
+(3912, 'click', 294),
+(3913, 'view', 115),
+(3914, 'buy', 312),
+(3915, 'scroll', 355),
+(3916, 'click', 663),
+(3917, 'view', 170),
+(3918, 'buy', 123),
+(3919, 'scroll', 61),
+(3920, 'click', 608),
+(3921, 'view', 982),
+(3922, 'buy', 979),
+(3923, 'scroll', 943),
+(3924, 'click', 526),
+(3925, 'view', 923),
+(3926, 'buy', 274),
+(3927, 'scroll', 86),
+(3928, 'click', 477),
+(3929, 'view', 604),
+(3930, 'buy', 546),
+(3931, 'scroll', 954),
+(3932, 'click', 151),
+(3933, 'view', 450),
+(3934, 'buy', 126),
+(3935, 'scroll', 523),
+(3936, 'click', 134),
+(3937, 'view', 906),
+(3938, 'buy', 300),
+(3939, 'scroll', 937),
+(3940, 'click', 416),
+(3941, 'view', 591),
+(3942, 'buy', 295),
+(3943, 'scroll', 280),
+(3944, 'click', 249),
+(3945, 'view', 753),
+(3946, 'buy', 89),
+(3947, 'scroll', 758),
+(3948, 'click', 559),
+(3949, 'view', 294),
+(3950, 'buy', 859),
+(3951, 'scroll', 465),
+(3952, 'click', 624),
+(3953, 'view', 711),
+(3954, 'buy', 583),
+(3955, 'scroll', 226),
+(3956, 'click', 665),
+(3957, 'view', 395),
+(3958, 'buy', 206),
+(3959, 'scroll', 561),
+(3960, 'click', 727),
+(3961, 'view', 375),
+(3962, 'buy', 471),
+(3963, 'scroll', 913),
+(3964, 'click', 561),
+(3965, 'view', 310),
+(3966, 'buy', 627),
+(3967, 'scroll', 489),
+(3968, 'click', 480),
+(3969, 'view', 838),
+(3970, 'buy', 317),
+(3971, 'scroll', 31),
+(3972, 'click', 248),
+(3973, 'view', 341),
+(3974, 'buy', 226),
+(3975, 'scroll', 193),
+(3976, 'click', 524),
+(3977, 'view', 559),
+(3978, 'buy', 392),
+(3979, 'scroll', 992),
+(3980, 'click', 599),
+(3981, 'view', 405),
+(3982, 'buy', 12),
+(3983, 'scroll', 946),
+(3984, 'click', 361),
+(3985, 'view', 166),
+(3986, 'buy', 882),
+(3987, 'scroll', 974),
+(3988, 'click', 244),
+(3989, 'view', 331),
+(3990, 'buy', 570),
+(3991, 'scroll', 333),
+(3992, 'click', 503),
+(3993, 'view', 276),
+(3994, 'buy', 291),
+(3995, 'scroll', 899),
+(3996, 'click', 221),
+(3997, 'view', 302),
+(3998, 'buy', 58),
+(3999, 'scroll', 790),
+(4000, 'click', 22),
+(4001, 'view', 162),
+(4002, 'buy', 564),
+(4003, 'scroll', 68),
+(4004, 'click', 620),
+(4005, 'view', 892),
+(4006, 'buy', 356),
+(4007, 'scroll', 450),
+(4008, 'click', 673),
+(4009, 'view', 63),
+(4010, 'buy', 529),
+(4011, 'scroll', 397),
+(4012, 'click', 854),
+(4013, 'view', 450),
+(4014, 'buy', 362),
+(4015, 'scroll', 753),
+(4016, 'click', 781),
+(4017, 'view', 111),
+(4018, 'buy', 533),
+(4019, 'scroll', 230),
+(4020, 'click', 982),
+(4021, 'view', 693),
+(4022, 'buy', 756),
+(4023, 'scroll', 956),
+(4024, 'click', 158),
+(4025, 'view', 426),
+(4026, 'buy', 345),
+(4027, 'scroll', 684),
+(4028, 'click', 360),
+(4029, 'view', 143),
+(4030, 'buy', 691),
+(4031, 'scroll', 207),
+(4032, 'click', 631),
+(4033, 'view', 625),
+(4034, 'buy', 870),
+(4035, 'scroll', 283),
+(4036, 'click', 840),
+(4037, 'view', 859),
+(4038, 'buy', 530),
+(4039, 'scroll', 97),
+(4040, 'click', 756),
+(4041, 'view', 876),
+(4042, 'buy', 761),
+(4043, 'scroll', 944),
+(4044, 'click', 777),
+(4045, 'view', 486),
+(4046, 'buy', 275),
+(4047, 'scroll', 803),
+(4048, 'click', 645),
+(4049, 'view', 725),
+(4050, 'buy', 647),
+(4051, 'scroll', 936),
+(4052, 'click', 720),
+(4053, 'view', 130),
+(4054, 'buy', 422),
+(4055, 'scroll', 891),
+(4056, 'click', 105),
+(4057, 'view', 4),
+(4058, 'buy', 420),
+(4059, 'scroll', 784),
+(4060, 'click', 563),
+(4061, 'view', 599),
+(4062, 'buy', 120),
+(4063, 'scroll', 509),
+(4064, 'click', 407),
+(4065, 'view', 985),
+(4066, 'buy', 585),
+(4067, 'scroll', 153),
+(4068, 'click', 427),
+(4069, 'view', 870),
+(4070, 'buy', 802),
+(4071, 'scroll', 286),
+(4072, 'click', 893),
+(4073, 'view', 636),
+(4074, 'buy', 621),
+(4075, 'scroll', 113),
+(4076, 'click', 388),
+(4077, 'view', 872),
+(4078, 'buy', 463),
+(4079, 'scroll', 709),
+(4080, 'click', 468),
+(4081, 'view', 294),
+(4082, 'buy', 740),
+(4083, 'scroll', 361),
+(4084, 'click', 299),
+(4085, 'view', 361),
+(4086, 'buy', 400),
+(4087, 'scroll', 538),
+(4088, 'click', 568),
+(4089, 'view', 609),
+(4090, 'buy', 393),
+(4091, 'scroll', 663),
+(4092, 'click', 329),
+(4093, 'view', 6),
+(4094, 'buy', 805),
+(4095, 'scroll', 763),
+(4096, 'click', 869),
+(4097, 'view', 511),
+(4098, 'buy', 389),
+(4099, 'scroll', 454),
+(4100, 'click', 307),
+(4101, 'view', 188),
+(4102, 'buy', 549),
+(4103, 'scroll', 311),
+(4104, 'click', 822),
+(4105, 'view', 148),
+(4106, 'buy', 446),
+(4107, 'scroll', 589),
+(4108, 'click', 386),
+(4109, 'view', 595),
+(4110, 'buy', 237),
+(4111, 'scroll', 90),
+(4112, 'click', 841),
+(4113, 'view', 942),
+(4114, 'buy', 338),
+(4115, 'scroll', 331),
+(4116, 'click', 992),
+(4117, 'view', 863),
+(4118, 'buy', 622),
+(4119, 'scroll', 858),
+(4120, 'click', 248),
+(4121, 'view', 981),
+(4122, 'buy', 333),
+(4123, 'scroll', 209),
+(4124, 'click', 995),
+(4125, 'view', 436),
+(4126, 'buy', 912),
+(4127, 'scroll', 932),
+(4128, 'click', 978),
+(4129, 'view', 10),
+(4130, 'buy', 26),
+(4131, 'scroll', 48),
+(4132, 'click', 262),
+(4133, 'view', 578),
+(4134, 'buy', 917),
+(4135, 'scroll', 509),
+(4136, 'click', 307),
+(4137, 'view', 942),
+(4138, 'buy', 549),
+(4139, 'scroll', 792),
+(4140, 'click', 319),
+(4141, 'view', 551),
+(4142, 'buy', 634),
+(4143, 'scroll', 447),
+(4144, 'click', 529),
+(4145, 'view', 845),
+(4146, 'buy', 529),
+(4147, 'scroll', 744),
+(4148, 'click', 701),
+(4149, 'view', 440),
+(4150, 'buy', 398),
+(4151, 'scroll', 475),
+(4152, 'click', 366),
+(4153, 'view', 41),
+(4154, 'buy', 608),
+(4155, 'scroll', 692),
+(4156, 'click', 359),
+(4157, 'view', 463),
+(4158, 'buy', 970),
+(4159, 'scroll', 10),
+(4160, 'click', 692),
+(4161, 'view', 69),
+(4162, 'buy', 537),
+(4163, 'scroll', 234),
+(4164, 'click', 101),
+(4165, 'view', 419),
+(4166, 'buy', 383),
+(4167, 'scroll', 512),
+(4168, 'click', 410),
+(4169, 'view', 664),
+(4170, 'buy', 574),
+(4171, 'scroll', 950),
+(4172, 'click', 587),
+(4173, 'view', 157),
+(4174, 'buy', 900),
+(4175, 'scroll', 192),
+(4176, 'click', 987),
+(4177, 'view', 431),
+(4178, 'buy', 498),
+(4179, 'scroll', 411),
+(4180, 'click', 450),
+(4181, 'view', 785),
+(4182, 'buy', 639),
+(4183, 'scroll', 920),
+(4184, 'click', 601),
+(4185, 'view', 351),
+(4186, 'buy', 708),
+(4187, 'scroll', 542),
+(4188, 'click', 764),
+(4189, 'view', 835),
+(4190, 'buy', 94),
+(4191, 'scroll', 174),
+(4192, 'click', 371),
+(4193, 'view', 325),
+(4194, 'buy', 375),
+(4195, 'scroll', 76),
+(4196, 'click', 845),
+(4197, 'view', 318),
+(4198, 'buy', 524),
+(4199, 'scroll', 179),
+(4200, 'click', 113),
+(4201, 'view', 671),
+(4202, 'buy', 915),
+(4203, 'scroll', 301),
+(4204, 'click', 706),
+(4205, 'view', 351),
+(4206, 'buy', 840),
+(4207, 'scroll', 957),
+(4208, 'click', 521),
+(4209, 'view', 909),
+(4210, 'buy', 994),
+(4211, 'scroll', 430),
+(4212, 'click', 646),
+(4213, 'view', 160),
+(4214, 'buy', 536),
+(4215, 'scroll', 296),
+(4216, 'click', 835),
+(4217, 'view', 523),
+(4218, 'buy', 212),
+(4219, 'scroll', 517),
+(4220, 'click', 914),
+(4221, 'view', 192),
+(4222, 'buy', 422),
+(4223, 'scroll', 186),
+(4224, 'click', 61),
+(4225, 'view', 645),
+(4226, 'buy', 578),
+(4227, 'scroll', 617),
+(4228, 'click', 109),
+(4229, 'view', 361),
+(4230, 'buy', 583),
+(4231, 'scroll', 646),
+(4232, 'click', 651),
+(4233, 'view', 740),
+(4234, 'buy', 43),
+(4235, 'scroll', 708),
+(4236, 'click', 421),
+(4237, 'view', 10),
+(4238, 'buy', 806),
+(4239, 'scroll', 2),
+(4240, 'click', 314),
+(4241, 'view', 727),
+(4242, 'buy', 707),
+(4243, 'scroll', 566),
+(4244, 'click', 4),
+(4245, 'view', 939),
+(4246, 'buy', 311),
+(4247, 'scroll', 407),
+(4248, 'click', 862),
+(4249, 'view', 100),
+(4250, 'buy', 600),
+(4251, 'scroll', 15),
+(4252, 'click', 684),
+(4253, 'view', 30),
+(4254, 'buy', 201),
+(4255, 'scroll', 179),
+(4256, 'click', 509),
+(4257, 'view', 787),
+(4258, 'buy', 566),
+(4259, 'scroll', 580),
+(4260, 'click', 272),
+(4261, 'view', 892),
+(4262, 'buy', 662),
+(4263, 'scroll', 917),
+(4264, 'click', 544),
+(4265, 'view', 526),
+(4266, 'buy', 147),
+(4267, 'scroll', 588),
+(4268, 'click', 203),
+(4269, 'view', 420),
+(4270, 'buy', 616),
+(4271, 'scroll', 124),
+(4272, 'click', 148),
+(4273, 'view', 160),
+(4274, 'buy', 530),
+(4275, 'scroll', 777),
+(4276, 'click', 521),
+(4277, 'view', 109),
+(4278, 'buy', 29),
+(4279, 'scroll', 102),
+(4280, 'click', 77),
+(4281, 'view', 174),
+(4282, 'buy', 970),
+(4283, 'scroll', 535),
+(4284, 'click', 502),
+(4285, 'view', 842),
+(4286, 'buy', 478),
+(4287, 'scroll', 627),
+(4288, 'click', 440),
+(4289, 'view', 825),
+(4290, 'buy', 819),
+(4291, 'scroll', 63),
+(4292, 'click', 665),
+(4293, 'view', 12),
+(4294, 'buy', 700),
+(4295, 'scroll', 789),
+(4296, 'click', 592),
+(4297, 'view', 330),
+(4298, 'buy', 147),
+(4299, 'scroll', 732),
+(4300, 'click', 243),
+(4301, 'view', 362),
+(4302, 'buy', 282),
+(4303, 'scroll', 173),
+(4304, 'click', 33),
+(4305, 'view', 273),
+(4306, 'buy', 643),
+(4307, 'scroll', 101),
+(4308, 'click', 879),
+(4309, 'view', 925),
+(4310, 'buy', 970),
+(4311, 'scroll', 596),
+(4312, 'click', 64),
+(4313, 'view', 357),
+(4314, 'buy', 196),
+(4315, 'scroll', 460),
+(4316, 'click', 638),
+(4317, 'view', 394),
+(4318, 'buy', 20),
+(4319, 'scroll', 55),
+(4320, 'click', 225),
+(4321, 'view', 911),
+(4322, 'buy', 405),
+(4323, 'scroll', 596),
+(4324, 'click', 782),
+(4325, 'view', 982),
+(4326, 'buy', 44),
+(4327, 'scroll', 450),
+(4328, 'click', 55),
+(4329, 'view', 635),
+(4330, 'buy', 244),
+(4331, 'scroll', 255),
+(4332, 'click', 228),
+(4333, 'view', 45),
+(4334, 'buy', 163),
+(4335, 'scroll', 953),
+(4336, 'click', 601),
+(4337, 'view', 875),
+(4338, 'buy', 177),
+(4339, 'scroll', 322),
+(4340, 'click', 6),
+(4341, 'view', 920),
+(4342, 'buy', 887),
+(4343, 'scroll', 835),
+(4344, 'click', 466),
+(4345, 'view', 310),
+(4346, 'buy', 428),
+(4347, 'scroll', 617),
+(4348, 'click', 258),
+(4349, 'view', 983),
+(4350, 'buy', 908),
+(4351, 'scroll', 507),
+(4352, 'click', 972),
+(4353, 'view', 69),
+(4354, 'buy', 248),
+(4355, 'scroll', 693),
+(4356, 'click', 399),
+(4357, 'view', 691),
+(4358, 'buy', 735),
+(4359, 'scroll', 598),
+(4360, 'click', 226),
+(4361, 'view', 423),
+(4362, 'buy', 316),
+(4363, 'scroll', 408),
+(4364, 'click', 896),
+(4365, 'view', 728),
+(4366, 'buy', 496),
+(4367, 'scroll', 22),
+(4368, 'click', 811),
+(4369, 'view', 889),
+(4370, 'buy', 249),
+(4371, 'scroll', 89),
+(4372, 'click', 177),
+(4373, 'view', 174),
+(4374, 'buy', 366),
+(4375, 'scroll', 388),
+(4376, 'click', 191),
+(4377, 'view', 7),
+(4378, 'buy', 994),
+(4379, 'scroll', 903),
+(4380, 'click', 297),
+(4381, 'view', 405),
+(4382, 'buy', 575),
+(4383, 'scroll', 371),
+(4384, 'click', 117),
+(4385, 'view', 343),
+(4386, 'buy', 546),
+(4387, 'scroll', 892),
+(4388, 'click', 394),
+(4389, 'view', 343),
+(4390, 'buy', 412),
+(4391, 'scroll', 666),
+(4392, 'click', 67),
+(4393, 'view', 984),
+(4394, 'buy', 126),
+(4395, 'scroll', 432),
+(4396, 'click', 845),
+(4397, 'view', 934),
+(4398, 'buy', 359),
+(4399, 'scroll', 567),
+(4400, 'click', 250),
+(4401, 'view', 396),
+(4402, 'buy', 195),
+(4403, 'scroll', 478),
+(4404, 'click', 290),
+(4405, 'view', 352),
+(4406, 'buy', 242),
+(4407, 'scroll', 446),
+(4408, 'click', 35),
+(4409, 'view', 285),
+(4410, 'buy', 680),
+(4411, 'scroll', 25),
+(4412, 'click', 349),
+(4413, 'view', 824),
+(4414, 'buy', 159),
+(4415, 'scroll', 247),
+(4416, 'click', 722),
+(4417, 'view', 132),
+(4418, 'buy', 94),
+(4419, 'scroll', 201),
+(4420, 'click', 276),
+(4421, 'view', 557),
+(4422, 'buy', 855),
+(4423, 'scroll', 806),
+(4424, 'click', 130),
+(4425, 'view', 568),
+(4426, 'buy', 453),
+(4427, 'scroll', 478),
+(4428, 'click', 856),
+(4429, 'view', 814),
+(4430, 'buy', 824),
+(4431, 'scroll', 245),
+(4432, 'click', 163),
+(4433, 'view', 376),
+(4434, 'buy', 361),
+(4435, 'scroll', 221),
+(4436, 'click', 739),
+(4437, 'view', 414),
+(4438, 'buy', 385),
+(4439, 'scroll', 644),
+(4440, 'click', 981),
+(4441, 'view', 594),
+(4442, 'buy', 213),
+(4443, 'scroll', 304),
+(4444, 'click', 973),
+(4445, 'view', 487),
+(4446, 'buy', 516),
+(4447, 'scroll', 209),
+(4448, 'click', 232),
+(4449, 'view', 878),
+(4450, 'buy', 463),
+(4451, 'scroll', 691),
+(4452, 'click', 134),
+(4453, 'view', 964),
+(4454, 'buy', 723),
+(4455, 'scroll', 267),
+(4456, 'click', 610),
+(4457, 'view', 921),
+(4458, 'buy', 450),
+(4459, 'scroll', 601),
+(4460, 'click', 376),
+(4461, 'view', 547),
+(4462, 'buy', 252),
+(4463, 'scroll', 413),
+(4464, 'click', 622),
+(4465, 'view', 522),
+(4466, 'buy', 217),
+(4467, 'scroll', 128),
+(4468, 'click', 893),
+(4469, 'view', 768),
+(4470, 'buy', 125),
+(4471, 'scroll', 694),
+(4472, 'click', 525),
+(4473, 'view', 93),
+(4474, 'buy', 555),
+(4475, 'scroll', 872),
+(4476, 'click', 276),
+(4477, 'view', 753),
+(4478, 'buy', 790),
+(4479, 'scroll', 783),
+(4480, 'click', 394),
+(4481, 'view', 29),
+(4482, 'buy', 673),
+(4483, 'scroll', 735),
+(4484, 'click', 581),
+(4485, 'view', 148),
+(4486, 'buy', 318),
+(4487, 'scroll', 15),
+(4488, 'click', 399),
+(4489, 'view', 727),
+(4490, 'buy', 88),
+(4491, 'scroll', 711),
+(4492, 'click', 181),
+(4493, 'view', 794),
+(4494, 'buy', 871),
+(4495, 'scroll', 237),
+(4496, 'click', 328),
+(4497, 'view', 192),
+(4498, 'buy', 678),
+(4499, 'scroll', 912),
+(4500, 'click', 111),
+(4501, 'view', 69),
+(4502, 'buy', 575),
+(4503, 'scroll', 935),
+(4504, 'click', 370),
+(4505, 'view', 824),
+(4506, 'buy', 512),
+(4507, 'scroll', 776),
+(4508, 'click', 304),
+(4509, 'view', 197),
+(4510, 'buy', 67),
+(4511, 'scroll', 735),
+(4512, 'click', 318),
+(4513, 'view', 90),
+(4514, 'buy', 231),
+(4515, 'scroll', 295),
+(4516, 'click', 129),
+(4517, 'view', 836),
+(4518, 'buy', 733),
+(4519, 'scroll', 408),
+(4520, 'click', 289),
+(4521, 'view', 364),
+(4522, 'buy', 413),
+(4523, 'scroll', 864),
+(4524, 'click', 930),
+(4525, 'view', 475),
+(4526, 'buy', 793),
+(4527, 'scroll', 643),
+(4528, 'click', 903),
+(4529, 'view', 643),
+(4530, 'buy', 881),
+(4531, 'scroll', 883),
+(4532, 'click', 135),
+(4533, 'view', 959),
+(4534, 'buy', 283),
+(4535, 'scroll', 180),
+(4536, 'click', 30),
+(4537, 'view', 375),
+(4538, 'buy', 695),
+(4539, 'scroll', 818),
+(4540, 'click', 679),
+(4541, 'view', 707),
+(4542, 'buy', 359),
+(4543, 'scroll', 918),
+(4544, 'click', 422),
+(4545, 'view', 25),
+(4546, 'buy', 674),
+(4547, 'scroll', 720),
+(4548, 'click', 716),
+(4549, 'view', 473),
+(4550, 'buy', 254),
+(4551, 'scroll', 867),
+(4552, 'click', 410),
+(4553, 'view', 360),
+(4554, 'buy', 927),
+(4555, 'scroll', 643),
+(4556, 'click', 100),
+(4557, 'view', 186),
+(4558, 'buy', 298),
+(4559, 'scroll', 117),
+(4560, 'click', 277),
+(4561, 'view', 934),
+(4562, 'buy', 623),
+(4563, 'scroll', 751),
+(4564, 'click', 224),
+(4565, 'view', 729),
+(4566, 'buy', 693),
+(4567, 'scroll', 41),
+(4568, 'click', 414),
+(4569, 'view', 40),
+(4570, 'buy', 623),
+(4571, 'scroll', 165),
+(4572, 'click', 441),
+(4573, 'view', 202),
+(4574, 'buy', 775),
+(4575, 'scroll', 310),
+(4576, 'click', 159),
+(4577, 'view', 389),
+(4578, 'buy', 756),
+(4579, 'scroll', 40),
+(4580, 'click', 565),
+(4581, 'view', 318),
+(4582, 'buy', 644),
+(4583, 'scroll', 653),
+(4584, 'click', 964),
+(4585, 'view', 183),
+(4586, 'buy', 578),
+(4587, 'scroll', 859),
+(4588, 'click', 233),
+(4589, 'view', 583),
+(4590, 'buy', 509),
+(4591, 'scroll', 733),
+(4592, 'click', 533),
+(4593, 'view', 260),
+(4594, 'buy', 947),
+(4595, 'scroll', 445),
+(4596, 'click', 686),
+(4597, 'view', 700),
+(4598, 'buy', 589),
+(4599, 'scroll', 357),
+(4600, 'click', 958),
+(4601, 'view', 0),
+(4602, 'buy', 114),
+(4603, 'scroll', 854),
+(4604, 'click', 782),
+(4605, 'view', 795),
+(4606, 'buy', 671),
+(4607, 'scroll', 293),
+(4608, 'click', 922),
+(4609, 'view', 43),
+(4610, 'buy', 896),
+(4611, 'scroll', 874),
+(4612, 'click', 599),
+(4613, 'view', 621),
+(4614, 'buy', 712),
+(4615, 'scroll', 48),
+(4616, 'click', 997),
+(4617, 'view', 250),
+(4618, 'buy', 697),
+(4619, 'scroll', 113),
+(4620, 'click', 38),
+(4621, 'view', 810),
+(4622, 'buy', 326),
+(4623, 'scroll', 215),
+(4624, 'click', 795),
+(4625, 'view', 936),
+(4626, 'buy', 353),
+(4627, 'scroll', 767),
+(4628, 'click', 935),
+(4629, 'view', 88),
+(4630, 'buy', 427),
+(4631, 'scroll', 711),
+(4632, 'click', 761),
+(4633, 'view', 403),
+(4634, 'buy', 765),
+(4635, 'scroll', 630),
+(4636, 'click', 848),
+(4637, 'view', 226),
+(4638, 'buy', 287),
+(4639, 'scroll', 539),
+(4640, 'click', 92),
+(4641, 'view', 357),
+(4642, 'buy', 969),
+(4643, 'scroll', 972),
+(4644, 'click', 434),
+(4645, 'view', 453),
+(4646, 'buy', 952),
+(4647, 'scroll', 348),
+(4648, 'click', 708),
+(4649, 'view', 515),
+(4650, 'buy', 756),
+(4651, 'scroll', 704),
+(4652, 'click', 849),
+(4653, 'view', 859),
+(4654, 'buy', 643),
+(4655, 'scroll', 640),
+(4656, 'click', 463),
+(4657, 'view', 520),
+(4658, 'buy', 55),
+(4659, 'scroll', 692),
+(4660, 'click', 715),
+(4661, 'view', 210),
+(4662, 'buy', 438),
+(4663, 'scroll', 689),
+(4664, 'click', 524),
+(4665, 'view', 866),
+(4666, 'buy', 950),
+(4667, 'scroll', 796),
+(4668, 'click', 130),
+(4669, 'view', 501),
+(4670, 'buy', 780),
+(4671, 'scroll', 193),
+(4672, 'click', 44),
+(4673, 'view', 975),
+(4674, 'buy', 719),
+(4675, 'scroll', 844),
+(4676, 'click', 825),
+(4677, 'view', 572),
+(4678, 'buy', 267),
+(4679, 'scroll', 178),
+(4680, 'click', 559),
+(4681, 'view', 167),
+(4682, 'buy', 992),
+(4683, 'scroll', 799),
+(4684, 'click', 652),
+(4685, 'view', 241),
+(4686, 'buy', 556),
+(4687, 'scroll', 266),
+(4688, 'click', 255),
+(4689, 'view', 986),
+(4690, 'buy', 60),
+(4691, 'scroll', 172),
+(4692, 'click', 366),
+(4693, 'view', 355),
+(4694, 'buy', 421),
+(4695, 'scroll', 94),
+(4696, 'click', 206),
+(4697, 'view', 651),
+(4698, 'buy', 318),
+(4699, 'scroll', 140),
+(4700, 'click', 139),
+(4701, 'view', 702),
+(4702, 'buy', 723),
+(4703, 'scroll', 498),
+(4704, 'click', 686),
+(4705, 'view', 494),
+(4706, 'buy', 243),
+(4707, 'scroll', 722),
+(4708, 'click', 247),
+(4709, 'view', 6),
+(4710, 'buy', 527),
+(4711, 'scroll', 708),
+(4712, 'click', 455),
+(4713, 'view', 136),
+(4714, 'buy', 958),
+(4715, 'scroll', 656),
+(4716, 'click', 359),
+(4717, 'view', 714),
+(4718, 'buy', 306),
+(4719, 'scroll', 136),
+(4720, 'click', 905),
+(4721, 'view', 724),
+(4722, 'buy', 145),
+(4723, 'scroll', 601),
+(4724, 'click', 576),
+(4725, 'view', 246),
+(4726, 'buy', 341),
+(4727, 'scroll', 644),
+(4728, 'click', 834),
+(4729, 'view', 120),
+(4730, 'buy', 561),
+(4731, 'scroll', 434),
+(4732, 'click', 778),
+(4733, 'view', 963),
+(4734, 'buy', 173),
+(4735, 'scroll', 693),
+(4736, 'click', 682),
+(4737, 'view', 158),
+(4738, 'buy', 613),
+(4739, 'scroll', 472),
+(4740, 'click', 859),
+(4741, 'view', 784),
+(4742, 'buy', 415),
+(4743, 'scroll', 851),
+(4744, 'click', 211),
+(4745, 'view', 117),
+(4746, 'buy', 706),
+(4747, 'scroll', 296),
+(4748, 'click', 12),
+(4749, 'view', 369),
+(4750, 'buy', 498),
+(4751, 'scroll', 211),
+(4752, 'click', 44),
+(4753, 'view', 61),
+(4754, 'buy', 917),
+(4755, 'scroll', 287),
+(4756, 'click', 311),
+(4757, 'view', 201),
+(4758, 'buy', 113),
+(4759, 'scroll', 718),
+(4760, 'click', 316),
+(4761, 'view', 458),
+(4762, 'buy', 985),
+(4763, 'scroll', 115),
+(4764, 'click', 165),
+(4765, 'view', 332),
+(4766, 'buy', 455),
+(4767, 'scroll', 479),
+(4768, 'click', 582),
+(4769, 'view', 371),
+(4770, 'buy', 296),
+(4771, 'scroll', 172),
+(4772, 'click', 570),
+(4773, 'view', 73),
+(4774, 'buy', 46),
+(4775, 'scroll', 11),
+(4776, 'click', 479),
+(4777, 'view', 768),
+(4778, 'buy', 497),
+(4779, 'scroll', 85),
+(4780, 'click', 765),
+(4781, 'view', 734),
+(4782, 'buy', 339),
+(4783, 'scroll', 756),
+(4784, 'click', 577),
+(4785, 'view', 270),
+(4786, 'buy', 111),
+(4787, 'scroll', 660),
+(4788, 'click', 500),
+(4789, 'view', 979),
+(4790, 'buy', 444),
+(4791, 'scroll', 500),
+(4792, 'click', 194),
+(4793, 'view', 802),
+(4794, 'buy', 556),
+(4795, 'scroll', 329),
+(4796, 'click', 8),
+(4797, 'view', 367),
+(4798, 'buy', 941),
+(4799, 'scroll', 93),
+(4800, 'click', 659),
+(4801, 'view', 292),
+(4802, 'buy', 642),
+(4803, 'scroll', 628),
+(4804, 'click', 957),
+(4805, 'view', 748),
+(4806, 'buy', 668),
+(4807, 'scroll', 716),
+(4808, 'click', 257),
+(4809, 'view', 668),
+(4810, 'buy', 251),
+(4811, 'scroll', 80),
+(4812, 'click', 141),
+(4813, 'view', 765),
+(4814, 'buy', 28),
+(4815, 'scroll', 25),
+(4816, 'click', 793),
+(4817, 'view', 404),
+(4818, 'buy', 859),
+(4819, 'scroll', 148),
+(4820, 'click', 303),
+(4821, 'view', 376),
+(4822, 'buy', 190),
+(4823, 'scroll', 985),
+(4824, 'click', 653),
+(4825, 'view', 538),
+(4826, 'buy', 866),
+(4827, 'scroll', 917),
+(4828, 'click', 948),
+(4829, 'view', 698),
+(4830, 'buy', 172),
+(4831, 'scroll', 104),
+(4832, 'click', 803),
+(4833, 'view', 736),
+(4834, 'buy', 850),
+(4835, 'scroll', 317),
+(4836, 'click', 760),
+(4837, 'view', 631),
+(4838, 'buy', 334),
+(4839, 'scroll', 388),
+(4840, 'click', 188),
+(4841, 'view', 662),
+(4842, 'buy', 845),
+(4843, 'scroll', 364),
+(4844, 'click', 327),
+(4845, 'view', 235),
+(4846, 'buy', 377),
+(4847, 'scroll', 139),
+(4848, 'click', 564),
+(4849, 'view', 941),
+(4850, 'buy', 378),
+(4851, 'scroll', 857),
+(4852, 'click', 851),
+(4853, 'view', 259),
+(4854, 'buy', 245),
+(4855, 'scroll', 59),
+(4856, 'click', 42),
+(4857, 'view', 109),
+(4858, 'buy', 580),
+(4859, 'scroll', 822),
+(4860, 'click', 643),
+(4861, 'view', 943),
+(4862, 'buy', 839),
+(4863, 'scroll', 722),
+(4864, 'click', 412),
+(4865, 'view', 926),
+(4866, 'buy', 51),
+(4867, 'scroll', 967),
+(4868, 'click', 221),
+(4869, 'view', 506),
+(4870, 'buy', 433),
+(4871, 'scroll', 511),
+(4872, 'click', 748),
+(4873, 'view', 161),
+(4874, 'buy', 306),
+(4875, 'scroll', 617),
+(4876, 'click', 595),
+(4877, 'view', 641),
+(4878, 'buy', 82),
+(4879, 'scroll', 145),
+(4880, 'click', 704),
+(4881, 'view', 232),
+(4882, 'buy', 167),
+(4883, 'scroll', 141),
+(4884, 'click', 453),
+(4885, 'view', 652),
+(4886, 'buy', 993),
+(4887, 'scroll', 411),
+(4888, 'click', 91),
+(4889, 'view', 40),
+(4890, 'buy', 871),
+(4891, 'scroll', 450),
+(4892, 'click', 490),
+(4893, 'view', 195),
+(4894, 'buy', 223),
+(4895, 'scroll', 740),
+(4896, 'click', 381),
+(4897, 'view', 2),
+(4898, 'buy', 32),
+(4899, 'scroll', 861),
+(4900, 'click', 625),
+(4901, 'view', 875),
+(4902, 'buy', 853),
+(4903, 'scroll', 805),
+(4904, 'click', 523),
+(4905, 'view', 435),
+(4906, 'buy', 146),
+(4907, 'scroll', 290),
+(4908, 'click', 73),
+(4909, 'view', 677),
+(4910, 'buy', 56),
+(4911, 'scroll', 526),
+(4912, 'click', 727),
+(4913, 'view', 431),
+(4914, 'buy', 911),
+(4915, 'scroll', 346),
+(4916, 'click', 64),
+(4917, 'view', 449),
+(4918, 'buy', 9),
+(4919, 'scroll', 682),
+(4920, 'click', 978),
+(4921, 'view', 845),
+(4922, 'buy', 180),
+(4923, 'scroll', 925),
+(4924, 'click', 742),
+(4925, 'view', 168),
+(4926, 'buy', 387),
+(4927, 'scroll', 302),
+(4928, 'click', 4),
+(4929, 'view', 453),
+(4930, 'buy', 823),
+(4931, 'scroll', 576),
+(4932, 'click', 691),
+(4933, 'view', 356),
+(4934, 'buy', 581),
+(4935, 'scroll', 200),
+(4936, 'click', 480),
+(4937, 'view', 87),
+(4938, 'buy', 555),
+(4939, 'scroll', 331),
+(4940, 'click', 529),
+(4941, 'view', 471),
+(4942, 'buy', 438),
+(4943, 'scroll', 994),
+(4944, 'click', 547),
+(4945, 'view', 930),
+(4946, 'buy', 640),
+(4947, 'scroll', 886),
+(4948, 'click', 158),
+(4949, 'view', 997),
+(4950, 'buy', 410),
+(4951, 'scroll', 984),
+(4952, 'click', 623),
+(4953, 'view', 634),
+(4954, 'buy', 83),
+(4955, 'scroll', 830),
+(4956, 'click', 829),
+(4957, 'view', 61),
+(4958, 'buy', 740),
+(4959, 'scroll', 692),
+(4960, 'click', 339),
+(4961, 'view', 623),
+(4962, 'buy', 674),
+(4963, 'scroll', 304),
+(4964, 'click', 578),
+(4965, 'view', 584),
+(4966, 'buy', 431),
+(4967, 'scroll', 975),
+(4968, 'click', 377),
+(4969, 'view', 492),
+(4970, 'buy', 672),
+(4971, 'scroll', 662),
+(4972, 'click', 140),
+(4973, 'view', 306),
+(4974, 'buy', 886),
+(4975, 'scroll', 351),
+(4976, 'click', 543),
+(4977, 'view', 906),
+(4978, 'buy', 648),
+(4979, 'scroll', 28),
+(4980, 'click', 868),
+(4981, 'view', 193),
+(4982, 'buy', 227),
+(4983, 'scroll', 694),
+(4984, 'click', 757),
+(4985, 'view', 458),
+(4986, 'buy', 707),
+(4987, 'scroll', 87),
+(4988, 'click', 150),
+(4989, 'view', 676),
+(4990, 'buy', 592),
+(4991, 'scroll', 380),
+(4992, 'click', 568),
+(4993, 'view', 594),
+(4994, 'buy', 965),
+(4995, 'scroll', 426),
+(4996, 'click', 368),
+(4997, 'view', 542),
+(4998, 'buy', 246),
+(4999, 'scroll', 578),
+(5000, 'click', 451),
+(5001, 'view', 405),
+(5002, 'buy', 267),
+(5003, 'scroll', 116),
+(5004, 'click', 232),
+(5005, 'view', 184),
+(5006, 'buy', 991),
+(5007, 'scroll', 911),
+(5008, 'click', 207),
+(5009, 'view', 561),
+(5010, 'buy', 767),
+(5011, 'scroll', 114),
+(5012, 'click', 226),
+(5013, 'view', 882),
+(5014, 'buy', 857),
+(5015, 'scroll', 259),
+(5016, 'click', 665),
+(5017, 'view', 97),
+(5018, 'buy', 192),
+(5019, 'scroll', 543),
+(5020, 'click', 686),
+(5021, 'view', 257),
+(5022, 'buy', 726),
+(5023, 'scroll', 501),
+(5024, 'click', 232),
+(5025, 'view', 567),
+(5026, 'buy', 469),
+(5027, 'scroll', 231),
+(5028, 'click', 554),
+(5029, 'view', 586),
+(5030, 'buy', 713),
+(5031, 'scroll', 115),
+(5032, 'click', 753),
+(5033, 'view', 525),
+(5034, 'buy', 931),
+(5035, 'scroll', 602),
+(5036, 'click', 580),
+(5037, 'view', 82),
+(5038, 'buy', 871),
+(5039, 'scroll', 417),
+(5040, 'click', 695),
+(5041, 'view', 75),
+(5042, 'buy', 819),
+(5043, 'scroll', 450),
+(5044, 'click', 137),
+(5045, 'view', 884),
+(5046, 'buy', 515),
+(5047, 'scroll', 563),
+(5048, 'click', 519),
+(5049, 'view', 731),
+(5050, 'buy', 858),
+(5051, 'scroll', 775),
+(5052, 'click', 970),
+(5053, 'view', 117),
+(5054, 'buy', 641),
+(5055, 'scroll', 983),
+(5056, 'click', 738),
+(5057, 'view', 527),
+(5058, 'buy', 104),
+(5059, 'scroll', 471),
+(5060, 'click', 850),
+(5061, 'view', 702),
+(5062, 'buy', 401),
+(5063, 'scroll', 557),
+(5064, 'click', 175),
+(5065, 'view', 991),
+(5066, 'buy', 983),
+(5067, 'scroll', 196),
+(5068, 'click', 576),
+(5069, 'view', 486),
+(5070, 'buy', 793),
+(5071, 'scroll', 95),
+(5072, 'click', 140),
+(5073, 'view', 382),
+(5074, 'buy', 794),
+(5075, 'scroll', 633),
+(5076, 'click', 58),
+(5077, 'view', 414),
+(5078, 'buy', 242),
+(5079, 'scroll', 48),
+(5080, 'click', 381),
+(5081, 'view', 42),
+(5082, 'buy', 15),
+(5083, 'scroll', 718),
+(5084, 'click', 608),
+(5085, 'view', 978),
+(5086, 'buy', 218),
+(5087, 'scroll', 470),
+(5088, 'click', 307),
+(5089, 'view', 123),
+(5090, 'buy', 724),
+(5091, 'scroll', 138),
+(5092, 'click', 436),
+(5093, 'view', 930),
+(5094, 'buy', 909),
+(5095, 'scroll', 89),
+(5096, 'click', 636),
+(5097, 'view', 893),
+(5098, 'buy', 206),
+(5099, 'scroll', 576),
+(5100, 'click', 117),
+(5101, 'view', 939),
+(5102, 'buy', 745),
+(5103, 'scroll', 891),
+(5104, 'click', 363),
+(5105, 'view', 172),
+(5106, 'buy', 375),
+(5107, 'scroll', 763),
+(5108, 'click', 861),
+(5109, 'view', 349),
+(5110, 'buy', 823),
+(5111, 'scroll', 781),
+(5112, 'click', 753),
+(5113, 'view', 696),
+(5114, 'buy', 11),
+(5115, 'scroll', 845),
+(5116, 'click', 261),
+(5117, 'view', 125),
+(5118, 'buy', 245),
+(5119, 'scroll', 381),
+(5120, 'click', 525),
+(5121, 'view', 754),
+(5122, 'buy', 537),
+(5123, 'scroll', 970),
+(5124, 'click', 365),
+(5125, 'view', 739),
+(5126, 'buy', 500),
+(5127, 'scroll', 44),
+(5128, 'click', 836),
+(5129, 'view', 618),
+(5130, 'buy', 361),
+(5131, 'scroll', 102),
+(5132, 'click', 364),
+(5133, 'view', 562),
+(5134, 'buy', 335),
+(5135, 'scroll', 822),
+(5136, 'click', 617),
+(5137, 'view', 115),
+(5138, 'buy', 34),
+(5139, 'scroll', 947),
+(5140, 'click', 932),
+(5141, 'view', 691),
+(5142, 'buy', 248),
+(5143, 'scroll', 260),
+(5144, 'click', 362),
+(5145, 'view', 197),
+(5146, 'buy', 710),
+(5147, 'scroll', 457),
+(5148, 'click', 21),
+(5149, 'view', 858),
+(5150, 'buy', 595),
+(5151, 'scroll', 450),
+(5152, 'click', 116),
+(5153, 'view', 810),
+(5154, 'buy', 21),
+(5155, 'scroll', 499),
+(5156, 'click', 113),
+(5157, 'view', 75),
+(5158, 'buy', 819),
+(5159, 'scroll', 264),
+(5160, 'click', 189),
+(5161, 'view', 153),
+(5162, 'buy', 567),
+(5163, 'scroll', 953),
+(5164, 'click', 296),
+(5165, 'view', 894),
+(5166, 'buy', 703),
+(5167, 'scroll', 685),
+(5168, 'click', 389),
+(5169, 'view', 856),
+(5170, 'buy', 147),
+(5171, 'scroll', 602),
+(5172, 'click', 896),
+(5173, 'view', 256),
+(5174, 'buy', 551),
+(5175, 'scroll', 706),
+(5176, 'click', 779),
+(5177, 'view', 827),
+(5178, 'buy', 275),
+(5179, 'scroll', 971),
+(5180, 'click', 454),
+(5181, 'view', 14),
+(5182, 'buy', 25),
+(5183, 'scroll', 350),
+(5184, 'click', 154),
+(5185, 'view', 498),
+(5186, 'buy', 513),
+(5187, 'scroll', 495),
+(5188, 'click', 894),
+(5189, 'view', 32),
+(5190, 'buy', 819),
+(5191, 'scroll', 857),
+(5192, 'click', 36),
+(5193, 'view', 76),
+(5194, 'buy', 186),
+(5195, 'scroll', 635),
+(5196, 'click', 837),
+(5197, 'view', 660),
+(5198, 'buy', 695),
+(5199, 'scroll', 614),
+(5200, 'click', 401),
+(5201, 'view', 863),
+(5202, 'buy', 487),
+(5203, 'scroll', 990),
+(5204, 'click', 162),
+(5205, 'view', 709),
+(5206, 'buy', 865),
+(5207, 'scroll', 459),
+(5208, 'click', 402),
+(5209, 'view', 234),
+(5210, 'buy', 893),
+(5211, 'scroll', 980),
+(5212, 'click', 625),
+(5213, 'view', 529),
+(5214, 'buy', 77),
+(5215, 'scroll', 369),
+(5216, 'click', 337),
+(5217, 'view', 540),
+(5218, 'buy', 221),
+(5219, 'scroll', 318),
+(5220, 'click', 915),
+(5221, 'view', 134),
+(5222, 'buy', 603),
+(5223, 'scroll', 639),
+(5224, 'click', 44),
+(5225, 'view', 216),
+(5226, 'buy', 173),
+(5227, 'scroll', 838),
+(5228, 'click', 369),
+(5229, 'view', 744),
+(5230, 'buy', 478),
+(5231, 'scroll', 339),
+(5232, 'click', 590),
+(5233, 'view', 479),
+(5234, 'buy', 397),
+(5235, 'scroll', 959),
+(5236, 'click', 362),
+(5237, 'view', 321),
+(5238, 'buy', 6),
+(5239, 'scroll', 343),
+(5240, 'click', 593),
+(5241, 'view', 495),
+(5242, 'buy', 341),
+(5243, 'scroll', 232),
+(5244, 'click', 21),
+(5245, 'view', 254),
+(5246, 'buy', 470),
+(5247, 'scroll', 897),
+(5248, 'click', 623),
+(5249, 'view', 46),
+(5250, 'buy', 646),
+(5251, 'scroll', 149),
+(5252, 'click', 744),
+(5253, 'view', 687),
+(5254, 'buy', 147),
+(5255, 'scroll', 279),
+(5256, 'click', 393),
+(5257, 'view', 279),
+(5258, 'buy', 65),
+(5259, 'scroll', 512),
+(5260, 'click', 268),
+(5261, 'view', 365),
+(5262, 'buy', 582),
+(5263, 'scroll', 587),
+(5264, 'click', 540),
+(5265, 'view', 598),
+(5266, 'buy', 979),
+(5267, 'scroll', 142),
+(5268, 'click', 715),
+(5269, 'view', 34),
+(5270, 'buy', 937),
+(5271, 'scroll', 574),
+(5272, 'click', 924),
+(5273, 'view', 789),
+(5274, 'buy', 97),
+(5275, 'scroll', 893),
+(5276, 'click', 204),
+(5277, 'view', 792),
+(5278, 'buy', 436),
+(5279, 'scroll', 648),
+(5280, 'click', 585),
+(5281, 'view', 649),
+(5282, 'buy', 101),
+(5283, 'scroll', 371),
+(5284, 'click', 810),
+(5285, 'view', 288),
+(5286, 'buy', 812),
+(5287, 'scroll', 814),
+(5288, 'click', 243),
+(5289, 'view', 893),
+(5290, 'buy', 815),
+(5291, 'scroll', 961),
+(5292, 'click', 144),
+(5293, 'view', 697),
+(5294, 'buy', 73),
+(5295, 'scroll', 311),
+(5296, 'click', 986),
+(5297, 'view', 781),
+(5298, 'buy', 349),
+(5299, 'scroll', 757),
+(5300, 'click', 371),
+(5301, 'view', 521),
+(5302, 'buy', 873),
+(5303, 'scroll', 650),
+(5304, 'click', 251),
+(5305, 'view', 358),
+(5306, 'buy', 893),
+(5307, 'scroll', 563),
+(5308, 'click', 732),
+(5309, 'view', 415),
+(5310, 'buy', 342),
+(5311, 'scroll', 61),
+(5312, 'click', 721),
+(5313, 'view', 345),
+(5314, 'buy', 687),
+(5315, 'scroll', 330),
+(5316, 'click', 904),
+(5317, 'view', 801),
+(5318, 'buy', 493),
+(5319, 'scroll', 515),
+(5320, 'click', 376),
+(5321, 'view', 915),
+(5322, 'buy', 249),
+(5323, 'scroll', 828),
+(5324, 'click', 240),
+(5325, 'view', 357),
+(5326, 'buy', 154),
+(5327, 'scroll', 138),
+(5328, 'click', 210),
+(5329, 'view', 7),
+(5330, 'buy', 910),
+(5331, 'scroll', 891),
+(5332, 'click', 687),
+(5333, 'view', 464),
+(5334, 'buy', 414),
+(5335, 'scroll', 456),
+(5336, 'click', 405),
+(5337, 'view', 582),
+(5338, 'buy', 790),
+(5339, 'scroll', 309),
+(5340, 'click', 951),
+(5341, 'view', 172),
+(5342, 'buy', 600),
+(5343, 'scroll', 67),
+(5344, 'click', 147),
+(5345, 'view', 308),
+(5346, 'buy', 737),
+(5347, 'scroll', 315),
+(5348, 'click', 258),
+(5349, 'view', 744),
+(5350, 'buy', 585),
+(5351, 'scroll', 564),
+(5352, 'click', 674),
+(5353, 'view', 959),
+(5354, 'buy', 988),
+(5355, 'scroll', 348),
+(5356, 'click', 75),
+(5357, 'view', 943),
+(5358, 'buy', 194),
+(5359, 'scroll', 597),
+(5360, 'click', 946),
+(5361, 'view', 81),
+(5362, 'buy', 598),
+(5363, 'scroll', 183),
+(5364, 'click', 311),
+(5365, 'view', 594),
+(5366, 'buy', 361),
+(5367, 'scroll', 479),
+(5368, 'click', 365),
+(5369, 'view', 993),
+(5370, 'buy', 793),
+(5371, 'scroll', 706),
+(5372, 'click', 438),
+(5373, 'view', 738),
+(5374, 'buy', 889),
+(5375, 'scroll', 944),
+(5376, 'click', 69),
+(5377, 'view', 858),
+(5378, 'buy', 496),
+(5379, 'scroll', 326),
+(5380, 'click', 920),
+(5381, 'view', 179),
+(5382, 'buy', 282),
+(5383, 'scroll', 919),
+(5384, 'click', 263),
+(5385, 'view', 559),
+(5386, 'buy', 23),
+(5387, 'scroll', 776),
+(5388, 'click', 168),
+(5389, 'view', 641),
+(5390, 'buy', 274),
+(5391, 'scroll', 242),
+(5392, 'click', 721),
+(5393, 'view', 20),
+(5394, 'buy', 223),
+(5395, 'scroll', 48),
+(5396, 'click', 409),
+(5397, 'view', 458),
+(5398, 'buy', 205),
+(5399, 'scroll', 914),
+(5400, 'click', 617),
+(5401, 'view', 289),
+(5402, 'buy', 884),
+(5403, 'scroll', 513),
+(5404, 'click', 663),
+(5405, 'view', 101),
+(5406, 'buy', 201),
+(5407, 'scroll', 247),
+(5408, 'click', 751),
+(5409, 'view', 58),
+(5410, 'buy', 986),
+(5411, 'scroll', 132),
+(5412, 'click', 615),
+(5413, 'view', 49),
+(5414, 'buy', 81),
+(5415, 'scroll', 75),
+(5416, 'click', 828),
+(5417, 'view', 835),
+(5418, 'buy', 896),
+(5419, 'scroll', 589),
+(5420, 'click', 349),
+(5421, 'view', 736),
+(5422, 'buy', 139),
+(5423, 'scroll', 5),
+(5424, 'click', 192),
+(5425, 'view', 277),
+(5426, 'buy', 549),
+(5427, 'scroll', 657),
+(5428, 'click', 896),
+(5429, 'view', 15),
+(5430, 'buy', 655),
+(5431, 'scroll', 330),
+(5432, 'click', 945),
+(5433, 'view', 28),
+(5434, 'buy', 217),
+(5435, 'scroll', 329),
+(5436, 'click', 334),
+(5437, 'view', 888),
+(5438, 'buy', 767),
+(5439, 'scroll', 27),
+(5440, 'click', 664),
+(5441, 'view', 497),
+(5442, 'buy', 415),
+(5443, 'scroll', 624),
+(5444, 'click', 695),
+(5445, 'view', 819),
+(5446, 'buy', 345),
+(5447, 'scroll', 178),
+(5448, 'click', 58),
+(5449, 'view', 884),
+(5450, 'buy', 424),
+(5451, 'scroll', 815),
+(5452, 'click', 46),
+(5453, 'view', 89),
+(5454, 'buy', 641),
+(5455, 'scroll', 627),
+(5456, 'click', 342),
+(5457, 'view', 794),
+(5458, 'buy', 506),
+(5459, 'scroll', 612),
+(5460, 'click', 409),
+(5461, 'view', 263),
+(5462, 'buy', 962),
+(5463, 'scroll', 474),
+(5464, 'click', 894),
+(5465, 'view', 13),
+(5466, 'buy', 26),
+(5467, 'scroll', 947),
+(5468, 'click', 324),
+(5469, 'view', 577),
+(5470, 'buy', 669),
+(5471, 'scroll', 320),
+(5472, 'click', 57),
+(5473, 'view', 425),
+(5474, 'buy', 628),
+(5475, 'scroll', 727),
+(5476, 'click', 741),
+(5477, 'view', 854),
+(5478, 'buy', 337),
+(5479, 'scroll', 160),
+(5480, 'click', 95),
+(5481, 'view', 19),
+(5482, 'buy', 159),
+(5483, 'scroll', 215),
+(5484, 'click', 146),
+(5485, 'view', 542),
+(5486, 'buy', 785),
+(5487, 'scroll', 860),
+(5488, 'click', 92),
+(5489, 'view', 366),
+(5490, 'buy', 833),
+(5491, 'scroll', 370),
+(5492, 'click', 433),
+(5493, 'view', 352),
+(5494, 'buy', 551),
+(5495, 'scroll', 696),
+(5496, 'click', 602),
+(5497, 'view', 886),
+(5498, 'buy', 568),
+(5499, 'scroll', 157),
+(5500, 'click', 673),
+(5501, 'view', 616),
+(5502, 'buy', 588),
+(5503, 'scroll', 338),
+(5504, 'click', 235),
+(5505, 'view', 758),
+(5506, 'buy', 633),
+(5507, 'scroll', 264),
+(5508, 'click', 832),
+(5509, 'view', 728),
+(5510, 'buy', 489),
+(5511, 'scroll', 781),
+(5512, 'click', 32),
+(5513, 'view', 794),
+(5514, 'buy', 662),
+(5515, 'scroll', 316),
+(5516, 'click', 667),
+(5517, 'view', 791),
+(5518, 'buy', 562),
+(5519, 'scroll', 723),
+(5520, 'click', 464),
+(5521, 'view', 572),
+(5522, 'buy', 284),
+(5523, 'scroll', 370),
+(5524, 'click', 535),
+(5525, 'view', 542),
+(5526, 'buy', 963),
+(5527, 'scroll', 280),
+(5528, 'click', 135),
+(5529, 'view', 258),
+(5530, 'buy', 9),
+(5531, 'scroll', 571),
+(5532, 'click', 487),
+(5533, 'view', 102),
+(5534, 'buy', 671),
+(5535, 'scroll', 828),
+(5536, 'click', 792),
+(5537, 'view', 371),
+(5538, 'buy', 154),
+(5539, 'scroll', 643),
+(5540, 'click', 233),
+(5541, 'view', 410),
+(5542, 'buy', 774),
+(5543, 'scroll', 92),
+(5544, 'click', 959),
+(5545, 'view', 28),
+(5546, 'buy', 639),
+(5547, 'scroll', 137),
+(5548, 'click', 125),
+(5549, 'view', 61),
+(5550, 'buy', 556),
+(5551, 'scroll', 513),
+(5552, 'click', 209),
+(5553, 'view', 568),
+(5554, 'buy', 796),
+(5555, 'scroll', 186),
+(5556, 'click', 265),
+(5557, 'view', 962),
+(5558, 'buy', 620),
+(5559, 'scroll', 374),
+(5560, 'click', 755),
+(5561, 'view', 152),
+(5562, 'buy', 924),
+(5563, 'scroll', 181),
+(5564, 'click', 891),
+(5565, 'view', 755),
+(5566, 'buy', 876),
+(5567, 'scroll', 943),
+(5568, 'click', 797),
+(5569, 'view', 165),
+(5570, 'buy', 541),
+(5571, 'scroll', 29),
+(5572, 'click', 359),
+(5573, 'view', 796),
+(5574, 'buy', 726),
+(5575, 'scroll', 248),
+(5576, 'click', 452),
+(5577, 'view', 880),
+(5578, 'buy', 510),
+(5579, 'scroll', 218),
+(5580, 'click', 651),
+(5581, 'view', 934),
+(5582, 'buy', 352),
+(5583, 'scroll', 922),
+(5584, 'click', 819),
+(5585, 'view', 398),
+(5586, 'buy', 471),
+(5587, 'scroll', 217),
+(5588, 'click', 331),
+(5589, 'view', 808),
+(5590, 'buy', 925),
+(5591, 'scroll', 27),
+(5592, 'click', 110),
+(5593, 'view', 675),
+(5594, 'buy', 750),
+(5595, 'scroll', 15),
+(5596, 'click', 67),
+(5597, 'view', 826),
+(5598, 'buy', 660),
+(5599, 'scroll', 935),
+(5600, 'click', 411),
+(5601, 'view', 690),
+(5602, 'buy', 884),
+(5603, 'scroll', 359),
+(5604, 'click', 61),
+(5605, 'view', 233),
+(5606, 'buy', 577),
+(5607, 'scroll', 385),
+(5608, 'click', 419),
+(5609, 'view', 928),
+(5610, 'buy', 941),
+(5611, 'scroll', 384),
+(5612, 'click', 967),
+(5613, 'view', 672),
+(5614, 'buy', 642),
+(5615, 'scroll', 880),
+(5616, 'click', 229),
+(5617, 'view', 31),
+(5618, 'buy', 257),
+(5619, 'scroll', 21),
+(5620, 'click', 268),
+(5621, 'view', 726),
+(5622, 'buy', 444),
+(5623, 'scroll', 247),
+(5624, 'click', 236),
+(5625, 'view', 362),
+(5626, 'buy', 208),
+(5627, 'scroll', 333),
+(5628, 'click', 777),
+(5629, 'view', 435),
+(5630, 'buy', 658),
+(5631, 'scroll', 285),
+(5632, 'click', 305),
+(5633, 'view', 900),
+(5634, 'buy', 510),
+(5635, 'scroll', 221),
+(5636, 'click', 583),
+(5637, 'view', 809),
+(5638, 'buy', 160),
+(5639, 'scroll', 488),
+(5640, 'click', 883),
+(5641, 'view', 956),
+(5642, 'buy', 890),
+(5643, 'scroll', 787),
+(5644, 'click', 273),
+(5645, 'view', 977),
+(5646, 'buy', 769),
+(5647, 'scroll', 139),
+(5648, 'click', 842),
+(5649, 'view', 307),
+(5650, 'buy', 289),
+(5651, 'scroll', 90),
+(5652, 'click', 339),
+(5653, 'view', 4),
+(5654, 'buy', 497),
+(5655, 'scroll', 893),
+(5656, 'click', 912),
+(5657, 'view', 255),
+(5658, 'buy', 165),
+(5659, 'scroll', 327),
+(5660, 'click', 699),
+(5661, 'view', 624),
+(5662, 'buy', 611),
+(5663, 'scroll', 979),
+(5664, 'click', 463),
+(5665, 'view', 217),
+(5666, 'buy', 593),
+(5667, 'scroll', 53),
+(5668, 'click', 904),
+(5669, 'view', 800),
+(5670, 'buy', 214),
+(5671, 'scroll', 871),
+(5672, 'click', 904),
+(5673, 'view', 753),
+(5674, 'buy', 369),
+(5675, 'scroll', 47),
+(5676, 'click', 798),
+(5677, 'view', 792),
+(5678, 'buy', 884),
+(5679, 'scroll', 449),
+(5680, 'click', 186),
+(5681, 'view', 445),
+(5682, 'buy', 884),
+(5683, 'scroll', 143),
+(5684, 'click', 958),
+(5685, 'view', 304),
+(5686, 'buy', 701),
+(5687, 'scroll', 25),
+(5688, 'click', 824),
+(5689, 'view', 114),
+(5690, 'buy', 155),
+(5691, 'scroll', 997),
+(5692, 'click', 934),
+(5693, 'view', 9),
+(5694, 'buy', 136),
+(5695, 'scroll', 933),
+(5696, 'click', 309),
+(5697, 'view', 154),
+(5698, 'buy', 514),
+(5699, 'scroll', 753),
+(5700, 'click', 360),
+(5701, 'view', 99),
+(5702, 'buy', 769),
+(5703, 'scroll', 172),
+(5704, 'click', 475),
+(5705, 'view', 699),
+(5706, 'buy', 406),
+(5707, 'scroll', 92),
+(5708, 'click', 424),
+(5709, 'view', 347),
+(5710, 'buy', 657),
+(5711, 'scroll', 940),
+(5712, 'click', 681),
+(5713, 'view', 733),
+(5714, 'buy', 406),
+(5715, 'scroll', 903),
+(5716, 'click', 343),
+(5717, 'view', 916),
+(5718, 'buy', 33),
+(5719, 'scroll', 599),
+(5720, 'click', 240),
+(5721, 'view', 206),
+(5722, 'buy', 811),
+(5723, 'scroll', 642),
+(5724, 'click', 706),
+(5725, 'view', 15),
+(5726, 'buy', 38),
+(5727, 'scroll', 138),
+(5728, 'click', 516),
+(5729, 'view', 609),
+(5730, 'buy', 237),
+(5731, 'scroll', 588),
+(5732, 'click', 440),
+(5733, 'view', 715),
+(5734, 'buy', 107),
+(5735, 'scroll', 745),
+(5736, 'click', 20),
+(5737, 'view', 49),
+(5738, 'buy', 915),
+(5739, 'scroll', 324),
+(5740, 'click', 66),
+(5741, 'view', 899),
+(5742, 'buy', 112),
+(5743, 'scroll', 123),
+(5744, 'click', 980),
+(5745, 'view', 499),
+(5746, 'buy', 993),
+(5747, 'scroll', 139),
+(5748, 'click', 538),
+(5749, 'view', 438),
+(5750, 'buy', 2),
+(5751, 'scroll', 183),
+(5752, 'click', 229),
+(5753, 'view', 701),
+(5754, 'buy', 553),
+(5755, 'scroll', 151),
+(5756, 'click', 648),
+(5757, 'view', 755),
+(5758, 'buy', 558),
+(5759, 'scroll', 512),
+(5760, 'click', 115),
+(5761, 'view', 542),
+(5762, 'buy', 362),
+(5763, 'scroll', 859),
+(5764, 'click', 508),
+(5765, 'view', 980),
+(5766, 'buy', 940),
+(5767, 'scroll', 79),
+(5768, 'click', 357),
+(5769, 'view', 993),
+(5770, 'buy', 220),
+(5771, 'scroll', 873),
+(5772, 'click', 990),
+(5773, 'view', 995),
+(5774, 'buy', 904),
+(5775, 'scroll', 229),
+(5776, 'click', 748),
+(5777, 'view', 74),
+(5778, 'buy', 279),
+(5779, 'scroll', 720),
+(5780, 'click', 181),
+(5781, 'view', 15),
+(5782, 'buy', 270),
+(5783, 'scroll', 275),
+(5784, 'click', 70),
+(5785, 'view', 989),
+(5786, 'buy', 44),
+(5787, 'scroll', 201),
+(5788, 'click', 520),
+(5789, 'view', 49),
+(5790, 'buy', 417),
+(5791, 'scroll', 808),
+(5792, 'click', 569),
+(5793, 'view', 974),
+(5794, 'buy', 371),
+(5795, 'scroll', 273),
+(5796, 'click', 10),
+(5797, 'view', 333),
+(5798, 'buy', 704),
+(5799, 'scroll', 42),
+(5800, 'click', 668),
+(5801, 'view', 464),
+(5802, 'buy', 557),
+(5803, 'scroll', 288),
+(5804, 'click', 561),
+(5805, 'view', 338),
+(5806, 'buy', 706),
+(5807, 'scroll', 420),
+(5808, 'click', 895),
+(5809, 'view', 763),
+(5810, 'buy', 734),
+(5811, 'scroll', 275),
+(5812, 'click', 408),
+(5813, 'view', 432),
+(5814, 'buy', 325),
+(5815, 'scroll', 552),
+(5816, 'click', 429),
+(5817, 'view', 392),
+(5818, 'buy', 996),
+(5819, 'scroll', 154),
+(5820, 'click', 396),
+(5821, 'view', 779),
+(5822, 'buy', 394),
+(5823, 'scroll', 902),
+(5824, 'click', 419),
+(5825, 'view', 823),
+(5826, 'buy', 146),
+(5827, 'scroll', 919),
+(5828, 'click', 650),
+(5829, 'view', 5),
+(5830, 'buy', 244),
+(5831, 'scroll', 622),
+(5832, 'click', 513),
+(5833, 'view', 948),
+(5834, 'buy', 260),
+(5835, 'scroll', 710),
+(5836, 'click', 625),
+(5837, 'view', 747),
+(5838, 'buy', 386),
+(5839, 'scroll', 246),
+(5840, 'click', 845),
+(5841, 'view', 203),
+(5842, 'buy', 679),
+(5843, 'scroll', 118),
+(5844, 'click', 88),
+(5845, 'view', 863),
+(5846, 'buy', 635),
+(5847, 'scroll', 802),
+(5848, 'click', 34),
+(5849, 'view', 930),
+(5850, 'buy', 733),
+(5851, 'scroll', 50),
+(5852, 'click', 415),
+(5853, 'view', 710),
+(5854, 'buy', 571),
+(5855, 'scroll', 332),
+(5856, 'click', 701),
+(5857, 'view', 661),
+(5858, 'buy', 453),
+(5859, 'scroll', 562),
+(5860, 'click', 684),
+(5861, 'view', 323),
+(5862, 'buy', 466),
+(5863, 'scroll', 994),
+(5864, 'click', 591),
+(5865, 'view', 0),
+(5866, 'buy', 484),
+(5867, 'scroll', 764),
+(5868, 'click', 662),
+(5869, 'view', 873),
+(5870, 'buy', 481),
+(5871, 'scroll', 522),
+(5872, 'click', 350),
+(5873, 'view', 606),
+(5874, 'buy', 559),
+(5875, 'scroll', 389),
+(5876, 'click', 240),
+(5877, 'view', 844),
+(5878, 'buy', 644),
+(5879, 'scroll', 810),
+(5880, 'click', 761),
+(5881, 'view', 890),
+(5882, 'buy', 387),
+(5883, 'scroll', 363),
+(5884, 'click', 729),
+(5885, 'view', 65),
+(5886, 'buy', 402),
+(5887, 'scroll', 999),
+(5888, 'click', 538),
+(5889, 'view', 272),
+(5890, 'buy', 627),
+(5891, 'scroll', 675),
+(5892, 'click', 693),
+(5893, 'view', 846),
+(5894, 'buy', 329),
+(5895, 'scroll', 73),
+(5896, 'click', 643),
+(5897, 'view', 816),
+(5898, 'buy', 556),
+(5899, 'scroll', 680),
+(5900, 'click', 228),
+(5901, 'view', 946),
+(5902, 'buy', 627),
+(5903, 'scroll', 783),
+(5904, 'click', 271),
+(5905, 'view', 268),
+(5906, 'buy', 930),
+(5907, 'scroll', 861),
+(5908, 'click', 484),
+(5909, 'view', 878),
+(5910, 'buy', 738),
+(5911, 'scroll', 356),
+(5912, 'click', 534),
+(5913, 'view', 603),
+(5914, 'buy', 488),
+(5915, 'scroll', 584),
+(5916, 'click', 226),
+(5917, 'view', 145),
+(5918, 'buy', 67),
+(5919, 'scroll', 949),
+(5920, 'click', 775),
+(5921, 'view', 541),
+(5922, 'buy', 372),
+(5923, 'scroll', 536),
+(5924, 'click', 209),
+(5925, 'view', 540),
+(5926, 'buy', 173),
+(5927, 'scroll', 832),
+(5928, 'click', 374),
+(5929, 'view', 244),
+(5930, 'buy', 689),
+(5931, 'scroll', 176),
+(5932, 'click', 156),
+(5933, 'view', 841),
+(5934, 'buy', 677),
+(5935, 'scroll', 471),
+(5936, 'click', 181),
+(5937, 'view', 655),
+(5938, 'buy', 970),
+(5939, 'scroll', 847),
+(5940, 'click', 876),
+(5941, 'view', 915),
+(5942, 'buy', 667),
+(5943, 'scroll', 888),
+(5944, 'click', 932),
+(5945, 'view', 44),
+(5946, 'buy', 329),
+(5947, 'scroll', 390),
+(5948, 'click', 370),
+(5949, 'view', 852),
+(5950, 'buy', 884),
+(5951, 'scroll', 837),
+(5952, 'click', 438),
+(5953, 'view', 125),
+(5954, 'buy', 419),
+(5955, 'scroll', 157),
+(5956, 'click', 719),
+(5957, 'view', 257),
+(5958, 'buy', 384),
+(5959, 'scroll', 105),
+(5960, 'click', 373),
+(5961, 'view', 365),
+(5962, 'buy', 678),
+(5963, 'scroll', 822),
+(5964, 'click', 535),
+(5965, 'view', 533),
+(5966, 'buy', 309),
+(5967, 'scroll', 463),
+(5968, 'click', 678),
+(5969, 'view', 90),
+(5970, 'buy', 281),
+(5971, 'scroll', 405),
+(5972, 'click', 297),
+(5973, 'view', 456),
+(5974, 'buy', 711),
+(5975, 'scroll', 114),
+(5976, 'click', 460),
+(5977, 'view', 649),
+(5978, 'buy', 489),
+(5979, 'scroll', 748),
+(5980, 'click', 817),
+(5981, 'view', 178),
+(5982, 'buy', 777),
+(5983, 'scroll', 529),
+(5984, 'click', 153),
+(5985, 'view', 6),
+(5986, 'buy', 696),
+(5987, 'scroll', 133),
+(5988, 'click', 375),
+(5989, 'view', 500),
+(5990, 'buy', 533),
+(5991, 'scroll', 676),
+(5992, 'click', 243),
+(5993, 'view', 637),
+(5994, 'buy', 379),
+(5995, 'scroll', 535),
+(5996, 'click', 348),
+(5997, 'view', 820),
+(5998, 'buy', 390),
+(5999, 'scroll', 258),
+(6000, 'click', 18),
+(6001, 'view', 569),
+(6002, 'buy', 205),
+(6003, 'scroll', 0),
+(6004, 'click', 584),
+(6005, 'view', 265),
+(6006, 'buy', 59),
+(6007, 'scroll', 604),
+(6008, 'click', 182),
+(6009, 'view', 313),
+(6010, 'buy', 735),
+(6011, 'scroll', 557),
+(6012, 'click', 281),
+(6013, 'view', 938),
+(6014, 'buy', 331),
+(6015, 'scroll', 261),
+(6016, 'click', 247),
+(6017, 'view', 271),
+(6018, 'buy', 854),
+(6019, 'scroll', 448),
+(6020, 'click', 93),
+(6021, 'view', 537),
+(6022, 'buy', 651),
+(6023, 'scroll', 505),
+(6024, 'click', 879),
+(6025, 'view', 90),
+(6026, 'buy', 206),
+(6027, 'scroll', 131),
+(6028, 'click', 433),
+(6029, 'view', 981),
+(6030, 'buy', 811),
+(6031, 'scroll', 297),
+(6032, 'click', 632),
+(6033, 'view', 799),
+(6034, 'buy', 380),
+(6035, 'scroll', 942),
+(6036, 'click', 44),
+(6037, 'view', 734),
+(6038, 'buy', 453),
+(6039, 'scroll', 384),
+(6040, 'click', 375),
+(6041, 'view', 42),
+(6042, 'buy', 729),
+(6043, 'scroll', 771),
+(6044, 'click', 302),
+(6045, 'view', 993),
+(6046, 'buy', 417),
+(6047, 'scroll', 441),
+(6048, 'click', 663),
+(6049, 'view', 622),
+(6050, 'buy', 830),
+(6051, 'scroll', 262),
+(6052, 'click', 360),
+(6053, 'view', 244),
+(6054, 'buy', 394),
+(6055, 'scroll', 870),
+(6056, 'click', 592),
+(6057, 'view', 132),
+(6058, 'buy', 947),
+(6059, 'scroll', 633),
+(6060, 'click', 196),
+(6061, 'view', 994),
+(6062, 'buy', 872),
+(6063, 'scroll', 728),
+(6064, 'click', 594),
+(6065, 'view', 381),
+(6066, 'buy', 64),
+(6067, 'scroll', 681),
+(6068, 'click', 208),
+(6069, 'view', 337),
+(6070, 'buy', 880),
+(6071, 'scroll', 72),
+(6072, 'click', 81),
+(6073, 'view', 774),
+(6074, 'buy', 456),
+(6075, 'scroll', 388),
+(6076, 'click', 402),
+(6077, 'view', 538),
+(6078, 'buy', 424),
+(6079, 'scroll', 508),
+(6080, 'click', 958),
+(6081, 'view', 922),
+(6082, 'buy', 658),
+(6083, 'scroll', 775),
+(6084, 'click', 810),
+(6085, 'view', 26),
+(6086, 'buy', 110),
+(6087, 'scroll', 607),
+(6088, 'click', 577),
+(6089, 'view', 473),
+(6090, 'buy', 957),
+(6091, 'scroll', 473),
+(6092, 'click', 717),
+(6093, 'view', 859),
+(6094, 'buy', 446),
+(6095, 'scroll', 424),
+(6096, 'click', 484),
+(6097, 'view', 180),
+(6098, 'buy', 911),
+(6099, 'scroll', 66),
+(6100, 'click', 450),
+(6101, 'view', 407),
+(6102, 'buy', 503),
+(6103, 'scroll', 138),
+(6104, 'click', 524),
+(6105, 'view', 770),
+(6106, 'buy', 844),
+(6107, 'scroll', 9),
+(6108, 'click', 686),
+(6109, 'view', 237),
+(6110, 'buy', 758),
+(6111, 'scroll', 205),
+(6112, 'click', 411),
+(6113, 'view', 554),
+(6114, 'buy', 41),
+(6115, 'scroll', 947),
+(6116, 'click', 696),
+(6117, 'view', 301),
+(6118, 'buy', 567),
+(6119, 'scroll', 338),
+(6120, 'click', 787),
+(6121, 'view', 396),
+(6122, 'buy', 788),
+(6123, 'scroll', 470),
+(6124, 'click', 120),
+(6125, 'view', 92),
+(6126, 'buy', 226),
+(6127, 'scroll', 868),
+(6128, 'click', 78),
+(6129, 'view', 584),
+(6130, 'buy', 837),
+(6131, 'scroll', 15),
+(6132, 'click', 104),
+(6133, 'view', 508),
+(6134, 'buy', 90),
+(6135, 'scroll', 868),
+(6136, 'click', 771),
+(6137, 'view', 220),
+(6138, 'buy', 577),
+(6139, 'scroll', 465),
+(6140, 'click', 56),
+(6141, 'view', 843),
+(6142, 'buy', 697),
+(6143, 'scroll', 204),
+(6144, 'click', 728),
+(6145, 'view', 343),
+(6146, 'buy', 494),
+(6147, 'scroll', 883),
+(6148, 'click', 56),
+(6149, 'view', 563),
+(6150, 'buy', 707),
+(6151, 'scroll', 765),
+(6152, 'click', 427),
+(6153, 'view', 863),
+(6154, 'buy', 597),
+(6155, 'scroll', 143),
+(6156, 'click', 416),
+(6157, 'view', 836),
+(6158, 'buy', 51),
+(6159, 'scroll', 892),
+(6160, 'click', 641),
+(6161, 'view', 149),
+(6162, 'buy', 328),
+(6163, 'scroll', 342),
+(6164, 'click', 194),
+(6165, 'view', 530),
+(6166, 'buy', 6),
+(6167, 'scroll', 190),
+(6168, 'click', 551),
+(6169, 'view', 281),
+(6170, 'buy', 532),
+(6171, 'scroll', 268),
+(6172, 'click', 88),
+(6173, 'view', 320),
+(6174, 'buy', 392),
+(6175, 'scroll', 261),
+(6176, 'click', 679),
+(6177, 'view', 879),
+(6178, 'buy', 305),
+(6179, 'scroll', 569),
+(6180, 'click', 404),
+(6181, 'view', 523),
+(6182, 'buy', 907),
+(6183, 'scroll', 430),
+(6184, 'click', 697),
+(6185, 'view', 52),
+(6186, 'buy', 314),
+(6187, 'scroll', 311),
+(6188, 'click', 254),
+(6189, 'view', 887),
+(6190, 'buy', 389),
+(6191, 'scroll', 821),
+(6192, 'click', 446),
+(6193, 'view', 877),
+(6194, 'buy', 552),
+(6195, 'scroll', 263),
+(6196, 'click', 312),
+(6197, 'view', 206),
+(6198, 'buy', 134),
+(6199, 'scroll', 53),
+(6200, 'click', 212),
+(6201, 'view', 549),
+(6202, 'buy', 667),
+(6203, 'scroll', 382),
+(6204, 'click', 954),
+(6205, 'view', 475),
+(6206, 'buy', 672),
+(6207, 'scroll', 500),
+(6208, 'click', 726),
+(6209, 'view', 597),
+(6210, 'buy', 144),
+(6211, 'scroll', 374),
+(6212, 'click', 952),
+(6213, 'view', 820),
+(6214, 'buy', 349),
+(6215, 'scroll', 205),
+(6216, 'click', 467),
+(6217, 'view', 941),
+(6218, 'buy', 723),
+(6219, 'scroll', 569),
+(6220, 'click', 679),
+(6221, 'view', 52),
+(6222, 'buy', 746),
+(6223, 'scroll', 321),
+(6224, 'click', 8),
+(6225, 'view', 545),
+(6226, 'buy', 69),
+(6227, 'scroll', 418),
+(6228, 'click', 974),
+(6229, 'view', 578),
+(6230, 'buy', 843),
+(6231, 'scroll', 331),
+(6232, 'click', 36),
+(6233, 'view', 280),
+(6234, 'buy', 224),
+(6235, 'scroll', 815),
+(6236, 'click', 449),
+(6237, 'view', 298),
+(6238, 'buy', 205),
+(6239, 'scroll', 727),
+(6240, 'click', 214),
+(6241, 'view', 821),
+(6242, 'buy', 996),
+(6243, 'scroll', 606),
+(6244, 'click', 625),
+(6245, 'view', 465),
+(6246, 'buy', 415),
+(6247, 'scroll', 957),
+(6248, 'click', 745),
+(6249, 'view', 455),
+(6250, 'buy', 208),
+(6251, 'scroll', 899),
+(6252, 'click', 208),
+(6253, 'view', 59),
+(6254, 'buy', 184),
+(6255, 'scroll', 444),
+(6256, 'click', 878),
+(6257, 'view', 654),
+(6258, 'buy', 127),
+(6259, 'scroll', 50),
+(6260, 'click', 140),
+(6261, 'view', 883),
+(6262, 'buy', 901),
+(6263, 'scroll', 73),
+(6264, 'click', 833),
+(6265, 'view', 610),
+(6266, 'buy', 509),
+(6267, 'scroll', 184),
+(6268, 'click', 14),
+(6269, 'view', 944),
+(6270, 'buy', 738),
+(6271, 'scroll', 574),
+(6272, 'click', 754),
+(6273, 'view', 819),
+(6274, 'buy', 168),
+(6275, 'scroll', 510),
+(6276, 'click', 226),
+(6277, 'view', 690),
+(6278, 'buy', 737),
+(6279, 'scroll', 691),
+(6280, 'click', 766),
+(6281, 'view', 301),
+(6282, 'buy', 821),
+(6283, 'scroll', 216),
+(6284, 'click', 547),
+(6285, 'view', 858),
+(6286, 'buy', 162),
+(6287, 'scroll', 149),
+(6288, 'click', 796),
+(6289, 'view', 939),
+(6290, 'buy', 732),
+(6291, 'scroll', 211),
+(6292, 'click', 528),
+(6293, 'view', 103),
+(6294, 'buy', 476),
+(6295, 'scroll', 97),
+(6296, 'click', 206),
+(6297, 'view', 803),
+(6298, 'buy', 93),
+(6299, 'scroll', 973),
+(6300, 'click', 51),
+(6301, 'view', 424),
+(6302, 'buy', 229),
+(6303, 'scroll', 674),
+(6304, 'click', 853),
+(6305, 'view', 263),
+(6306, 'buy', 723),
+(6307, 'scroll', 927),
+(6308, 'click', 453),
+(6309, 'view', 702),
+(6310, 'buy', 434),
+(6311, 'scroll', 158),
+(6312, 'click', 889),
+(6313, 'view', 58),
+(6314, 'buy', 946),
+(6315, 'scroll', 712),
+(6316, 'click', 136),
+(6317, 'view', 42),
+(6318, 'buy', 163),
+(6319, 'scroll', 856),
+(6320, 'click', 457),
+(6321, 'view', 300),
+(6322, 'buy', 776),
+(6323, 'scroll', 238),
+(6324, 'click', 895),
+(6325, 'view', 596),
+(6326, 'buy', 816),
+(6327, 'scroll', 326),
+(6328, 'click', 723),
+(6329, 'view', 574),
+(6330, 'buy', 736),
+(6331, 'scroll', 157),
+(6332, 'click', 316),
+(6333, 'view', 933),
+(6334, 'buy', 264),
+(6335, 'scroll', 332),
+(6336, 'click', 561),
+(6337, 'view', 861),
+(6338, 'buy', 219),
+(6339, 'scroll', 155),
+(6340, 'click', 968),
+(6341, 'view', 818),
+(6342, 'buy', 681),
+(6343, 'scroll', 236),
+(6344, 'click', 400),
+(6345, 'view', 997),
+(6346, 'buy', 33),
+(6347, 'scroll', 335),
+(6348, 'click', 389),
+(6349, 'view', 159),
+(6350, 'buy', 656),
+(6351, 'scroll', 298),
+(6352, 'click', 228),
+(6353, 'view', 670),
+(6354, 'buy', 558),
+(6355, 'scroll', 710),
+(6356, 'click', 95),
+(6357, 'view', 202),
+(6358, 'buy', 475),
+(6359, 'scroll', 152),
+(6360, 'click', 745),
+(6361, 'view', 188),
+(6362, 'buy', 440),
+(6363, 'scroll', 341),
+(6364, 'click', 695),
+(6365, 'view', 411),
+(6366, 'buy', 117),
+(6367, 'scroll', 39),
+(6368, 'click', 848),
+(6369, 'view', 360),
+(6370, 'buy', 125),
+(6371, 'scroll', 673),
+(6372, 'click', 945),
+(6373, 'view', 215),
+(6374, 'buy', 671),
+(6375, 'scroll', 961),
+(6376, 'click', 536),
+(6377, 'view', 538),
+(6378, 'buy', 74),
+(6379, 'scroll', 297),
+(6380, 'click', 501),
+(6381, 'view', 356),
+(6382, 'buy', 18),
+(6383, 'scroll', 768),
+(6384, 'click', 800),
+(6385, 'view', 508),
+(6386, 'buy', 910),
+(6387, 'scroll', 952),
+(6388, 'click', 934),
+(6389, 'view', 95),
+(6390, 'buy', 205),
+(6391, 'scroll', 496),
+(6392, 'click', 286),
+(6393, 'view', 884),
+(6394, 'buy', 310),
+(6395, 'scroll', 612),
+(6396, 'click', 597),
+(6397, 'view', 553),
+(6398, 'buy', 774),
+(6399, 'scroll', 90),
+(6400, 'click', 206),
+(6401, 'view', 143),
+(6402, 'buy', 481),
+(6403, 'scroll', 277),
+(6404, 'click', 786),
+(6405, 'view', 914),
+(6406, 'buy', 783),
+(6407, 'scroll', 865),
+(6408, 'click', 925),
+(6409, 'view', 232),
+(6410, 'buy', 592),
+(6411, 'scroll', 946),
+(6412, 'click', 307),
+(6413, 'view', 33),
+(6414, 'buy', 594),
+(6415, 'scroll', 613),
+(6416, 'click', 103),
+(6417, 'view', 990),
+(6418, 'buy', 1),
+(6419, 'scroll', 352),
+(6420, 'click', 199),
+(6421, 'view', 967),
+(6422, 'buy', 155),
+(6423, 'scroll', 672),
+(6424, 'click', 307),
+(6425, 'view', 51),
+(6426, 'buy', 176),
+(6427, 'scroll', 341),
+(6428, 'click', 358),
+(6429, 'view', 460),
+(6430, 'buy', 492),
+(6431, 'scroll', 253),
+(6432, 'click', 337),
+(6433, 'view', 760),
+(6434, 'buy', 372),
+(6435, 'scroll', 183),
+(6436, 'click', 112),
+(6437, 'view', 806),
+(6438, 'buy', 851),
+(6439, 'scroll', 305),
+(6440, 'click', 828),
+(6441, 'view', 71),
+(6442, 'buy', 741),
+(6443, 'scroll', 572),
+(6444, 'click', 465),
+(6445, 'view', 97),
+(6446, 'buy', 764),
+(6447, 'scroll', 564),
+(6448, 'click', 115),
+(6449, 'view', 806),
+(6450, 'buy', 165),
+(6451, 'scroll', 609),
+(6452, 'click', 402),
+(6453, 'view', 472),
+(6454, 'buy', 36),
+(6455, 'scroll', 34),
+(6456, 'click', 40),
+(6457, 'view', 525),
+(6458, 'buy', 593),
+(6459, 'scroll', 99),
+(6460, 'click', 422),
+(6461, 'view', 662),
+(6462, 'buy', 713),
+(6463, 'scroll', 135),
+(6464, 'click', 425),
+(6465, 'view', 591),
+(6466, 'buy', 857),
+(6467, 'scroll', 361),
+(6468, 'click', 78),
+(6469, 'view', 383),
+(6470, 'buy', 745),
+(6471, 'scroll', 679),
+(6472, 'click', 751),
+(6473, 'view', 167),
+(6474, 'buy', 368),
+(6475, 'scroll', 173),
+(6476, 'click', 678),
+(6477, 'view', 964),
+(6478, 'buy', 92),
+(6479, 'scroll', 339),
+(6480, 'click', 5),
+(6481, 'view', 862),
+(6482, 'buy', 660),
+(6483, 'scroll', 894),
+(6484, 'click', 856),
+(6485, 'view', 491),
+(6486, 'buy', 310),
+(6487, 'scroll', 152),
+(6488, 'click', 267),
+(6489, 'view', 96),
+(6490, 'buy', 109),
+(6491, 'scroll', 900),
+(6492, 'click', 244),
+(6493, 'view', 119),
+(6494, 'buy', 156),
+(6495, 'scroll', 508),
+(6496, 'click', 276),
+(6497, 'view', 548),
+(6498, 'buy', 554),
+(6499, 'scroll', 120),
+(6500, 'click', 332),
+(6501, 'view', 479),
+(6502, 'buy', 251),
+(6503, 'scroll', 167),
+(6504, 'click', 582),
+(6505, 'view', 548),
+(6506, 'buy', 43),
+(6507, 'scroll', 518),
+(6508, 'click', 262),
+(6509, 'view', 375),
+(6510, 'buy', 972),
+(6511, 'scroll', 202),
+(6512, 'click', 290),
+(6513, 'view', 413),
+(6514, 'buy', 568),
+(6515, 'scroll', 208),
+(6516, 'click', 130),
+(6517, 'view', 930),
+(6518, 'buy', 245),
+(6519, 'scroll', 744),
+(6520, 'click', 892),
+(6521, 'view', 547),
+(6522, 'buy', 513),
+(6523, 'scroll', 245),
+(6524, 'click', 911),
+(6525, 'view', 97),
+(6526, 'buy', 15),
+(6527, 'scroll', 108),
+(6528, 'click', 965),
+(6529, 'view', 54),
+(6530, 'buy', 500),
+(6531, 'scroll', 810),
+(6532, 'click', 810),
+(6533, 'view', 718),
+(6534, 'buy', 584),
+(6535, 'scroll', 215),
+(6536, 'click', 705),
+(6537, 'view', 761),
+(6538, 'buy', 234),
+(6539, 'scroll', 89),
+(6540, 'click', 768),
+(6541, 'view', 175),
+(6542, 'buy', 157),
+(6543, 'scroll', 861),
+(6544, 'click', 270),
+(6545, 'view', 31),
+(6546, 'buy', 434),
+(6547, 'scroll', 402),
+(6548, 'click', 639),
+(6549, 'view', 530),
+(6550, 'buy', 112),
+(6551, 'scroll', 298),
+(6552, 'click', 583),
+(6553, 'view', 911),
+(6554, 'buy', 123),
+(6555, 'scroll', 86),
+(6556, 'click', 679),
+(6557, 'view', 592),
+(6558, 'buy', 222),
+(6559, 'scroll', 239),
+(6560, 'click', 249),
+(6561, 'view', 609),
+(6562, 'buy', 793),
+(6563, 'scroll', 802),
+(6564, 'click', 525),
+(6565, 'view', 727),
+(6566, 'buy', 838),
+(6567, 'scroll', 63),
+(6568, 'click', 841),
+(6569, 'view', 251),
+(6570, 'buy', 74),
+(6571, 'scroll', 613),
+(6572, 'click', 345),
+(6573, 'view', 100),
+(6574, 'buy', 42),
+(6575, 'scroll', 220),
+(6576, 'click', 633),
+(6577, 'view', 791),
+(6578, 'buy', 708),
+(6579, 'scroll', 178),
+(6580, 'click', 834),
+(6581, 'view', 310),
+(6582, 'buy', 350),
+(6583, 'scroll', 86),
+(6584, 'click', 830),
+(6585, 'view', 777),
+(6586, 'buy', 472),
+(6587, 'scroll', 606),
+(6588, 'click', 942),
+(6589, 'view', 187),
+(6590, 'buy', 11),
+(6591, 'scroll', 325),
+(6592, 'click', 962),
+(6593, 'view', 953),
+(6594, 'buy', 421),
+(6595, 'scroll', 805),
+(6596, 'click', 416),
+(6597, 'view', 33),
+(6598, 'buy', 90),
+(6599, 'scroll', 807),
+(6600, 'click', 250),
+(6601, 'view', 151),
+(6602, 'buy', 751),
+(6603, 'scroll', 523),
+(6604, 'click', 695),
+(6605, 'view', 171),
+(6606, 'buy', 154),
+(6607, 'scroll', 816),
+(6608, 'click', 352),
+(6609, 'view', 788),
+(6610, 'buy', 143),
+(6611, 'scroll', 208),
+(6612, 'click', 202),
+(6613, 'view', 947),
+(6614, 'buy', 224),
+(6615, 'scroll', 702),
+(6616, 'click', 339),
+(6617, 'view', 725),
+(6618, 'buy', 999),
+(6619, 'scroll', 68),
+(6620, 'click', 2),
+(6621, 'view', 810),
+(6622, 'buy', 901),
+(6623, 'scroll', 491),
+(6624, 'click', 38),
+(6625, 'view', 509),
+(6626, 'buy', 538),
+(6627, 'scroll', 797),
+(6628, 'click', 337),
+(6629, 'view', 929),
+(6630, 'buy', 70),
+(6631, 'scroll', 769),
+(6632, 'click', 617),
+(6633, 'view', 651),
+(6634, 'buy', 64),
+(6635, 'scroll', 203),
+(6636, 'click', 887),
+(6637, 'view', 640),
+(6638, 'buy', 51),
+(6639, 'scroll', 866),
+(6640, 'click', 374),
+(6641, 'view', 805),
+(6642, 'buy', 421),
+(6643, 'scroll', 94),
+(6644, 'click', 666),
+(6645, 'view', 734),
+(6646, 'buy', 994),
+(6647, 'scroll', 357),
+(6648, 'click', 596),
+(6649, 'view', 166),
+(6650, 'buy', 822),
+(6651, 'scroll', 988),
+(6652, 'click', 504),
+(6653, 'view', 688),
+(6654, 'buy', 790),
+(6655, 'scroll', 763),
+(6656, 'click', 508),
+(6657, 'view', 138),
+(6658, 'buy', 265),
+(6659, 'scroll', 848),
+(6660, 'click', 710),
+(6661, 'view', 959),
+(6662, 'buy', 310),
+(6663, 'scroll', 926),
+(6664, 'click', 54),
+(6665, 'view', 762),
+(6666, 'buy', 477),
+(6667, 'scroll', 852),
+(6668, 'click', 807),
+(6669, 'view', 821),
+(6670, 'buy', 696),
+(6671, 'scroll', 604),
+(6672, 'click', 168),
+(6673, 'view', 445),
+(6674, 'buy', 395),
+(6675, 'scroll', 844),
+(6676, 'click', 655),
+(6677, 'view', 803),
+(6678, 'buy', 960),
+(6679, 'scroll', 891),
+(6680, 'click', 525),
+(6681, 'view', 306),
+(6682, 'buy', 765),
+(6683, 'scroll', 983),
+(6684, 'click', 607),
+(6685, 'view', 544),
+(6686, 'buy', 670),
+(6687, 'scroll', 968),
+(6688, 'click', 647),
+(6689, 'view', 118),
+(6690, 'buy', 69),
+(6691, 'scroll', 991),
+(6692, 'click', 801),
+(6693, 'view', 806),
+(6694, 'buy', 821),
+(6695, 'scroll', 258),
+(6696, 'click', 768),
+(6697, 'view', 858),
+(6698, 'buy', 867),
+(6699, 'scroll', 237),
+(6700, 'click', 245),
+(6701, 'view', 202),
+(6702, 'buy', 601),
+(6703, 'scroll', 468),
+(6704, 'click', 575),
+(6705, 'view', 242),
+(6706, 'buy', 898),
+(6707, 'scroll', 504),
+(6708, 'click', 588),
+(6709, 'view', 929),
+(6710, 'buy', 955),
+(6711, 'scroll', 701),
+(6712, 'click', 910),
+(6713, 'view', 727),
+(6714, 'buy', 51),
+(6715, 'scroll', 401),
+(6716, 'click', 679),
+(6717, 'view', 802),
+(6718, 'buy', 404),
+(6719, 'scroll', 812),
+(6720, 'click', 641),
+(6721, 'view', 699),
+(6722, 'buy', 792),
+(6723, 'scroll', 964),
+(6724, 'click', 350),
+(6725, 'view', 845),
+(6726, 'buy', 388),
+(6727, 'scroll', 415),
+(6728, 'click', 970),
+(6729, 'view', 89),
+(6730, 'buy', 233),
+(6731, 'scroll', 668),
+(6732, 'click', 688),
+(6733, 'view', 856),
+(6734, 'buy', 810),
+(6735, 'scroll', 347),
+(6736, 'click', 679),
+(6737, 'view', 609),
+(6738, 'buy', 925),
+(6739, 'scroll', 856),
+(6740, 'click', 436),
+(6741, 'view', 811),
+(6742, 'buy', 312),
+(6743, 'scroll', 4),
+(6744, 'click', 307),
+(6745, 'view', 500),
+(6746, 'buy', 618),
+(6747, 'scroll', 16),
+(6748, 'click', 973),
+(6749, 'view', 113),
+(6750, 'buy', 899),
+(6751, 'scroll', 831),
+(6752, 'click', 486),
+(6753, 'view', 428),
+(6754, 'buy', 420),
+(6755, 'scroll', 619),
+(6756, 'click', 306),
+(6757, 'view', 468),
+(6758, 'buy', 149),
+(6759, 'scroll', 343),
+(6760, 'click', 558),
+(6761, 'view', 218),
+(6762, 'buy', 85),
+(6763, 'scroll', 362),
+(6764, 'click', 403),
+(6765, 'view', 864),
+(6766, 'buy', 477),
+(6767, 'scroll', 634),
+(6768, 'click', 33),
+(6769, 'view', 299),
+(6770, 'buy', 343),
+(6771, 'scroll', 90),
+(6772, 'click', 277),
+(6773, 'view', 191),
+(6774, 'buy', 718),
+(6775, 'scroll', 910),
+(6776, 'click', 452),
+(6777, 'view', 417),
+(6778, 'buy', 676),
+(6779, 'scroll', 551),
+(6780, 'click', 826),
+(6781, 'view', 247),
+(6782, 'buy', 123),
+(6783, 'scroll', 221),
+(6784, 'click', 699),
+(6785, 'view', 642),
+(6786, 'buy', 42),
+(6787, 'scroll', 384),
+(6788, 'click', 842),
+(6789, 'view', 918),
+(6790, 'buy', 188),
+(6791, 'scroll', 399),
+(6792, 'click', 277),
+(6793, 'view', 340),
+(6794, 'buy', 980),
+(6795, 'scroll', 154),
+(6796, 'click', 371),
+(6797, 'view', 171),
+(6798, 'buy', 229),
+(6799, 'scroll', 359),
+(6800, 'click', 911),
+(6801, 'view', 835),
+(6802, 'buy', 624),
+(6803, 'scroll', 903),
+(6804, 'click', 915),
+(6805, 'view', 983),
+(6806, 'buy', 403),
+(6807, 'scroll', 315),
+(6808, 'click', 511),
+(6809, 'view', 326),
+(6810, 'buy', 978),
+(6811, 'scroll', 897),
+(6812, 'click', 518),
+(6813, 'view', 809),
+(6814, 'buy', 621),
+(6815, 'scroll', 193),
+(6816, 'click', 877),
+(6817, 'view', 850),
+(6818, 'buy', 991),
+(6819, 'scroll', 166),
+(6820, 'click', 400),
+(6821, 'view', 539),
+(6822, 'buy', 9),
+(6823, 'scroll', 0),
+(6824, 'click', 873),
+(6825, 'view', 179),
+(6826, 'buy', 106),
+(6827, 'scroll', 967),
+(6828, 'click', 251),
+(6829, 'view', 465),
+(6830, 'buy', 578),
+(6831, 'scroll', 828),
+(6832, 'click', 672),
+(6833, 'view', 256),
+(6834, 'buy', 754),
+(6835, 'scroll', 360),
+(6836, 'click', 692),
+(6837, 'view', 103),
+(6838, 'buy', 565),
+(6839, 'scroll', 752),
+(6840, 'click', 882),
+(6841, 'view', 771),
+(6842, 'buy', 526),
+(6843, 'scroll', 682),
+(6844, 'click', 385),
+(6845, 'view', 138),
+(6846, 'buy', 950),
+(6847, 'scroll', 771),
+(6848, 'click', 915),
+(6849, 'view', 259),
+(6850, 'buy', 682),
+(6851, 'scroll', 426),
+(6852, 'click', 77),
+(6853, 'view', 526),
+(6854, 'buy', 638),
+(6855, 'scroll', 339),
+(6856, 'click', 454),
+(6857, 'view', 272),
+(6858, 'buy', 980),
+(6859, 'scroll', 302),
+(6860, 'click', 370),
+(6861, 'view', 312),
+(6862, 'buy', 677),
+(6863, 'scroll', 726),
+(6864, 'click', 647),
+(6865, 'view', 702),
+(6866, 'buy', 384),
+(6867, 'scroll', 960),
+(6868, 'click', 534),
+(6869, 'view', 828),
+(6870, 'buy', 692),
+(6871, 'scroll', 61),
+(6872, 'click', 928),
+(6873, 'view', 670),
+(6874, 'buy', 510),
+(6875, 'scroll', 505),
+(6876, 'click', 372),
+(6877, 'view', 708),
+(6878, 'buy', 999),
+(6879, 'scroll', 18),
+(6880, 'click', 58),
+(6881, 'view', 896),
+(6882, 'buy', 854),
+(6883, 'scroll', 909),
+(6884, 'click', 699),
+(6885, 'view', 121),
+(6886, 'buy', 570),
+(6887, 'scroll', 386),
+(6888, 'click', 458),
+(6889, 'view', 318),
+(6890, 'buy', 769),
+(6891, 'scroll', 524),
+(6892, 'click', 912),
+(6893, 'view', 155),
+(6894, 'buy', 746),
+(6895, 'scroll', 621),
+(6896, 'click', 767),
+(6897, 'view', 469),
+(6898, 'buy', 35),
+(6899, 'scroll', 970),
+(6900, 'click', 333),
+(6901, 'view', 494),
+(6902, 'buy', 140),
+(6903, 'scroll', 7),
+(6904, 'click', 975),
+(6905, 'view', 959),
+(6906, 'buy', 912),
+(6907, 'scroll', 277),
+(6908, 'click', 147),
+(6909, 'view', 192),
+(6910, 'buy', 601),
+(6911, 'scroll', 940),
+(6912, 'click', 590),
+(6913, 'view', 520),
+(6914, 'buy', 47),
+(6915, 'scroll', 401),
+(6916, 'click', 177),
+(6917, 'view', 765),
+(6918, 'buy', 603),
+(6919, 'scroll', 656),
+(6920, 'click', 287),
+(6921, 'view', 642),
+(6922, 'buy', 780),
+(6923, 'scroll', 247),
+(6924, 'click', 298),
+(6925, 'view', 791),
+(6926, 'buy', 557),
+(6927, 'scroll', 26),
+(6928, 'click', 430),
+(6929, 'view', 561),
+(6930, 'buy', 417),
+(6931, 'scroll', 664),
+(6932, 'click', 86),
+(6933, 'view', 824),
+(6934, 'buy', 972),
+(6935, 'scroll', 692),
+(6936, 'click', 654),
+(6937, 'view', 389),
+(6938, 'buy', 504),
+(6939, 'scroll', 986),
+(6940, 'click', 997),
+(6941, 'view', 726),
+(6942, 'buy', 368),
+(6943, 'scroll', 707),
+(6944, 'click', 924),
+(6945, 'view', 284),
+(6946, 'buy', 331),
+(6947, 'scroll', 165),
+(6948, 'click', 853),
+(6949, 'view', 588),
+(6950, 'buy', 507),
+(6951, 'scroll', 845),
+(6952, 'click', 49),
+(6953, 'view', 812),
+(6954, 'buy', 545),
+(6955, 'scroll', 355),
+(6956, 'click', 915),
+(6957, 'view', 143),
+(6958, 'buy', 205),
+(6959, 'scroll', 528),
+(6960, 'click', 826),
+(6961, 'view', 898),
+(6962, 'buy', 63),
+(6963, 'scroll', 166),
+(6964, 'click', 315),
+(6965, 'view', 756),
+(6966, 'buy', 533),
+(6967, 'scroll', 174),
+(6968, 'click', 697),
+(6969, 'view', 319),
+(6970, 'buy', 929),
+(6971, 'scroll', 54),
+(6972, 'click', 601),
+(6973, 'view', 304),
+(6974, 'buy', 994),
+(6975, 'scroll', 392),
+(6976, 'click', 795),
+(6977, 'view', 990),
+(6978, 'buy', 368),
+(6979, 'scroll', 985),
+(6980, 'click', 710),
+(6981, 'view', 191),
+(6982, 'buy', 278),
+(6983, 'scroll', 316),
+(6984, 'click', 912),
+(6985, 'view', 966),
+(6986, 'buy', 486),
+(6987, 'scroll', 202),
+(6988, 'click', 635),
+(6989, 'view', 328),
+(6990, 'buy', 950),
+(6991, 'scroll', 448),
+(6992, 'click', 412),
+(6993, 'view', 111),
+(6994, 'buy', 697),
+(6995, 'scroll', 266),
+(6996, 'click', 370),
+(6997, 'view', 403),
+(6998, 'buy', 327),
+(6999, 'scroll', 394),
+(7000, 'click', 812),
+(7001, 'view', 986),
+(7002, 'buy', 483),
+(7003, 'scroll', 273),
+(7004, 'click', 115),
+(7005, 'view', 208),
+(7006, 'buy', 948),
+(7007, 'scroll', 930),
+(7008, 'click', 637),
+(7009, 'view', 461),
+(7010, 'buy', 513),
+(7011, 'scroll', 857),
+(7012, 'click', 418),
+(7013, 'view', 652),
+(7014, 'buy', 163),
+(7015, 'scroll', 797),
+(7016, 'click', 913),
+(7017, 'view', 322),
+(7018, 'buy', 45),
+(7019, 'scroll', 155),
+(7020, 'click', 285),
+(7021, 'view', 775),
+(7022, 'buy', 548),
+(7023, 'scroll', 481),
+(7024, 'click', 677),
+(7025, 'view', 572),
+(7026, 'buy', 868),
+(7027, 'scroll', 686),
+(7028, 'click', 421),
+(7029, 'view', 770),
+(7030, 'buy', 78),
+(7031, 'scroll', 281),
+(7032, 'click', 401),
+(7033, 'view', 371),
+(7034, 'buy', 734),
+(7035, 'scroll', 939),
+(7036, 'click', 405),
+(7037, 'view', 542),
+(7038, 'buy', 830),
+(7039, 'scroll', 295),
+(7040, 'click', 871),
+(7041, 'view', 645),
+(7042, 'buy', 124),
+(7043, 'scroll', 265),
+(7044, 'click', 460),
+(7045, 'view', 789),
+(7046, 'buy', 12),
+(7047, 'scroll', 42),
+(7048, 'click', 544),
+(7049, 'view', 846),
+(7050, 'buy', 714),
+(7051, 'scroll', 580),
+(7052, 'click', 312),
+(7053, 'view', 362),
+(7054, 'buy', 616),
+(7055, 'scroll', 962),
+(7056, 'click', 368),
+(7057, 'view', 271),
+(7058, 'buy', 249),
+(7059, 'scroll', 907),
+(7060, 'click', 71),
+(7061, 'view', 896),
+(7062, 'buy', 561),
+(7063, 'scroll', 98),
+(7064, 'click', 771),
+(7065, 'view', 617),
+(7066, 'buy', 694),
+(7067, 'scroll', 848),
+(7068, 'click', 422),
+(7069, 'view', 854),
+(7070, 'buy', 827),
+(7071, 'scroll', 728),
+(7072, 'click', 113),
+(7073, 'view', 952),
+(7074, 'buy', 314),
+(7075, 'scroll', 169),
+(7076, 'click', 660),
+(7077, 'view', 180),
+(7078, 'buy', 990),
+(7079, 'scroll', 740),
+(7080, 'click', 649),
+(7081, 'view', 760),
+(7082, 'buy', 708),
+(7083, 'scroll', 120),
+(7084, 'click', 793),
+(7085, 'view', 413),
+(7086, 'buy', 403),
+(7087, 'scroll', 861),
+(7088, 'click', 962),
+(7089, 'view', 808),
+(7090, 'buy', 760),
+(7091, 'scroll', 859),
+(7092, 'click', 349),
+(7093, 'view', 409),
+(7094, 'buy', 401),
+(7095, 'scroll', 511),
+(7096, 'click', 825),
+(7097, 'view', 344),
+(7098, 'buy', 358),
+(7099, 'scroll', 885),
+(7100, 'click', 190),
+(7101, 'view', 729),
+(7102, 'buy', 892),
+(7103, 'scroll', 146),
+(7104, 'click', 544),
+(7105, 'view', 753),
+(7106, 'buy', 533),
+(7107, 'scroll', 423),
+(7108, 'click', 685),
+(7109, 'view', 949),
+(7110, 'buy', 923),
+(7111, 'scroll', 295),
+(7112, 'click', 136),
+(7113, 'view', 218),
+(7114, 'buy', 346),
+(7115, 'scroll', 698),
+(7116, 'click', 67),
+(7117, 'view', 946),
+(7118, 'buy', 423),
+(7119, 'scroll', 68),
+(7120, 'click', 514),
+(7121, 'view', 3),
+(7122, 'buy', 872),
+(7123, 'scroll', 587),
+(7124, 'click', 683),
+(7125, 'view', 241),
+(7126, 'buy', 591),
+(7127, 'scroll', 442),
+(7128, 'click', 413),
+(7129, 'view', 219),
+(7130, 'buy', 587),
+(7131, 'scroll', 746),
+(7132, 'click', 280),
+(7133, 'view', 804),
+(7134, 'buy', 865),
+(7135, 'scroll', 695),
+(7136, 'click', 807),
+(7137, 'view', 873),
+(7138, 'buy', 858),
+(7139, 'scroll', 135),
+(7140, 'click', 154),
+(7141, 'view', 227),
+(7142, 'buy', 687),
+(7143, 'scroll', 870),
+(7144, 'click', 772),
+(7145, 'view', 244),
+(7146, 'buy', 512),
+(7147, 'scroll', 127),
+(7148, 'click', 919),
+(7149, 'view', 289),
+(7150, 'buy', 920),
+(7151, 'scroll', 34),
+(7152, 'click', 760),
+(7153, 'view', 993),
+(7154, 'buy', 840),
+(7155, 'scroll', 952),
+(7156, 'click', 664),
+(7157, 'view', 390),
+(7158, 'buy', 899),
+(7159, 'scroll', 294),
+(7160, 'click', 134),
+(7161, 'view', 662),
+(7162, 'buy', 721),
+(7163, 'scroll', 896),
+(7164, 'click', 720),
+(7165, 'view', 393),
+(7166, 'buy', 627),
+(7167, 'scroll', 917),
+(7168, 'click', 281),
+(7169, 'view', 729),
+(7170, 'buy', 68),
+(7171, 'scroll', 790),
+(7172, 'click', 617),
+(7173, 'view', 619),
+(7174, 'buy', 844),
+(7175, 'scroll', 521),
+(7176, 'click', 279),
+(7177, 'view', 622),
+(7178, 'buy', 218),
+(7179, 'scroll', 925),
+(7180, 'click', 229),
+(7181, 'view', 316),
+(7182, 'buy', 96),
+(7183, 'scroll', 368),
+(7184, 'click', 692),
+(7185, 'view', 582),
+(7186, 'buy', 998),
+(7187, 'scroll', 909),
+(7188, 'click', 821),
+(7189, 'view', 80),
+(7190, 'buy', 368),
+(7191, 'scroll', 23),
+(7192, 'click', 716),
+(7193, 'view', 529),
+(7194, 'buy', 73),
+(7195, 'scroll', 124),
+(7196, 'click', 858),
+(7197, 'view', 976),
+(7198, 'buy', 332),
+(7199, 'scroll', 223),
+(7200, 'click', 3),
+(7201, 'view', 468),
+(7202, 'buy', 644),
+(7203, 'scroll', 782),
+(7204, 'click', 142),
+(7205, 'view', 457),
+(7206, 'buy', 281),
+(7207, 'scroll', 515),
+(7208, 'click', 60),
+(7209, 'view', 456),
+(7210, 'buy', 604),
+(7211, 'scroll', 568),
+(7212, 'click', 609),
+(7213, 'view', 826),
+(7214, 'buy', 33),
+(7215, 'scroll', 40),
+(7216, 'click', 550),
+(7217, 'view', 847),
+(7218, 'buy', 478),
+(7219, 'scroll', 113),
+(7220, 'click', 495),
+(7221, 'view', 229),
+(7222, 'buy', 301),
+(7223, 'scroll', 644),
+(7224, 'click', 958),
+(7225, 'view', 348),
+(7226, 'buy', 987),
+(7227, 'scroll', 338),
+(7228, 'click', 543),
+(7229, 'view', 582),
+(7230, 'buy', 235),
+(7231, 'scroll', 223),
+(7232, 'click', 569),
+(7233, 'view', 812),
+(7234, 'buy', 840),
+(7235, 'scroll', 213),
+(7236, 'click', 288),
+(7237, 'view', 859),
+(7238, 'buy', 997),
+(7239, 'scroll', 828),
+(7240, 'click', 591),
+(7241, 'view', 549),
+(7242, 'buy', 730),
+(7243, 'scroll', 31),
+(7244, 'click', 228),
+(7245, 'view', 796),
+(7246, 'buy', 177),
+(7247, 'scroll', 29),
+(7248, 'click', 830),
+(7249, 'view', 516),
+(7250, 'buy', 274),
+(7251, 'scroll', 434),
+(7252, 'click', 383),
+(7253, 'view', 64),
+(7254, 'buy', 977),
+(7255, 'scroll', 645),
+(7256, 'click', 280),
+(7257, 'view', 741),
+(7258, 'buy', 91),
+(7259, 'scroll', 598),
+(7260, 'click', 115),
+(7261, 'view', 409),
+(7262, 'buy', 399),
+(7263, 'scroll', 524),
+(7264, 'click', 977),
+(7265, 'view', 602),
+(7266, 'buy', 418),
+(7267, 'scroll', 231),
+(7268, 'click', 682),
+(7269, 'view', 888),
+(7270, 'buy', 902),
+(7271, 'scroll', 56),
+(7272, 'click', 823),
+(7273, 'view', 380),
+(7274, 'buy', 984),
+(7275, 'scroll', 544),
+(7276, 'click', 337),
+(7277, 'view', 673),
+(7278, 'buy', 257),
+(7279, 'scroll', 73),
+(7280, 'click', 657),
+(7281, 'view', 489),
+(7282, 'buy', 589),
+(7283, 'scroll', 136),
+(7284, 'click', 441),
+(7285, 'view', 464),
+(7286, 'buy', 992),
+(7287, 'scroll', 699),
+(7288, 'click', 901),
+(7289, 'view', 725),
+(7290, 'buy', 632),
+(7291, 'scroll', 465),
+(7292, 'click', 195),
+(7293, 'view', 349),
+(7294, 'buy', 630),
+(7295, 'scroll', 194),
+(7296, 'click', 114),
+(7297, 'view', 412),
+(7298, 'buy', 169),
+(7299, 'scroll', 289),
+(7300, 'click', 777),
+(7301, 'view', 198),
+(7302, 'buy', 78),
+(7303, 'scroll', 753),
+(7304, 'click', 918),
+(7305, 'view', 528),
+(7306, 'buy', 16),
+(7307, 'scroll', 449),
+(7308, 'click', 796),
+(7309, 'view', 202),
+(7310, 'buy', 809),
+(7311, 'scroll', 720),
+(7312, 'click', 760),
+(7313, 'view', 201),
+(7314, 'buy', 791),
+(7315, 'scroll', 271),
+(7316, 'click', 206),
+(7317, 'view', 573),
+(7318, 'buy', 773),
+(7319, 'scroll', 718),
+(7320, 'click', 858),
+(7321, 'view', 996),
+(7322, 'buy', 303),
+(7323, 'scroll', 765),
+(7324, 'click', 805),
+(7325, 'view', 971),
+(7326, 'buy', 23),
+(7327, 'scroll', 942),
+(7328, 'click', 757),
+(7329, 'view', 739),
+(7330, 'buy', 627),
+(7331, 'scroll', 736),
+(7332, 'click', 16),
+(7333, 'view', 64),
+(7334, 'buy', 362),
+(7335, 'scroll', 210),
+(7336, 'click', 427),
+(7337, 'view', 13),
+(7338, 'buy', 855),
+(7339, 'scroll', 884),
+(7340, 'click', 656),
+(7341, 'view', 739),
+(7342, 'buy', 765),
+(7343, 'scroll', 645),
+(7344, 'click', 550),
+(7345, 'view', 270),
+(7346, 'buy', 571),
+(7347, 'scroll', 363),
+(7348, 'click', 642),
+(7349, 'view', 167),
+(7350, 'buy', 578),
+(7351, 'scroll', 647),
+(7352, 'click', 323),
+(7353, 'view', 363),
+(7354, 'buy', 313),
+(7355, 'scroll', 107),
+(7356, 'click', 45),
+(7357, 'view', 757),
+(7358, 'buy', 179),
+(7359, 'scroll', 707),
+(7360, 'click', 363),
+(7361, 'view', 431),
+(7362, 'buy', 920),
+(7363, 'scroll', 30),
+(7364, 'click', 823),
+(7365, 'view', 730),
+(7366, 'buy', 465),
+(7367, 'scroll', 791),
+(7368, 'click', 104),
+(7369, 'view', 351),
+(7370, 'buy', 109),
+(7371, 'scroll', 878),
+(7372, 'click', 157),
+(7373, 'view', 372),
+(7374, 'buy', 796),
+(7375, 'scroll', 905),
+(7376, 'click', 482),
+(7377, 'view', 497),
+(7378, 'buy', 84),
+(7379, 'scroll', 933),
+(7380, 'click', 345),
+(7381, 'view', 813),
+(7382, 'buy', 326),
+(7383, 'scroll', 487),
+(7384, 'click', 918),
+(7385, 'view', 841),
+(7386, 'buy', 999),
+(7387, 'scroll', 131),
+(7388, 'click', 870),
+(7389, 'view', 111),
+(7390, 'buy', 540),
+(7391, 'scroll', 576),
+(7392, 'click', 257),
+(7393, 'view', 520),
+(7394, 'buy', 398),
+(7395, 'scroll', 214),
+(7396, 'click', 362),
+(7397, 'view', 257),
+(7398, 'buy', 672),
+(7399, 'scroll', 21),
+(7400, 'click', 960),
+(7401, 'view', 930),
+(7402, 'buy', 197),
+(7403, 'scroll', 727),
+(7404, 'click', 284),
+(7405, 'view', 968),
+(7406, 'buy', 834),
+(7407, 'scroll', 531),
+(7408, 'click', 447),
+(7409, 'view', 793),
+(7410, 'buy', 749),
+(7411, 'scroll', 743),
+(7412, 'click', 393),
+(7413, 'view', 164),
+(7414, 'buy', 831),
+(7415, 'scroll', 917),
+(7416, 'click', 861),
+(7417, 'view', 447),
+(7418, 'buy', 137),
+(7419, 'scroll', 141),
+(7420, 'click', 13),
+(7421, 'view', 113),
+(7422, 'buy', 219),
+(7423, 'scroll', 745),
+(7424, 'click', 599),
+(7425, 'view', 544),
+(7426, 'buy', 388),
+(7427, 'scroll', 28),
+(7428, 'click', 9),
+(7429, 'view', 832),
+(7430, 'buy', 850),
+(7431, 'scroll', 996),
+(7432, 'click', 804),
+(7433, 'view', 88),
+(7434, 'buy', 474),
+(7435, 'scroll', 799),
+(7436, 'click', 44),
+(7437, 'view', 208),
+(7438, 'buy', 910),
+(7439, 'scroll', 586),
+(7440, 'click', 547),
+(7441, 'view', 935),
+(7442, 'buy', 72),
+(7443, 'scroll', 879),
+(7444, 'click', 331),
+(7445, 'view', 346),
+(7446, 'buy', 639),
+(7447, 'scroll', 573),
+(7448, 'click', 906),
+(7449, 'view', 472),
+(7450, 'buy', 496),
+(7451, 'scroll', 787),
+(7452, 'click', 654),
+(7453, 'view', 925),
+(7454, 'buy', 210),
+(7455, 'scroll', 7),
+(7456, 'click', 249),
+(7457, 'view', 209),
+(7458, 'buy', 927),
+(7459, 'scroll', 363),
+(7460, 'click', 391),
+(7461, 'view', 901),
+(7462, 'buy', 106),
+(7463, 'scroll', 100),
+(7464, 'click', 605),
+(7465, 'view', 898),
+(7466, 'buy', 129),
+(7467, 'scroll', 967),
+(7468, 'click', 204),
+(7469, 'view', 450),
+(7470, 'buy', 467),
+(7471, 'scroll', 585),
+(7472, 'click', 599),
+(7473, 'view', 942),
+(7474, 'buy', 651),
+(7475, 'scroll', 701),
+(7476, 'click', 723),
+(7477, 'view', 935),
+(7478, 'buy', 450),
+(7479, 'scroll', 779),
+(7480, 'click', 69),
+(7481, 'view', 583),
+(7482, 'buy', 741),
+(7483, 'scroll', 736),
+(7484, 'click', 55),
+(7485, 'view', 882),
+(7486, 'buy', 481),
+(7487, 'scroll', 173),
+(7488, 'click', 409),
+(7489, 'view', 667),
+(7490, 'buy', 689),
+(7491, 'scroll', 882),
+(7492, 'click', 730),
+(7493, 'view', 245),
+(7494, 'buy', 734),
+(7495, 'scroll', 665),
+(7496, 'click', 480),
+(7497, 'view', 708),
+(7498, 'buy', 901),
+(7499, 'scroll', 483),
+(7500, 'click', 620),
+(7501, 'view', 145),
+(7502, 'buy', 121),
+(7503, 'scroll', 930),
+(7504, 'click', 509),
+(7505, 'view', 613),
+(7506, 'buy', 390),
+(7507, 'scroll', 64),
+(7508, 'click', 716),
+(7509, 'view', 244),
+(7510, 'buy', 819),
+(7511, 'scroll', 910),
+(7512, 'click', 234),
+(7513, 'view', 5),
+(7514, 'buy', 401),
+(7515, 'scroll', 579),
+(7516, 'click', 806),
+(7517, 'view', 763),
+(7518, 'buy', 843),
+(7519, 'scroll', 229),
+(7520, 'click', 649),
+(7521, 'view', 756),
+(7522, 'buy', 759),
+(7523, 'scroll', 663),
+(7524, 'click', 39),
+(7525, 'view', 248),
+(7526, 'buy', 96),
+(7527, 'scroll', 929),
+(7528, 'click', 999),
+(7529, 'view', 204),
+(7530, 'buy', 821),
+(7531, 'scroll', 0),
+(7532, 'click', 38),
+(7533, 'view', 477),
+(7534, 'buy', 49),
+(7535, 'scroll', 411),
+(7536, 'click', 246),
+(7537, 'view', 963),
+(7538, 'buy', 953),
+(7539, 'scroll', 982),
+(7540, 'click', 224),
+(7541, 'view', 793),
+(7542, 'buy', 688),
+(7543, 'scroll', 45),
+(7544, 'click', 952),
+(7545, 'view', 569),
+(7546, 'buy', 653),
+(7547, 'scroll', 591),
+(7548, 'click', 941),
+(7549, 'view', 423),
+(7550, 'buy', 269),
+(7551, 'scroll', 42),
+(7552, 'click', 157),
+(7553, 'view', 479),
+(7554, 'buy', 18),
+(7555, 'scroll', 490),
+(7556, 'click', 775),
+(7557, 'view', 979),
+(7558, 'buy', 106),
+(7559, 'scroll', 777),
+(7560, 'click', 996),
+(7561, 'view', 903),
+(7562, 'buy', 727),
+(7563, 'scroll', 98),
+(7564, 'click', 191),
+(7565, 'view', 146),
+(7566, 'buy', 826),
+(7567, 'scroll', 541),
+(7568, 'click', 166),
+(7569, 'view', 630),
+(7570, 'buy', 524),
+(7571, 'scroll', 331),
+(7572, 'click', 108),
+(7573, 'view', 522),
+(7574, 'buy', 805),
+(7575, 'scroll', 979),
+(7576, 'click', 911),
+(7577, 'view', 390),
+(7578, 'buy', 938),
+(7579, 'scroll', 900),
+(7580, 'click', 2),
+(7581, 'view', 73),
+(7582, 'buy', 871),
+(7583, 'scroll', 30),
+(7584, 'click', 569),
+(7585, 'view', 663),
+(7586, 'buy', 841),
+(7587, 'scroll', 87),
+(7588, 'click', 514),
+(7589, 'view', 575),
+(7590, 'buy', 634),
+(7591, 'scroll', 627),
+(7592, 'click', 608),
+(7593, 'view', 810),
+(7594, 'buy', 818),
+(7595, 'scroll', 550),
+(7596, 'click', 79),
+(7597, 'view', 722),
+(7598, 'buy', 55),
+(7599, 'scroll', 677),
+(7600, 'click', 558),
+(7601, 'view', 629),
+(7602, 'buy', 297),
+(7603, 'scroll', 468),
+(7604, 'click', 406),
+(7605, 'view', 686),
+(7606, 'buy', 7),
+(7607, 'scroll', 573),
+(7608, 'click', 762),
+(7609, 'view', 213),
+(7610, 'buy', 24),
+(7611, 'scroll', 191),
+(7612, 'click', 849),
+(7613, 'view', 519),
+(7614, 'buy', 831),
+(7615, 'scroll', 857),
+(7616, 'click', 468),
+(7617, 'view', 213),
+(7618, 'buy', 125),
+(7619, 'scroll', 725),
+(7620, 'click', 665),
+(7621, 'view', 753),
+(7622, 'buy', 212),
+(7623, 'scroll', 687),
+(7624, 'click', 439),
+(7625, 'view', 113),
+(7626, 'buy', 627),
+(7627, 'scroll', 999),
+(7628, 'click', 88),
+(7629, 'view', 559),
+(7630, 'buy', 532),
+(7631, 'scroll', 360),
+(7632, 'click', 693),
+(7633, 'view', 96),
+(7634, 'buy', 89),
+(7635, 'scroll', 747),
+(7636, 'click', 244),
+(7637, 'view', 870),
+(7638, 'buy', 902),
+(7639, 'scroll', 868),
+(7640, 'click', 103),
+(7641, 'view', 91),
+(7642, 'buy', 376),
+(7643, 'scroll', 280),
+(7644, 'click', 309),
+(7645, 'view', 316),
+(7646, 'buy', 780),
+(7647, 'scroll', 302),
+(7648, 'click', 151),
+(7649, 'view', 505),
+(7650, 'buy', 620),
+(7651, 'scroll', 590),
+(7652, 'click', 342),
+(7653, 'view', 787),
+(7654, 'buy', 196),
+(7655, 'scroll', 7),
+(7656, 'click', 80),
+(7657, 'view', 76),
+(7658, 'buy', 44),
+(7659, 'scroll', 116),
+(7660, 'click', 699),
+(7661, 'view', 709),
+(7662, 'buy', 785),
+(7663, 'scroll', 613),
+(7664, 'click', 219),
+(7665, 'view', 532),
+(7666, 'buy', 394),
+(7667, 'scroll', 466),
+(7668, 'click', 417),
+(7669, 'view', 945),
+(7670, 'buy', 625),
+(7671, 'scroll', 588),
+(7672, 'click', 664),
+(7673, 'view', 215),
+(7674, 'buy', 938),
+(7675, 'scroll', 776),
+(7676, 'click', 750),
+(7677, 'view', 770),
+(7678, 'buy', 815),
+(7679, 'scroll', 81),
+(7680, 'click', 934),
+(7681, 'view', 22),
+(7682, 'buy', 857),
+(7683, 'scroll', 60),
+(7684, 'click', 733),
+(7685, 'view', 746),
+(7686, 'buy', 31),
+(7687, 'scroll', 686),
+(7688, 'click', 697),
+(7689, 'view', 138),
+(7690, 'buy', 870),
+(7691, 'scroll', 933),
+(7692, 'click', 441),
+(7693, 'view', 820),
+(7694, 'buy', 899),
+(7695, 'scroll', 56),
+(7696, 'click', 184),
+(7697, 'view', 633),
+(7698, 'buy', 965),
+(7699, 'scroll', 300),
+(7700, 'click', 452),
+(7701, 'view', 261),
+(7702, 'buy', 723),
+(7703, 'scroll', 137),
+(7704, 'click', 258),
+(7705, 'view', 806),
+(7706, 'buy', 307),
+(7707, 'scroll', 866),
+(7708, 'click', 356),
+(7709, 'view', 29),
+(7710, 'buy', 332),
+(7711, 'scroll', 391),
+(7712, 'click', 96),
+(7713, 'view', 166),
+(7714, 'buy', 453),
+(7715, 'scroll', 166),
+(7716, 'click', 969),
+(7717, 'view', 669),
+(7718, 'buy', 671),
+(7719, 'scroll', 954),
+(7720, 'click', 484),
+(7721, 'view', 780),
+(7722, 'buy', 638),
+(7723, 'scroll', 856),
+(7724, 'click', 771),
+(7725, 'view', 768),
+(7726, 'buy', 770),
+(7727, 'scroll', 333),
+(7728, 'click', 280),
+(7729, 'view', 822),
+(7730, 'buy', 255),
+(7731, 'scroll', 13),
+(7732, 'click', 422),
+(7733, 'view', 550),
+(7734, 'buy', 21),
+(7735, 'scroll', 348),
+(7736, 'click', 236),
+(7737, 'view', 557),
+(7738, 'buy', 907),
+(7739, 'scroll', 365),
+(7740, 'click', 943),
+(7741, 'view', 835),
+(7742, 'buy', 336),
+(7743, 'scroll', 1),
+(7744, 'click', 788),
+(7745, 'view', 789),
+(7746, 'buy', 793),
+(7747, 'scroll', 244),
+(7748, 'click', 911),
+(7749, 'view', 350),
+(7750, 'buy', 813),
+(7751, 'scroll', 81),
+(7752, 'click', 544),
+(7753, 'view', 165),
+(7754, 'buy', 107),
+(7755, 'scroll', 36),
+(7756, 'click', 845),
+(7757, 'view', 871),
+(7758, 'buy', 321),
+(7759, 'scroll', 435),
+(7760, 'click', 642),
+(7761, 'view', 345),
+(7762, 'buy', 375),
+(7763, 'scroll', 65),
+(7764, 'click', 550),
+(7765, 'view', 124),
+(7766, 'buy', 988),
+(7767, 'scroll', 469),
+(7768, 'click', 164),
+(7769, 'view', 216),
+(7770, 'buy', 543),
+(7771, 'scroll', 54),
+(7772, 'click', 665),
+(7773, 'view', 679),
+(7774, 'buy', 551),
+(7775, 'scroll', 250),
+(7776, 'click', 960),
+(7777, 'view', 939),
+(7778, 'buy', 417),
+(7779, 'scroll', 953),
+(7780, 'click', 935),
+(7781, 'view', 531),
+(7782, 'buy', 706),
+(7783, 'scroll', 795),
+(7784, 'click', 990),
+(7785, 'view', 646),
+(7786, 'buy', 91),
+(7787, 'scroll', 663),
+(7788, 'click', 217),
+(7789, 'view', 223),
+(7790, 'buy', 294),
+(7791, 'scroll', 773),
+(7792, 'click', 928),
+(7793, 'view', 906),
+(7794, 'buy', 13),
+(7795, 'scroll', 731),
+(7796, 'click', 266),
+(7797, 'view', 441),
+(7798, 'buy', 732),
+(7799, 'scroll', 121),
+(7800, 'click', 970),
+(7801, 'view', 180),
+(7802, 'buy', 625),
+(7803, 'scroll', 448),
+(7804, 'click', 629),
+(7805, 'view', 703),
+(7806, 'buy', 170),
+(7807, 'scroll', 707),
+(7808, 'click', 970),
+(7809, 'view', 763),
+(7810, 'buy', 291),
+(7811, 'scroll', 771),
+(7812, 'click', 400),
+(7813, 'view', 254),
+(7814, 'buy', 349),
+(7815, 'scroll', 263),
+(7816, 'click', 983),
+(7817, 'view', 28),
+(7818, 'buy', 93),
+(7819, 'scroll', 707),
+(7820, 'click', 887),
+(7821, 'view', 214),
+(7822, 'buy', 656),
+(7823, 'scroll', 265),
+(7824, 'click', 633),
+(7825, 'view', 987),
+(7826, 'buy', 671),
+(7827, 'scroll', 658),
+(7828, 'click', 758),
+(7829, 'view', 605),
+(7830, 'buy', 145),
+(7831, 'scroll', 671),
+(7832, 'click', 71),
+(7833, 'view', 612),
+(7834, 'buy', 69),
+(7835, 'scroll', 711),
+(7836, 'click', 400),
+(7837, 'view', 311),
+(7838, 'buy', 79),
+(7839, 'scroll', 65),
+(7840, 'click', 747),
+(7841, 'view', 68),
+(7842, 'buy', 548),
+(7843, 'scroll', 14),
+(7844, 'click', 75),
+(7845, 'view', 370),
+(7846, 'buy', 76),
+(7847, 'scroll', 145),
+(7848, 'click', 570),
+(7849, 'view', 115),
+(7850, 'buy', 739),
+(7851, 'scroll', 505),
+(7852, 'click', 663),
+(7853, 'view', 992),
+(7854, 'buy', 522),
+(7855, 'scroll', 704),
+(7856, 'click', 898),
+(7857, 'view', 280),
+(7858, 'buy', 942),
+(7859, 'scroll', 787),
+(7860, 'click', 460),
+(7861, 'view', 182),
+(7862, 'buy', 921),
+(7863, 'scroll', 102),
+(7864, 'click', 261),
+(7865, 'view', 310),
+(7866, 'buy', 404),
+(7867, 'scroll', 418),
+(7868, 'click', 713),
+(7869, 'view', 706),
+(7870, 'buy', 177),
+(7871, 'scroll', 455),
+(7872, 'click', 745),
+(7873, 'view', 899),
+(7874, 'buy', 97),
+(7875, 'scroll', 881),
+(7876, 'click', 954),
+(7877, 'view', 471),
+(7878, 'buy', 350),
+(7879, 'scroll', 330),
+(7880, 'click', 852),
+(7881, 'view', 210),
+(7882, 'buy', 31),
+(7883, 'scroll', 397),
+(7884, 'click', 848),
+(7885, 'view', 803),
+(7886, 'buy', 231),
+(7887, 'scroll', 109),
+(7888, 'click', 875),
+(7889, 'view', 213),
+(7890, 'buy', 822),
+(7891, 'scroll', 359),
+(7892, 'click', 686),
+(7893, 'view', 343),
+(7894, 'buy', 284),
+(7895, 'scroll', 639),
+(7896, 'click', 10),
+(7897, 'view', 865),
+(7898, 'buy', 194),
+(7899, 'scroll', 74),
+(7900, 'click', 926),
+(7901, 'view', 91),
+(7902, 'buy', 161),
+(7903, 'scroll', 801),
+(7904, 'click', 675),
+(7905, 'view', 677),
+(7906, 'buy', 601),
+(7907, 'scroll', 319),
+(7908, 'click', 677),
+(7909, 'view', 269),
+(7910, 'buy', 184),
+(7911, 'scroll', 46),
+(7912, 'click', 147),
+(7913, 'view', 492),
+(7914, 'buy', 99),
+(7915, 'scroll', 856),
+(7916, 'click', 58),
+(7917, 'view', 392),
+(7918, 'buy', 260),
+(7919, 'scroll', 667),
+(7920, 'click', 91),
+(7921, 'view', 583),
+(7922, 'buy', 597),
+(7923, 'scroll', 228),
+(7924, 'click', 63),
+(7925, 'view', 66),
+(7926, 'buy', 302),
+(7927, 'scroll', 15),
+(7928, 'click', 274),
+(7929, 'view', 873),
+(7930, 'buy', 953),
+(7931, 'scroll', 133),
+(7932, 'click', 958),
+(7933, 'view', 986),
+(7934, 'buy', 363),
+(7935, 'scroll', 372),
+(7936, 'click', 555),
+(7937, 'view', 739),
+(7938, 'buy', 180),
+(7939, 'scroll', 141),
+(7940, 'click', 378),
+(7941, 'view', 806),
+(7942, 'buy', 754),
+(7943, 'scroll', 257),
+(7944, 'click', 379),
+(7945, 'view', 375),
+(7946, 'buy', 170),
+(7947, 'scroll', 535),
+(7948, 'click', 679),
+(7949, 'view', 114),
+(7950, 'buy', 893),
+(7951, 'scroll', 254),
+(7952, 'click', 931),
+(7953, 'view', 815),
+(7954, 'buy', 169),
+(7955, 'scroll', 292),
+(7956, 'click', 779),
+(7957, 'view', 389),
+(7958, 'buy', 954),
+(7959, 'scroll', 783),
+(7960, 'click', 30),
+(7961, 'view', 229),
+(7962, 'buy', 664),
+(7963, 'scroll', 198),
+(7964, 'click', 907),
+(7965, 'view', 224),
+(7966, 'buy', 780),
+(7967, 'scroll', 393),
+(7968, 'click', 873),
+(7969, 'view', 374),
+(7970, 'buy', 246),
+(7971, 'scroll', 656),
+(7972, 'click', 914),
+(7973, 'view', 483),
+(7974, 'buy', 269),
+(7975, 'scroll', 890),
+(7976, 'click', 7),
+(7977, 'view', 51),
+(7978, 'buy', 101),
+(7979, 'scroll', 679),
+(7980, 'click', 386),
+(7981, 'view', 856),
+(7982, 'buy', 378),
+(7983, 'scroll', 240),
+(7984, 'click', 288),
+(7985, 'view', 30),
+(7986, 'buy', 483),
+(7987, 'scroll', 448),
+(7988, 'click', 499),
+(7989, 'view', 118),
+(7990, 'buy', 112),
+(7991, 'scroll', 470),
+(7992, 'click', 568),
+(7993, 'view', 728),
+(7994, 'buy', 503),
+(7995, 'scroll', 95),
+(7996, 'click', 414),
+(7997, 'view', 120),
+(7998, 'buy', 496),
+(7999, 'scroll', 491),
+(8000, 'click', 945),
+(8001, 'view', 177),
+(8002, 'buy', 931),
+(8003, 'scroll', 236),
+(8004, 'click', 436),
+(8005, 'view', 450),
+(8006, 'buy', 62),
+(8007, 'scroll', 121),
+(8008, 'click', 195),
+(8009, 'view', 69),
+(8010, 'buy', 272),
+(8011, 'scroll', 369),
+(8012, 'click', 454),
+(8013, 'view', 480),
+(8014, 'buy', 244),
+(8015, 'scroll', 959),
+(8016, 'click', 346),
+(8017, 'view', 568),
+(8018, 'buy', 58),
+(8019, 'scroll', 73),
+(8020, 'click', 521),
+(8021, 'view', 227),
+(8022, 'buy', 495),
+(8023, 'scroll', 762),
+(8024, 'click', 221),
+(8025, 'view', 576),
+(8026, 'buy', 625),
+(8027, 'scroll', 891),
+(8028, 'click', 985),
+(8029, 'view', 950),
+(8030, 'buy', 878),
+(8031, 'scroll', 385),
+(8032, 'click', 112),
+(8033, 'view', 61),
+(8034, 'buy', 966),
+(8035, 'scroll', 442),
+(8036, 'click', 537),
+(8037, 'view', 57),
+(8038, 'buy', 245),
+(8039, 'scroll', 534),
+(8040, 'click', 174),
+(8041, 'view', 522),
+(8042, 'buy', 885),
+(8043, 'scroll', 323),
+(8044, 'click', 217),
+(8045, 'view', 103),
+(8046, 'buy', 85),
+(8047, 'scroll', 488),
+(8048, 'click', 271),
+(8049, 'view', 479),
+(8050, 'buy', 946),
+(8051, 'scroll', 968),
+(8052, 'click', 471),
+(8053, 'view', 803),
+(8054, 'buy', 748),
+(8055, 'scroll', 134),
+(8056, 'click', 76),
+(8057, 'view', 826),
+(8058, 'buy', 463),
+(8059, 'scroll', 646),
+(8060, 'click', 325),
+(8061, 'view', 100),
+(8062, 'buy', 210),
+(8063, 'scroll', 287),
+(8064, 'click', 678),
+(8065, 'view', 808),
+(8066, 'buy', 369),
+(8067, 'scroll', 69),
+(8068, 'click', 122),
+(8069, 'view', 720),
+(8070, 'buy', 486),
+(8071, 'scroll', 493),
+(8072, 'click', 263),
+(8073, 'view', 184),
+(8074, 'buy', 521),
+(8075, 'scroll', 11),
+(8076, 'click', 642),
+(8077, 'view', 668),
+(8078, 'buy', 831),
+(8079, 'scroll', 527),
+(8080, 'click', 924),
+(8081, 'view', 25),
+(8082, 'buy', 659),
+(8083, 'scroll', 481),
+(8084, 'click', 703),
+(8085, 'view', 758),
+(8086, 'buy', 32),
+(8087, 'scroll', 550),
+(8088, 'click', 663),
+(8089, 'view', 239),
+(8090, 'buy', 791),
+(8091, 'scroll', 510),
+(8092, 'click', 680),
+(8093, 'view', 619),
+(8094, 'buy', 142),
+(8095, 'scroll', 666),
+(8096, 'click', 373),
+(8097, 'view', 148),
+(8098, 'buy', 396),
+(8099, 'scroll', 822),
+(8100, 'click', 908),
+(8101, 'view', 968),
+(8102, 'buy', 329),
+(8103, 'scroll', 758),
+(8104, 'click', 42),
+(8105, 'view', 877),
+(8106, 'buy', 878),
+(8107, 'scroll', 376),
+(8108, 'click', 672),
+(8109, 'view', 924),
+(8110, 'buy', 666),
+(8111, 'scroll', 186),
+(8112, 'click', 716),
+(8113, 'view', 232),
+(8114, 'buy', 16),
+(8115, 'scroll', 612),
+(8116, 'click', 469),
+(8117, 'view', 923),
+(8118, 'buy', 741),
+(8119, 'scroll', 83),
+(8120, 'click', 460),
+(8121, 'view', 222),
+(8122, 'buy', 870),
+(8123, 'scroll', 36),
+(8124, 'click', 292),
+(8125, 'view', 449),
+(8126, 'buy', 998),
+(8127, 'scroll', 143),
+(8128, 'click', 859),
+(8129, 'view', 196),
+(8130, 'buy', 311),
+(8131, 'scroll', 766),
+(8132, 'click', 321),
+(8133, 'view', 597),
+(8134, 'buy', 204),
+(8135, 'scroll', 961),
+(8136, 'click', 67),
+(8137, 'view', 411),
+(8138, 'buy', 25),
+(8139, 'scroll', 695),
+(8140, 'click', 169),
+(8141, 'view', 12),
+(8142, 'buy', 368),
+(8143, 'scroll', 971),
+(8144, 'click', 495),
+(8145, 'view', 238),
+(8146, 'buy', 67),
+(8147, 'scroll', 488),
+(8148, 'click', 382),
+(8149, 'view', 523),
+(8150, 'buy', 873),
+(8151, 'scroll', 971),
+(8152, 'click', 760),
+(8153, 'view', 503),
+(8154, 'buy', 688),
+(8155, 'scroll', 217),
+(8156, 'click', 636),
+(8157, 'view', 927),
+(8158, 'buy', 221),
+(8159, 'scroll', 197),
+(8160, 'click', 853),
+(8161, 'view', 481),
+(8162, 'buy', 206),
+(8163, 'scroll', 317),
+(8164, 'click', 803),
+(8165, 'view', 467),
+(8166, 'buy', 277),
+(8167, 'scroll', 231),
+(8168, 'click', 998),
+(8169, 'view', 984),
+(8170, 'buy', 773),
+(8171, 'scroll', 329),
+(8172, 'click', 32),
+(8173, 'view', 416),
+(8174, 'buy', 181),
+(8175, 'scroll', 351),
+(8176, 'click', 422),
+(8177, 'view', 684),
+(8178, 'buy', 725),
+(8179, 'scroll', 23),
+(8180, 'click', 582),
+(8181, 'view', 382),
+(8182, 'buy', 788),
+(8183, 'scroll', 165),
+(8184, 'click', 244),
+(8185, 'view', 847),
+(8186, 'buy', 857),
+(8187, 'scroll', 0),
+(8188, 'click', 158),
+(8189, 'view', 622),
+(8190, 'buy', 831),
+(8191, 'scroll', 264),
+(8192, 'click', 621),
+(8193, 'view', 465),
+(8194, 'buy', 486),
+(8195, 'scroll', 575),
+(8196, 'click', 561),
+(8197, 'view', 728),
+(8198, 'buy', 395),
+(8199, 'scroll', 140),
+(8200, 'click', 267),
+(8201, 'view', 246),
+(8202, 'buy', 575),
+(8203, 'scroll', 123),
+(8204, 'click', 280),
+(8205, 'view', 983),
+(8206, 'buy', 426),
+(8207, 'scroll', 152),
+(8208, 'click', 932),
+(8209, 'view', 140),
+(8210, 'buy', 534),
+(8211, 'scroll', 138),
+(8212, 'click', 595),
+(8213, 'view', 328),
+(8214, 'buy', 907),
+(8215, 'scroll', 771),
+(8216, 'click', 58),
+(8217, 'view', 171),
+(8218, 'buy', 239),
+(8219, 'scroll', 432),
+(8220, 'click', 171),
+(8221, 'view', 82),
+(8222, 'buy', 599),
+(8223, 'scroll', 839),
+(8224, 'click', 463),
+(8225, 'view', 808),
+(8226, 'buy', 418),
+(8227, 'scroll', 259),
+(8228, 'click', 909),
+(8229, 'view', 583),
+(8230, 'buy', 677),
+(8231, 'scroll', 228),
+(8232, 'click', 880),
+(8233, 'view', 154),
+(8234, 'buy', 979),
+(8235, 'scroll', 762),
+(8236, 'click', 275),
+(8237, 'view', 990),
+(8238, 'buy', 964),
+(8239, 'scroll', 729),
+(8240, 'click', 417),
+(8241, 'view', 97),
+(8242, 'buy', 52),
+(8243, 'scroll', 446),
+(8244, 'click', 936),
+(8245, 'view', 839),
+(8246, 'buy', 106),
+(8247, 'scroll', 990),
+(8248, 'click', 17),
+(8249, 'view', 925),
+(8250, 'buy', 296),
+(8251, 'scroll', 72),
+(8252, 'click', 295),
+(8253, 'view', 771),
+(8254, 'buy', 990),
+(8255, 'scroll', 179),
+(8256, 'click', 891),
+(8257, 'view', 141),
+(8258, 'buy', 430),
+(8259, 'scroll', 75),
+(8260, 'click', 542),
+(8261, 'view', 385),
+(8262, 'buy', 869),
+(8263, 'scroll', 307),
+(8264, 'click', 826),
+(8265, 'view', 679),
+(8266, 'buy', 669),
+(8267, 'scroll', 722),
+(8268, 'click', 525),
+(8269, 'view', 597),
+(8270, 'buy', 119),
+(8271, 'scroll', 456),
+(8272, 'click', 249),
+(8273, 'view', 511),
+(8274, 'buy', 673),
+(8275, 'scroll', 543),
+(8276, 'click', 600),
+(8277, 'view', 696),
+(8278, 'buy', 820),
+(8279, 'scroll', 378),
+(8280, 'click', 920),
+(8281, 'view', 534),
+(8282, 'buy', 985),
+(8283, 'scroll', 571),
+(8284, 'click', 197),
+(8285, 'view', 446),
+(8286, 'buy', 77),
+(8287, 'scroll', 606),
+(8288, 'click', 919),
+(8289, 'view', 259),
+(8290, 'buy', 584),
+(8291, 'scroll', 391),
+(8292, 'click', 185),
+(8293, 'view', 880),
+(8294, 'buy', 708),
+(8295, 'scroll', 979),
+(8296, 'click', 261),
+(8297, 'view', 658),
+(8298, 'buy', 242),
+(8299, 'scroll', 421),
+(8300, 'click', 375),
+(8301, 'view', 979),
+(8302, 'buy', 536),
+(8303, 'scroll', 263),
+(8304, 'click', 693),
+(8305, 'view', 841),
+(8306, 'buy', 75),
+(8307, 'scroll', 717),
+(8308, 'click', 759),
+(8309, 'view', 58),
+(8310, 'buy', 639),
+(8311, 'scroll', 698),
+(8312, 'click', 483),
+(8313, 'view', 217),
+(8314, 'buy', 688),
+(8315, 'scroll', 335),
+(8316, 'click', 818),
+(8317, 'view', 942),
+(8318, 'buy', 9),
+(8319, 'scroll', 455),
+(8320, 'click', 486),
+(8321, 'view', 348),
+(8322, 'buy', 694),
+(8323, 'scroll', 779),
+(8324, 'click', 726),
+(8325, 'view', 978),
+(8326, 'buy', 663),
+(8327, 'scroll', 911),
+(8328, 'click', 184),
+(8329, 'view', 476),
+(8330, 'buy', 981),
+(8331, 'scroll', 332),
+(8332, 'click', 804),
+(8333, 'view', 994),
+(8334, 'buy', 238),
+(8335, 'scroll', 440),
+(8336, 'click', 91),
+(8337, 'view', 980),
+(8338, 'buy', 994),
+(8339, 'scroll', 212),
+(8340, 'click', 555),
+(8341, 'view', 418),
+(8342, 'buy', 410),
+(8343, 'scroll', 984),
+(8344, 'click', 137),
+(8345, 'view', 921),
+(8346, 'buy', 765),
+(8347, 'scroll', 238),
+(8348, 'click', 379),
+(8349, 'view', 752),
+(8350, 'buy', 725),
+(8351, 'scroll', 368),
+(8352, 'click', 389),
+(8353, 'view', 679),
+(8354, 'buy', 506),
+(8355, 'scroll', 785),
+(8356, 'click', 373),
+(8357, 'view', 130),
+(8358, 'buy', 227),
+(8359, 'scroll', 655),
+(8360, 'click', 220),
+(8361, 'view', 900),
+(8362, 'buy', 272),
+(8363, 'scroll', 115),
+(8364, 'click', 36),
+(8365, 'view', 522),
+(8366, 'buy', 139),
+(8367, 'scroll', 905),
+(8368, 'click', 415),
+(8369, 'view', 630),
+(8370, 'buy', 430),
+(8371, 'scroll', 661),
+(8372, 'click', 79),
+(8373, 'view', 480),
+(8374, 'buy', 596),
+(8375, 'scroll', 465),
+(8376, 'click', 964),
+(8377, 'view', 340),
+(8378, 'buy', 590),
+(8379, 'scroll', 555),
+(8380, 'click', 364),
+(8381, 'view', 353),
+(8382, 'buy', 721),
+(8383, 'scroll', 776),
+(8384, 'click', 447),
+(8385, 'view', 322),
+(8386, 'buy', 179),
+(8387, 'scroll', 830),
+(8388, 'click', 493),
+(8389, 'view', 709),
+(8390, 'buy', 18),
+(8391, 'scroll', 692),
+(8392, 'click', 692),
+(8393, 'view', 799),
+(8394, 'buy', 164),
+(8395, 'scroll', 403),
+(8396, 'click', 378),
+(8397, 'view', 119),
+(8398, 'buy', 985),
+(8399, 'scroll', 644),
+(8400, 'click', 785),
+(8401, 'view', 299),
+(8402, 'buy', 855),
+(8403, 'scroll', 563),
+(8404, 'click', 657),
+(8405, 'view', 208),
+(8406, 'buy', 649),
+(8407, 'scroll', 254),
+(8408, 'click', 721),
+(8409, 'view', 606),
+(8410, 'buy', 989),
+(8411, 'scroll', 787),
+(8412, 'click', 201),
+(8413, 'view', 378),
+(8414, 'buy', 784),
+(8415, 'scroll', 870),
+(8416, 'click', 308),
+(8417, 'view', 664),
+(8418, 'buy', 261),
+(8419, 'scroll', 167),
+(8420, 'click', 841),
+(8421, 'view', 66),
+(8422, 'buy', 615),
+(8423, 'scroll', 465),
+(8424, 'click', 870),
+(8425, 'view', 681),
+(8426, 'buy', 896),
+(8427, 'scroll', 785),
+(8428, 'click', 602),
+(8429, 'view', 46),
+(8430, 'buy', 203),
+(8431, 'scroll', 918),
+(8432, 'click', 15),
+(8433, 'view', 609),
+(8434, 'buy', 547),
+(8435, 'scroll', 422),
+(8436, 'click', 743),
+(8437, 'view', 574),
+(8438, 'buy', 278),
+(8439, 'scroll', 29),
+(8440, 'click', 71),
+(8441, 'view', 817),
+(8442, 'buy', 4),
+(8443, 'scroll', 857),
+(8444, 'click', 177),
+(8445, 'view', 87),
+(8446, 'buy', 712),
+(8447, 'scroll', 254),
+(8448, 'click', 4),
+(8449, 'view', 177),
+(8450, 'buy', 235),
+(8451, 'scroll', 178),
+(8452, 'click', 271),
+(8453, 'view', 922),
+(8454, 'buy', 728),
+(8455, 'scroll', 804),
+(8456, 'click', 242),
+(8457, 'view', 19),
+(8458, 'buy', 24),
+(8459, 'scroll', 116),
+(8460, 'click', 84),
+(8461, 'view', 957),
+(8462, 'buy', 90),
+(8463, 'scroll', 993),
+(8464, 'click', 203),
+(8465, 'view', 152),
+(8466, 'buy', 481),
+(8467, 'scroll', 343),
+(8468, 'click', 75),
+(8469, 'view', 534),
+(8470, 'buy', 357),
+(8471, 'scroll', 327),
+(8472, 'click', 298),
+(8473, 'view', 427),
+(8474, 'buy', 765),
+(8475, 'scroll', 490),
+(8476, 'click', 895),
+(8477, 'view', 264),
+(8478, 'buy', 341),
+(8479, 'scroll', 56),
+(8480, 'click', 949),
+(8481, 'view', 85),
+(8482, 'buy', 270),
+(8483, 'scroll', 166),
+(8484, 'click', 271),
+(8485, 'view', 93),
+(8486, 'buy', 64),
+(8487, 'scroll', 639),
+(8488, 'click', 53),
+(8489, 'view', 713),
+(8490, 'buy', 996),
+(8491, 'scroll', 269),
+(8492, 'click', 134),
+(8493, 'view', 810),
+(8494, 'buy', 888),
+(8495, 'scroll', 746),
+(8496, 'click', 336),
+(8497, 'view', 349),
+(8498, 'buy', 513),
+(8499, 'scroll', 503),
+(8500, 'click', 144),
+(8501, 'view', 192),
+(8502, 'buy', 619),
+(8503, 'scroll', 951),
+(8504, 'click', 573),
+(8505, 'view', 824),
+(8506, 'buy', 52),
+(8507, 'scroll', 769),
+(8508, 'click', 157),
+(8509, 'view', 859),
+(8510, 'buy', 709),
+(8511, 'scroll', 432),
+(8512, 'click', 394),
+(8513, 'view', 302),
+(8514, 'buy', 734),
+(8515, 'scroll', 17),
+(8516, 'click', 234),
+(8517, 'view', 318),
+(8518, 'buy', 816),
+(8519, 'scroll', 73),
+(8520, 'click', 821),
+(8521, 'view', 483),
+(8522, 'buy', 96),
+(8523, 'scroll', 67),
+(8524, 'click', 600),
+(8525, 'view', 155),
+(8526, 'buy', 195),
+(8527, 'scroll', 812),
+(8528, 'click', 724),
+(8529, 'view', 463),
+(8530, 'buy', 823),
+(8531, 'scroll', 479),
+(8532, 'click', 810),
+(8533, 'view', 834),
+(8534, 'buy', 236),
+(8535, 'scroll', 637),
+(8536, 'click', 95),
+(8537, 'view', 844),
+(8538, 'buy', 679),
+(8539, 'scroll', 483),
+(8540, 'click', 578),
+(8541, 'view', 445),
+(8542, 'buy', 141),
+(8543, 'scroll', 13),
+(8544, 'click', 197),
+(8545, 'view', 955),
+(8546, 'buy', 596),
+(8547, 'scroll', 220),
+(8548, 'click', 110),
+(8549, 'view', 860),
+(8550, 'buy', 649),
+(8551, 'scroll', 468),
+(8552, 'click', 246),
+(8553, 'view', 768),
+(8554, 'buy', 264),
+(8555, 'scroll', 513),
+(8556, 'click', 433),
+(8557, 'view', 534),
+(8558, 'buy', 545),
+(8559, 'scroll', 339),
+(8560, 'click', 741),
+(8561, 'view', 58),
+(8562, 'buy', 31),
+(8563, 'scroll', 234),
+(8564, 'click', 741),
+(8565, 'view', 24),
+(8566, 'buy', 226),
+(8567, 'scroll', 525),
+(8568, 'click', 297),
+(8569, 'view', 216),
+(8570, 'buy', 655),
+(8571, 'scroll', 735),
+(8572, 'click', 707),
+(8573, 'view', 465),
+(8574, 'buy', 629),
+(8575, 'scroll', 196),
+(8576, 'click', 923),
+(8577, 'view', 188),
+(8578, 'buy', 209),
+(8579, 'scroll', 318),
+(8580, 'click', 678),
+(8581, 'view', 920),
+(8582, 'buy', 267),
+(8583, 'scroll', 134),
+(8584, 'click', 161),
+(8585, 'view', 63),
+(8586, 'buy', 231),
+(8587, 'scroll', 474),
+(8588, 'click', 789),
+(8589, 'view', 347),
+(8590, 'buy', 846),
+(8591, 'scroll', 720),
+(8592, 'click', 733),
+(8593, 'view', 697),
+(8594, 'buy', 981),
+(8595, 'scroll', 718),
+(8596, 'click', 813),
+(8597, 'view', 824),
+(8598, 'buy', 317),
+(8599, 'scroll', 406),
+(8600, 'click', 323),
+(8601, 'view', 535),
+(8602, 'buy', 738),
+(8603, 'scroll', 313),
+(8604, 'click', 56),
+(8605, 'view', 793),
+(8606, 'buy', 623),
+(8607, 'scroll', 323),
+(8608, 'click', 91),
+(8609, 'view', 300),
+(8610, 'buy', 50),
+(8611, 'scroll', 332),
+(8612, 'click', 526),
+(8613, 'view', 242),
+(8614, 'buy', 154),
+(8615, 'scroll', 179),
+(8616, 'click', 954),
+(8617, 'view', 644),
+(8618, 'buy', 898),
+(8619, 'scroll', 251),
+(8620, 'click', 472),
+(8621, 'view', 30),
+(8622, 'buy', 202),
+(8623, 'scroll', 328),
+(8624, 'click', 122),
+(8625, 'view', 803),
+(8626, 'buy', 518),
+(8627, 'scroll', 735),
+(8628, 'click', 533),
+(8629, 'view', 890),
+(8630, 'buy', 371),
+(8631, 'scroll', 702),
+(8632, 'click', 733),
+(8633, 'view', 487),
+(8634, 'buy', 541),
+(8635, 'scroll', 318),
+(8636, 'click', 794),
+(8637, 'view', 76),
+(8638, 'buy', 108),
+(8639, 'scroll', 674),
+(8640, 'click', 71),
+(8641, 'view', 638),
+(8642, 'buy', 396),
+(8643, 'scroll', 447),
+(8644, 'click', 495),
+(8645, 'view', 68),
+(8646, 'buy', 258),
+(8647, 'scroll', 822),
+(8648, 'click', 684),
+(8649, 'view', 525),
+(8650, 'buy', 227),
+(8651, 'scroll', 460),
+(8652, 'click', 325),
+(8653, 'view', 872),
+(8654, 'buy', 488),
+(8655, 'scroll', 960),
+(8656, 'click', 729),
+(8657, 'view', 428),
+(8658, 'buy', 788),
+(8659, 'scroll', 722),
+(8660, 'click', 380),
+(8661, 'view', 547),
+(8662, 'buy', 457),
+(8663, 'scroll', 798),
+(8664, 'click', 949),
+(8665, 'view', 742),
+(8666, 'buy', 956),
+(8667, 'scroll', 322),
+(8668, 'click', 633),
+(8669, 'view', 52),
+(8670, 'buy', 107),
+(8671, 'scroll', 787),
+(8672, 'click', 466),
+(8673, 'view', 89),
+(8674, 'buy', 652),
+(8675, 'scroll', 944),
+(8676, 'click', 285),
+(8677, 'view', 136),
+(8678, 'buy', 38),
+(8679, 'scroll', 878),
+(8680, 'click', 966),
+(8681, 'view', 931),
+(8682, 'buy', 570),
+(8683, 'scroll', 132),
+(8684, 'click', 64),
+(8685, 'view', 477),
+(8686, 'buy', 700),
+(8687, 'scroll', 634),
+(8688, 'click', 35),
+(8689, 'view', 307),
+(8690, 'buy', 673),
+(8691, 'scroll', 70),
+(8692, 'click', 872),
+(8693, 'view', 768),
+(8694, 'buy', 676),
+(8695, 'scroll', 789),
+(8696, 'click', 348),
+(8697, 'view', 447),
+(8698, 'buy', 532),
+(8699, 'scroll', 87),
+(8700, 'click', 148),
+(8701, 'view', 403),
+(8702, 'buy', 714),
+(8703, 'scroll', 96),
+(8704, 'click', 733),
+(8705, 'view', 986),
+(8706, 'buy', 753),
+(8707, 'scroll', 52),
+(8708, 'click', 32),
+(8709, 'view', 294),
+(8710, 'buy', 931),
+(8711, 'scroll', 786),
+(8712, 'click', 686),
+(8713, 'view', 138),
+(8714, 'buy', 542),
+(8715, 'scroll', 109),
+(8716, 'click', 716),
+(8717, 'view', 72),
+(8718, 'buy', 323),
+(8719, 'scroll', 167),
+(8720, 'click', 838),
+(8721, 'view', 544),
+(8722, 'buy', 618),
+(8723, 'scroll', 853),
+(8724, 'click', 416),
+(8725, 'view', 173),
+(8726, 'buy', 245),
+(8727, 'scroll', 177),
+(8728, 'click', 396),
+(8729, 'view', 783),
+(8730, 'buy', 826),
+(8731, 'scroll', 436),
+(8732, 'click', 724),
+(8733, 'view', 346),
+(8734, 'buy', 371),
+(8735, 'scroll', 126),
+(8736, 'click', 912),
+(8737, 'view', 248),
+(8738, 'buy', 469),
+(8739, 'scroll', 995),
+(8740, 'click', 565),
+(8741, 'view', 119),
+(8742, 'buy', 93),
+(8743, 'scroll', 265),
+(8744, 'click', 965),
+(8745, 'view', 758),
+(8746, 'buy', 962),
+(8747, 'scroll', 913),
+(8748, 'click', 737),
+(8749, 'view', 925),
+(8750, 'buy', 395),
+(8751, 'scroll', 484),
+(8752, 'click', 231),
+(8753, 'view', 979),
+(8754, 'buy', 189),
+(8755, 'scroll', 618),
+(8756, 'click', 830),
+(8757, 'view', 295),
+(8758, 'buy', 776),
+(8759, 'scroll', 476),
+(8760, 'click', 402),
+(8761, 'view', 733),
+(8762, 'buy', 206),
+(8763, 'scroll', 751),
+(8764, 'click', 806),
+(8765, 'view', 132),
+(8766, 'buy', 766),
+(8767, 'scroll', 198),
+(8768, 'click', 937),
+(8769, 'view', 981),
+(8770, 'buy', 502),
+(8771, 'scroll', 109),
+(8772, 'click', 888),
+(8773, 'view', 832),
+(8774, 'buy', 525),
+(8775, 'scroll', 346),
+(8776, 'click', 821),
+(8777, 'view', 253),
+(8778, 'buy', 28),
+(8779, 'scroll', 261),
+(8780, 'click', 525),
+(8781, 'view', 480),
+(8782, 'buy', 833),
+(8783, 'scroll', 712),
+(8784, 'click', 152),
+(8785, 'view', 999),
+(8786, 'buy', 875),
+(8787, 'scroll', 630),
+(8788, 'click', 328),
+(8789, 'view', 320),
+(8790, 'buy', 176),
+(8791, 'scroll', 746),
+(8792, 'click', 762),
+(8793, 'view', 869),
+(8794, 'buy', 349),
+(8795, 'scroll', 699),
+(8796, 'click', 192),
+(8797, 'view', 675),
+(8798, 'buy', 428),
+(8799, 'scroll', 57),
+(8800, 'click', 841),
+(8801, 'view', 0),
+(8802, 'buy', 883),
+(8803, 'scroll', 237),
+(8804, 'click', 588),
+(8805, 'view', 352),
+(8806, 'buy', 10),
+(8807, 'scroll', 806),
+(8808, 'click', 781),
+(8809, 'view', 260),
+(8810, 'buy', 621),
+(8811, 'scroll', 40),
+(8812, 'click', 920),
+(8813, 'view', 38),
+(8814, 'buy', 974),
+(8815, 'scroll', 334),
+(8816, 'click', 233),
+(8817, 'view', 868),
+(8818, 'buy', 325),
+(8819, 'scroll', 838),
+(8820, 'click', 902),
+(8821, 'view', 272),
+(8822, 'buy', 972),
+(8823, 'scroll', 374),
+(8824, 'click', 308),
+(8825, 'view', 383),
+(8826, 'buy', 632),
+(8827, 'scroll', 361),
+(8828, 'click', 403),
+(8829, 'view', 387),
+(8830, 'buy', 290),
+(8831, 'scroll', 112),
+(8832, 'click', 965),
+(8833, 'view', 232),
+(8834, 'buy', 12),
+(8835, 'scroll', 931),
+(8836, 'click', 692),
+(8837, 'view', 420),
+(8838, 'buy', 774),
+(8839, 'scroll', 651),
+(8840, 'click', 788),
+(8841, 'view', 908),
+(8842, 'buy', 580),
+(8843, 'scroll', 773),
+(8844, 'click', 933),
+(8845, 'view', 250),
+(8846, 'buy', 836),
+(8847, 'scroll', 941),
+(8848, 'click', 659),
+(8849, 'view', 823),
+(8850, 'buy', 53),
+(8851, 'scroll', 910),
+(8852, 'click', 745),
+(8853, 'view', 175),
+(8854, 'buy', 772),
+(8855, 'scroll', 154),
+(8856, 'click', 832),
+(8857, 'view', 314),
+(8858, 'buy', 259),
+(8859, 'scroll', 516),
+(8860, 'click', 671),
+(8861, 'view', 333),
+(8862, 'buy', 389),
+(8863, 'scroll', 447),
+(8864, 'click', 859),
+(8865, 'view', 314),
+(8866, 'buy', 136),
+(8867, 'scroll', 245),
+(8868, 'click', 552),
+(8869, 'view', 730),
+(8870, 'buy', 344),
+(8871, 'scroll', 686),
+(8872, 'click', 840),
+(8873, 'view', 56),
+(8874, 'buy', 353),
+(8875, 'scroll', 917),
+(8876, 'click', 864),
+(8877, 'view', 176),
+(8878, 'buy', 868),
+(8879, 'scroll', 327),
+(8880, 'click', 899),
+(8881, 'view', 792),
+(8882, 'buy', 142),
+(8883, 'scroll', 877),
+(8884, 'click', 960),
+(8885, 'view', 977),
+(8886, 'buy', 762),
+(8887, 'scroll', 894),
+(8888, 'click', 693),
+(8889, 'view', 555),
+(8890, 'buy', 668),
+(8891, 'scroll', 932),
+(8892, 'click', 49),
+(8893, 'view', 812),
+(8894, 'buy', 891),
+(8895, 'scroll', 862),
+(8896, 'click', 560),
+(8897, 'view', 466),
+(8898, 'buy', 968),
+(8899, 'scroll', 347),
+(8900, 'click', 481),
+(8901, 'view', 801),
+(8902, 'buy', 472),
+(8903, 'scroll', 801),
+(8904, 'click', 766),
+(8905, 'view', 890),
+(8906, 'buy', 857),
+(8907, 'scroll', 219),
+(8908, 'click', 746),
+(8909, 'view', 348),
+(8910, 'buy', 369),
+(8911, 'scroll', 255),
+(8912, 'click', 65),
+(8913, 'view', 102),
+(8914, 'buy', 121),
+(8915, 'scroll', 334),
+(8916, 'click', 907),
+(8917, 'view', 26),
+(8918, 'buy', 924),
+(8919, 'scroll', 815),
+(8920, 'click', 26),
+(8921, 'view', 232),
+(8922, 'buy', 378),
+(8923, 'scroll', 72),
+(8924, 'click', 629),
+(8925, 'view', 69),
+(8926, 'buy', 509),
+(8927, 'scroll', 758),
+(8928, 'click', 53),
+(8929, 'view', 203),
+(8930, 'buy', 880),
+(8931, 'scroll', 473),
+(8932, 'click', 655),
+(8933, 'view', 411),
+(8934, 'buy', 318),
+(8935, 'scroll', 821),
+(8936, 'click', 488),
+(8937, 'view', 976),
+(8938, 'buy', 387),
+(8939, 'scroll', 317),
+(8940, 'click', 653),
+(8941, 'view', 647),
+(8942, 'buy', 908),
+(8943, 'scroll', 916),
+(8944, 'click', 590),
+(8945, 'view', 481),
+(8946, 'buy', 326),
+(8947, 'scroll', 921),
+(8948, 'click', 353),
+(8949, 'view', 751),
+(8950, 'buy', 859),
+(8951, 'scroll', 319),
+(8952, 'click', 756),
+(8953, 'view', 894),
+(8954, 'buy', 360),
+(8955, 'scroll', 587),
+(8956, 'click', 936),
+(8957, 'view', 108),
+(8958, 'buy', 614),
+(8959, 'scroll', 601),
+(8960, 'click', 849),
+(8961, 'view', 917),
+(8962, 'buy', 530),
+(8963, 'scroll', 70),
+(8964, 'click', 495),
+(8965, 'view', 456),
+(8966, 'buy', 426),
+(8967, 'scroll', 12),
+(8968, 'click', 901),
+(8969, 'view', 978),
+(8970, 'buy', 681),
+(8971, 'scroll', 232),
+(8972, 'click', 212),
+(8973, 'view', 213),
+(8974, 'buy', 371),
+(8975, 'scroll', 555),
+(8976, 'click', 371),
+(8977, 'view', 949),
+(8978, 'buy', 981),
+(8979, 'scroll', 674),
+(8980, 'click', 712),
+(8981, 'view', 883),
+(8982, 'buy', 127),
+(8983, 'scroll', 670),
+(8984, 'click', 936),
+(8985, 'view', 582),
+(8986, 'buy', 35),
+(8987, 'scroll', 472),
+(8988, 'click', 605),
+(8989, 'view', 582),
+(8990, 'buy', 442),
+(8991, 'scroll', 24),
+(8992, 'click', 734),
+(8993, 'view', 134),
+(8994, 'buy', 439),
+(8995, 'scroll', 94),
+(8996, 'click', 188),
+(8997, 'view', 536),
+(8998, 'buy', 297),
+(8999, 'scroll', 840),
+(9000, 'click', 527),
+(9001, 'view', 807),
+(9002, 'buy', 762),
+(9003, 'scroll', 365),
+(9004, 'click', 103),
+(9005, 'view', 227),
+(9006, 'buy', 812),
+(9007, 'scroll', 762),
+(9008, 'click', 618),
+(9009, 'view', 820),
+(9010, 'buy', 59),
+(9011, 'scroll', 224),
+(9012, 'click', 375),
+(9013, 'view', 904),
+(9014, 'buy', 964),
+(9015, 'scroll', 755),
+(9016, 'click', 443),
+(9017, 'view', 161),
+(9018, 'buy', 389),
+(9019, 'scroll', 652),
+(9020, 'click', 726),
+(9021, 'view', 78),
+(9022, 'buy', 952),
+(9023, 'scroll', 426),
+(9024, 'click', 206),
+(9025, 'view', 335),
+(9026, 'buy', 309),
+(9027, 'scroll', 336),
+(9028, 'click', 527),
+(9029, 'view', 749),
+(9030, 'buy', 995),
+(9031, 'scroll', 191),
+(9032, 'click', 503),
+(9033, 'view', 559),
+(9034, 'buy', 770),
+(9035, 'scroll', 512),
+(9036, 'click', 11),
+(9037, 'view', 684),
+(9038, 'buy', 892),
+(9039, 'scroll', 146),
+(9040, 'click', 619),
+(9041, 'view', 979),
+(9042, 'buy', 387),
+(9043, 'scroll', 851),
+(9044, 'click', 574),
+(9045, 'view', 921),
+(9046, 'buy', 814),
+(9047, 'scroll', 168),
+(9048, 'click', 187),
+(9049, 'view', 17),
+(9050, 'buy', 932),
+(9051, 'scroll', 664),
+(9052, 'click', 564),
+(9053, 'view', 900),
+(9054, 'buy', 777),
+(9055, 'scroll', 115),
+(9056, 'click', 889),
+(9057, 'view', 582),
+(9058, 'buy', 370),
+(9059, 'scroll', 54),
+(9060, 'click', 946),
+(9061, 'view', 56),
+(9062, 'buy', 212),
+(9063, 'scroll', 517),
+(9064, 'click', 23),
+(9065, 'view', 922),
+(9066, 'buy', 514),
+(9067, 'scroll', 871),
+(9068, 'click', 920),
+(9069, 'view', 731),
+(9070, 'buy', 922),
+(9071, 'scroll', 729),
+(9072, 'click', 977),
+(9073, 'view', 220),
+(9074, 'buy', 523),
+(9075, 'scroll', 473),
+(9076, 'click', 955),
+(9077, 'view', 158),
+(9078, 'buy', 573),
+(9079, 'scroll', 218),
+(9080, 'click', 147),
+(9081, 'view', 156),
+(9082, 'buy', 646),
+(9083, 'scroll', 448),
+(9084, 'click', 822),
+(9085, 'view', 31),
+(9086, 'buy', 434),
+(9087, 'scroll', 139),
+(9088, 'click', 616),
+(9089, 'view', 704),
+(9090, 'buy', 265),
+(9091, 'scroll', 618),
+(9092, 'click', 282),
+(9093, 'view', 239),
+(9094, 'buy', 430),
+(9095, 'scroll', 221),
+(9096, 'click', 525),
+(9097, 'view', 643),
+(9098, 'buy', 479),
+(9099, 'scroll', 55),
+(9100, 'click', 94),
+(9101, 'view', 792),
+(9102, 'buy', 5),
+(9103, 'scroll', 821),
+(9104, 'click', 348),
+(9105, 'view', 924),
+(9106, 'buy', 734),
+(9107, 'scroll', 169),
+(9108, 'click', 766),
+(9109, 'view', 801),
+(9110, 'buy', 242),
+(9111, 'scroll', 551),
+(9112, 'click', 261),
+(9113, 'view', 237),
+(9114, 'buy', 529),
+(9115, 'scroll', 841),
+(9116, 'click', 179),
+(9117, 'view', 237),
+(9118, 'buy', 617),
+(9119, 'scroll', 179),
+(9120, 'click', 925),
+(9121, 'view', 893),
+(9122, 'buy', 206),
+(9123, 'scroll', 999),
+(9124, 'click', 599),
+(9125, 'view', 738),
+(9126, 'buy', 738),
+(9127, 'scroll', 112),
+(9128, 'click', 767),
+(9129, 'view', 473),
+(9130, 'buy', 729),
+(9131, 'scroll', 608),
+(9132, 'click', 727),
+(9133, 'view', 221),
+(9134, 'buy', 279),
+(9135, 'scroll', 856),
+(9136, 'click', 858),
+(9137, 'view', 434),
+(9138, 'buy', 947),
+(9139, 'scroll', 523),
+(9140, 'click', 53),
+(9141, 'view', 500),
+(9142, 'buy', 966),
+(9143, 'scroll', 1),
+(9144, 'click', 453),
+(9145, 'view', 890),
+(9146, 'buy', 88),
+(9147, 'scroll', 889),
+(9148, 'click', 71),
+(9149, 'view', 919),
+(9150, 'buy', 815),
+(9151, 'scroll', 572),
+(9152, 'click', 693),
+(9153, 'view', 425),
+(9154, 'buy', 145),
+(9155, 'scroll', 327),
+(9156, 'click', 471),
+(9157, 'view', 175),
+(9158, 'buy', 654),
+(9159, 'scroll', 221),
+(9160, 'click', 556),
+(9161, 'view', 344),
+(9162, 'buy', 418),
+(9163, 'scroll', 784),
+(9164, 'click', 738),
+(9165, 'view', 251),
+(9166, 'buy', 203),
+(9167, 'scroll', 233),
+(9168, 'click', 165),
+(9169, 'view', 890),
+(9170, 'buy', 419),
+(9171, 'scroll', 365),
+(9172, 'click', 633),
+(9173, 'view', 446),
+(9174, 'buy', 310),
+(9175, 'scroll', 317),
+(9176, 'click', 165),
+(9177, 'view', 650),
+(9178, 'buy', 223),
+(9179, 'scroll', 456),
+(9180, 'click', 87),
+(9181, 'view', 145),
+(9182, 'buy', 197),
+(9183, 'scroll', 603),
+(9184, 'click', 323),
+(9185, 'view', 127),
+(9186, 'buy', 516),
+(9187, 'scroll', 303),
+(9188, 'click', 188),
+(9189, 'view', 427),
+(9190, 'buy', 491),
+(9191, 'scroll', 860),
+(9192, 'click', 450),
+(9193, 'view', 787),
+(9194, 'buy', 996),
+(9195, 'scroll', 606),
+(9196, 'click', 497),
+(9197, 'view', 484),
+(9198, 'buy', 967),
+(9199, 'scroll', 283),
+(9200, 'click', 482),
+(9201, 'view', 530),
+(9202, 'buy', 202),
+(9203, 'scroll', 483),
+(9204, 'click', 606),
+(9205, 'view', 521),
+(9206, 'buy', 148),
+(9207, 'scroll', 512),
+(9208, 'click', 173),
+(9209, 'view', 238),
+(9210, 'buy', 75),
+(9211, 'scroll', 360),
+(9212, 'click', 718),
+(9213, 'view', 392),
+(9214, 'buy', 990),
+(9215, 'scroll', 71),
+(9216, 'click', 413),
+(9217, 'view', 102),
+(9218, 'buy', 362),
+(9219, 'scroll', 751),
+(9220, 'click', 435),
+(9221, 'view', 343),
+(9222, 'buy', 360),
+(9223, 'scroll', 721),
+(9224, 'click', 707),
+(9225, 'view', 860),
+(9226, 'buy', 401),
+(9227, 'scroll', 660),
+(9228, 'click', 155),
+(9229, 'view', 476),
+(9230, 'buy', 885),
+(9231, 'scroll', 854),
+(9232, 'click', 586),
+(9233, 'view', 561),
+(9234, 'buy', 6),
+(9235, 'scroll', 42),
+(9236, 'click', 869),
+(9237, 'view', 803),
+(9238, 'buy', 745),
+(9239, 'scroll', 488),
+(9240, 'click', 362),
+(9241, 'view', 521),
+(9242, 'buy', 645),
+(9243, 'scroll', 729),
+(9244, 'click', 942),
+(9245, 'view', 694),
+(9246, 'buy', 411),
+(9247, 'scroll', 974),
+(9248, 'click', 442),
+(9249, 'view', 634),
+(9250, 'buy', 305),
+(9251, 'scroll', 160),
+(9252, 'click', 567),
+(9253, 'view', 668),
+(9254, 'buy', 678),
+(9255, 'scroll', 764),
+(9256, 'click', 752),
+(9257, 'view', 4),
+(9258, 'buy', 972),
+(9259, 'scroll', 702),
+(9260, 'click', 148),
+(9261, 'view', 641),
+(9262, 'buy', 374),
+(9263, 'scroll', 694),
+(9264, 'click', 872),
+(9265, 'view', 408),
+(9266, 'buy', 810),
+(9267, 'scroll', 334),
+(9268, 'click', 604),
+(9269, 'view', 585),
+(9270, 'buy', 693),
+(9271, 'scroll', 224),
+(9272, 'click', 348),
+(9273, 'view', 820),
+(9274, 'buy', 967),
+(9275, 'scroll', 160),
+(9276, 'click', 562),
+(9277, 'view', 565),
+(9278, 'buy', 412),
+(9279, 'scroll', 666),
+(9280, 'click', 186),
+(9281, 'view', 292),
+(9282, 'buy', 118),
+(9283, 'scroll', 139),
+(9284, 'click', 919),
+(9285, 'view', 926),
+(9286, 'buy', 819),
+(9287, 'scroll', 998),
+(9288, 'click', 27),
+(9289, 'view', 631),
+(9290, 'buy', 330),
+(9291, 'scroll', 825),
+(9292, 'click', 491),
+(9293, 'view', 451),
+(9294, 'buy', 507),
+(9295, 'scroll', 281),
+(9296, 'click', 372),
+(9297, 'view', 533),
+(9298, 'buy', 916),
+(9299, 'scroll', 20),
+(9300, 'click', 358),
+(9301, 'view', 562),
+(9302, 'buy', 544),
+(9303, 'scroll', 810),
+(9304, 'click', 951),
+(9305, 'view', 332),
+(9306, 'buy', 654),
+(9307, 'scroll', 960),
+(9308, 'click', 488),
+(9309, 'view', 119),
+(9310, 'buy', 340),
+(9311, 'scroll', 260),
+(9312, 'click', 396),
+(9313, 'view', 624),
+(9314, 'buy', 623),
+(9315, 'scroll', 578),
+(9316, 'click', 804),
+(9317, 'view', 877),
+(9318, 'buy', 266),
+(9319, 'scroll', 17),
+(9320, 'click', 379),
+(9321, 'view', 819),
+(9322, 'buy', 397),
+(9323, 'scroll', 68),
+(9324, 'click', 371),
+(9325, 'view', 829),
+(9326, 'buy', 934),
+(9327, 'scroll', 643),
+(9328, 'click', 551),
+(9329, 'view', 12),
+(9330, 'buy', 282),
+(9331, 'scroll', 912),
+(9332, 'click', 340),
+(9333, 'view', 294),
+(9334, 'buy', 841),
+(9335, 'scroll', 506),
+(9336, 'click', 164),
+(9337, 'view', 961),
+(9338, 'buy', 706),
+(9339, 'scroll', 386),
+(9340, 'click', 22),
+(9341, 'view', 77),
+(9342, 'buy', 197),
+(9343, 'scroll', 214),
+(9344, 'click', 60),
+(9345, 'view', 754),
+(9346, 'buy', 824),
+(9347, 'scroll', 143),
+(9348, 'click', 150),
+(9349, 'view', 318),
+(9350, 'buy', 233),
+(9351, 'scroll', 224),
+(9352, 'click', 58),
+(9353, 'view', 447),
+(9354, 'buy', 270),
+(9355, 'scroll', 124),
+(9356, 'click', 751),
+(9357, 'view', 994),
+(9358, 'buy', 737),
+(9359, 'scroll', 928),
+(9360, 'click', 932),
+(9361, 'view', 109),
+(9362, 'buy', 969),
+(9363, 'scroll', 147),
+(9364, 'click', 564),
+(9365, 'view', 564),
+(9366, 'buy', 944),
+(9367, 'scroll', 996),
+(9368, 'click', 91),
+(9369, 'view', 791),
+(9370, 'buy', 947),
+(9371, 'scroll', 152),
+(9372, 'click', 444),
+(9373, 'view', 857),
+(9374, 'buy', 197),
+(9375, 'scroll', 40),
+(9376, 'click', 766),
+(9377, 'view', 508),
+(9378, 'buy', 879),
+(9379, 'scroll', 747),
+(9380, 'click', 395),
+(9381, 'view', 432),
+(9382, 'buy', 95),
+(9383, 'scroll', 644),
+(9384, 'click', 893),
+(9385, 'view', 725),
+(9386, 'buy', 771),
+(9387, 'scroll', 183),
+(9388, 'click', 611),
+(9389, 'view', 129),
+(9390, 'buy', 308),
+(9391, 'scroll', 39),
+(9392, 'click', 86),
+(9393, 'view', 57),
+(9394, 'buy', 164),
+(9395, 'scroll', 127),
+(9396, 'click', 39),
+(9397, 'view', 22),
+(9398, 'buy', 335),
+(9399, 'scroll', 725),
+(9400, 'click', 711),
+(9401, 'view', 645),
+(9402, 'buy', 172),
+(9403, 'scroll', 115),
+(9404, 'click', 474),
+(9405, 'view', 165),
+(9406, 'buy', 109),
+(9407, 'scroll', 185),
+(9408, 'click', 202),
+(9409, 'view', 623),
+(9410, 'buy', 366),
+(9411, 'scroll', 688),
+(9412, 'click', 963),
+(9413, 'view', 992),
+(9414, 'buy', 202),
+(9415, 'scroll', 369),
+(9416, 'click', 123),
+(9417, 'view', 877),
+(9418, 'buy', 444),
+(9419, 'scroll', 333),
+(9420, 'click', 400),
+(9421, 'view', 418),
+(9422, 'buy', 259),
+(9423, 'scroll', 456),
+(9424, 'click', 238),
+(9425, 'view', 494),
+(9426, 'buy', 998),
+(9427, 'scroll', 25),
+(9428, 'click', 689),
+(9429, 'view', 722),
+(9430, 'buy', 921),
+(9431, 'scroll', 179),
+(9432, 'click', 169),
+(9433, 'view', 184),
+(9434, 'buy', 914),
+(9435, 'scroll', 155),
+(9436, 'click', 812),
+(9437, 'view', 359),
+(9438, 'buy', 641),
+(9439, 'scroll', 754),
+(9440, 'click', 670),
+(9441, 'view', 60),
+(9442, 'buy', 456),
+(9443, 'scroll', 542),
+(9444, 'click', 637),
+(9445, 'view', 697),
+(9446, 'buy', 927),
+(9447, 'scroll', 34),
+(9448, 'click', 801),
+(9449, 'view', 450),
+(9450, 'buy', 560),
+(9451, 'scroll', 809),
+(9452, 'click', 905),
+(9453, 'view', 589),
+(9454, 'buy', 14),
+(9455, 'scroll', 462),
+(9456, 'click', 449),
+(9457, 'view', 902),
+(9458, 'buy', 23),
+(9459, 'scroll', 615),
+(9460, 'click', 648),
+(9461, 'view', 345),
+(9462, 'buy', 676),
+(9463, 'scroll', 405),
+(9464, 'click', 523),
+(9465, 'view', 965),
+(9466, 'buy', 151),
+(9467, 'scroll', 880),
+(9468, 'click', 49),
+(9469, 'view', 936),
+(9470, 'buy', 805),
+(9471, 'scroll', 574),
+(9472, 'click', 528),
+(9473, 'view', 145),
+(9474, 'buy', 508),
+(9475, 'scroll', 179),
+(9476, 'click', 704),
+(9477, 'view', 392),
+(9478, 'buy', 160),
+(9479, 'scroll', 707),
+(9480, 'click', 661),
+(9481, 'view', 4),
+(9482, 'buy', 512),
+(9483, 'scroll', 821),
+(9484, 'click', 944),
+(9485, 'view', 804),
+(9486, 'buy', 718),
+(9487, 'scroll', 527),
+(9488, 'click', 961),
+(9489, 'view', 5),
+(9490, 'buy', 864),
+(9491, 'scroll', 817),
+(9492, 'click', 370),
+(9493, 'view', 424),
+(9494, 'buy', 722),
+(9495, 'scroll', 685),
+(9496, 'click', 193),
+(9497, 'view', 583),
+(9498, 'buy', 389),
+(9499, 'scroll', 745),
+(9500, 'click', 678),
+(9501, 'view', 418),
+(9502, 'buy', 341),
+(9503, 'scroll', 982),
+(9504, 'click', 491),
+(9505, 'view', 978),
+(9506, 'buy', 593),
+(9507, 'scroll', 951),
+(9508, 'click', 629),
+(9509, 'view', 165),
+(9510, 'buy', 323),
+(9511, 'scroll', 916),
+(9512, 'click', 385),
+(9513, 'view', 195),
+(9514, 'buy', 275),
+(9515, 'scroll', 925),
+(9516, 'click', 216),
+(9517, 'view', 811),
+(9518, 'buy', 680),
+(9519, 'scroll', 807),
+(9520, 'click', 629),
+(9521, 'view', 840),
+(9522, 'buy', 4),
+(9523, 'scroll', 593),
+(9524, 'click', 704),
+(9525, 'view', 334),
+(9526, 'buy', 325),
+(9527, 'scroll', 657),
+(9528, 'click', 775),
+(9529, 'view', 573),
+(9530, 'buy', 268),
+(9531, 'scroll', 820),
+(9532, 'click', 625),
+(9533, 'view', 344),
+(9534, 'buy', 162),
+(9535, 'scroll', 587),
+(9536, 'click', 878),
+(9537, 'view', 559),
+(9538, 'buy', 500),
+(9539, 'scroll', 974),
+(9540, 'click', 281),
+(9541, 'view', 879),
+(9542, 'buy', 945),
+(9543, 'scroll', 84),
+(9544, 'click', 503),
+(9545, 'view', 952),
+(9546, 'buy', 848),
+(9547, 'scroll', 775),
+(9548, 'click', 47),
+(9549, 'view', 152),
+(9550, 'buy', 438),
+(9551, 'scroll', 779),
+(9552, 'click', 84),
+(9553, 'view', 587),
+(9554, 'buy', 424),
+(9555, 'scroll', 928),
+(9556, 'click', 301),
+(9557, 'view', 600),
+(9558, 'buy', 519),
+(9559, 'scroll', 437),
+(9560, 'click', 721),
+(9561, 'view', 955),
+(9562, 'buy', 4),
+(9563, 'scroll', 89),
+(9564, 'click', 603),
+(9565, 'view', 795),
+(9566, 'buy', 136),
+(9567, 'scroll', 105),
+(9568, 'click', 385),
+(9569, 'view', 283),
+(9570, 'buy', 897),
+(9571, 'scroll', 116),
+(9572, 'click', 620),
+(9573, 'view', 892),
+(9574, 'buy', 445),
+(9575, 'scroll', 452),
+(9576, 'click', 903),
+(9577, 'view', 743),
+(9578, 'buy', 828),
+(9579, 'scroll', 262),
+(9580, 'click', 83),
+(9581, 'view', 747),
+(9582, 'buy', 459),
+(9583, 'scroll', 664),
+(9584, 'click', 377),
+(9585, 'view', 99),
+(9586, 'buy', 36),
+(9587, 'scroll', 505),
+(9588, 'click', 854),
+(9589, 'view', 739),
+(9590, 'buy', 306),
+(9591, 'scroll', 219),
+(9592, 'click', 66),
+(9593, 'view', 670),
+(9594, 'buy', 264),
+(9595, 'scroll', 284),
+(9596, 'click', 800),
+(9597, 'view', 379),
+(9598, 'buy', 210),
+(9599, 'scroll', 942),
+(9600, 'click', 520),
+(9601, 'view', 965),
+(9602, 'buy', 512),
+(9603, 'scroll', 539),
+(9604, 'click', 436),
+(9605, 'view', 787),
+(9606, 'buy', 585),
+(9607, 'scroll', 709),
+(9608, 'click', 827),
+(9609, 'view', 663),
+(9610, 'buy', 776),
+(9611, 'scroll', 284),
+(9612, 'click', 467),
+(9613, 'view', 658),
+(9614, 'buy', 884),
+(9615, 'scroll', 325),
+(9616, 'click', 410),
+(9617, 'view', 699),
+(9618, 'buy', 972),
+(9619, 'scroll', 714),
+(9620, 'click', 484),
+(9621, 'view', 981),
+(9622, 'buy', 121),
+(9623, 'scroll', 47),
+(9624, 'click', 767),
+(9625, 'view', 856),
+(9626, 'buy', 148),
+(9627, 'scroll', 830),
+(9628, 'click', 695),
+(9629, 'view', 302),
+(9630, 'buy', 54),
+(9631, 'scroll', 616),
+(9632, 'click', 885),
+(9633, 'view', 553),
+(9634, 'buy', 754),
+(9635, 'scroll', 758),
+(9636, 'click', 960),
+(9637, 'view', 134),
+(9638, 'buy', 360),
+(9639, 'scroll', 652),
+(9640, 'click', 871),
+(9641, 'view', 385),
+(9642, 'buy', 878),
+(9643, 'scroll', 255),
+(9644, 'click', 265),
+(9645, 'view', 834),
+(9646, 'buy', 518),
+(9647, 'scroll', 34),
+(9648, 'click', 455),
+(9649, 'view', 489),
+(9650, 'buy', 26),
+(9651, 'scroll', 88),
+(9652, 'click', 83),
+(9653, 'view', 871),
+(9654, 'buy', 810),
+(9655, 'scroll', 914),
+(9656, 'click', 904),
+(9657, 'view', 35),
+(9658, 'buy', 220),
+(9659, 'scroll', 475),
+(9660, 'click', 615),
+(9661, 'view', 480),
+(9662, 'buy', 897),
+(9663, 'scroll', 735),
+(9664, 'click', 82),
+(9665, 'view', 746),
+(9666, 'buy', 297),
+(9667, 'scroll', 351),
+(9668, 'click', 860),
+(9669, 'view', 955),
+(9670, 'buy', 623),
+(9671, 'scroll', 189),
+(9672, 'click', 979),
+(9673, 'view', 139),
+(9674, 'buy', 660),
+(9675, 'scroll', 834),
+(9676, 'click', 776),
+(9677, 'view', 122),
+(9678, 'buy', 660),
+(9679, 'scroll', 190),
+(9680, 'click', 858),
+(9681, 'view', 512),
+(9682, 'buy', 266),
+(9683, 'scroll', 344),
+(9684, 'click', 168),
+(9685, 'view', 167),
+(9686, 'buy', 928),
+(9687, 'scroll', 952),
+(9688, 'click', 228),
+(9689, 'view', 485),
+(9690, 'buy', 878),
+(9691, 'scroll', 804),
+(9692, 'click', 229),
+(9693, 'view', 256),
+(9694, 'buy', 265),
+(9695, 'scroll', 934),
+(9696, 'click', 62),
+(9697, 'view', 226),
+(9698, 'buy', 164),
+(9699, 'scroll', 928),
+(9700, 'click', 627),
+(9701, 'view', 309),
+(9702, 'buy', 994),
+(9703, 'scroll', 789),
+(9704, 'click', 64),
+(9705, 'view', 645),
+(9706, 'buy', 392),
+(9707, 'scroll', 545),
+(9708, 'click', 639),
+(9709, 'view', 875),
+(9710, 'buy', 991),
+(9711, 'scroll', 454),
+(9712, 'click', 217),
+(9713, 'view', 100),
+(9714, 'buy', 426),
+(9715, 'scroll', 935),
+(9716, 'click', 480),
+(9717, 'view', 824),
+(9718, 'buy', 320),
+(9719, 'scroll', 698),
+(9720, 'click', 61),
+(9721, 'view', 762),
+(9722, 'buy', 392),
+(9723, 'scroll', 237),
+(9724, 'click', 668),
+(9725, 'view', 474),
+(9726, 'buy', 492),
+(9727, 'scroll', 842),
+(9728, 'click', 542),
+(9729, 'view', 985),
+(9730, 'buy', 200),
+(9731, 'scroll', 945),
+(9732, 'click', 265),
+(9733, 'view', 164),
+(9734, 'buy', 533),
+(9735, 'scroll', 700),
+(9736, 'click', 122),
+(9737, 'view', 567),
+(9738, 'buy', 325),
+(9739, 'scroll', 414),
+(9740, 'click', 910),
+(9741, 'view', 171),
+(9742, 'buy', 936),
+(9743, 'scroll', 140),
+(9744, 'click', 920),
+(9745, 'view', 481),
+(9746, 'buy', 480),
+(9747, 'scroll', 504),
+(9748, 'click', 955),
+(9749, 'view', 274),
+(9750, 'buy', 576),
+(9751, 'scroll', 376),
+(9752, 'click', 101),
+(9753, 'view', 567),
+(9754, 'buy', 509),
+(9755, 'scroll', 780),
+(9756, 'click', 997),
+(9757, 'view', 603),
+(9758, 'buy', 336),
+(9759, 'scroll', 166),
+(9760, 'click', 351),
+(9761, 'view', 907),
+(9762, 'buy', 97),
+(9763, 'scroll', 376),
+(9764, 'click', 388),
+(9765, 'view', 982),
+(9766, 'buy', 114),
+(9767, 'scroll', 993),
+(9768, 'click', 143),
+(9769, 'view', 510),
+(9770, 'buy', 596),
+(9771, 'scroll', 289),
+(9772, 'click', 990),
+(9773, 'view', 338),
+(9774, 'buy', 394),
+(9775, 'scroll', 591),
+(9776, 'click', 560),
+(9777, 'view', 182),
+(9778, 'buy', 321),
+(9779, 'scroll', 788),
+(9780, 'click', 29),
+(9781, 'view', 325),
+(9782, 'buy', 209),
+(9783, 'scroll', 469),
+(9784, 'click', 126),
+(9785, 'view', 979),
+(9786, 'buy', 291),
+(9787, 'scroll', 466),
+(9788, 'click', 644),
+(9789, 'view', 378),
+(9790, 'buy', 576),
+(9791, 'scroll', 796),
+(9792, 'click', 970),
+(9793, 'view', 960),
+(9794, 'buy', 701),
+(9795, 'scroll', 712),
+(9796, 'click', 371),
+(9797, 'view', 492),
+(9798, 'buy', 972),
+(9799, 'scroll', 951),
+(9800, 'click', 649),
+(9801, 'view', 202),
+(9802, 'buy', 556),
+(9803, 'scroll', 981),
+(9804, 'click', 883),
+(9805, 'view', 680),
+(9806, 'buy', 685),
+(9807, 'scroll', 179),
+(9808, 'click', 368),
+(9809, 'view', 192),
+(9810, 'buy', 619),
+(9811, 'scroll', 194),
+(9812, 'click', 307),
+(9813, 'view', 300),
+(9814, 'buy', 992),
+(9815, 'scroll', 726),
+(9816, 'click', 250),
+(9817, 'view', 726),
+(9818, 'buy', 996),
+(9819, 'scroll', 600),
+(9820, 'click', 65),
+(9821, 'view', 430),
+(9822, 'buy', 10),
+(9823, 'scroll', 214),
+(9824, 'click', 566),
+(9825, 'view', 72),
+(9826, 'buy', 210),
+(9827, 'scroll', 527),
+(9828, 'click', 519),
+(9829, 'view', 678),
+(9830, 'buy', 120),
+(9831, 'scroll', 771),
+(9832, 'click', 856),
+(9833, 'view', 242),
+(9834, 'buy', 685),
+(9835, 'scroll', 113),
+(9836, 'click', 700),
+(9837, 'view', 293),
+(9838, 'buy', 948),
+(9839, 'scroll', 103),
+(9840, 'click', 197),
+(9841, 'view', 694),
+(9842, 'buy', 594),
+(9843, 'scroll', 730),
+(9844, 'click', 683),
+(9845, 'view', 1),
+(9846, 'buy', 272),
+(9847, 'scroll', 50),
+(9848, 'click', 998),
+(9849, 'view', 436),
+(9850, 'buy', 89),
+(9851, 'scroll', 992),
+(9852, 'click', 287),
+(9853, 'view', 320),
+(9854, 'buy', 916),
+(9855, 'scroll', 582),
+(9856, 'click', 709),
+(9857, 'view', 9),
+(9858, 'buy', 527),
+(9859, 'scroll', 425),
+(9860, 'click', 358),
+(9861, 'view', 924),
+(9862, 'buy', 727),
+(9863, 'scroll', 603),
+(9864, 'click', 545),
+(9865, 'view', 844),
+(9866, 'buy', 185),
+(9867, 'scroll', 13),
+(9868, 'click', 586),
+(9869, 'view', 207),
+(9870, 'buy', 183),
+(9871, 'scroll', 927),
+(9872, 'click', 852),
+(9873, 'view', 229),
+(9874, 'buy', 104),
+(9875, 'scroll', 215),
+(9876, 'click', 954),
+(9877, 'view', 124),
+(9878, 'buy', 273),
+(9879, 'scroll', 599),
+(9880, 'click', 901),
+(9881, 'view', 757),
+(9882, 'buy', 527),
+(9883, 'scroll', 979),
+(9884, 'click', 331),
+(9885, 'view', 691),
+(9886, 'buy', 989),
+(9887, 'scroll', 393),
+(9888, 'click', 414),
+(9889, 'view', 714),
+(9890, 'buy', 27),
+(9891, 'scroll', 68),
+(9892, 'click', 610),
+(9893, 'view', 850),
+(9894, 'buy', 714),
+(9895, 'scroll', 434),
+(9896, 'click', 113),
+(9897, 'view', 849),
+(9898, 'buy', 764),
+(9899, 'scroll', 913),
+(9900, 'click', 276),
+(9901, 'view', 526),
+(9902, 'buy', 151),
+(9903, 'scroll', 438),
+(9904, 'click', 372),
+(9905, 'view', 891),
+(9906, 'buy', 677),
+(9907, 'scroll', 22),
+(9908, 'click', 976),
+(9909, 'view', 27),
+(9910, 'buy', 55),
+(9911, 'scroll', 437),
+(9912, 'click', 638),
+(9913, 'view', 544),
+(9914, 'buy', 669),
+(9915, 'scroll', 394),
+(9916, 'click', 164),
+(9917, 'view', 380),
+(9918, 'buy', 743),
+(9919, 'scroll', 374),
+(9920, 'click', 564),
+(9921, 'view', 136),
+(9922, 'buy', 367),
+(9923, 'scroll', 941),
+(9924, 'click', 921),
+(9925, 'view', 378),
+(9926, 'buy', 261),
+(9927, 'scroll', 556),
+(9928, 'click', 145),
+(9929, 'view', 166),
+(9930, 'buy', 161),
+(9931, 'scroll', 155),
+(9932, 'click', 152),
+(9933, 'view', 113),
+(9934, 'buy', 602),
+(9935, 'scroll', 815),
+(9936, 'click', 820),
+(9937, 'view', 127),
+(9938, 'buy', 163),
+(9939, 'scroll', 316),
+(9940, 'click', 514),
+(9941, 'view', 580),
+(9942, 'buy', 588),
+(9943, 'scroll', 98),
+(9944, 'click', 573),
+(9945, 'view', 508),
+(9946, 'buy', 422),
+(9947, 'scroll', 474),
+(9948, 'click', 556),
+(9949, 'view', 768),
+(9950, 'buy', 15),
+(9951, 'scroll', 744),
+(9952, 'click', 59),
+(9953, 'view', 241),
+(9954, 'buy', 432),
+(9955, 'scroll', 143),
+(9956, 'click', 242),
+(9957, 'view', 947),
+(9958, 'buy', 774),
+(9959, 'scroll', 5),
+(9960, 'click', 247),
+(9961, 'view', 916),
+(9962, 'buy', 843),
+(9963, 'scroll', 365),
+(9964, 'click', 247),
+(9965, 'view', 792),
+(9966, 'buy', 94),
+(9967, 'scroll', 854),
+(9968, 'click', 488),
+(9969, 'view', 603),
+(9970, 'buy', 396),
+(9971, 'scroll', 439),
+(9972, 'click', 343),
+(9973, 'view', 487),
+(9974, 'buy', 783),
+(9975, 'scroll', 42),
+(9976, 'click', 227),
+(9977, 'view', 998),
+(9978, 'buy', 686),
+(9979, 'scroll', 854),
+(9980, 'click', 50),
+(9981, 'view', 463),
+(9982, 'buy', 515),
+(9983, 'scroll', 244),
+(9984, 'click', 945),
+(9985, 'view', 38),
+(9986, 'buy', 618),
+(9987, 'scroll', 947),
+(9988, 'click', 185),
+(9989, 'view', 202),
+(9990, 'buy', 71),
+(9991, 'scroll', 266),
+(9992, 'click', 84),
+(9993, 'view', 792),
+(9994, 'buy', 339),
+(9995, 'scroll', 772),
+(9996, 'click', 90),
+(9997, 'view', 346),
+(9998, 'buy', 664),
+(9999, 'scroll', 80),
+(10000, 'click', 433);
@@ -0,0 +1,47 @@
+-- A star query joining a fact table to twenty dimensions.
+SELECT fact.id, d1.name, d2.name, d3.name, d4.name, d5.name, d6.name, d7.name, d8.name, d9.name, d10.name, d11.name, d12.name, d13.name, d14.name, d15.name, d16.name, d17.name, d18.name, d19.name, d20.name
+FROM fact
+INNER JOIN d1 ON fact.d1_id = d1.id
+INNER JOIN d2 ON fact.d2_id = d2.id
+INNER JOIN d3 ON fact.d3_id = d3.id
+INNER JOIN d4 ON fact.d4_id = d4.id
+INNER JOIN d5 ON fact.d5_id = d5.id
+INNER JOIN d6 ON fact.d6_id = d6.id
+INNER JOIN d7 ON fact.d7_id = d7.id
+INNER JOIN d8 ON fact.d8_id = d8.id
+INNER JOIN d9 ON fact.d9_id = d9.id
+INNER JOIN d10 ON fact.d10_id = d10.id
+INNER JOIN d11 ON fact.d11_id = d11.id
+INNER JOIN d12 ON fact.d12_id = d12.id
+INNER JOIN d13 ON fact.d13_id = d13.id
+INNER JOIN d14 ON fact.d14_id = d14.id
+INNER JOIN d15 ON fact.d15_id = d15.id
+INNER JOIN d16 ON fact.d16_id = d16.id
+INNER JOIN d17 ON fact.d17_id = d17.id
+INNER JOIN d18 ON fact.d18_id = d18.id
+INNER JOIN d19 ON fact.d19_id = d19.id
+INNER JOIN d20 ON fact.d20_id = d20.id
+WHERE fact.amount > 0;
+SELECT fact.id, d1.name, d2.name, d3.name, d4.name, d5.name, d6.name, d7.name, d8.name, d9.name, d10.name, d11.name, d12.name, d13.name, d14.name, d15.name, d16.name, d17.name, d18.name, d19.name, d20.name
+FROM fact
+INNER JOIN d1 ON fact.d1_id = d1.id
+INNER JOIN d2 ON fact.d2_id = d2.id
+INNER JOIN d3 ON fact.d3_id = d3.id
+INNER JOIN d4 ON fact.d4_id = d4.id
+INNER JOIN d5 ON fact.d5_id = d5.id
+INNER JOIN d6 ON fact.d6_id = d6.id
+INNER JOIN d7 ON fact.d7_id = d7.id
+INNER JOIN d8 ON fact.d8_id = d8.id
+INNER JOIN d9 ON fact.d9_id = d9.id
+INNER JOIN d10 ON fact.d10_id = d10.id
+INNER JOIN d11 ON fact.d11_id = d11.id
+INNER JOIN d12 ON fact.d12_id = d12.id
+INNER JOIN d13 ON fact.d13_id = d13.id
+INNER JOIN d14 ON fact.d14_id = d14.id
+INNER JOIN d15 ON fact.d15_id = d15.id
+INNER JOIN d16 ON fact.d16_id = d16.id
+INNER JOIN d17 ON fact.d17_id = d17.id
+INNER JOIN d18 ON fact.d18_id = d18.id
+INNER JOIN d19 ON fact.d19_id = d19.id
+INNER JOIN d20 ON fact.d20_id = d20.id
+WHERE fact.amount > 10;
@@ -0,0 +1,381 @@
+-- Statements carrying long generated headers and annotations.
+/*
+ * line 0: migration note; keep (these) 'quotes' and ; in mind
+ * line 1: migration note; keep (these) 'quotes' and ; in mind
+ * line 2: migration note; keep (these) 'quotes' and ; in mind
+ * line 3: migration note; keep (these) 'quotes' and ; in mind
+ * line 4: migration note; keep (these) 'quotes' and ; in mind
+ * line 5: migration note; keep (these) 'quotes' and ; in mind
+ * line 6: migration note; keep (these) 'quotes' and ; in mind
+ * line 7: migration note; keep (these) 'quotes' and ; in mind
+ * line 8: migration note; keep (these) 'quotes' and ; in mind
+ * line 9: migration note; keep (these) 'quotes' and ; in mind
+ * line 10: migration note; keep (these) 'quotes' and ; in mind
+ * line 11: migration note; keep (these) 'quotes' and ; in mind
+ * line 12: migration note; keep (these) 'quotes' and ; in mind
+ * line 13: migration note; keep (these) 'quotes' and ; in mind
+ * line 14: migration note; keep (these) 'quotes' and ; in mind
+ * line 15: migration note; keep (these) 'quotes' and ; in mind
+ * line 16: migration note; keep (these) 'quotes' and ; in mind
+ * line 17: migration note; keep (these) 'quotes' and ; in mind
+ * line 18: migration note; keep (these) 'quotes' and ; in mind
+ * line 19: migration note; keep (these) 'quotes' and ; in mind
+ * line 20: migration note; keep (these) 'quotes' and ; in mind
+ * line 21: migration note; keep (these) 'quotes' and ; in mind
+ * line 22: migration note; keep (these) 'quotes' and ; in mind
+ * line 23: migration note; keep (these) 'quotes' and ; in mind
+ * line 24: migration note; keep (these) 'quotes' and ; in mind
+ * line 25: migration note; keep (these) 'quotes' and ; in mind
+ * line 26: migration note; keep (these) 'quotes' and ; in mind
+ * line 27: migration note; keep (these) 'quotes' and ; in mind
+ * line 28: migration note; keep (these) 'quotes' and ; in mind
+ * line 29: migration note; keep (these) 'quotes' and ; in mind
+ * line 30: migration note; keep (these) 'quotes' and ; in mind
+ * line 31: migration note; keep (these) 'quotes' and ; in mind
+ * line 32: migration note; keep (these) 'quotes' and ; in mind
+ * line 33: migration note; keep (these) 'quotes' and ; in mind
+ * line 34: migration note; keep (these) 'quotes' and ; in mind
+ * line 35: migration note; keep (these) 'quotes' and ; in mind
+ * line 36: migration note; keep (these) 'quotes' and ; in mind
+ * line 37: migration note; keep (these) 'quotes' and ; in mind
+ * line 38: migration note; keep (these) 'quotes' and ; in mind
+ * line 39: migration note; keep (these) 'quotes' and ; in mind
+ * line 40: migration note; keep (these) 'quotes' and ; in mind
+ * line 41: migration note; keep (these) 'quotes' and ; in mind
+ * line 42: migration note; keep (these) 'quotes' and ; in mind
+ * line 43: migration note; keep (these) 'quotes' and ; in mind
+ * line 44: migration note; keep (these) 'quotes' and ; in mind
+ * line 45: migration note; keep (these) 'quotes' and ; in mind
+ * line 46: migration note; keep (these) 'quotes' and ; in mind
+ * line 47: migration note; keep (these) 'quotes' and ; in mind
+ * line 48: migration note; keep (these) 'quotes' and ; in mind
+ * line 49: migration note; keep (these) 'quotes' and ; in mind
+ * line 50: migration note; keep (these) 'quotes' and ; in mind
+ * line 51: migration note; keep (these) 'quotes' and ; in mind
+ * line 52: migration note; keep (these) 'quotes' and ; in mind
+ * line 53: migration note; keep (these) 'quotes' and ; in mind
+ * line 54: migration note; keep (these) 'quotes' and ; in mind
+ * line 55: migration note; keep (these) 'quotes' and ; in mind
+ * line 56: migration note; keep (these) 'quotes' and ; in mind
+ * line 57: migration note; keep (these) 'quotes' and ; in mind
+ * line 58: migration note; keep (these) 'quotes' and ; in mind
+ * line 59: migration note; keep (these) 'quotes' and ; in mind
+ */
+SELECT id, name
+  -- annotation 0: reviewed; see ticket 1000
+  -- annotation 1: reviewed; see ticket 1001
+  -- annotation 2: reviewed; see ticket 1002
+  -- annotation 3: reviewed; see ticket 1003
+  -- annotation 4: reviewed; see ticket 1004
+  -- annotation 5: reviewed; see ticket 1005
+  -- annotation 6: reviewed; see ticket 1006
+  -- annotation 7: reviewed; see ticket 1007
+  -- annotation 8: reviewed; see ticket 1008
+  -- annotation 9: reviewed; see ticket 1009
+  -- annotation 10: reviewed; see ticket 1010
+  -- annotation 11: reviewed; see ticket 1011
+  -- annotation 12: reviewed; see ticket 1012
+  -- annotation 13: reviewed; see ticket 1013
+  -- annotation 14: reviewed; see ticket 1014
+  -- annotation 15: reviewed; see ticket 1015
+  -- annotation 16: reviewed; see ticket 1016
+  -- annotation 17: reviewed; see ticket 1017
+  -- annotation 18: reviewed; see ticket 1018
+  -- annotation 19: reviewed; see ticket 1019
+  -- annotation 20: reviewed; see ticket 1020
+  -- annotation 21: reviewed; see ticket 1021
+  -- annotation 22: reviewed; see ticket 1022
+  -- annotation 23: reviewed; see ticket 1023
+  -- annotation 24: reviewed; see ticket 1024
+  -- annotation 25: reviewed; see ticket 1025
+  -- annotation 26: reviewed; see ticket 1026
+  -- annotation 27: reviewed; see ticket 1027
+  -- annotation 28: reviewed; see ticket 1028
+  -- annotation 29: reviewed; see ticket 1029
+FROM users
+WHERE id = 0 /* trailing; note */;
+/*
+ * line 0: migration note; keep (these) 'quotes' and ; in mind
+ * line 1: migration note; keep (these) 'quotes' and ; in mind
+ * line 2: migration note; keep (these) 'quotes' and ; in mind
+ * line 3: migration note; keep (these) 'quotes' and ; in mind
+ * line 4: migration note; keep (these) 'quotes' and ; in mind
+ * line 5: migration note; keep (these) 'quotes' and ; in mind
+ * line 6: migration note; keep (these) 'quotes' and ; in mind
+ * line 7: migration note; keep (these) 'quotes' and ; in mind
+ * line 8: migration note; keep (these) 'quotes' and ; in mind
+ * line 9: migration note; keep (these) 'quotes' and ; in mind
+ * line 10: migration note; keep (these) 'quotes' and ; in mind
+ * line 11: migration note; keep (these) 'quotes' and ; in mind
+ * line 12: migration note; keep (these) 'quotes' and ; in mind
+ * line 13: migration note; keep (these) 'quotes' and ; in mind
+ * line 14: migration note; keep (these) 'quotes' and ; in mind
+ * line 15: migration note; keep (these) 'quotes' and ; in mind
+ * line 16: migration note; keep (these) 'quotes' and ; in mind
+ * line 17: migration note; keep (these) 'quotes' and ; in mind
+ * line 18: migration note; keep (these) 'quotes' and ; in mind
+ * line 19: migration note; keep (these) 'quotes' and ; in mind
+ * line 20: migration note; keep (these) 'quotes' and ; in mind
+ * line 21: migration note; keep (these) 'quotes' and ; in mind
+ * line 22: migration note; keep (these) 'quotes' and ; in mind
+ * line 23: migration note; keep (these) 'quotes' and ; in mind
+ * line 24: migration note; keep (these) 'quotes' and ; in mind
+ * line 25: migration note; keep (these) 'quotes' and ; in mind
+ * line 26: migration note; keep (these) 'quotes' and ; in mind
+ * line 27: migration note; keep (these) 'quotes' and ; in mind
+ * line 28: migration note; keep (these) 'quotes' and ; in mind
+ * line 29: migration note; keep (these) 'quotes' and ; in mind
+ * line 30: migration note; keep (these) 'quotes' and ; in mind
+ * line 31: migration note; keep (these) 'quotes' and ; in mind
+ * line 32: migration note; keep (these) 'quotes' and ; in mind
+ * line 33: migration note; keep (these) 'quotes' and ; in mind
+ * line 34: migration note; keep (these) 'quotes' and ; in mind
+ * line 35: migration note; keep (these) 'quotes' and ; in mind
+ * line 36: migration note; keep (these) 'quotes' and ; in mind
+ * line 37: migration note; keep (these) 'quotes' and ; in mind
+ * line 38: migration note; keep (these) 'quotes' and ; in mind
+ * line 39: migration note; keep (these) 'quotes' and ; in mind
+ * line 40: migration note; keep (these) 'quotes' and ; in mind
+ * line 41: migration note; keep (these) 'quotes' and ; in mind
+ * line 42: migration note; keep (these) 'quotes' and ; in mind
+ * line 43: migration note; keep (these) 'quotes' and ; in mind
+ * line 44: migration note; keep (these) 'quotes' and ; in mind
+ * line 45: migration note; keep (these) 'quotes' and ; in mind
+ * line 46: migration note; keep (these) 'quotes' and ; in mind
+ * line 47: migration note; keep (these) 'quotes' and ; in mind
+ * line 48: migration note; keep (these) 'quotes' and ; in mind
+ * line 49: migration note; keep (these) 'quotes' and ; in mind
+ * line 50: migration note; keep (these) 'quotes' and ; in mind
+ * line 51: migration note; keep (these) 'quotes' and ; in mind
+ * line 52: migration note; keep (these) 'quotes' and ; in mind
+ * line 53: migration note; keep (these) 'quotes' and ; in mind
+ * line 54: migration note; keep (these) 'quotes' and ; in mind
+ * line 55: migration note; keep (these) 'quotes' and ; in mind
+ * line 56: migration note; keep (these) 'quotes' and ; in mind
+ * line 57: migration note; keep (these) 'quotes' and ; in mind
+ * line 58: migration note; keep (these) 'quotes' and ; in mind
+ * line 59: migration note; keep (these) 'quotes' and ; in mind
+ */
+SELECT id, name
+  -- annotation 0: reviewed; see ticket 1000
+  -- annotation 1: reviewed; see ticket 1001
+  -- annotation 2: reviewed; see ticket 1002
+  -- annotation 3: reviewed; see ticket 1003
+  -- annotation 4: reviewed; see ticket 1004
+  -- annotation 5: reviewed; see ticket 1005
+  -- annotation 6: reviewed; see ticket 1006
+  -- annotation 7: reviewed; see ticket 1007
+  -- annotation 8: reviewed; see ticket 1008
+  -- annotation 9: reviewed; see ticket 1009
+  -- annotation 10: reviewed; see ticket 1010
+  -- annotation 11: reviewed; see ticket 1011
+  -- annotation 12: reviewed; see ticket 1012
+  -- annotation 13: reviewed; see ticket 1013
+  -- annotation 14: reviewed; see ticket 1014
+  -- annotation 15: reviewed; see ticket 1015
+  -- annotation 16: reviewed; see ticket 1016
+  -- annotation 17: reviewed; see ticket 1017
+  -- annotation 18: reviewed; see ticket 1018
+  -- annotation 19: reviewed; see ticket 1019
+  -- annotation 20: reviewed; see ticket 1020
+  -- annotation 21: reviewed; see ticket 1021
+  -- annotation 22: reviewed; see ticket 1022
+  -- annotation 23: reviewed; see ticket 1023
+  -- annotation 24: reviewed; see ticket 1024
+  -- annotation 25: reviewed; see ticket 1025
+  -- annotation 26: reviewed; see ticket 1026
+  -- annotation 27: reviewed; see ticket 1027
+  -- annotation 28: reviewed; see ticket 1028
+  -- annotation 29: reviewed; see ticket 1029
+FROM users
+WHERE id = 1 /* trailing; note */;
+/*
+ * line 0: migration note; keep (these) 'quotes' and ; in mind
+ * line 1: migration note; keep (these) 'quotes' and ; in mind
+ * line 2: migration note; keep (these) 'quotes' and ; in mind
+ * line 3: migration note; keep (these) 'quotes' and ; in mind
+ * line 4: migration note; keep (these) 'quotes' and ; in mind
+ * line 5: migration note; keep (these) 'quotes' and ; in mind
+ * line 6: migration note; keep (these) 'quotes' and ; in mind
+ * line 7: migration note; keep (these) 'quotes' and ; in mind
+ * line 8: migration note; keep (these) 'quotes' and ; in mind
+ * line 9: migration note; keep (these) 'quotes' and ; in mind
+ * line 10: migration note; keep (these) 'quotes' and ; in mind
+ * line 11: migration note; keep (these) 'quotes' and ; in mind
+ * line 12: migration note; keep (these) 'quotes' and ; in mind
+ * line 13: migration note; keep (these) 'quotes' and ; in mind
+ * line 14: migration note; keep (these) 'quotes' and ; in mind
+ * line 15: migration note; keep (these) 'quotes' and ; in mind
+ * line 16: migration note; keep (these) 'quotes' and ; in mind
+ * line 17: migration note; keep (these) 'quotes' and ; in mind
+ * line 18: migration note; keep (these) 'quotes' and ; in mind
+ * line 19: migration note; keep (these) 'quotes' and ; in mind
+ * line 20: migration note; keep (these) 'quotes' and ; in mind
+ * line 21: migration note; keep (these) 'quotes' and ; in mind
+ * line 22: migration note; keep (these) 'quotes' and ; in mind
+ * line 23: migration note; keep (these) 'quotes' and ; in mind
+ * line 24: migration note; keep (these) 'quotes' and ; in mind
+ * line 25: migration note; keep (these) 'quotes' and ; in mind
+ * line 26: migration note; keep (these) 'quotes' and ; in mind
+ * line 27: migration note; keep (these) 'quotes' and ; in mind
+ * line 28: migration note; keep (these) 'quotes' and ; in mind
+ * line 29: migration note; keep (these) 'quotes' and ; in mind
+ * line 30: migration note; keep (these) 'quotes' and ; in mind
+ * line 31: migration note; keep (these) 'quotes' and ; in mind
+ * line 32: migration note; keep (these) 'quotes' and ; in mind
+ * line 33: migration note; keep (these) 'quotes' and ; in mind
+ * line 34: migration note; keep (these) 'quotes' and ; in mind
+ * line 35: migration note; keep (these) 'quotes' and ; in mind
+ * line 36: migration note; keep (these) 'quotes' and ; in mind
+ * line 37: migration note; keep (these) 'quotes' and ; in mind
+ * line 38: migration note; keep (these) 'quotes' and ; in mind
+ * line 39: migration note; keep (these) 'quotes' and ; in mind
+ * line 40: migration note; keep (these) 'quotes' and ; in mind
+ * line 41: migration note; keep (these) 'quotes' and ; in mind
+ * line 42: migration note; keep (these) 'quotes' and ; in mind
+ * line 43: migration note; keep (these) 'quotes' and ; in mind
+ * line 44: migration note; keep (these) 'quotes' and ; in mind
+ * line 45: migration note; keep (these) 'quotes' and ; in mind
+ * line 46: migration note; keep (these) 'quotes' and ; in mind
+ * line 47: migration note; keep (these) 'quotes' and ; in mind
+ * line 48: migration note; keep (these) 'quotes' and ; in mind
+ * line 49: migration note; keep (these) 'quotes' and ; in mind
+ * line 50: migration note; keep (these) 'quotes' and ; in mind
+ * line 51: migration note; keep (these) 'quotes' and ; in mind
+ * line 52: migration note; keep (these) 'quotes' and ; in mind
+ * line 53: migration note; keep (these) 'quotes' and ; in mind
+ * line 54: migration note; keep (these) 'quotes' and ; in mind
+ * line 55: migration note; keep (these) 'quotes' and ; in mind
+ * line 56: migration note; keep (these) 'quotes' and ; in mind
+ * line 57: migration note; keep (these) 'quotes' and ; in mind
+ * line 58: migration note; keep (these) 'quotes' and ; in mind
+ * line 59: migration note; keep (these) 'quotes' and ; in mind
+ */
+SELECT id, name
+  -- annotation 0: reviewed; see ticket 1000
+  -- annotation 1: reviewed; see ticket 1001
+  -- annotation 2: reviewed; see ticket 1002
+  -- annotation 3: reviewed; see ticket 1003
+  -- annotation 4: reviewed; see ticket 1004
+  -- annotation 5: reviewed; see ticket 1005
+  -- annotation 6: reviewed; see ticket 1006
+  -- annotation 7: reviewed; see ticket 1007
+  -- annotation 8: reviewed; see ticket 1008
+  -- annotation 9: reviewed; see ticket 1009
+  -- annotation 10: reviewed; see ticket 1010
+  -- annotation 11: reviewed; see ticket 1011
+  -- annotation 12: reviewed; see ticket 1012
+  -- annotation 13: reviewed; see ticket 1013
+  -- annotation 14: reviewed; see ticket 1014
+  -- annotation 15: reviewed; see ticket 1015
+  -- annotation 16: reviewed; see ticket 1016
+  -- annotation 17: reviewed; see ticket 1017
+  -- annotation 18: reviewed; see ticket 1018
+  -- annotation 19: reviewed; see ticket 1019
+  -- annotation 20: reviewed; see ticket 1020
+  -- annotation 21: reviewed; see ticket 1021
+  -- annotation 22: reviewed; see ticket 1022
+  -- annotation 23: reviewed; see ticket 1023
+  -- annotation 24: reviewed; see ticket 1024
+  -- annotation 25: reviewed; see ticket 1025
+  -- annotation 26: reviewed; see ticket 1026
+  -- annotation 27: reviewed; see ticket 1027
+  -- annotation 28: reviewed; see ticket 1028
+  -- annotation 29: reviewed; see ticket 1029
+FROM users
+WHERE id = 2 /* trailing; note */;
+/*
+ * line 0: migration note; keep (these) 'quotes' and ; in mind
+ * line 1: migration note; keep (these) 'quotes' and ; in mind
+ * line 2: migration note; keep (these) 'quotes' and ; in mind
+ * line 3: migration note; keep (these) 'quotes' and ; in mind
+ * line 4: migration note; keep (these) 'quotes' and ; in mind
+ * line 5: migration note; keep (these) 'quotes' and ; in mind
+ * line 6: migration note; keep (these) 'quotes' and ; in mind
+ * line 7: migration note; keep (these) 'quotes' and ; in mind
+ * line 8: migration note; keep (these) 'quotes' and ; in mind
+ * line 9: migration note; keep (these) 'quotes' and ; in mind
+ * line 10: migration note; keep (these) 'quotes' and ; in mind
+ * line 11: migration note; keep (these) 'quotes' and ; in mind
+ * line 12: migration note; keep (these) 'quotes' and ; in mind
+ * line 13: migration note; keep (these) 'quotes' and ; in mind
+ * line 14: migration note; keep (these) 'quotes' and ; in mind
+ * line 15: migration note; keep (these) 'quotes' and ; in mind
+ * line 16: migration note; keep (these) 'quotes' and ; in mind
+ * line 17: migration note; keep (these) 'quotes' and ; in mind
+ * line 18: migration note; keep (these) 'quotes' and ; in mind
+ * line 19: migration note; keep (these) 'quotes' and ; in mind
+ * line 20: migration note; keep (these) 'quotes' and ; in mind
+ * line 21: migration note; keep (these) 'quotes' and ; in mind
+ * line 22: migration note; keep (these) 'quotes' and ; in mind
+ * line 23: migration note; keep (these) 'quotes' and ; in mind
+ * line 24: migration note; keep (these) 'quotes' and ; in mind
+ * line 25: migration note; keep (these) 'quotes' and ; in mind
+ * line 26: migration note; keep (these) 'quotes' and ; in mind
+ * line 27: migration note; keep (these) 'quotes' and ; in mind
+ * line 28: migration note; keep (these) 'quotes' and ; in mind
+ * line 29: migration note; keep (these) 'quotes' and ; in mind
+ * line 30: migration note; keep (these) 'quotes' and ; in mind
+ * line 31: migration note; keep (these) 'quotes' and ; in mind
+ * line 32: migration note; keep (these) 'quotes' and ; in mind
+ * line 33: migration note; keep (these) 'quotes' and ; in mind
+ * line 34: migration note; keep (these) 'quotes' and ; in mind
+ * line 35: migration note; keep (these) 'quotes' and ; in mind
+ * line 36: migration note; keep (these) 'quotes' and ; in mind
+ * line 37: migration note; keep (these) 'quotes' and ; in mind
+ * line 38: migration note; keep (these) 'quotes' and ; in mind
+ * line 39: migration note; keep (these) 'quotes' and ; in mind
+ * line 40: migration note; keep (these) 'quotes' and ; in mind
+ * line 41: migration note; keep (these) 'quotes' and ; in mind
+ * line 42: migration note; keep (these) 'quotes' and ; in mind
+ * line 43: migration note; keep (these) 'quotes' and ; in mind
+ * line 44: migration note; keep (these) 'quotes' and ; in mind
+ * line 45: migration note; keep (these) 'quotes' and ; in mind
+ * line 46: migration note; keep (these) 'quotes' and ; in mind
+ * line 47: migration note; keep (these) 'quotes' and ; in mind
+ * line 48: migration note; keep (these) 'quotes' and ; in mind
+ * line 49: migration note; keep (these) 'quotes' and ; in mind
+ * line 50: migration note; keep (these) 'quotes' and ; in mind
+ * line 51: migration note; keep (these) 'quotes' and ; in mind
+ * line 52: migration note; keep (these) 'quotes' and ; in mind
+ * line 53: migration note; keep (these) 'quotes' and ; in mind
+ * line 54: migration note; keep (these) 'quotes' and ; in mind
+ * line 55: migration note; keep (these) 'quotes' and ; in mind
+ * line 56: migration note; keep (these) 'quotes' and ; in mind
+ * line 57: migration note; keep (these) 'quotes' and ; in mind
+ * line 58: migration note; keep (these) 'quotes' and ; in mind
+ * line 59: migration note; keep (these) 'quotes' and ; in mind
+ */
+SELECT id, name
+  -- annotation 0: reviewed; see ticket 1000
+  -- annotation 1: reviewed; see ticket 1001
+  -- annotation 2: reviewed; see ticket 1002
+  -- annotation 3: reviewed; see ticket 1003
+  -- annotation 4: reviewed; see ticket 1004
+  -- annotation 5: reviewed; see ticket 1005
+  -- annotation 6: reviewed; see ticket 1006
+  -- annotation 7: reviewed; see ticket 1007
+  -- annotation 8: reviewed; see ticket 1008
+  -- annotation 9: reviewed; see ticket 1009
+  -- annotation 10: reviewed; see ticket 1010
+  -- annotation 11: reviewed; see ticket 1011
+  -- annotation 12: reviewed; see ticket 1012
+  -- annotation 13: reviewed; see ticket 1013
+  -- annotation 14: reviewed; see ticket 1014
+  -- annotation 15: reviewed; see ticket 1015
+  -- annotation 16: reviewed; see ticket 1016
+  -- annotation 17: reviewed; see ticket 1017
+  -- annotation 18: reviewed; see ticket 1018
+  -- annotation 19: reviewed; see ticket 1019
+  -- annotation 20: reviewed; see ticket 1020
+  -- annotation 21: reviewed; see ticket 1021
+  -- annotation 22: reviewed; see ticket 1022
+  -- annotation 23: reviewed; see ticket 1023
+  -- annotation 24: reviewed; see ticket 1024
+  -- annotation 25: reviewed; see ticket 1025
+  -- annotation 26: reviewed; see ticket 1026
+  -- annotation 27: reviewed; see ticket 1027
+  -- annotation 28: reviewed; see ticket 1028
+  -- annotation 29: reviewed; see ticket 1029
+FROM users
+WHERE id = 3 /* trailing; note */;
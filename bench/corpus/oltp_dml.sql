@@ -0,0 +1,6 @@
+-- Writes and DDL, so every statement type is measured.
+INSERT INTO users (id, name, email) VALUES (42, 'alice', 'alice@example.com');
+UPDATE accounts SET balance = 100, updated_at = 1700000000 WHERE id = 3;
+DELETE FROM sessions WHERE expires_at < 1700000000;
+CREATE TABLE audit_log (id BIGINT, actor VARCHAR, action VARCHAR, at BIGINT);
+DROP TABLE staging_events;
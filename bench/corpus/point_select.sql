@@ -0,0 +1,21 @@
+-- Primary-key lookups, the bulk of an OLTP workload.
+SELECT id, name, email, created_at FROM users WHERE id = 339564;
+SELECT id, customer_id, total, status FROM orders WHERE id = 993909;
+SELECT balance FROM accounts WHERE id = 158177;
+SELECT user_id, expires_at FROM sessions WHERE id = 414003;
+SELECT name, price, stock FROM products WHERE id = 682555;
+SELECT id, name, email, created_at FROM users WHERE id = 50632;
+SELECT id, customer_id, total, status FROM orders WHERE id = 75955;
+SELECT balance FROM accounts WHERE id = 861169;
+SELECT user_id, expires_at FROM sessions WHERE id = 561914;
+SELECT name, price, stock FROM products WHERE id = 98703;
+SELECT id, name, email, created_at FROM users WHERE id = 383453;
+SELECT id, customer_id, total, status FROM orders WHERE id = 611098;
+SELECT balance FROM accounts WHERE id = 60817;
+SELECT user_id, expires_at FROM sessions WHERE id = 953894;
+SELECT name, price, stock FROM products WHERE id = 532085;
+SELECT id, name, email, created_at FROM users WHERE id = 225128;
+SELECT id, customer_id, total, status FROM orders WHERE id = 39318;
+SELECT balance FROM accounts WHERE id = 90123;
+SELECT user_id, expires_at FROM sessions WHERE id = 454711;
+SELECT name, price, stock FROM products WHERE id = 438486;
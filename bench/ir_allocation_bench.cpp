@@ -0,0 +1,86 @@
+// Measures heap allocations and latency of SqlParser::Parse for a set of
+// OLTP-shaped statements, once with a per-statement monotonic resource that
+// takes every chunk from the heap and once with a per-statement
+// StatementArena, whose inline buffer holds a typical statement. Allocations
+// are counted by src/allocation_hooks.cpp, linked into this executable.
+//
+//   ./ir_allocation_bench [iterations]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+#include "detail/arena.hpp"
+#include "detail/heap_counter.hpp"
+#include "detail/sql_parser.hpp"
+
+namespace {
+
+constexpr std::string_view kStatements[] = {
+    "SELECT id, name, email, created_at FROM users WHERE id = 42",
+    "SELECT * FROM orders WHERE customer_id = 7 ORDER BY created_at DESC "
+    "LIMIT 20",
+    "INSERT INTO events (id, kind, payload) VALUES (1001, 'click', 'home')",
+    "UPDATE accounts SET balance = 100, updated_at = 5 WHERE id = 3",
+    "DELETE FROM sessions WHERE expires_at < 1700000000",
+    "SELECT id FROM orders INNER JOIN users ON orders.user_id = users.id",
+};
+
+struct Result {
+    double allocations_per_statement;
+    double nanoseconds_per_statement;
+};
+
+template <typename ParseFn>
+Result Measure(int iterations, ParseFn parse) {
+    size_t statements = 0;
+    const uint64_t allocations_before =
+        pink_perilla::detail::thread_heap_counter.allocations;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        for (std::string_view sql : kStatements) {
+            if (!parse(sql)) {
+                std::fprintf(stderr, "failed to parse: %.*s\n",
+                             static_cast<int>(sql.size()), sql.data());
+                std::exit(1);
+            }
+            ++statements;
+        }
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const uint64_t allocations =
+        pink_perilla::detail::thread_heap_counter.allocations -
+        allocations_before;
+    return {static_cast<double>(allocations) / statements,
+            std::chrono::duration<double, std::nano>(elapsed).count() /
+                statements};
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const int iterations = argc > 1 ? std::atoi(argv[1]) : 100000;
+    const std::vector<pink_perilla::TableDefinition> no_tables;
+
+    const Result heap = Measure(iterations, [&](std::string_view sql) {
+        std::pmr::monotonic_buffer_resource heap_arena;
+        return SqlParser::Parse(sql, no_tables, &heap_arena).ok();
+    });
+    const Result arena = Measure(iterations, [&](std::string_view sql) {
+        pink_perilla::StatementArena statement_arena;
+        return SqlParser::Parse(sql, no_tables, statement_arena.resource())
+            .ok();
+    });
+
+    std::printf("%-8s %14s %14s\n", "mode", "allocs/stmt", "ns/stmt");
+    std::printf("%-8s %14.2f %14.1f\n", "heap", heap.allocations_per_statement,
+                heap.nanoseconds_per_statement);
+    std::printf("%-8s %14.2f %14.1f\n", "arena",
+                arena.allocations_per_statement,
+                arena.nanoseconds_per_statement);
+    return 0;
+}
@@ -0,0 +1,117 @@
+// Event-loop latency while large statements are planned. A single loop thread
+// handles a small request every `interval_us` and a large multi-row INSERT
+// every `large_every` requests. Each small request's latency runs from the
+// moment it was due to the moment the loop handled it. The run is made twice:
+// once planning the large statements synchronously on the loop, and once
+// handing them to ParseAsync on a ThreadPool.
+//
+//   ./parse_async_bench [requests] [interval_us] [large_every] [large_rows]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "catalog.hpp"
+#include "pink_perilla.hpp"
+#include "thread_pool.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+std::string LargeInsert(size_t rows) {
+    std::string sql = "INSERT INTO events (id, kind, payload) VALUES ";
+    for (size_t i = 0; i < rows; ++i) {
+        sql += i == 0 ? "(" : ", (";
+        sql += std::to_string(i) + ", " + std::to_string(i % 7) + ", 'event')";
+    }
+    return sql;
+}
+
+double Percentile(const std::vector<uint64_t>& sorted, double fraction) {
+    const size_t index = static_cast<size_t>(fraction * (sorted.size() - 1));
+    return sorted[index] / 1000.0;
+}
+
+// Runs the loop and returns the sorted latencies of its small requests.
+std::vector<uint64_t> RunLoop(size_t requests, Clock::duration interval,
+                              size_t large_every, const std::string& large,
+                              const std::shared_ptr<const pink_perilla::Catalog>& catalog,
+                              pink_perilla::ThreadPool* pool) {
+    std::atomic<size_t> outstanding{0};
+    std::vector<uint64_t> latencies;
+    latencies.reserve(requests);
+    const Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < requests; ++i) {
+        const Clock::time_point due = start + interval * i;
+        std::this_thread::sleep_until(due);
+        if (i % large_every == large_every - 1) {
+            if (pool == nullptr) {
+                pink_perilla::Parse(large, *catalog).IgnoreError();
+            } else {
+                outstanding.fetch_add(1, std::memory_order_relaxed);
+                pink_perilla::ParseAsync(
+                    large, catalog, *pool,
+                    [&outstanding](absl::StatusOr<substrait::Plan>) {
+                        outstanding.fetch_sub(1, std::memory_order_release);
+                    });
+            }
+            continue;
+        }
+        pink_perilla::Parse("SELECT id, kind FROM events WHERE id = " +
+                                std::to_string(i),
+                            *catalog)
+            .IgnoreError();
+        latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                Clock::now() - due)
+                                .count());
+    }
+    while (outstanding.load(std::memory_order_acquire) != 0) {
+        std::this_thread::yield();
+    }
+    std::sort(latencies.begin(), latencies.end());
+    return latencies;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const size_t requests = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20000;
+    const size_t interval_us = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 100;
+    const size_t large_every =
+        std::max<size_t>(argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 500, 1);
+    const size_t large_rows = argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 20000;
+
+    const std::string large = LargeInsert(large_rows);
+    const auto catalog = std::make_shared<const pink_perilla::Catalog>(
+        std::vector<pink_perilla::TableDefinition>{
+            {"events",
+             {{"id", pink_perilla::DataType::kI64, false},
+              {"kind", pink_perilla::DataType::kI32},
+              {"payload", pink_perilla::DataType::kString}}}});
+    pink_perilla::ThreadPool pool(2);
+
+    std::printf("requests %zu  interval %zuus  large INSERT of %zu rows every %zu\n",
+                requests, interval_us, large_rows, large_every);
+    std::printf("mode      p50_us    p99_us   p999_us    max_us\n");
+    pink_perilla::ThreadPool* const executors[] = {nullptr, &pool};
+    for (pink_perilla::ThreadPool* executor : executors) {
+        const std::vector<uint64_t> latencies =
+            RunLoop(requests, std::chrono::microseconds(interval_us), large_every,
+                    large, catalog, executor);
+        if (latencies.empty()) {
+            continue;
+        }
+        std::printf("%-6s %9.1f %9.1f %9.1f %9.1f\n",
+                    executor == nullptr ? "sync" : "async",
+                    Percentile(latencies, 0.50), Percentile(latencies, 0.99),
+                    Percentile(latencies, 0.999), latencies.back() / 1000.0);
+    }
+    return 0;
+}
@@ -0,0 +1,75 @@
+// Measures ParseBatch throughput in statements per second for 1..N worker
+// threads over a burst of OLTP-shaped statements.
+//
+//   ./parse_batch_bench [statements] [max_threads]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "catalog.hpp"
+#include "pink_perilla.hpp"
+#include "thread_pool.hpp"
+
+namespace {
+
+constexpr std::string_view kShapes[] = {
+    "SELECT id, name, email, created_at FROM users WHERE id = ",
+    "SELECT * FROM orders WHERE customer_id = ",
+    "UPDATE accounts SET balance = 100, updated_at = 5 WHERE id = ",
+    "DELETE FROM sessions WHERE expires_at < ",
+    "SELECT users.name, orders.total FROM orders INNER JOIN users ON "
+    "orders.user_id = users.id WHERE orders.total > ",
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    const size_t max_threads =
+        argc > 2 ? std::strtoul(argv[2], nullptr, 10)
+                 : std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<std::string> sql;
+    sql.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        sql.push_back(std::string(kShapes[i % std::size(kShapes)]) +
+                      std::to_string(i));
+    }
+    const std::vector<std::string_view> statements(sql.begin(), sql.end());
+    const pink_perilla::Catalog catalog(
+        {{"users",
+          {{"id", pink_perilla::DataType::kI64, false},
+           {"name", pink_perilla::DataType::kString},
+           {"email", pink_perilla::DataType::kString},
+           {"created_at", pink_perilla::DataType::kTimestamp}}}});
+
+    std::printf("threads     statements/s     speedup\n");
+    double baseline = 0;
+    for (size_t threads = 1; threads <= max_threads; ++threads) {
+        pink_perilla::ThreadPool pool(threads);
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<absl::StatusOr<substrait::Plan>> plans =
+            pink_perilla::ParseBatch(statements, catalog, pool);
+        const double seconds = std::chrono::duration<double>(
+                                   std::chrono::steady_clock::now() - start)
+                                   .count();
+        for (const absl::StatusOr<substrait::Plan>& plan : plans) {
+            if (!plan.ok()) {
+                std::fprintf(stderr, "failed to plan: %s\n",
+                             plan.status().ToString().c_str());
+                return 1;
+            }
+        }
+        const double rate = count / seconds;
+        if (threads == 1) {
+            baseline = rate;
+        }
+        std::printf("%7zu %16.0f %11.2f\n", threads, rate, rate / baseline);
+    }
+    return 0;
+}
@@ -0,0 +1,196 @@
+// Checks that planning time grows linearly with the input. Each flat shape
+// is planned at sizes from 1 KB up to `max_mb` MB, and each nesting shape at
+// 4 to 128 levels. Prints the cost per byte (or per level) and exits non-zero
+// if the largest input costs more than kMaxGrowth times as much per unit as
+// the smallest input measured against it. Nesting shapes are also built at
+// 1,000 and 10,000 levels, past SqlParser::kMaxNestingDepth; those must fail
+// with ResourceExhausted and are not timed against the rest.
+//
+//   ./parse_scaling_bench [max_mb]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "detail/sql_parser.hpp"
+#include "pink_perilla.hpp"
+
+namespace {
+
+// Allowed rise in cost per unit from the smallest compared input to the
+// largest. Cache misses on inputs far larger than the cache account for
+// part of it; a quadratic step would show up as a factor of 1,000 or more.
+constexpr double kMaxGrowth = 4.0;
+// Inputs smaller than this are dominated by fixed per-call costs, so they
+// are reported but not compared.
+constexpr size_t kMinComparedBytes = 64 * 1024;
+constexpr size_t kMinComparedLevels = 16;
+// Half of SqlParser::kMaxNestingDepth, which leaves every nesting shape room
+// for the statement around it.
+constexpr size_t kMaxComparedLevels = SqlParser::kMaxNestingDepth / 2;
+
+using Clock = std::chrono::steady_clock;
+
+struct FlatShape {
+    const char* name;
+    std::string prefix;
+    // Appended with an increasing counter until the input is big enough.
+    std::string (*item)(size_t i);
+    std::string separator;
+    std::string suffix;
+};
+
+struct NestedShape {
+    const char* name;
+    std::string (*build)(size_t levels);
+};
+
+std::string Repeat(const std::string& text, size_t times) {
+    std::string result;
+    result.reserve(text.size() * times);
+    for (size_t i = 0; i < times; ++i) {
+        result += text;
+    }
+    return result;
+}
+
+const FlatShape kFlatShapes[] = {
+    {"insert_rows", "INSERT INTO t (a, b, c) VALUES ",
+     [](size_t i) {
+         return "(" + std::to_string(i) + ", 'row', " + std::to_string(i % 97) +
+                ".5)";
+     },
+     ", ", ""},
+    {"or_chain", "SELECT a FROM t WHERE ",
+     [](size_t i) { return "a = " + std::to_string(i); }, " OR ", ""},
+    {"in_list", "SELECT a FROM t WHERE a IN (",
+     [](size_t i) { return std::to_string(i); }, ", ", ")"},
+    {"select_list", "SELECT ",
+     [](size_t i) { return "a + " + std::to_string(i); }, ", ", " FROM t"},
+    {"string_literal", "INSERT INTO t (a) VALUES ('",
+     [](size_t) { return std::string("it''s a long string "); }, "", "')"},
+    {"comments", "SELECT a FROM t ",
+     [](size_t) { return std::string("/* a comment */ -- and another\n"); }, "",
+     "WHERE a = 1"},
+};
+
+const NestedShape kNestedShapes[] = {
+    {"parentheses",
+     [](size_t levels) {
+         return "SELECT " + std::string(levels, '(') + "a" +
+                std::string(levels, ')') + " FROM t";
+     }},
+    {"subqueries",
+     [](size_t levels) {
+         return "SELECT a FROM " + Repeat("(SELECT * FROM ", levels) + "t" +
+                std::string(levels, ')');
+     }},
+    {"not_chain",
+     [](size_t levels) {
+         return "SELECT a FROM t WHERE " + Repeat("NOT ", levels) + "b";
+     }},
+    {"function_calls",
+     [](size_t levels) {
+         return "SELECT " + Repeat("abs(", levels) + "a" +
+                std::string(levels, ')') + " FROM t";
+     }},
+};
+
+std::string BuildFlat(const FlatShape& shape, size_t bytes) {
+    std::string sql = shape.prefix;
+    for (size_t i = 0; sql.size() < bytes; ++i) {
+        if (i != 0) {
+            sql += shape.separator;
+        }
+        sql += shape.item(i);
+    }
+    return sql + shape.suffix;
+}
+
+// Best of a few runs, in nanoseconds. Large inputs run once.
+double TimeParse(const std::string& sql, absl::StatusCode* code) {
+    const int runs = sql.size() < (1 << 20) ? 5 : 1;
+    double best = 0;
+    for (int run = 0; run < runs; ++run) {
+        const auto start = Clock::now();
+        absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(sql);
+        const double ns =
+            std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        *code = plan.status().code();
+        best = run == 0 ? ns : std::min(best, ns);
+    }
+    return best;
+}
+
+// Ratio of the largest to the smallest cost per unit among `costs`.
+bool CheckGrowth(const char* name, const std::vector<double>& costs) {
+    if (costs.size() < 2) {
+        return true;
+    }
+    const double growth = costs.back() / costs.front();
+    std::printf("%-16s growth %.2fx\n", name, growth);
+    if (growth > kMaxGrowth) {
+        std::printf("%-16s SUPERLINEAR: cost per unit rose more than %.0fx\n",
+                    name, kMaxGrowth);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const size_t max_mb = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 16;
+    bool linear = true;
+
+    std::printf("%-16s %12s %12s %10s  %s\n", "shape", "bytes", "ms", "ns/byte",
+                "status");
+    for (const FlatShape& shape : kFlatShapes) {
+        std::vector<double> compared;
+        for (size_t bytes = 1024; bytes <= (max_mb << 20); bytes *= 4) {
+            const std::string sql = BuildFlat(shape, bytes);
+            absl::StatusCode code;
+            const double ns = TimeParse(sql, &code);
+            std::printf("%-16s %12zu %12.3f %10.2f  %s\n", shape.name, sql.size(),
+                        ns / 1e6, ns / sql.size(),
+                        absl::StatusCodeToString(code).c_str());
+            if (code != absl::StatusCode::kOk) {
+                linear = false;
+            }
+            if (bytes >= kMinComparedBytes) {
+                compared.push_back(ns / sql.size());
+            }
+        }
+        linear &= CheckGrowth(shape.name, compared);
+    }
+
+    std::printf("\n%-16s %12s %12s %10s  %s\n", "shape", "levels", "ms",
+                "ns/level", "status");
+    for (const NestedShape& shape : kNestedShapes) {
+        std::vector<double> compared;
+        for (size_t levels : {4, 16, 32, 64, 128, 1000, 10000}) {
+            const std::string sql = shape.build(levels);
+            absl::StatusCode code;
+            const double ns = TimeParse(sql, &code);
+            std::printf("%-16s %12zu %12.3f %10.2f  %s\n", shape.name, levels,
+                        ns / 1e6, ns / levels,
+                        absl::StatusCodeToString(code).c_str());
+            // Rejected inputs stop at the depth limit, so their time says
+            // nothing about how nesting scales; only their status is checked.
+            if (levels > SqlParser::kMaxNestingDepth) {
+                linear &= code == absl::StatusCode::kResourceExhausted;
+                continue;
+            }
+            linear &= code == absl::StatusCode::kOk;
+            if (levels >= kMinComparedLevels && levels <= kMaxComparedLevels) {
+                compared.push_back(ns / levels);
+            }
+        }
+        linear &= CheckGrowth(shape.name, compared);
+    }
+    return linear ? 0 : 1;
+}
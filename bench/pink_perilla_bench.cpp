@@ -0,0 +1,265 @@
+// Google Benchmark suite over the statements in bench/corpus. Every corpus
+// file is measured at each stage of planning:
+//
+//   SqlParser::Parse/<corpus>             SQL to IR
+//   ToSubstrait(<Info>)/<corpus>          IR to plan, per converter overload
+//   pink_perilla::Parse/<corpus>          both, end to end
+//   SerializeToString/<corpus>            plan to wire bytes
+//
+// One iteration handles one statement, so the reported time is ns/statement.
+// Counters give heap allocations and bytes allocated per statement, and the
+// plan's serialized size. Allocations are counted by src/allocation_hooks.cpp,
+// linked into this executable.
+//
+//   ./pink_perilla_bench [--corpus=DIR] [benchmark flags]
+//   ./pink_perilla_bench --benchmark_format=json > current.json
+//   bench/compare_bench.py bench/baseline.json current.json
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "catalog.hpp"
+#include "detail/arena.hpp"
+#include "detail/heap_counter.hpp"
+#include "detail/sql_parser.hpp"
+#include "detail/substrait_converter.hpp"
+#include "pink_perilla.hpp"
+#include "script_reader.hpp"
+#include "substrait/plan.pb.h"
+
+#ifndef PINK_PERILLA_BENCH_CORPUS
+#define PINK_PERILLA_BENCH_CORPUS "bench/corpus"
+#endif
+
+namespace {
+
+struct Corpus {
+    std::string name;
+    std::vector<std::string> statements;
+};
+
+// Heap traffic of the benchmark loop, reported per statement.
+class AllocationCounters {
+public:
+    AllocationCounters() : before_(pink_perilla::detail::thread_heap_counter) {}
+
+    void Report(benchmark::State& state) const {
+        const pink_perilla::detail::HeapCounter& now =
+            pink_perilla::detail::thread_heap_counter;
+        state.counters["allocs"] = benchmark::Counter(
+            static_cast<double>(now.allocations - this->before_.allocations),
+            benchmark::Counter::kAvgIterations);
+        state.counters["alloc_bytes"] = benchmark::Counter(
+            static_cast<double>(now.bytes - this->before_.bytes),
+            benchmark::Counter::kAvgIterations);
+    }
+
+private:
+    const pink_perilla::detail::HeapCounter before_;
+};
+
+void ReportPlanBytes(benchmark::State& state,
+                     const std::vector<substrait::Plan>& plans) {
+    size_t bytes = 0;
+    for (const substrait::Plan& plan : plans) {
+        bytes += plan.ByteSizeLong();
+    }
+    state.counters["plan_bytes"] = static_cast<double>(bytes) / plans.size();
+}
+
+const char* StatementTypeName(const Statement& statement) {
+    static constexpr const char* kNames[] = {
+        "SelectInfo", "UpdateInfo",      "InsertInfo",
+        "DeleteInfo", "CreateTableInfo", "DropTableInfo",
+        "CopyInfo",
+    };
+    return kNames[statement.index()];
+}
+
+std::vector<Corpus> LoadCorpus(const std::filesystem::path& directory) {
+    std::vector<std::filesystem::path> files;
+    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+        if (entry.path().extension() == ".sql") {
+            files.push_back(entry.path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    std::vector<Corpus> corpus;
+    for (const std::filesystem::path& file : files) {
+        absl::StatusOr<std::unique_ptr<pink_perilla::ScriptReader>> reader =
+            pink_perilla::ScriptReader::Open(file.string());
+        if (!reader.ok()) {
+            std::fprintf(stderr, "%s\n", reader.status().ToString().c_str());
+            std::exit(1);
+        }
+        Corpus entry{file.stem().string(), {}};
+        while (std::optional<pink_perilla::ScriptStatement> statement =
+                   (*reader)->Next()) {
+            entry.statements.emplace_back(statement->sql);
+        }
+        corpus.push_back(std::move(entry));
+    }
+    return corpus;
+}
+
+// Statements of one corpus file that plan, parsed once up front so the
+// converter and serializer can be measured on their own.
+struct Planned {
+    pink_perilla::StatementArena arena;
+    std::vector<std::string_view> sql;
+    std::vector<Statement> statements;
+    std::vector<substrait::Plan> plans;
+};
+
+std::unique_ptr<Planned> Plan(const Corpus& corpus,
+                              const pink_perilla::Catalog& catalog) {
+    auto planned = std::make_unique<Planned>();
+    for (const std::string& sql : corpus.statements) {
+        absl::StatusOr<Statement> statement =
+            SqlParser::Parse(sql, catalog, planned->arena.resource());
+        if (!statement.ok()) {
+            std::fprintf(stderr, "%s: skipping a statement that does not plan\n",
+                         corpus.name.c_str());
+            continue;
+        }
+        planned->plans.push_back(std::visit(
+            [](const auto& info) { return pink_perilla::converter::ToSubstrait(info); },
+            *statement));
+        planned->sql.push_back(sql);
+        planned->statements.push_back(*std::move(statement));
+    }
+    return planned;
+}
+
+void RegisterCorpus(const Corpus& corpus, const pink_perilla::Catalog& catalog) {
+    std::shared_ptr<const Planned> planned = Plan(corpus, catalog);
+    if (planned->statements.empty()) {
+        return;
+    }
+
+    benchmark::RegisterBenchmark(
+        ("SqlParser::Parse/" + corpus.name).c_str(),
+        [planned, &catalog](benchmark::State& state) {
+            const std::vector<std::string_view>& sql = planned->sql;
+            pink_perilla::StatementArena arena;
+            size_t i = 0;
+            const AllocationCounters counters;
+            for (auto _ : state) {
+                {
+                    absl::StatusOr<Statement> statement =
+                        SqlParser::Parse(sql[i], catalog, arena.resource());
+                    benchmark::DoNotOptimize(statement);
+                }
+                arena.Reset();
+                i = i + 1 == sql.size() ? 0 : i + 1;
+            }
+            counters.Report(state);
+        });
+
+    // One benchmark per converter overload the corpus exercises.
+    std::vector<size_t> types;
+    for (const Statement& statement : planned->statements) {
+        if (std::find(types.begin(), types.end(), statement.index()) ==
+            types.end()) {
+            types.push_back(statement.index());
+        }
+    }
+    for (size_t type : types) {
+        std::vector<size_t> members;
+        std::vector<substrait::Plan> plans;
+        for (size_t i = 0; i < planned->statements.size(); ++i) {
+            if (planned->statements[i].index() == type) {
+                members.push_back(i);
+                plans.push_back(planned->plans[i]);
+            }
+        }
+        const std::string name =
+            std::string("ToSubstrait(") +
+            StatementTypeName(planned->statements[members.front()]) + ")/" +
+            corpus.name;
+        benchmark::RegisterBenchmark(
+            name.c_str(),
+            [planned, members, plans](benchmark::State& state) {
+                size_t i = 0;
+                const AllocationCounters counters;
+                for (auto _ : state) {
+                    substrait::Plan plan = std::visit(
+                        [](const auto& info) {
+                            return pink_perilla::converter::ToSubstrait(info);
+                        },
+                        planned->statements[members[i]]);
+                    benchmark::DoNotOptimize(plan);
+                    i = i + 1 == members.size() ? 0 : i + 1;
+                }
+                counters.Report(state);
+                ReportPlanBytes(state, plans);
+            });
+    }
+
+    benchmark::RegisterBenchmark(
+        ("pink_perilla::Parse/" + corpus.name).c_str(),
+        [planned, &catalog](benchmark::State& state) {
+            const std::vector<std::string_view>& sql = planned->sql;
+            size_t i = 0;
+            const AllocationCounters counters;
+            for (auto _ : state) {
+                absl::StatusOr<substrait::Plan> plan =
+                    pink_perilla::Parse(sql[i], catalog);
+                benchmark::DoNotOptimize(plan);
+                i = i + 1 == sql.size() ? 0 : i + 1;
+            }
+            counters.Report(state);
+            ReportPlanBytes(state, planned->plans);
+        });
+
+    benchmark::RegisterBenchmark(
+        ("SerializeToString/" + corpus.name).c_str(),
+        [planned](benchmark::State& state) {
+            const std::vector<substrait::Plan>& plans = planned->plans;
+            std::string bytes;
+            size_t i = 0;
+            const AllocationCounters counters;
+            for (auto _ : state) {
+                plans[i].SerializeToString(&bytes);
+                benchmark::DoNotOptimize(bytes);
+                i = i + 1 == plans.size() ? 0 : i + 1;
+            }
+            counters.Report(state);
+            ReportPlanBytes(state, plans);
+        });
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    benchmark::Initialize(&argc, argv);
+    std::string directory = PINK_PERILLA_BENCH_CORPUS;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], "--corpus=", 9) == 0) {
+            directory = argv[i] + 9;
+        } else {
+            std::fprintf(stderr, "Unknown argument: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    static const std::vector<Corpus> corpus = LoadCorpus(directory);
+    static const pink_perilla::Catalog catalog({});
+    for (const Corpus& entry : corpus) {
+        RegisterCorpus(entry, catalog);
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,154 @@
+// Load generator for `pink_perilla --serve`: keeps `depth` requests in flight
+// on each of `connections` connections and reports throughput and latency
+// percentiles. Without a socket path it starts a server in-process on a
+// temporary socket, so the whole measurement runs on one machine.
+//
+//   ./plan_server_bench [requests] [connections] [depth] [socket_path]
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "catalog.hpp"
+#include "plan_server.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr std::string_view kShapes[] = {
+    "SELECT id, name, email, created_at FROM users WHERE id = ",
+    "SELECT * FROM orders WHERE customer_id = ",
+    "UPDATE accounts SET balance = 100, updated_at = 5 WHERE id = ",
+    "DELETE FROM sessions WHERE expires_at < ",
+    "SELECT users.name, orders.total FROM orders INNER JOIN users ON "
+    "orders.user_id = users.id WHERE orders.total > ",
+};
+
+struct Result {
+    std::vector<uint64_t> latencies_ns;
+    size_t errors = 0;
+    std::string failure;
+};
+
+// Sends `count` requests over one connection, never more than `depth`
+// unanswered, timing each from its send to its answer.
+Result Drive(const std::string& path, size_t first, size_t count, size_t depth) {
+    Result result;
+    absl::StatusOr<pink_perilla::PlanClient> client =
+        pink_perilla::PlanClient::Connect(path);
+    if (!client.ok()) {
+        result.failure = client.status().ToString();
+        return result;
+    }
+    std::vector<Clock::time_point> sent_at(count);
+    result.latencies_ns.reserve(count);
+    std::string plan;
+    size_t sent = 0;
+    for (size_t answered = 0; answered < count; ++answered) {
+        for (; sent < count && sent - answered < depth; ++sent) {
+            const size_t i = first + sent;
+            const std::string sql =
+                std::string(kShapes[i % std::size(kShapes)]) + std::to_string(i);
+            sent_at[sent] = Clock::now();
+            if (absl::Status status = client->Send(sql); !status.ok()) {
+                result.failure = status.ToString();
+                return result;
+            }
+        }
+        absl::Status status = client->Receive(&plan);
+        result.latencies_ns.push_back(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                Clock::now() - sent_at[answered])
+                .count());
+        if (absl::IsUnavailable(status)) {
+            result.failure = status.ToString();
+            return result;
+        }
+        result.errors += !status.ok();
+    }
+    return result;
+}
+
+double Percentile(const std::vector<uint64_t>& sorted, double fraction) {
+    const size_t index = static_cast<size_t>(fraction * (sorted.size() - 1));
+    return sorted[index] / 1000.0;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const size_t requests = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200000;
+    const size_t connections = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 4;
+    const size_t depth = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 32;
+    std::string path = argc > 4 ? argv[4] : "";
+
+    const pink_perilla::CatalogHandle catalog(
+        std::make_shared<const pink_perilla::Catalog>(
+            std::vector<pink_perilla::TableDefinition>{}));
+    std::unique_ptr<pink_perilla::PlanServer> server;
+    std::thread serving;
+    if (path.empty()) {
+        path = "/tmp/plan_server_bench." + std::to_string(getpid()) + ".sock";
+        absl::StatusOr<std::unique_ptr<pink_perilla::PlanServer>> listening =
+            pink_perilla::PlanServer::Listen(path, catalog);
+        if (!listening.ok()) {
+            std::fprintf(stderr, "%s\n", listening.status().ToString().c_str());
+            return 1;
+        }
+        server = *std::move(listening);
+        serving = std::thread([&server] { server->Run().IgnoreError(); });
+    }
+
+    std::vector<Result> results(connections);
+    std::vector<std::thread> drivers;
+    const auto start = Clock::now();
+    for (size_t i = 0; i < connections; ++i) {
+        const size_t first = requests * i / connections;
+        const size_t count = requests * (i + 1) / connections - first;
+        drivers.emplace_back([&, i, first, count] {
+            results[i] = Drive(path, first, count, std::max<size_t>(depth, 1));
+        });
+    }
+    for (std::thread& driver : drivers) {
+        driver.join();
+    }
+    const double seconds =
+        std::chrono::duration<double>(Clock::now() - start).count();
+    if (server != nullptr) {
+        server->Shutdown();
+        serving.join();
+    }
+
+    std::vector<uint64_t> latencies;
+    size_t errors = 0;
+    for (const Result& result : results) {
+        if (!result.failure.empty()) {
+            std::fprintf(stderr, "%s\n", result.failure.c_str());
+            return 1;
+        }
+        latencies.insert(latencies.end(), result.latencies_ns.begin(),
+                         result.latencies_ns.end());
+        errors += result.errors;
+    }
+    if (latencies.empty()) {
+        return 0;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    std::printf("connections %zu depth %zu requests %zu errors %zu\n",
+                connections, depth, latencies.size(), errors);
+    std::printf("throughput  %.0f requests/s\n", latencies.size() / seconds);
+    std::printf("latency_us  p50 %.1f  p99 %.1f  p999 %.1f  max %.1f\n",
+                Percentile(latencies, 0.50), Percentile(latencies, 0.99),
+                Percentile(latencies, 0.999), latencies.back() / 1000.0);
+    return 0;
+}
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""Measures how long the pink_perilla binary takes to plan its first statement.
+
+    bench/startup_bench.py ./build/pink_perilla [--runs 50]
+        [--budget-ms 25] [--budget-rss-mb 32]
+
+Each run starts a fresh process, as a CLI or serverless invocation would,
+and times it from exec to the first byte of plan on stdout. That covers
+dynamic loading, static initializers, argument parsing, planning and the
+first write. Peak RSS comes from the process's rusage. Reports the median
+and worst run for each output format, and exits with status 1 if a median
+is over budget.
+"""
+
+import argparse
+import os
+import statistics
+import subprocess
+import sys
+import time
+
+SQL = "SELECT a, b FROM t WHERE a > 1 ORDER BY b LIMIT 10"
+# JSON output builds protobuf descriptors on first use; binary output never
+# touches them, so the two are measured apart.
+FORMATS = ("binary-delimited", "json")
+
+
+def run_once(binary, output_format):
+    """Returns (ms to first plan byte, peak RSS in MB) for one process."""
+    start = time.perf_counter()
+    process = subprocess.Popen(
+        [binary, "--sql", SQL, f"--format={output_format}"],
+        stdout=subprocess.PIPE, stderr=subprocess.DEVNULL)
+    first = process.stdout.read(1)
+    first_plan_ms = (time.perf_counter() - start) * 1e3
+    process.stdout.read()
+    process.stdout.close()
+    _, status, usage = os.wait4(process.pid, 0)
+    if not first or os.waitstatus_to_exitcode(status) != 0:
+        sys.exit(f"{binary} failed to plan {SQL!r}")
+    # ru_maxrss is in kilobytes on Linux.
+    return first_plan_ms, usage.ru_maxrss / 1024
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("binary")
+    parser.add_argument("--runs", type=int, default=50)
+    parser.add_argument("--budget-ms", type=float, default=25.0,
+                        help="allowed median time to first plan "
+                             "(default: 25)")
+    parser.add_argument("--budget-rss-mb", type=float, default=32.0,
+                        help="allowed median peak RSS (default: 32)")
+    args = parser.parse_args()
+
+    over_budget = 0
+    print(f"{'format':18} {'p50_ms':>8} {'max_ms':>8} {'rss_mb':>8}")
+    for output_format in FORMATS:
+        # One unmeasured run, so the binary and its libraries are in the page
+        # cache like they would be on a warm host.
+        run_once(args.binary, output_format)
+        runs = [run_once(args.binary, output_format) for _ in range(args.runs)]
+        times = [ms for ms, _ in runs]
+        median_ms = statistics.median(times)
+        median_rss = statistics.median(rss for _, rss in runs)
+        over = median_ms > args.budget_ms or median_rss > args.budget_rss_mb
+        over_budget += over
+        print(f"{output_format:18} {median_ms:8.2f} {max(times):8.2f} "
+              f"{median_rss:8.1f}{'  OVER BUDGET' if over else ''}")
+
+    if over_budget:
+        print(f"{over_budget} format(s) over {args.budget_ms:g} ms or "
+              f"{args.budget_rss_mb:g} MB", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "symbol_table.hpp"
+#include "table_definition.hpp"
+
+namespace pink_perilla {
+
+// Table definitions indexed by name. Table and column names are interned in
+// the catalog's SymbolTable, so lookups ignore ASCII case and the binder
+// matches columns by comparing symbols. A Catalog is built once and only read
+// afterwards, so a single instance can be shared by any number of concurrent
+// planners without copying the definitions per statement. Build one with
+// std::make_shared<const Catalog>(...) and publish it through a CatalogHandle
+// to let schema changes reach planners that are already running.
+class Catalog {
+public:
+    // Takes the definitions over; pass an rvalue to avoid copying them.
+    explicit Catalog(std::vector<TableDefinition> table_definitions);
+    // Indexes `table_definitions` in place, without copying them. They must
+    // outlive the catalog.
+    static Catalog Borrow(const std::vector<TableDefinition>& table_definitions);
+
+    Catalog(Catalog&&) = default;
+    Catalog& operator=(Catalog&&) = default;
+    Catalog(const Catalog&) = delete;
+    Catalog& operator=(const Catalog&) = delete;
+
+    // The definition of `name`, or nullptr when the catalog has none.
+    const TableDefinition* Find(std::string_view name) const {
+        return this->Find(this->symbols_.Find(name));
+    }
+    // The definition of the table interned as `table`, or nullptr.
+    const TableDefinition* Find(Symbol table) const {
+        return table < this->tables_.size() ? this->tables_[table].definition
+                                            : nullptr;
+    }
+
+    // The symbol of a table or column name, or kNoSymbol if no table or
+    // column is called that.
+    Symbol symbol(std::string_view name) const {
+        return this->symbols_.Find(name);
+    }
+    // The symbols of the columns of `table`, in definition order. `table`
+    // must have a definition.
+    const std::vector<Symbol>& column_symbols(Symbol table) const {
+        return this->tables_[table].columns;
+    }
+    const SymbolTable& symbols() const { return this->symbols_; }
+
+    bool empty() const { return this->size_ == 0; }
+    size_t size() const { return this->size_; }
+
+    // Hash of every definition, equal for catalogs built from equal
+    // definitions in the same order. Computed once, at construction.
+    size_t fingerprint() const { return this->fingerprint_; }
+
+private:
+    void Index(const std::vector<TableDefinition>& table_definitions);
+
+    struct Table {
+        const TableDefinition* definition = nullptr;
+        std::vector<Symbol> columns;
+    };
+
+    // Empty when borrowing.
+    std::vector<TableDefinition> owned_;
+    SymbolTable symbols_;
+    // Indexed by symbol; names that are only ever columns have no definition.
+    std::vector<Table> tables_;
+    size_t size_ = 0;
+    size_t fingerprint_ = 0;
+};
+
+// The current catalog of a running system. Planners Load() a snapshot and plan
+// against it for as long as they like; Swap() publishes a new one without
+// waiting for them, and the old snapshot is freed when its last planner lets
+// go of it.
+class CatalogHandle {
+public:
+    explicit CatalogHandle(std::shared_ptr<const Catalog> catalog)
+        : catalog_(std::move(catalog)) {}
+    CatalogHandle(const CatalogHandle&) = delete;
+    CatalogHandle& operator=(const CatalogHandle&) = delete;
+
+    std::shared_ptr<const Catalog> Load() const;
+
+    // Publishes `catalog` and returns the snapshot it replaces.
+    std::shared_ptr<const Catalog> Swap(std::shared_ptr<const Catalog> catalog);
+
+private:
+    // Accessed only through the std::atomic_* shared_ptr functions.
+    std::shared_ptr<const Catalog> catalog_;
+};
+
+}  // namespace pink_perilla
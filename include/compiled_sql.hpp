@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "absl/types/span.h"
+// PP_SQL expands in the caller's code, so the tokenizer it runs there has to
+// be visible from this public header.
+#include "detail/lexer.hpp"
+
+namespace pink_perilla {
+
+// A statement tokenized and checked by the compiler; see PP_SQL. Parse() and
+// Prepare() accept it in place of SQL text and start from its tokens, so the
+// statement is never lexed at run time.
+class CompiledSql {
+public:
+    constexpr CompiledSql(std::string_view sql, const lexer::Token* tokens,
+                          size_t token_count)
+        : sql_(sql), tokens_(tokens), token_count_(token_count) {}
+
+    constexpr std::string_view sql() const { return this->sql_; }
+    // The statement's tokens, ending with kEnd.
+    absl::Span<const lexer::Token> tokens() const {
+        return absl::MakeConstSpan(this->tokens_, this->token_count_);
+    }
+
+private:
+    std::string_view sql_;
+    const lexer::Token* tokens_;
+    size_t token_count_;
+};
+
+namespace detail {
+
+// What PP_SQL can tell is wrong with a statement without parsing it.
+enum class CompiledSqlError : uint8_t {
+    kNone,
+    kUnexpectedCharacter,
+    kUnterminatedQuote,
+    kEmpty,
+    kNotAStatement,
+    kUnbalancedParentheses,
+    kMixedPlaceholders,
+    kMultipleStatements,
+};
+
+// Checks the `count` tokens of a statement (kEnd included) that tokenized
+// with `lex`. The parser reports everything else, when the statement is
+// first planned.
+constexpr CompiledSqlError CheckCompiledSql(lexer::StaticLexError lex,
+                                            const lexer::Token* tokens,
+                                            size_t count) {
+    using lexer::Keyword;
+    using lexer::TokenType;
+    switch (lex) {
+        case lexer::StaticLexError::kNone:
+            break;
+        case lexer::StaticLexError::kUnexpectedCharacter:
+            return CompiledSqlError::kUnexpectedCharacter;
+        case lexer::StaticLexError::kUnterminatedQuote:
+            return CompiledSqlError::kUnterminatedQuote;
+    }
+    if (count < 2) {
+        return CompiledSqlError::kEmpty;
+    }
+    switch (tokens[0].keyword) {
+        case Keyword::kSelect:
+        case Keyword::kInsert:
+        case Keyword::kUpdate:
+        case Keyword::kDelete:
+        case Keyword::kCreate:
+        case Keyword::kDrop:
+        case Keyword::kCopy:
+            break;
+        default:
+            return CompiledSqlError::kNotAStatement;
+    }
+    size_t depth = 0;
+    bool positional = false;
+    bool numbered = false;
+    for (size_t i = 0; i + 1 < count; ++i) {
+        const lexer::Token& token = tokens[i];
+        if (token.type == TokenType::kLParen) {
+            ++depth;
+        } else if (token.type == TokenType::kRParen) {
+            if (depth == 0) {
+                return CompiledSqlError::kUnbalancedParentheses;
+            }
+            --depth;
+        } else if (token.type == TokenType::kParameter) {
+            (token.text == "?" ? positional : numbered) = true;
+        } else if (token.type == TokenType::kSemicolon &&
+                   tokens[i + 1].type != TokenType::kSemicolon &&
+                   tokens[i + 1].type != TokenType::kEnd) {
+            return CompiledSqlError::kMultipleStatements;
+        }
+    }
+    if (depth != 0) {
+        return CompiledSqlError::kUnbalancedParentheses;
+    }
+    if (positional && numbered) {
+        return CompiledSqlError::kMixedPlaceholders;
+    }
+    return CompiledSqlError::kNone;
+}
+
+// Instantiated by PP_SQL with the statement's CheckCompiledSql() result, so
+// a bad statement stops the build with one of these messages.
+template <CompiledSqlError kError>
+constexpr bool AssertCompiledSql() {
+    static_assert(kError != CompiledSqlError::kUnexpectedCharacter,
+                  "PP_SQL: unexpected character in statement");
+    static_assert(kError != CompiledSqlError::kUnterminatedQuote,
+                  "PP_SQL: unterminated quoted literal");
+    static_assert(kError != CompiledSqlError::kEmpty, "PP_SQL: empty statement");
+    static_assert(kError != CompiledSqlError::kNotAStatement,
+                  "PP_SQL: statement must start with SELECT, INSERT, UPDATE, "
+                  "DELETE, CREATE, DROP or COPY");
+    static_assert(kError != CompiledSqlError::kUnbalancedParentheses,
+                  "PP_SQL: unbalanced parentheses");
+    static_assert(kError != CompiledSqlError::kMixedPlaceholders,
+                  "PP_SQL: statement mixes ? and $n placeholders");
+    static_assert(kError != CompiledSqlError::kMultipleStatements,
+                  "PP_SQL: more than one statement");
+    return kError == CompiledSqlError::kNone;
+}
+
+}  // namespace detail
+}  // namespace pink_perilla
+
+// Tokenizes and checks the string literal `sql` at compile time and yields a
+// pink_perilla::CompiledSql for it. Lexical errors, unbalanced parentheses,
+// mixed placeholder styles and more than one statement fail the build; other
+// mistakes are reported when the statement is planned. The tokens live in
+// the binary's read-only data, and placeholders are bound at run time through
+// Prepare():
+//
+//   static const auto kByAge = pink_perilla::Prepare(
+//       PP_SQL("SELECT name FROM users WHERE age > ?"), catalog);
+//   auto plan = kByAge->Bind({int64_t{30}});
+#define PP_SQL(sql)                                                          \
+    ([] {                                                                    \
+        constexpr std::string_view kPpSql = sql;                             \
+        constexpr ::pink_perilla::lexer::StaticScan kPpScan =                \
+            ::pink_perilla::lexer::ScanStatically(kPpSql);                   \
+        static constexpr auto kPpTokens =                                    \
+            ::pink_perilla::lexer::TokenizeStatically<kPpScan.tokens>(kPpSql); \
+        static_assert(::pink_perilla::detail::AssertCompiledSql<             \
+                      ::pink_perilla::detail::CheckCompiledSql(              \
+                          kPpScan.error, kPpTokens.data(),                   \
+                          kPpTokens.size())>());                             \
+        return ::pink_perilla::CompiledSql(kPpSql, kPpTokens.data(),         \
+                                           kPpTokens.size());                \
+    }())
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory_resource>
+#include <string_view>
+
+namespace pink_perilla {
+
+// Bump allocator for everything built while planning one statement: the token
+// stream, the structural index and the IR vectors. The first kInlineSize bytes
+// live inside the object, so a typical statement is planned without touching
+// the heap; larger statements spill into heap chunks that are freed together.
+class StatementArena {
+public:
+    static constexpr size_t kInlineSize = 8 * 1024;
+
+    StatementArena() : resource_(buffer_, sizeof(buffer_)) {}
+    StatementArena(const StatementArena&) = delete;
+    StatementArena& operator=(const StatementArena&) = delete;
+
+    std::pmr::memory_resource* resource() {
+        return &this->resource_;
+    }
+
+    // Frees every allocation at once and rewinds to the inline buffer. Nothing
+    // previously allocated from this arena may be used afterwards.
+    void Reset() {
+        this->resource_.release();
+    }
+
+private:
+    alignas(std::max_align_t) char buffer_[kInlineSize];
+    std::pmr::monotonic_buffer_resource resource_;
+};
+
+// Copies `text` into memory owned by `resource`; used for the rare strings the
+// parser has to synthesize rather than slice out of the source buffer. The copy
+// is never deallocated on its own, so `resource` must be one that frees
+// everything at once, such as a StatementArena.
+inline std::string_view CopyToArena(std::pmr::memory_resource* resource,
+                                    std::string_view text) {
+    if (text.empty()) {
+        return {};
+    }
+    char* copy = static_cast<char*>(resource->allocate(text.size(), 1));
+    std::memcpy(copy, text.data(), text.size());
+    return {copy, text.size()};
+}
+
+}  // namespace pink_perilla
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <memory_resource>
+#include <string>
+
+#include "absl/status/status.h"
+#include "catalog.hpp"
+#include "sql_parser.hpp"
+#include "table_definition.hpp"
+
+namespace pink_perilla::binder {
+
+// Resolves every column reference in `statement` to a field index, assigns
+// result types to expression nodes, and records what the converter needs to
+// lay out relations: table schemas, aggregate measures and SET targets.
+//
+// Tables with a definition in `catalog` get its full schema and reject
+// unknown columns. Other tables, which the parser only lets through when the
+// catalog is empty, get a schema inferred from the columns the statement
+// references. Schemas borrow their column names from `catalog`, which must
+// outlive `statement`; `arena` holds the rest of what binding allocates.
+absl::Status Bind(
+    Statement& statement,
+    const Catalog& catalog,
+    std::pmr::memory_resource* arena);
+
+}  // namespace pink_perilla::binder
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "absl/status/status.h"
+#include "parse_options.hpp"
+
+namespace pink_perilla::detail {
+
+// The cancellation flag of the planning running on the calling thread, or
+// nullptr if it cannot be cancelled. Set by CancellationScope; the lexer,
+// parser and converter poll it at their checkpoints.
+extern thread_local const std::atomic<bool>* thread_cancellation;
+
+// The deadline and size limits of the planning running on the calling
+// thread, or nullptr if it has none. Set by LimitsScope.
+extern thread_local const ParseOptions* thread_limits;
+
+// Checkpoints left until the deadline is next compared with the clock.
+extern thread_local uint32_t thread_deadline_countdown;
+
+// Reading the clock costs about as much as a checkpoint's own work, so only
+// every this many checkpoints do it. Between two of them lie at most a few
+// microseconds of planning.
+constexpr uint32_t kDeadlineCheckInterval = 64;
+
+// Whether the deadline in `limits` has passed, as of the last checkpoint
+// that read the clock. Once it has, every later call reads it again, so the
+// answer stays true.
+inline bool DeadlinePassed(const ParseOptions& limits) {
+    if (--thread_deadline_countdown != 0) {
+        return false;
+    }
+    if (std::chrono::steady_clock::now() < limits.deadline) {
+        thread_deadline_countdown = kDeadlineCheckInterval;
+        return false;
+    }
+    thread_deadline_countdown = 1;
+    return true;
+}
+
+// Whether the planning running on this thread has to stop: it has been
+// asked to, or its deadline has passed.
+inline bool Interrupted() {
+    const std::atomic<bool>* flag = thread_cancellation;
+    if (flag != nullptr && flag->load(std::memory_order_relaxed)) {
+        return true;
+    }
+    const ParseOptions* limits = thread_limits;
+    return limits != nullptr && DeadlinePassed(*limits);
+}
+
+// What a checkpoint that finds the flag set returns.
+inline absl::Status CancellationError() {
+    return absl::CancelledError("Planning was cancelled");
+}
+
+// What a checkpoint that finds Interrupted() returns.
+inline absl::Status InterruptionError() {
+    const std::atomic<bool>* flag = thread_cancellation;
+    if (flag != nullptr && flag->load(std::memory_order_relaxed)) {
+        return CancellationError();
+    }
+    return absl::DeadlineExceededError("Planning deadline exceeded");
+}
+
+// The limits' max_ir_nodes, or 0 if the planning on this thread has none.
+inline size_t MaxIrNodes() {
+    const ParseOptions* limits = thread_limits;
+    return limits != nullptr ? limits->max_ir_nodes : 0;
+}
+
+// The limits' max_plan_bytes, or 0 if the planning on this thread has none.
+inline size_t MaxPlanBytes() {
+    const ParseOptions* limits = thread_limits;
+    return limits != nullptr ? limits->max_plan_bytes : 0;
+}
+
+// Makes `flag` the calling thread's cancellation flag for its lifetime.
+class CancellationScope {
+public:
+    explicit CancellationScope(const std::atomic<bool>* flag)
+        : previous_(thread_cancellation) {
+        thread_cancellation = flag;
+    }
+    ~CancellationScope() { thread_cancellation = this->previous_; }
+    CancellationScope(const CancellationScope&) = delete;
+    CancellationScope& operator=(const CancellationScope&) = delete;
+
+private:
+    const std::atomic<bool>* const previous_;
+};
+
+// Makes the deadline and size limits of `options` apply to the calling
+// thread's planning for its lifetime. Options without limits leave planning
+// unbounded, and the checkpoints never read the clock.
+class LimitsScope {
+public:
+    explicit LimitsScope(const ParseOptions& options)
+        : previous_(thread_limits),
+          previous_countdown_(thread_deadline_countdown) {
+        thread_limits = HasLimits(options) ? &options : nullptr;
+        // The deadline may already have passed, so the first checkpoint
+        // looks.
+        thread_deadline_countdown = 1;
+    }
+    ~LimitsScope() {
+        thread_limits = this->previous_;
+        thread_deadline_countdown = this->previous_countdown_;
+    }
+    LimitsScope(const LimitsScope&) = delete;
+    LimitsScope& operator=(const LimitsScope&) = delete;
+
+private:
+    static bool HasLimits(const ParseOptions& options) {
+        return options.deadline != std::chrono::steady_clock::time_point::max() ||
+               options.max_ir_nodes != 0 || options.max_plan_bytes != 0;
+    }
+
+    const ParseOptions* const previous_;
+    const uint32_t previous_countdown_;
+};
+
+}  // namespace pink_perilla::detail
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "table_definition.hpp"
+
+// Scalar expressions in the IR are stored as a flat node table per statement
+// rather than as a pointer tree: nodes live in one vector, and each node's
+// operands are a contiguous run of ids in a second vector. Both vectors draw
+// from the statement's memory resource, so a whole WHERE clause costs two
+// bump allocations on an arena and is destroyed with the statement.
+
+using ExprId = uint32_t;
+inline constexpr ExprId kNoExpr = ~ExprId{0};
+
+enum class ExprKind : uint8_t {
+    kColumn,    // [qualifier.]text
+    kLiteral,   // text is the literal token, quotes included
+    kStar,      // `*` as a function argument, e.g. COUNT(*)
+    kUnary,     // op args[0]
+    kBinary,    // args[0] op args[1]; AND and OR take any number of args
+    kIsNull,    // args[0] IS [NOT] NULL
+    kBetween,   // args[0] [NOT] BETWEEN args[1] AND args[2]
+    kInList,    // args[0] [NOT] IN (args[1], ...)
+    kCase,      // [operand] {WHEN, THEN}... [ELSE]
+    kCast,      // CAST(args[0] AS text)
+    kFunction,  // text(args...)
+    kParameter, // ? or $n; see ExprNode::parameter
+};
+
+enum class ExprOp : uint8_t {
+    kNone,
+    kNot,
+    kNegate,
+    kAnd,
+    kOr,
+    kEq,
+    kNe,
+    kLt,
+    kLe,
+    kGt,
+    kGe,
+    kLike,
+    kConcat,
+    kAdd,
+    kSubtract,
+    kMultiply,
+    kDivide,
+    kModulo,
+};
+
+// kDate and kTimestamp are DATE '...' and TIMESTAMP '...'; their text is the
+// string token alone.
+enum class LiteralKind : uint8_t {
+    kNull,
+    kBoolean,
+    kInteger,
+    kDecimal,
+    kString,
+    kDate,
+    kTimestamp,
+};
+
+struct ExprNode {
+    ExprKind kind = ExprKind::kLiteral;
+    ExprOp op = ExprOp::kNone;
+    LiteralKind literal = LiteralKind::kNull;
+    // NOT BETWEEN, NOT IN, NOT LIKE, IS NOT NULL; for numeric literals, a
+    // folded unary minus.
+    bool negated = false;
+    bool case_has_operand = false;
+    bool case_has_else = false;
+    // Column or function name, literal token, or CAST target type.
+    std::string_view text;
+    // Table name of a qualified column reference.
+    std::string_view qualifier;
+    // The SQL this node was parsed from.
+    std::string_view source;
+    uint32_t first_arg = 0;
+    uint32_t arg_count = 0;
+    // Zero-based placeholder index: ? counts up from 0, $n is n - 1.
+    uint32_t parameter = 0;
+
+    // Set by the binder. A node with field >= 0 is emitted as a reference to
+    // that field of its relation's input instead of being evaluated: columns,
+    // aggregate calls above the aggregation, and GROUP BY expressions.
+    int32_t field = -1;
+    pink_perilla::DataType type = pink_perilla::DataType::kUnknown;
+};
+
+struct ExpressionTree {
+    std::pmr::vector<ExprNode> nodes;
+    std::pmr::vector<ExprId> args;
+
+    ExpressionTree() = default;
+    explicit ExpressionTree(std::pmr::memory_resource* arena)
+        : nodes(arena), args(arena) {}
+
+    const ExprNode& operator[](ExprId id) const {
+        return this->nodes[id];
+    }
+    ExprNode& operator[](ExprId id) {
+        return this->nodes[id];
+    }
+    ExprId arg(const ExprNode& node, size_t i) const {
+        return this->args[node.first_arg + i];
+    }
+};
+
+// A SQL type name such as "INTEGER", "VARCHAR(20)" or "DECIMAL(10, 2)".
+struct TypeSpec {
+    pink_perilla::DataType type = pink_perilla::DataType::kUnknown;
+    int32_t length = 0;
+    int32_t precision = 0;
+    int32_t scale = 0;
+};
+
+// Returns std::nullopt for type names the planner does not know.
+std::optional<TypeSpec> ParseTypeSpec(std::string_view type_name);
+
+// COUNT, SUM, AVG, MIN and MAX, case-insensitively.
+bool IsAggregateFunction(std::string_view name);
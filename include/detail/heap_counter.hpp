@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+namespace pink_perilla::detail {
+
+struct HeapCounter {
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+};
+
+// Heap traffic of the calling thread. src/allocation_hooks.cpp feeds it from
+// the global operator new when a program is built with it; otherwise it stays
+// zero.
+extern thread_local HeapCounter thread_heap_counter;
+
+}  // namespace pink_perilla::detail
@@ -0,0 +1,494 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+#include "absl/status/statusor.h"
+
+namespace pink_perilla::lexer {
+
+enum class TokenType : uint8_t {
+    kEnd,
+    kIdentifier,        // Bare word; `keyword` tells whether it is reserved.
+    kQuotedIdentifier,  // "Name", text keeps the quotes.
+    kNumber,            // 123, 1.5, 2e10
+    kString,            // 'text', text keeps the quotes.
+    kParameter,         // ? or $1, $2, ...
+    kLParen,
+    kRParen,
+    kComma,
+    kSemicolon,
+    kDot,
+    kStar,
+    kPlus,
+    kMinus,
+    kSlash,
+    kPercent,
+    kConcat,  // ||
+    kEq,
+    kNe,  // <> or !=
+    kLt,
+    kLe,
+    kGt,
+    kGe,
+};
+
+// Every keyword the parser dispatches on. Keep in sync with kKeywords below.
+enum class Keyword : uint8_t {
+    kNone,
+    kAnd,
+    kAs,
+    kAsc,
+    kBetween,
+    kBy,
+    kCase,
+    kCast,
+    kCopy,
+    kCreate,
+    kDelete,
+    kDesc,
+    kDrop,
+    kElse,
+    kEnd,
+    kFalse,
+    kFrom,
+    kGroup,
+    kIn,
+    kInner,
+    kInsert,
+    kInto,
+    kIs,
+    kJoin,
+    kLeft,
+    kLike,
+    kLimit,
+    kNot,
+    kNull,
+    kOn,
+    kOr,
+    kOrder,
+    kOuter,
+    kOver,
+    kPartition,
+    kSelect,
+    kSet,
+    kTable,
+    kThen,
+    kTrue,
+    kUpdate,
+    kValues,
+    kWhen,
+    kWhere,
+    kWith,
+};
+
+struct Token {
+    TokenType type = TokenType::kEnd;
+    Keyword keyword = Keyword::kNone;
+    // Points into the source buffer passed to Tokenize().
+    std::string_view text;
+
+    friend std::ostream &operator<<(std::ostream &ost, const Token &token) {
+        return ost << "Token{type: " << static_cast<int>(token.type)
+                   << ", text: " << token.text << "}";
+    }
+};
+
+namespace internal {
+
+struct KeywordEntry {
+    std::string_view text;
+    Keyword keyword;
+};
+
+inline constexpr std::array<KeywordEntry, 44> kKeywords = {{
+    {"AND", Keyword::kAnd},
+    {"AS", Keyword::kAs},
+    {"ASC", Keyword::kAsc},
+    {"BETWEEN", Keyword::kBetween},
+    {"BY", Keyword::kBy},
+    {"CASE", Keyword::kCase},
+    {"CAST", Keyword::kCast},
+    {"COPY", Keyword::kCopy},
+    {"CREATE", Keyword::kCreate},
+    {"DELETE", Keyword::kDelete},
+    {"DESC", Keyword::kDesc},
+    {"DROP", Keyword::kDrop},
+    {"ELSE", Keyword::kElse},
+    {"END", Keyword::kEnd},
+    {"FALSE", Keyword::kFalse},
+    {"FROM", Keyword::kFrom},
+    {"GROUP", Keyword::kGroup},
+    {"IN", Keyword::kIn},
+    {"INNER", Keyword::kInner},
+    {"INSERT", Keyword::kInsert},
+    {"INTO", Keyword::kInto},
+    {"IS", Keyword::kIs},
+    {"JOIN", Keyword::kJoin},
+    {"LEFT", Keyword::kLeft},
+    {"LIKE", Keyword::kLike},
+    {"LIMIT", Keyword::kLimit},
+    {"NOT", Keyword::kNot},
+    {"NULL", Keyword::kNull},
+    {"ON", Keyword::kOn},
+    {"OR", Keyword::kOr},
+    {"ORDER", Keyword::kOrder},
+    {"OUTER", Keyword::kOuter},
+    {"OVER", Keyword::kOver},
+    {"PARTITION", Keyword::kPartition},
+    {"SELECT", Keyword::kSelect},
+    {"SET", Keyword::kSet},
+    {"TABLE", Keyword::kTable},
+    {"THEN", Keyword::kThen},
+    {"TRUE", Keyword::kTrue},
+    {"UPDATE", Keyword::kUpdate},
+    {"VALUES", Keyword::kValues},
+    {"WHEN", Keyword::kWhen},
+    {"WHERE", Keyword::kWhere},
+    {"WITH", Keyword::kWith},
+}};
+
+// Must be a power of two. 512 slots keep the seed search short for ~50 words.
+inline constexpr size_t kKeywordSlots = 512;
+
+// Case-insensitive FNV-1a. Clearing bit 0x20 upper-cases ASCII letters; other
+// characters may alias, which is fine because a hit is always re-compared.
+constexpr uint32_t HashWord(std::string_view word, uint32_t seed) {
+    uint32_t hash = 2166136261u ^ seed;
+    for (char c : word) {
+        hash = (hash ^ static_cast<uint8_t>(c & ~0x20)) * 16777619u;
+    }
+    return hash;
+}
+
+struct KeywordTable {
+    uint32_t seed = 0;
+    // Index into kKeywords plus one; zero marks an empty slot.
+    std::array<uint8_t, kKeywordSlots> slots{};
+};
+
+// Searches for a seed under which no two keywords share a slot, so lookup is
+// one hash, one probe and one comparison.
+constexpr KeywordTable BuildKeywordTable() {
+    for (uint32_t seed = 1; seed < 4096; ++seed) {
+        KeywordTable table;
+        table.seed = seed;
+        bool collision = false;
+        for (size_t i = 0; i < kKeywords.size() && !collision; ++i) {
+            const size_t slot =
+                HashWord(kKeywords[i].text, seed) & (kKeywordSlots - 1);
+            if (table.slots[slot] != 0) {
+                collision = true;
+            } else {
+                table.slots[slot] = static_cast<uint8_t>(i + 1);
+            }
+        }
+        if (!collision) {
+            return table;
+        }
+    }
+    return KeywordTable{};
+}
+
+inline constexpr KeywordTable kKeywordTable = BuildKeywordTable();
+static_assert(kKeywordTable.seed != 0,
+              "No perfect hash seed found for the keyword table");
+
+}  // namespace internal
+
+// Classifies a bare word. Returns Keyword::kNone for ordinary identifiers.
+constexpr Keyword LookupKeyword(std::string_view word) {
+    const size_t slot =
+        internal::HashWord(word, internal::kKeywordTable.seed) &
+        (internal::kKeywordSlots - 1);
+    const uint8_t entry = internal::kKeywordTable.slots[slot];
+    if (entry == 0) {
+        return Keyword::kNone;
+    }
+    const internal::KeywordEntry &candidate = internal::kKeywords[entry - 1];
+    if (candidate.text.size() != word.size()) {
+        return Keyword::kNone;
+    }
+    for (size_t i = 0; i < word.size(); ++i) {
+        if ((word[i] & ~0x20) != candidate.text[i]) {
+            return Keyword::kNone;
+        }
+    }
+    return candidate.keyword;
+}
+
+namespace internal {
+
+constexpr bool IsIdentifierStart(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+constexpr bool IsDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+constexpr bool IsIdentifierChar(char c) {
+    return IsIdentifierStart(c) || IsDigit(c);
+}
+
+constexpr bool IsWhitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+constexpr size_t ScanNumber(std::string_view sql, size_t begin) {
+    size_t i = begin;
+    while (i < sql.size() && IsDigit(sql[i])) {
+        ++i;
+    }
+    if (i + 1 < sql.size() && sql[i] == '.' && IsDigit(sql[i + 1])) {
+        ++i;
+        while (i < sql.size() && IsDigit(sql[i])) {
+            ++i;
+        }
+    }
+    if (i < sql.size() && (sql[i] == 'e' || sql[i] == 'E')) {
+        size_t exponent = i + 1;
+        if (exponent < sql.size() &&
+            (sql[exponent] == '+' || sql[exponent] == '-')) {
+            ++exponent;
+        }
+        if (exponent < sql.size() && IsDigit(sql[exponent])) {
+            i = exponent;
+            while (i < sql.size() && IsDigit(sql[i])) {
+                ++i;
+            }
+        }
+    }
+    return i;
+}
+
+// Reads the token that starts at sql[i], a position outside whitespace and
+// comments, into `token`, and sets `end` just past it. `word_end(i)` and
+// `quote_end(i)` give where an identifier run and a quoted literal starting
+// at i end; Tokenize() answers them from its StructuralIndex, the
+// compile-time tokenizer by scanning. Returns false if no token can start at
+// sql[i].
+template <typename WordEnd, typename QuoteEnd>
+constexpr bool ScanToken(std::string_view sql, size_t i, WordEnd word_end,
+                         QuoteEnd quote_end, Token *token, size_t *end) {
+    const size_t n = sql.size();
+    const char c = sql[i];
+    const char next = i + 1 < n ? sql[i + 1] : '\0';
+    *end = i + 1;
+    if (IsIdentifierStart(c)) {
+        *end = word_end(i);
+        token->type = TokenType::kIdentifier;
+        token->keyword = LookupKeyword(sql.substr(i, *end - i));
+    } else if (IsDigit(c) || (c == '.' && IsDigit(next))) {
+        *end = ScanNumber(sql, c == '.' ? i + 1 : i);
+        token->type = TokenType::kNumber;
+    } else if (c == '$' && IsDigit(next)) {
+        *end = i + 1;
+        while (*end < n && IsDigit(sql[*end])) {
+            ++*end;
+        }
+        token->type = TokenType::kParameter;
+    } else if (c == '\'' || c == '"') {
+        *end = quote_end(i);
+        token->type =
+            c == '\'' ? TokenType::kString : TokenType::kQuotedIdentifier;
+    } else {
+        switch (c) {
+            case '(':
+                token->type = TokenType::kLParen;
+                break;
+            case ')':
+                token->type = TokenType::kRParen;
+                break;
+            case ',':
+                token->type = TokenType::kComma;
+                break;
+            case ';':
+                token->type = TokenType::kSemicolon;
+                break;
+            case '.':
+                token->type = TokenType::kDot;
+                break;
+            case '*':
+                token->type = TokenType::kStar;
+                break;
+            case '+':
+                token->type = TokenType::kPlus;
+                break;
+            case '-':
+                token->type = TokenType::kMinus;
+                break;
+            case '/':
+                token->type = TokenType::kSlash;
+                break;
+            case '%':
+                token->type = TokenType::kPercent;
+                break;
+            case '=':
+                token->type = TokenType::kEq;
+                break;
+            case '?':
+                token->type = TokenType::kParameter;
+                break;
+            case '|':
+                if (next != '|') {
+                    return false;
+                }
+                token->type = TokenType::kConcat;
+                *end = i + 2;
+                break;
+            case '!':
+                if (next != '=') {
+                    return false;
+                }
+                token->type = TokenType::kNe;
+                *end = i + 2;
+                break;
+            case '<':
+                if (next == '=' || next == '>') {
+                    token->type = next == '=' ? TokenType::kLe : TokenType::kNe;
+                    *end = i + 2;
+                } else {
+                    token->type = TokenType::kLt;
+                }
+                break;
+            case '>':
+                if (next == '=') {
+                    token->type = TokenType::kGe;
+                    *end = i + 2;
+                } else {
+                    token->type = TokenType::kGt;
+                }
+                break;
+            default:
+                return false;
+        }
+    }
+    token->text = sql.substr(i, *end - i);
+    return true;
+}
+
+// First position >= i that is neither whitespace nor inside a comment. An
+// unclosed comment runs to the end, as in StructuralIndex.
+constexpr size_t SkipInsignificant(std::string_view sql, size_t i) {
+    const size_t n = sql.size();
+    while (i < n) {
+        if (IsWhitespace(sql[i])) {
+            ++i;
+        } else if (sql[i] == '-' && i + 1 < n && sql[i + 1] == '-') {
+            i += 2;
+            while (i < n && sql[i] != '\n') {
+                ++i;
+            }
+        } else if (sql[i] == '/' && i + 1 < n && sql[i + 1] == '*') {
+            i += 2;
+            while (i < n && !(sql[i] == '*' && i + 1 < n && sql[i + 1] == '/')) {
+                ++i;
+            }
+            i = i < n ? i + 2 : n;
+        } else {
+            break;
+        }
+    }
+    return i;
+}
+
+// Just past the quote that closes the literal opened at sql[i], skipping
+// doubled quotes; sql.size() + 1 if it is never closed.
+constexpr size_t ScanQuoteEnd(std::string_view sql, size_t i) {
+    const char quote = sql[i];
+    for (size_t pos = i + 1; pos < sql.size(); ++pos) {
+        if (sql[pos] != quote) {
+            continue;
+        }
+        if (pos + 1 < sql.size() && sql[pos + 1] == quote) {
+            ++pos;
+            continue;
+        }
+        return pos + 1;
+    }
+    return sql.size() + 1;
+}
+
+}  // namespace internal
+
+// Why a statement failed to tokenize at compile time.
+enum class StaticLexError : uint8_t {
+    kNone,
+    kUnexpectedCharacter,
+    kUnterminatedQuote,
+};
+
+// Tokenizes `sql` byte by byte, calling `emit` with each token but the final
+// kEnd. Produces the same tokens as Tokenize(), but is constexpr, for
+// statements known at compile time (see PP_SQL).
+template <typename Emit>
+constexpr StaticLexError ForEachTokenStatically(std::string_view sql,
+                                                Emit emit) {
+    const auto word_end = [sql](size_t pos) {
+        while (pos < sql.size() && internal::IsIdentifierChar(sql[pos])) {
+            ++pos;
+        }
+        return pos;
+    };
+    const auto quote_end = [sql](size_t pos) {
+        return internal::ScanQuoteEnd(sql, pos);
+    };
+    for (size_t i = internal::SkipInsignificant(sql, 0); i < sql.size();) {
+        if ((sql[i] == '\'' || sql[i] == '"') && quote_end(i) > sql.size()) {
+            return StaticLexError::kUnterminatedQuote;
+        }
+        Token token;
+        size_t end = i;
+        if (!internal::ScanToken(sql, i, word_end, quote_end, &token, &end)) {
+            return StaticLexError::kUnexpectedCharacter;
+        }
+        emit(token);
+        i = internal::SkipInsignificant(sql, end);
+    }
+    return StaticLexError::kNone;
+}
+
+// Token count of `sql` without the final kEnd, and whether it tokenizes.
+struct StaticScan {
+    size_t tokens = 0;
+    StaticLexError error = StaticLexError::kNone;
+};
+
+constexpr StaticScan ScanStatically(std::string_view sql) {
+    StaticScan scan;
+    scan.error = ForEachTokenStatically(
+        sql, [&scan](const Token &) { ++scan.tokens; });
+    return scan;
+}
+
+// The tokens of `sql`, which has kCount of them (from ScanStatically), plus
+// the final kEnd.
+template <size_t kCount>
+constexpr std::array<Token, kCount + 1> TokenizeStatically(
+    std::string_view sql) {
+    std::array<Token, kCount + 1> tokens{};
+    size_t count = 0;
+    ForEachTokenStatically(sql, [&tokens, &count](const Token &token) {
+        if (count < kCount) {
+            tokens[count++] = token;
+        }
+    });
+    tokens[count] = Token{TokenType::kEnd, Keyword::kNone, sql.substr(sql.size())};
+    return tokens;
+}
+
+// Splits `sql` into tokens in a single pass, dropping whitespace and comments.
+// The returned tokens reference `sql`, which must outlive them. The stream is
+// always terminated by a kEnd token. Scratch space and the token vector are
+// allocated from `resource`.
+absl::StatusOr<std::pmr::vector<Token>> Tokenize(
+    std::string_view sql,
+    std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+}  // namespace pink_perilla::lexer
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "absl/numeric/int128.h"
+
+// Conversions from SQL literal text to the values Substrait literals carry.
+// None of them throws or allocates; text that does not convert yields
+// std::nullopt. Number text is a lexer number token, sign excluded: the
+// parser folds a leading minus into `negated`.
+namespace pink_perilla::literal {
+
+// Integer digits as int64, or std::nullopt if out of range.
+std::optional<int64_t> ParseInteger(std::string_view digits, bool negated);
+
+// Any number token, exponent included, as the nearest double.
+std::optional<double> ParseDouble(std::string_view text, bool negated);
+
+// A fixed-point number: `value` / 10^scale, with at most 38 digits.
+struct Decimal {
+    absl::int128 value = 0;
+    int32_t precision = 1;
+    int32_t scale = 0;
+};
+
+// Digits with an optional fraction, exactly. Exponents and numbers of more
+// than 38 significant digits yield std::nullopt.
+std::optional<Decimal> ParseDecimal(std::string_view text, bool negated);
+
+// The 16-byte little-endian two's complement form of Literal.Decimal.value.
+std::string DecimalBytes(const Decimal& decimal);
+
+// 'YYYY-MM-DD' as days since 1970-01-01.
+std::optional<int32_t> ParseDate(std::string_view text);
+
+// 'YYYY-MM-DD[ HH:MM:SS[.ffffff]]', with 'T' also accepted as separator, as
+// microseconds since 1970-01-01 00:00:00.
+std::optional<int64_t> ParseTimestamp(std::string_view text);
+
+// The contents of a single-quoted string token, with doubled quotes still
+// doubled.
+inline std::string_view StringBody(std::string_view token) {
+    return token.substr(1, token.size() - 2);
+}
+
+}  // namespace pink_perilla::literal
@@ -1,19 +1,97 @@
 #pragma once
 
+#include <memory_resource>
 #include <ostream>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <variant>
 #include <vector>
 #include <memory>
 #include <substrait/plan.pb.h>
 #include <absl/container/flat_hash_map.h>
 
 #include "absl/status/statusor.h"
+#include "absl/types/span.h"
+#include "catalog.hpp"
+#include "detail/expression.hpp"
+#include "detail/lexer.hpp"
+#include "parse_options.hpp"
+#include "symbol_table.hpp"
 #include "table_definition.hpp"
 
+// The IR below does not own its text: every std::string_view points either
+// into the SQL buffer handed to SqlParser::Parse or into the memory resource
+// the statement was parsed with, and every vector allocates from that same
+// resource. Both must outlive the Statement.
+
+// Streams the SQL an expression was parsed from.
+struct ExprSource {
+    const ExpressionTree &tree;
+    ExprId id;
+
+    friend std::ostream &operator<<(std::ostream &ost, const ExprSource &expr) {
+        if (expr.id == kNoExpr) {
+            return ost << "(none)";
+        }
+        return ost << expr.tree[expr.id].source;
+    }
+};
+
+struct BoundColumn {
+    std::string_view name;
+    // The catalog's symbol for the name; kNoSymbol in inferred schemas.
+    pink_perilla::Symbol symbol = pink_perilla::kNoSymbol;
+    pink_perilla::DataType type = pink_perilla::DataType::kUnknown;
+    bool nullable = true;
+};
+
+// The columns of a table as one statement sees them. With a TableDefinition
+// this is the whole definition; without one it holds only the columns the
+// statement references, with unknown types, in the order the binder meets
+// them: JOIN ON, WHERE, GROUP BY, the select list, then ORDER BY.
+struct TableSchema {
+    std::pmr::vector<BoundColumn> columns;
+    bool inferred = true;
+
+    TableSchema() = default;
+    explicit TableSchema(std::pmr::memory_resource* arena) : columns(arena) {}
+};
+
+// A table name as written, with the catalog's symbol for it when the catalog
+// defines the table.
+struct TableName {
+    std::string_view name;
+    pink_perilla::Symbol symbol = pink_perilla::kNoSymbol;
+};
+
+struct TableRef {
+    std::string_view name;
+    pink_perilla::Symbol symbol = pink_perilla::kNoSymbol;
+    TableSchema schema;
+
+    friend std::ostream &operator<<(std::ostream &ost, const TableRef &table) {
+        return ost << table.name;
+    }
+};
+
 struct InsertInfo {
-    std::string table_name;
-    std::vector<std::string> columns;
-    std::vector<std::string> values;
+    std::string_view table_name;
+    pink_perilla::Symbol table_symbol = pink_perilla::kNoSymbol;
+    std::pmr::vector<std::string_view> columns;
+    // The VALUES rows back to back, row_width expressions each.
+    std::pmr::vector<ExprId> values;
+    ExpressionTree expressions;
+    // Only used to type placeholders and literals in `values`.
+    TableSchema schema;
+    // Set by the binder: the type of each listed column, kUnknown when the
+    // table has no definition.
+    std::pmr::vector<pink_perilla::DataType> column_types;
+    uint32_t row_width = 0;
+
+    size_t row_count() const {
+        return this->row_width == 0 ? 0 : this->values.size() / this->row_width;
+    }
 
     friend std::ostream &operator<<(std::ostream &ost, const InsertInfo &info) {
         ost << "InsertInfo{table_name: " << info.table_name << ", columns: [";
@@ -22,15 +100,65 @@ struct InsertInfo {
         }
         ost << "], values: [";
         for (size_t i = 0; i < info.values.size(); ++i) {
-            ost << info.values[i] << (i < info.values.size() - 1 ? ", " : "");
+            if (i % info.row_width == 0) {
+                ost << (i == 0 ? "(" : ", (");
+            }
+            ost << ExprSource{info.expressions, info.values[i]}
+                << ((i + 1) % info.row_width == 0 ? ")" : ", ");
         }
         return ost << "]}";
     }
 };
 
+enum class CopyFormat { kCsv, kParquet, kArrow };
+
+// COPY table [(columns)] FROM 'path' [WITH (option value, ...)]. Only the
+// file's location and layout are recorded; planning never opens it.
+struct CopyInfo {
+    std::string_view table_name;
+    pink_perilla::Symbol table_symbol = pink_perilla::kNoSymbol;
+    // Empty to load every column of the table.
+    std::pmr::vector<std::string_view> columns;
+    // Unescaped, and written to the plan as given.
+    std::string_view path;
+    CopyFormat format = CopyFormat::kCsv;
+    // CSV options, ignored for other formats.
+    std::string_view delimiter = ",";
+    std::string_view quote = "\"";
+    std::string_view escape;
+    std::optional<std::string_view> null_string;
+    uint64_t header_lines = 0;
+    // With both set, the file is read as ceil(file_size / split_size) byte
+    // ranges that can be loaded in parallel.
+    uint64_t file_size = 0;
+    uint64_t split_size = 0;
+    // The columns read from the file, in file order; set by the binder.
+    TableSchema schema;
+
+    CopyInfo() = default;
+    explicit CopyInfo(std::pmr::memory_resource* arena)
+        : columns(arena), schema(arena) {}
+
+    size_t split_count() const {
+        if (this->split_size == 0 || this->file_size == 0) {
+            return 1;
+        }
+        return (this->file_size - 1) / this->split_size + 1;
+    }
+
+    friend std::ostream &operator<<(std::ostream &ost, const CopyInfo &info) {
+        ost << "CopyInfo{table_name: " << info.table_name << ", columns: [";
+        for (size_t i = 0; i < info.columns.size(); ++i) {
+            ost << info.columns[i] << (i < info.columns.size() - 1 ? ", " : "");
+        }
+        return ost << "], path: " << info.path << ", splits: "
+                   << info.split_count() << "}";
+    }
+};
+
 struct ColumnDef {
-    std::string name;
-    std::string type;
+    std::string_view name;
+    std::string_view type;
 
     friend std::ostream &operator<<(std::ostream &ost, const ColumnDef &info) {
         return ost << "ColumnDef{name: " << info.name << ", type: " << info.type
@@ -39,8 +167,8 @@ struct ColumnDef {
 };
 
 struct CreateTableInfo {
-    std::string table_name;
-    std::vector<ColumnDef> columns;
+    std::string_view table_name;
+    std::pmr::vector<ColumnDef> columns;
 
     friend std::ostream &operator<<(std::ostream &ost,
                                     const CreateTableInfo &info) {
@@ -54,7 +182,7 @@ struct CreateTableInfo {
 };
 
 struct DropTableInfo {
-    std::string table_name;
+    std::string_view table_name;
 
     friend std::ostream &operator<<(std::ostream &ost,
                                     const DropTableInfo &info) {
@@ -63,33 +191,41 @@ struct DropTableInfo {
 };
 
 struct DeleteInfo {
-    std::string table_name;
-    std::optional<std::string> where_clause;
+    std::string_view table_name;
+    pink_perilla::Symbol table_symbol = pink_perilla::kNoSymbol;
+    ExprId where_clause = kNoExpr;
+    ExpressionTree expressions;
+    TableSchema schema;
 
     friend std::ostream &operator<<(std::ostream &ost, const DeleteInfo &info) {
         ost << "DeleteInfo{table_name: " << info.table_name;
-        if (info.where_clause) {
-            ost << ", where_clause: " << *info.where_clause;
+        if (info.where_clause != kNoExpr) {
+            ost << ", where_clause: "
+                << ExprSource{info.expressions, info.where_clause};
         }
         return ost << "}";
     }
 };
 
 struct SetClause {
-    std::string column_name;
-    std::string
-    value; // For simplicity, we'll treat values as raw strings for now
+    std::string_view column_name;
+    ExprId value = kNoExpr;
+    // Index of column_name in the table schema; set by the binder.
+    int32_t column_index = -1;
 
     friend std::ostream &operator<<(std::ostream &ost, const SetClause &info) {
         return ost << "SetClause{column_name: " << info.column_name
-               << ", value: " << info.value << "}";
+               << ", value: expr#" << info.value << "}";
     }
 };
 
 struct UpdateInfo {
-    std::string table_name;
-    std::vector<SetClause> set_clauses;
-    std::optional<std::string> where_clause;
+    std::string_view table_name;
+    pink_perilla::Symbol table_symbol = pink_perilla::kNoSymbol;
+    std::pmr::vector<SetClause> set_clauses;
+    ExprId where_clause = kNoExpr;
+    ExpressionTree expressions;
+    TableSchema schema;
 
     friend std::ostream &operator<<(std::ostream &ost, const UpdateInfo &info) {
         ost << "UpdateInfo{table_name: " << info.table_name
@@ -99,8 +235,9 @@ struct UpdateInfo {
                     << (i < info.set_clauses.size() - 1 ? ", " : "");
         }
         ost << "]";
-        if (info.where_clause) {
-            ost << ", where_clause: " << *info.where_clause;
+        if (info.where_clause != kNoExpr) {
+            ost << ", where_clause: "
+                << ExprSource{info.expressions, info.where_clause};
         }
         return ost << "}";
     }
@@ -140,49 +277,42 @@ inline std::ostream& operator<<(std::ostream& ost, const SortDirection &directio
 }
 
 struct SortInfo {
-    std::string column;
+    ExprId expr = kNoExpr;
     SortDirection direction;
 
     friend std::ostream &operator<<(std::ostream &ost, const SortInfo &info) {
-        return ost << "SortInfo{column: " << info.column
+        return ost << "SortInfo{expr#" << info.expr
                << ", direction: " << info.direction << "}";
     }
 };
 
 struct WindowFunctionInfo {
-    std::string function_name;
-    std::vector<std::string> partition_by;
+    std::string_view function_name;
+    std::pmr::vector<ExprId> partition_by;
 
     friend std::ostream &operator<<(std::ostream &ost,
                                     const WindowFunctionInfo &info) {
         ost << "WindowFunctionInfo{function_name: " << info.function_name
                 << ", partition_by: [";
         for (size_t i = 0; i < info.partition_by.size(); ++i) {
-            ost << info.partition_by[i]
+            ost << "expr#" << info.partition_by[i]
                     << (i < info.partition_by.size() - 1 ? ", " : "");
         }
         return ost << "]}";
     }
 };
 
+// COLUMN covers every scalar item, not just bare columns. AGGREGATE_FUNCTION
+// is an item that is itself an aggregate call, e.g. COUNT(x).
 enum class SelectItemType { COLUMN, AGGREGATE_FUNCTION, WINDOW_FUNCTION };
 
-struct AggregateFunctionInfo {
-    std::string function_name;
-    std::string column;
-
-    friend std::ostream &operator<<(std::ostream &ost,
-                                    const AggregateFunctionInfo &info) {
-        return ost << "AggregateFunctionInfo{function_name: "
-               << info.function_name << ", column: " << info.column << "}";
-    }
-};
-
 struct SelectItem {
     SelectItemType type;
-    std::string expression; // e.g., "col1", "row_number() OVER (...)"
-    std::optional<AggregateFunctionInfo> agg_info;
+    std::string_view expression; // e.g., "col1", "row_number() OVER (...)"
+    // For a window item, the function call under OVER.
+    ExprId expr = kNoExpr;
     std::optional<WindowFunctionInfo> win_info;
+    std::string_view alias;  // Empty unless an alias was given.
 
     friend std::ostream &operator<<(std::ostream &ost, const SelectItem &info) {
         ost << "SelectItem{type: ";
@@ -198,8 +328,8 @@ struct SelectItem {
                 break;
         }
         ost << ", expression: " << info.expression;
-        if (info.agg_info) {
-            ost << ", agg_info: " << *info.agg_info;
+        if (!info.alias.empty()) {
+            ost << ", alias: " << info.alias;
         }
         if (info.win_info) {
             ost << ", win_info: " << *info.win_info;
@@ -212,28 +342,48 @@ enum class JoinType { INNER, LEFT };
 
 struct JoinInfo {
     JoinType type;
-    std::string table;
-    std::string on_condition;
+    TableRef table;
+    ExprId on_condition = kNoExpr;
 
     friend std::ostream &operator<<(std::ostream &ost, const JoinInfo &info) {
         return ost << "JoinInfo{type: "
                << (info.type == JoinType::INNER ? "INNER" : "LEFT")
                << ", table: " << info.table
-               << ", on_condition: " << info.on_condition << "}";
+               << ", on_condition: expr#" << info.on_condition << "}";
     }
 };
 
 struct SelectInfo {
-    std::vector<SelectItem> select_items;
-    std::optional<std::string> from_table;
+    std::pmr::vector<SelectItem> select_items;
+    std::optional<TableRef> from_table;
     std::optional<std::unique_ptr<SelectInfo> > from_subquery;
-    std::vector<std::string> cross_join_tables;
-    std::optional<std::string> where_condition;
-    std::vector<JoinInfo> joins;
-    std::vector<std::string> group_by_columns;
-    std::vector<SortInfo> order_by_columns;
+    std::pmr::vector<TableRef> cross_join_tables;
+    ExprId where_condition = kNoExpr;
+    std::pmr::vector<JoinInfo> joins;
+    std::pmr::vector<ExprId> group_by;
+    std::pmr::vector<SortInfo> order_by_columns;
     int64_t limit = -1;
-    // We will add more fields like window functions, etc. later
+    ExpressionTree expressions;
+
+    // Filled in by the binder.
+    // Aggregate calls found in the select list and ORDER BY, in the order
+    // they become AggregateRel measures.
+    std::pmr::vector<ExprId> measures;
+    // Number of fields in the relation the projection reads from.
+    uint32_t project_input_width = 0;
+    // Number of fields FROM and its joins produce, kept so that enclosing
+    // queries need not recount a chain of nested SELECT * subqueries.
+    uint32_t from_width = 0;
+
+    SelectInfo() = default;
+    explicit SelectInfo(std::pmr::memory_resource* arena)
+        : select_items(arena),
+          cross_join_tables(arena),
+          joins(arena),
+          group_by(arena),
+          order_by_columns(arena),
+          expressions(arena),
+          measures(arena) {}
 
     friend std::ostream &operator<<(std::ostream &ost, const SelectInfo &info) {
         ost << "SelectInfo{select_items: [";
@@ -260,13 +410,14 @@ struct SelectInfo {
             }
         }
         ost << "]";
-        if (info.where_condition) {
-            ost << ", where: [" << *info.where_condition;
+        if (info.where_condition != kNoExpr) {
+            ost << ", where: ["
+                << ExprSource{info.expressions, info.where_condition};
         }
-        ost << "], group_by_columns: [";
-        for (size_t i = 0; i < info.group_by_columns.size(); ++i) {
-            ost << info.group_by_columns[i]
-                    << (i < info.group_by_columns.size() - 1 ? ", " : "");
+        ost << "], group_by: [";
+        for (size_t i = 0; i < info.group_by.size(); ++i) {
+            ost << ExprSource{info.expressions, info.group_by[i]}
+                    << (i < info.group_by.size() - 1 ? ", " : "");
         }
         ost << "], order_by_columns: [";
         for (size_t i = 0; i < info.order_by_columns.size(); ++i) {
@@ -284,24 +435,66 @@ typedef std::variant<
     InsertInfo,
     DeleteInfo,
     CreateTableInfo,
-    DropTableInfo
+    DropTableInfo,
+    CopyInfo
     > Statement;
 
 class SqlParser {
 public:
+    // How deep expressions and subqueries may nest, counting each operand,
+    // argument, parenthesis and subquery as a level, and each operator of a
+    // chain like a + b + c as one more. The parser, binder and converter all
+    // recurse over this nesting, at up to ~2 KB of stack per level in an
+    // unoptimized build, so this fits a 512 KB thread stack. Deeper
+    // statements fail with ResourceExhausted instead of crashing.
+    static constexpr size_t kMaxNestingDepth = 256;
+
+    // Parses with every allocation drawn from `arena`, typically a
+    // pink_perilla::StatementArena. Text the parser synthesizes is never
+    // deallocated individually, so `arena` must free everything when it goes
+    // away, as a monotonic resource does. `sql`, `arena` and the table
+    // definitions, whose column names the IR borrows, must outlive the result.
+    static absl::StatusOr<Statement> Parse(
+    std::string_view sql,
+    const std::vector<pink_perilla::TableDefinition>& table_definitions,
+    std::pmr::memory_resource* arena);
+    // Same as above, reading table definitions from a shared `catalog`
+    // instead of indexing them for this one statement. If `stats` is given,
+    // its tokenize_ns and tokens are filled in.
+    static absl::StatusOr<Statement> Parse(
+    std::string_view sql,
+    const pink_perilla::Catalog& catalog,
+    std::pmr::memory_resource* arena,
+    pink_perilla::PlanningStats* stats = nullptr);
+    // Same as above, starting from `tokens`, the tokens of `sql` ending in
+    // kEnd (as made by lexer::TokenizeStatically), instead of lexing it.
     static absl::StatusOr<Statement> Parse(
     std::string_view sql,
-    const std::vector<pink_perilla::TableDefinition>& table_definitions);
+    absl::Span<const pink_perilla::lexer::Token> tokens,
+    const pink_perilla::Catalog& catalog,
+    std::pmr::memory_resource* arena);
 
 private:
     SqlParser(std::string_view sql,
-              const std::vector<pink_perilla::TableDefinition>& table_definitions);
+              const pink_perilla::Catalog& catalog,
+              std::pmr::memory_resource* arena,
+              pink_perilla::PlanningStats* stats);
     absl::StatusOr<Statement> Parse();
-    void ConsumeWhitespace();
-    bool ConsumeKeyword(const std::string& keyword);
-    absl::StatusOr<std::string> ParseIdentifier();
-    bool ConsumeChar(char c);
-    absl::StatusOr<std::string> ParseType();
+    // Parses and binds the statement in tokens_.
+    absl::StatusOr<Statement> ParseTokens();
+    absl::StatusOr<Statement> ParseStatement();
+    const pink_perilla::lexer::Token& Peek(size_t ahead = 0) const;
+    bool AtEnd() const;
+    bool ConsumeKeyword(pink_perilla::lexer::Keyword keyword);
+    bool ConsumeToken(pink_perilla::lexer::TokenType type);
+    // Consumes an identifier. Failing is cheap, so the grammar may probe
+    // with it; a caller that needs one reports ExpectedIdentifier().
+    std::optional<std::string_view> ParseIdentifier();
+    absl::Status ExpectedIdentifier() const;
+    // An identifier naming a table that must exist, unless the catalog is
+    // empty.
+    absl::StatusOr<TableName> ParseTableName();
+    absl::StatusOr<std::string_view> ParseType();
     absl::StatusOr<ColumnDef> ParseColumnDef();
 
     absl::StatusOr<CreateTableInfo> ParseCreateTable();
@@ -309,20 +502,51 @@ private:
     absl::StatusOr<DeleteInfo> ParseDeleteStatement();
     absl::StatusOr<UpdateInfo> ParseUpdateStatement();
     absl::StatusOr<InsertInfo> ParseInsertStatement();
+    absl::StatusOr<CopyInfo> ParseCopyStatement();
+    // The WITH (...) list of a COPY, applied to *info.
+    absl::Status ParseCopyOptions(CopyInfo* info);
+    // A string literal's value, unescaped.
+    absl::StatusOr<std::string_view> ParseString();
+    // An unsigned integer literal.
+    absl::StatusOr<uint64_t> ParseCount();
     absl::StatusOr<SelectInfo> ParseSelectStatement();
     absl::StatusOr<SelectItem> ParseSelectItem();
-    absl::StatusOr<std::string> ParseExpression();
-    absl::StatusOr<std::vector<SelectItem>> ParseSelectItems();
-    absl::StatusOr<std::string> ParseFromClause();
-    absl::StatusOr<std::vector<JoinInfo>> ParseJoinClauses();
-    absl::StatusOr<std::vector<std::string>> ParseGroupByClause();
-    absl::StatusOr<std::vector<SortInfo>> ParseOrderByClause();
-    absl::StatusOr<int64_t> ParseLimitClause();
-    absl::StatusOr<std::vector<SetClause>> ParseSetClauses();
-    absl::StatusOr<std::string> ParseWhereClause();
-    absl::StatusOr<std::vector<ColumnDef>> ParseColumnDefinitions();
-    absl::StatusOr<std::string> ParseSetValue();
+    // Parses a scalar expression into *expressions_ by precedence climbing,
+    // consuming only operators that bind at least as tightly as
+    // `min_precedence`. Stops at the first token that cannot continue it.
+    absl::StatusOr<ExprId> ParseExpression(int min_precedence = 0);
+    absl::StatusOr<ExprId> ParseUnary();
+    absl::StatusOr<ExprId> ParsePrimary();
+    absl::StatusOr<ExprId> ParseFunctionCall(std::string_view name, size_t begin);
+    // DATE '...' or TIMESTAMP '...'; the string must be a valid value.
+    absl::StatusOr<ExprId> ParseTypedLiteral();
+    absl::StatusOr<ExprId> ParseCase();
+    absl::StatusOr<ExprId> ParseCast();
+    // Appends a node spanning tokens [begin, pos_) whose operands are `args`.
+    ExprId AddExpr(ExprNode node, size_t begin, const std::pmr::vector<ExprId>& args);
+    TableRef MakeTableRef(const TableName& table) const;
+    // Returns the source text covered by tokens [begin, end).
+    std::string_view TextBetween(size_t begin, size_t end) const;
+    // ResourceExhausted once depth_ passes kMaxNestingDepth.
+    absl::Status CheckDepth() const;
+    // ResourceExhausted once the IR holds more than max_ir_nodes_ nodes.
+    absl::Status CheckIrNodes() const;
 
     std::string_view sql_view_;
-    absl::flat_hash_map<std::string, pink_perilla::TableDefinition> table_definitions_;
+    std::pmr::memory_resource* arena_;
+    std::pmr::vector<pink_perilla::lexer::Token> tokens_;
+    size_t pos_ = 0;
+    // Tree of the statement (or subquery) currently being parsed.
+    ExpressionTree* expressions_ = nullptr;
+    // Nesting of the construct being parsed; see kMaxNestingDepth.
+    size_t depth_ = 0;
+    // Expression nodes added so far, across every tree of the statement, and
+    // the most ParseOptions::max_ir_nodes allows (SIZE_MAX if unlimited).
+    size_t ir_nodes_ = 0;
+    size_t max_ir_nodes_;
+    // Placeholders seen so far. A statement uses either ? or $n, never both.
+    uint32_t positional_parameters_ = 0;
+    bool numbered_parameters_ = false;
+    const pink_perilla::Catalog* catalog_;
+    pink_perilla::PlanningStats* stats_;
 };
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+#include "absl/status/statusor.h"
+
+namespace pink_perilla::lexer {
+
+// Character-classification kernels. kAvx2 and kSse2 are only available on
+// x86; requesting an unsupported kernel falls back to kScalar.
+enum class ScanKernel { kScalar, kSse2, kAvx2 };
+
+// The fastest kernel supported by the running CPU, detected once.
+ScanKernel DetectScanKernel();
+
+// Bitmaps over a SQL buffer, one bit per byte, built in a single sweep.
+//
+// Each 64-byte block is classified with SIMD compares (whitespace, quotes,
+// comment delimiters, identifier characters). Only the few candidate bytes
+// that can open or close a quote or comment are then visited by a scalar
+// state machine, so the cost is one vector pass plus O(quotes + comments).
+// The lexer uses the result to jump over whitespace, comments, quoted
+// literals and identifier runs with count-trailing-zeros instead of walking
+// them byte by byte.
+class StructuralIndex {
+public:
+    // Fails with InvalidArgument if a quoted literal is never closed. An
+    // unclosed block comment extends to the end of the input.
+    static absl::StatusOr<StructuralIndex> Build(std::string_view sql);
+    static absl::StatusOr<StructuralIndex> Build(
+        std::string_view sql,
+        ScanKernel kernel,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    // First position >= pos that is neither whitespace nor inside a comment,
+    // or size() if there is none.
+    size_t NextSignificant(size_t pos) const;
+    // First position >= pos that is not an identifier character
+    // ([A-Za-z0-9_]).
+    size_t WordEnd(size_t pos) const;
+    // For a quote character at pos, the position just past the closing quote.
+    // Doubled quotes inside the literal are escapes, not terminators.
+    size_t QuoteEnd(size_t pos) const;
+
+    size_t size() const {
+        return size_;
+    }
+
+private:
+    explicit StructuralIndex(std::pmr::memory_resource* resource)
+        : skip_(resource), word_(resource), quote_close_(resource) {}
+
+    size_t size_ = 0;
+    // Whitespace outside quotes, plus every byte of every comment.
+    std::pmr::vector<uint64_t> skip_;
+    // Identifier characters.
+    std::pmr::vector<uint64_t> word_;
+    // The closing quote of every quoted literal.
+    std::pmr::vector<uint64_t> quote_close_;
+};
+
+}  // namespace pink_perilla::lexer
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "google/protobuf/arena.h"
 #include "sql_parser.hpp"
 #include "substrait/plan.pb.h"
 
@@ -23,5 +24,25 @@ substrait::Plan ToSubstrait(const UpdateInfo& info);
 // Converts the intermediate representation (InsertInfo) into a Substrait Plan.
 substrait::Plan ToSubstrait(const InsertInfo& info);
 
+// Converts the intermediate representation (CopyInfo) into a Substrait Plan.
+substrait::Plan ToSubstrait(const CopyInfo& info);
+
+// Arena variants of the above. The plan and every message nested in it are
+// allocated on `arena`, which owns them: do not delete the returned pointer,
+// and do not use it after the arena is reset or destroyed. Passing nullptr
+// allocates on the heap and hands ownership to the caller.
+substrait::Plan* ToSubstrait(const SelectInfo& info, google::protobuf::Arena* arena);
+substrait::Plan* ToSubstrait(const CreateTableInfo& info, google::protobuf::Arena* arena);
+substrait::Plan* ToSubstrait(const DropTableInfo& info, google::protobuf::Arena* arena);
+substrait::Plan* ToSubstrait(const DeleteInfo& info, google::protobuf::Arena* arena);
+substrait::Plan* ToSubstrait(const UpdateInfo& info, google::protobuf::Arena* arena);
+substrait::Plan* ToSubstrait(const InsertInfo& info, google::protobuf::Arena* arena);
+substrait::Plan* ToSubstrait(const CopyInfo& info, google::protobuf::Arena* arena);
+
+// The plan writing only rows [first_row, first_row + row_count) of a
+// multi-row INSERT, built on `arena` as above. Converting a long VALUES list
+// one chunk at a time keeps just one chunk's plan in memory.
+substrait::Plan* ToSubstrait(const InsertInfo& info, size_t first_row,
+                             size_t row_count, google::protobuf::Arena* arena);
 
 }  // namespace pink_perilla::converter
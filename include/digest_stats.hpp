@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "catalog.hpp"
+#include "substrait/plan.pb.h"
+#include "table_definition.hpp"
+
+namespace pink_perilla {
+
+struct LatencySummary {
+    uint64_t total_ns = 0;
+    uint64_t min_ns = 0;
+    uint64_t max_ns = 0;
+    // Upper bound of the histogram bucket holding the 99th percentile; within
+    // 25% of the true value.
+    uint64_t p99_ns = 0;
+};
+
+// Everything recorded for one query shape.
+struct DigestSnapshot {
+    uint64_t fingerprint = 0;
+    // The statement's tokens separated by single spaces, with each numeric or
+    // string literal shown as `?`.
+    std::string normalized_sql;
+    uint64_t calls = 0;
+    // Calls that failed to parse; they count toward `parse` but not
+    // `convert` or the plan sizes.
+    uint64_t errors = 0;
+    LatencySummary parse;
+    LatencySummary convert;
+    uint64_t plan_bytes_total = 0;
+    uint64_t plan_bytes_min = 0;
+    uint64_t plan_bytes_max = 0;
+};
+
+// Opt-in per-shape planning statistics, in the spirit of pg_stat_statements.
+// Statements are grouped by a fingerprint of their token stream with literals
+// stripped, so `WHERE id = 1` and `where id = 2` are one shape. Each thread
+// accumulates into its own digests without locks or read-modify-write
+// contention; Snapshot() merges them.
+class DigestStats {
+public:
+    DigestStats();
+    ~DigestStats();
+    DigestStats(const DigestStats&) = delete;
+    DigestStats& operator=(const DigestStats&) = delete;
+
+    // Same contract as pink_perilla::Parse(), timing the parse and the
+    // conversion to Substrait separately.
+    absl::StatusOr<substrait::Plan> Parse(
+        std::string_view sql,
+        const std::vector<TableDefinition>& table_definitions = {});
+    absl::StatusOr<substrait::Plan> Parse(std::string_view sql,
+                                          const Catalog& catalog);
+
+    // Every shape seen so far, most total planning time first.
+    std::vector<DigestSnapshot> Snapshot() const;
+
+    // The `n` shapes with the most total planning time.
+    std::vector<DigestSnapshot> Top(size_t n) const;
+
+private:
+    struct Digest;
+    struct ThreadDigests;
+
+    ThreadDigests& ForThisThread();
+
+    // Distinguishes instances in thread-local lookups, since an address can
+    // be reused once an instance is destroyed.
+    const uint64_t id_;
+    std::atomic<ThreadDigests*> threads_{nullptr};
+};
+
+}  // namespace pink_perilla
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <functional>
+
+namespace pink_perilla {
+
+// Somewhere to run planning off the calling thread. ThreadPool is one; an
+// application with its own workers can implement this to plan on them.
+class Executor {
+public:
+    virtual ~Executor() = default;
+
+    // Runs `task` exactly once, on some thread, at some later point.
+    virtual void Schedule(std::function<void()> task) = 0;
+};
+
+}  // namespace pink_perilla
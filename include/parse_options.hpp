@@ -0,0 +1,53 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace pink_perilla {
+
+// Per-call knobs for pink_perilla::Parse().
+struct ParseOptions {
+    // Fill in a PlanningStats. Off by default; when off, planning does no
+    // timing or counting at all.
+    bool collect_stats = false;
+    // For ParseChunked(): the most VALUES rows one INSERT plan may write.
+    // Zero puts every row in one plan.
+    size_t insert_chunk_rows = 0;
+    // Planning still running at this time stops at its next checkpoint with
+    // kDeadlineExceeded. The lexer, parser and converter each check it as
+    // they go, so a huge statement gives up within microseconds of the
+    // deadline rather than running to completion. The default never passes.
+    std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::time_point::max();
+    // Planning stops with kResourceExhausted once the statement's IR holds
+    // more expression nodes than this. Zero means no limit.
+    size_t max_ir_nodes = 0;
+    // Planning stops with kResourceExhausted once the plan would serialize
+    // to more bytes than this; for ParseChunked(), once any one chunk would.
+    // Zero means no limit.
+    size_t max_plan_bytes = 0;
+};
+
+// Where the time and memory of planning one statement went. Filled in even
+// when planning fails, up to the phase that failed.
+struct PlanningStats {
+    uint64_t tokenize_ns = 0;
+    // Building and binding the IR from the tokens.
+    uint64_t parse_ns = 0;
+    // Turning the IR into a substrait::Plan.
+    uint64_t convert_ns = 0;
+    // Heap allocations on the planning thread, from tokenizing through
+    // conversion. Only counted in programs built with
+    // src/allocation_hooks.cpp, as the pink_perilla CLI is; zero otherwise.
+    uint64_t heap_allocations = 0;
+    uint64_t heap_bytes = 0;
+    // Tokens in the statement, not counting the end marker.
+    uint64_t tokens = 0;
+    // Expression nodes in the IR, subqueries included.
+    uint64_t ir_nodes = 0;
+    // Serialized size of the plan.
+    uint64_t plan_bytes = 0;
+};
+
+}  // namespace pink_perilla
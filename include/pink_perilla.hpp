@@ -1,14 +1,117 @@
 #pragma once
 
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
 #include <string_view>
 #include <vector>
 
+#include "absl/functional/function_ref.h"
+#include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "absl/types/span.h"
+#include "catalog.hpp"
+#include "compiled_sql.hpp"
+#include "executor.hpp"
+#include "google/protobuf/arena.h"
+#include "parse_options.hpp"
+#include "prepared_plan.hpp"
 #include "substrait/plan.pb.h"
 #include "table_definition.hpp"
+#include "thread_pool.hpp"
 
 namespace pink_perilla {
 absl::StatusOr<substrait::Plan> Parse(
     std::string_view sql,
     const std::vector<TableDefinition>& table_definitions = {});
+
+// Same as above, but the plan is built on `arena` and owned by it. Reusing one
+// arena across requests and calling arena->Reset() between them turns plan
+// construction and teardown into bump allocations.
+absl::StatusOr<substrait::Plan*> Parse(
+    std::string_view sql,
+    const std::vector<TableDefinition>& table_definitions,
+    google::protobuf::Arena* arena);
+
+// Plans `sql` against `catalog`, which is only read, so one instance (say a
+// CatalogHandle snapshot) can serve any number of concurrent calls. The
+// overloads taking a vector index the definitions again on every call.
+absl::StatusOr<substrait::Plan> Parse(std::string_view sql,
+                                      const Catalog& catalog);
+
+// Same as above, with the plan built on and owned by `arena`.
+absl::StatusOr<substrait::Plan*> Parse(std::string_view sql,
+                                       const Catalog& catalog,
+                                       google::protobuf::Arena* arena);
+
+// Same as above. With options.collect_stats set, also fills in `stats`, which
+// must then be non-null, whether or not planning succeeds.
+absl::StatusOr<substrait::Plan> Parse(std::string_view sql,
+                                      const Catalog& catalog,
+                                      const ParseOptions& options,
+                                      PlanningStats* stats);
+
+// Plans `sql` against `catalog` and hands each resulting plan to `sink`. An
+// INSERT ... VALUES with more than options.insert_chunk_rows rows (if
+// nonzero) yields a sequence of plans, each writing the next run of at most
+// that many rows; every other statement yields one plan. A plan is only valid
+// during its call to `sink`, and the next one reuses its memory, so memory
+// for plans stays bounded by the chunk size however long the statement is.
+// Returns the first error from planning or from `sink`.
+absl::Status ParseChunked(
+    std::string_view sql, const Catalog& catalog, const ParseOptions& options,
+    absl::FunctionRef<absl::Status(const substrait::Plan&)> sink);
+
+// Cancels the planning ParseAsync() started. Copies share that planning.
+class ParseHandle {
+public:
+    explicit ParseHandle(std::shared_ptr<std::atomic<bool>> cancelled)
+        : cancelled_(std::move(cancelled)) {}
+
+    // Asks planning to stop at its next checkpoint, or not to start. Its
+    // callback then receives kCancelled, unless planning was already done.
+    void Cancel() { this->cancelled_->store(true, std::memory_order_relaxed); }
+
+private:
+    std::shared_ptr<std::atomic<bool>> cancelled_;
+};
+
+// Plans `sql` against `catalog` on `executor` and hands the outcome to
+// `callback` there, exactly once: the plan, the error planning failed with,
+// or kCancelled. Returns as soon as the work is scheduled, so an event loop
+// can pass on statements of any size without stalling its other requests.
+ParseHandle ParseAsync(
+    std::string sql, std::shared_ptr<const Catalog> catalog, Executor& executor,
+    std::function<void(absl::StatusOr<substrait::Plan>)> callback);
+
+// Plans every statement in `statements` on `pool`, each against the shared,
+// read-only `catalog`. Plans come back in input order, one result per
+// statement. Must not be called from a task running on `pool`.
+std::vector<absl::StatusOr<substrait::Plan>> ParseBatch(
+    absl::Span<const std::string_view> statements, const Catalog& catalog,
+    ThreadPool& pool);
+
+// Parses `sql`, which may hold `?` or `$1`-style placeholders (not both), into
+// a plan that can be bound to values many times without parsing again.
+absl::StatusOr<PreparedPlan> Prepare(
+    std::string_view sql,
+    const std::vector<TableDefinition>& table_definitions = {});
+absl::StatusOr<PreparedPlan> Prepare(std::string_view sql,
+                                     const Catalog& catalog);
+
+// Plans a statement written with PP_SQL. It was tokenized and checked when
+// the program was built, so planning starts from its tokens.
+absl::StatusOr<substrait::Plan> Parse(
+    const CompiledSql& sql,
+    const std::vector<TableDefinition>& table_definitions = {});
+absl::StatusOr<substrait::Plan> Parse(const CompiledSql& sql,
+                                      const Catalog& catalog);
+
+// Prepare() for a statement written with PP_SQL.
+absl::StatusOr<PreparedPlan> Prepare(
+    const CompiledSql& sql,
+    const std::vector<TableDefinition>& table_definitions = {});
+absl::StatusOr<PreparedPlan> Prepare(const CompiledSql& sql,
+                                     const Catalog& catalog);
 }
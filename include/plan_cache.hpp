@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "catalog.hpp"
+#include "substrait/plan.pb.h"
+#include "table_definition.hpp"
+
+namespace pink_perilla {
+
+struct PlanCacheOptions {
+    // Upper bound on the bytes held by cached plans and their keys, split
+    // evenly across shards.
+    size_t max_bytes = 64 << 20;
+    // Number of independently locked LRU lists. Statements hash to a shard, so
+    // concurrent callers only contend when they hit the same one.
+    size_t shards = 16;
+};
+
+struct PlanCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    size_t entries = 0;
+    size_t bytes = 0;
+};
+
+// A plan cache in front of Parse() for ad-hoc SQL. Statements that differ only
+// in their numeric and string literals share an entry: the key is the SQL with
+// each literal replaced by a marker for its type, and a hit copies the cached
+// plan with the new literal values written in. Literals whose value shapes the
+// plan (an ORDER BY ordinal, a LIMIT, a VARCHAR length, ...) must match
+// exactly. The table definitions are part of the key, so a schema change never
+// serves a plan bound against the old one. Safe to use from many threads.
+class PlanCache {
+public:
+    explicit PlanCache(PlanCacheOptions options = {});
+    ~PlanCache();
+    PlanCache(const PlanCache&) = delete;
+    PlanCache& operator=(const PlanCache&) = delete;
+
+    // Same contract as pink_perilla::Parse().
+    absl::StatusOr<substrait::Plan> Parse(
+        std::string_view sql,
+        const std::vector<TableDefinition>& table_definitions = {});
+    // Same, keyed on the catalog's precomputed fingerprint instead of hashing
+    // the definitions on every call.
+    absl::StatusOr<substrait::Plan> Parse(std::string_view sql,
+                                          const Catalog& catalog);
+
+    PlanCacheStats stats() const;
+
+    // Drops every entry. Counters keep running.
+    void Clear();
+
+private:
+    struct Entry;
+    struct Shard;
+
+    Shard& ShardFor(std::string_view key);
+    void Insert(std::shared_ptr<const Entry> entry);
+
+    PlanCacheOptions options_;
+    std::unique_ptr<Shard[]> shards_;
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+    std::atomic<uint64_t> evictions_{0};
+};
+
+}  // namespace pink_perilla
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "catalog.hpp"
+#include "substrait/plan.pb.h"
+
+// A planner that stays up between statements, so protobuf initialization,
+// the catalog and the worker threads are paid for once rather than per call.
+//
+// Wire format, both directions: frames of a 4-byte little-endian length
+// followed by that many bytes. A request frame holds one SQL statement. A
+// response frame starts with one byte, an absl::StatusCode; the rest is the
+// serialized substrait::Plan when that is kOk and the error message
+// otherwise. A client may send any number of requests without waiting;
+// answers come back on the same connection in request order.
+//
+// Linux only: the server is built on epoll.
+namespace pink_perilla {
+
+struct PlanServerOptions {
+    // Planning threads; I/O runs on the thread that calls Run().
+    size_t threads = std::thread::hardware_concurrency();
+    // Longer requests are answered with kResourceExhausted and the
+    // connection is closed.
+    size_t max_request_bytes = size_t{64} << 20;
+    // Requests of one connection being planned or waiting to be written.
+    // Beyond this the server stops reading from the connection until answers
+    // drain, so a client that never reads cannot grow the server's memory.
+    size_t max_pending_per_connection = 1024;
+    // How long a request may take from arriving to being planned. One still
+    // queued or being planned after that is answered with kDeadlineExceeded,
+    // so a burst of huge statements cannot hold up the requests behind it
+    // for long. Zero means no limit.
+    std::chrono::milliseconds request_timeout{0};
+    // Plans that would serialize to more bytes than this are answered with
+    // kResourceExhausted instead. Zero means no limit.
+    size_t max_plan_bytes = 0;
+};
+
+class PlanServer {
+public:
+    // Listens on a Unix domain socket at `socket_path`, replacing a stale
+    // socket file left there. Requests are planned against whatever snapshot
+    // `catalog` holds when they arrive; it must outlive the server.
+    static absl::StatusOr<std::unique_ptr<PlanServer>> Listen(
+        const std::string& socket_path, const CatalogHandle& catalog,
+        const PlanServerOptions& options = {});
+    // Closes every connection and removes the socket file.
+    ~PlanServer();
+    PlanServer(const PlanServer&) = delete;
+    PlanServer& operator=(const PlanServer&) = delete;
+
+    // Serves connections until Shutdown(). Returns an error only if waiting
+    // for events fails.
+    absl::Status Run();
+
+    // Makes Run() return. Safe to call from any thread, and from a signal
+    // handler.
+    void Shutdown();
+
+private:
+    class Impl;
+
+    explicit PlanServer(std::unique_ptr<Impl> impl);
+
+    std::unique_ptr<Impl> impl_;
+};
+
+// A blocking connection to a PlanServer.
+class PlanClient {
+public:
+    static absl::StatusOr<PlanClient> Connect(const std::string& socket_path);
+    PlanClient(PlanClient&& other) noexcept;
+    PlanClient& operator=(PlanClient&& other) noexcept;
+    ~PlanClient();
+
+    // Sends one statement. Pipelining is fine: answers are read later, in
+    // the order their requests were sent.
+    absl::Status Send(std::string_view sql);
+
+    // Reads the answer to the oldest request not yet answered. On success
+    // *plan holds the serialized plan; a failed plan comes back as its error.
+    absl::Status Receive(std::string* plan);
+    // Same, parsing the plan.
+    absl::StatusOr<substrait::Plan> Receive();
+
+private:
+    explicit PlanClient(int fd) : fd_(fd) {}
+
+    int fd_ = -1;
+    std::string frame_;
+};
+
+}  // namespace pink_perilla
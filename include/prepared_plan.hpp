@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "absl/functional/function_ref.h"
+#include "absl/status/statusor.h"
+#include "google/protobuf/arena.h"
+#include "google/protobuf/descriptor.h"
+#include "substrait/plan.pb.h"
+
+namespace pink_perilla {
+
+// A value for one placeholder. std::monostate binds SQL NULL.
+using ParameterValue =
+    std::variant<std::monostate, bool, int64_t, double, std::string>;
+
+// Every value of one placeholder across a batch, so a batch of N rows for a
+// statement with K placeholders is K columns of N values.
+using ParameterColumn = std::vector<ParameterValue>;
+
+// A plan parsed once from SQL with `?` or `$n` placeholders. Each placeholder
+// is a Substrait dynamic_parameter in the template plan; binding copies the
+// template and replaces those expressions with literals, so no SQL is parsed
+// or bound again.
+class PreparedPlan {
+public:
+    // Finds the dynamic_parameter expressions in `plan`. Fails if they span
+    // more than one relation, which Parse() never produces.
+    static absl::StatusOr<PreparedPlan> FromPlan(substrait::Plan plan);
+
+    // Number of values Bind() expects: one per `?`, or the highest `$n`.
+    size_t parameter_count() const { return this->parameter_count_; }
+
+    // Whether some placeholder in the plan refers to `parameter`.
+    bool uses_parameter(uint32_t parameter) const;
+
+    // The plan with every placeholder still a dynamic_parameter.
+    const substrait::Plan& plan_template() const { return this->template_; }
+
+    // Returns the plan with placeholder i replaced by `parameters[i]`. Integer
+    // values narrow to i32 where the placeholder is typed i32 and still fit;
+    // integers and decimal strings such as "-1.50" bind to DECIMAL
+    // placeholders exactly. Values that do not match the placeholder type are
+    // InvalidArgument.
+    absl::StatusOr<substrait::Plan> Bind(
+        const std::vector<ParameterValue>& parameters) const;
+
+    // Same as above, but the plan is built on and owned by `arena`.
+    absl::StatusOr<substrait::Plan*> Bind(
+        const std::vector<ParameterValue>& parameters,
+        google::protobuf::Arena* arena) const;
+
+    // Binds a batch given column-major: `columns[i][row]` is placeholder i of
+    // `row`. An INSERT ... VALUES with placeholders gets one VALUES row per
+    // batch row; any other statement gets one relation per batch row.
+    absl::StatusOr<substrait::Plan> BindBatch(
+        const std::vector<ParameterColumn>& columns) const;
+
+private:
+    // One step from a message to a field of it; `index` is -1 for singular
+    // fields.
+    struct PathStep {
+        const google::protobuf::FieldDescriptor* field;
+        int index;
+    };
+
+    // Where a placeholder sits in the template, found once at prepare time.
+    struct Slot {
+        uint32_t parameter;
+        std::vector<PathStep> path;
+    };
+
+    static void FindSlots(const google::protobuf::Message& message,
+                          std::vector<PathStep>* path,
+                          std::vector<Slot>* slots);
+
+    absl::Status CheckCount(size_t count) const;
+
+    // Replaces every slot under `root`, which sits `path_offset` steps below
+    // the plan, with the value `value_of` returns for its parameter.
+    absl::Status BindSlots(
+        google::protobuf::Message* root, size_t path_offset,
+        absl::FunctionRef<const ParameterValue&(uint32_t)> value_of) const;
+
+    substrait::Plan template_;
+    std::vector<Slot> slots_;
+    size_t parameter_count_ = 0;
+    // Length of the path prefix shared by every slot that BindBatch
+    // replicates: a VALUES row of an INSERT, or otherwise the relation.
+    size_t batch_unit_depth_ = 0;
+};
+
+}  // namespace pink_perilla
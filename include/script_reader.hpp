@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "catalog.hpp"
+#include "parse_options.hpp"
+#include "substrait/plan.pb.h"
+
+namespace pink_perilla {
+
+// One statement of a script, without its terminating semicolon.
+struct ScriptStatement {
+    std::string_view sql;
+    // Byte offset of `sql` from the start of the script.
+    uint64_t offset = 0;
+};
+
+// Splits a script into statements on top-level semicolons, ignoring those in
+// quoted literals and identifiers, comments and parentheses. Statements that
+// hold nothing but whitespace and comments are skipped.
+//
+// A mapped file is split in place. A stream is read in chunks, keeping only
+// the statement being split plus one chunk in memory, so scripts far larger
+// than RAM can be planned.
+class ScriptReader {
+public:
+    // Maps the file at `path` read-only.
+    static absl::StatusOr<std::unique_ptr<ScriptReader>> Open(
+        const std::string& path);
+    // Splits `script` in place; it must outlive the reader.
+    explicit ScriptReader(std::string_view script);
+    // Reads `input` `chunk_size` bytes at a time.
+    explicit ScriptReader(std::istream& input, size_t chunk_size = 1 << 20);
+    ~ScriptReader();
+    ScriptReader(const ScriptReader&) = delete;
+    ScriptReader& operator=(const ScriptReader&) = delete;
+
+    // The next statement, or nullopt at the end of the script. The statement
+    // text stays valid until the next call.
+    std::optional<ScriptStatement> Next();
+
+    // Not OK if reading the stream failed; Next() then returns nullopt.
+    const absl::Status& status() const { return this->status_; }
+
+private:
+    enum class State { kCode, kSingleQuote, kDoubleQuote, kLineComment, kBlockComment };
+
+    ScriptReader() = default;
+
+    // Scans from scanned_ for the end of the current statement. Returns its
+    // semicolon's position, or npos if more input is needed first.
+    size_t Scan();
+    // Drops text before the current statement and appends the next chunk.
+    // Returns false at the end of the stream.
+    bool Refill();
+    // Lets the kernel drop mapped pages that are already planned.
+    void ReleaseConsumedPages();
+
+    // Everything readable right now; statements are slices of it.
+    std::string_view window_;
+    // Offset of window_[0] in the script.
+    uint64_t window_offset_ = 0;
+    // Start of the current statement and how far it has been scanned.
+    size_t begin_ = 0;
+    size_t scanned_ = 0;
+    State state_ = State::kCode;
+    int depth_ = 0;
+    // Whether the current statement has anything besides whitespace and
+    // comments.
+    bool significant_ = false;
+    bool at_eof_ = false;
+
+    // Stream input.
+    std::istream* input_ = nullptr;
+    size_t chunk_size_ = 0;
+    std::string buffer_;
+
+    // Mapped input.
+    void* mapping_ = nullptr;
+    size_t mapping_size_ = 0;
+    size_t released_ = 0;
+
+    absl::Status status_;
+};
+
+// Plans a script one statement at a time, against a shared catalog.
+class ScriptPlanner {
+public:
+    ScriptPlanner(ScriptReader& reader, const Catalog& catalog,
+                  const ParseOptions& options = {})
+        : reader_(reader), catalog_(catalog), options_(options) {}
+
+    // The plan of the next statement, or nullopt at the end of the script.
+    std::optional<absl::StatusOr<substrait::Plan>> Next();
+
+    // The statement the last Next() planned.
+    const ScriptStatement& statement() const { return this->statement_; }
+    // Its planning stats, if the options asked for them.
+    const PlanningStats& stats() const { return this->stats_; }
+
+private:
+    ScriptReader& reader_;
+    const Catalog& catalog_;
+    const ParseOptions options_;
+    ScriptStatement statement_;
+    PlanningStats stats_;
+};
+
+}  // namespace pink_perilla
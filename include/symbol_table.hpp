@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "absl/container/node_hash_map.h"
+
+namespace pink_perilla {
+
+// A dense ID for an identifier. Names that differ only in ASCII case share
+// one, so comparing two symbols compares the names as SQL does.
+using Symbol = uint32_t;
+inline constexpr Symbol kNoSymbol = ~Symbol{0};
+
+// Interns identifiers as Symbols numbered 0, 1, 2, ... in the order they are
+// first seen. Find() and name() may be called from any number of threads as
+// long as nothing is interning concurrently.
+class SymbolTable {
+public:
+    SymbolTable() = default;
+    SymbolTable(SymbolTable&&) = default;
+    SymbolTable& operator=(SymbolTable&&) = default;
+    SymbolTable(const SymbolTable&) = delete;
+    SymbolTable& operator=(const SymbolTable&) = delete;
+
+    // The symbol of `name`, interning it if it is new.
+    Symbol Intern(std::string_view name);
+
+    // The symbol of `name`, or kNoSymbol if it was never interned. Does not
+    // allocate.
+    Symbol Find(std::string_view name) const {
+        auto it = this->index_.find(name);
+        return it == this->index_.end() ? kNoSymbol : it->second;
+    }
+
+    // The spelling `symbol` was first interned with.
+    std::string_view name(Symbol symbol) const { return this->names_[symbol]; }
+
+    size_t size() const { return this->names_.size(); }
+
+private:
+    struct FoldedHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view name) const;
+    };
+    struct FoldedEq {
+        using is_transparent = void;
+        bool operator()(std::string_view a, std::string_view b) const;
+    };
+
+    // Node keys never move, so names_ can point into them. Neither container
+    // allocates until the first Intern().
+    absl::node_hash_map<std::string, Symbol, FoldedHash, FoldedEq> index_;
+    std::vector<std::string_view> names_;
+};
+
+}  // namespace pink_perilla
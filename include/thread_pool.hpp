@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "absl/synchronization/mutex.h"
+#include "executor.hpp"
+
+namespace pink_perilla {
+
+// A fixed set of worker threads with one task deque each. A worker runs its
+// own tasks newest first and, when it runs dry, steals the oldest task from
+// another worker, so uneven batches still keep every thread busy.
+class ThreadPool : public Executor {
+public:
+    explicit ThreadPool(size_t threads = std::thread::hardware_concurrency());
+    // Runs every task already scheduled, then joins the workers.
+    ~ThreadPool() override;
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t size() const { return this->workers_.size(); }
+
+    // Queues `task`. From a worker thread it lands on that worker's own deque;
+    // from any other thread the deques are filled round-robin.
+    void Schedule(std::function<void()> task) override;
+
+private:
+    struct Worker;
+
+    void Run(size_t self);
+    // Pops from worker `self`, else steals from the others. Returns an empty
+    // function when every deque is empty.
+    std::function<void()> Take(size_t self);
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::vector<std::thread> threads_;
+    std::atomic<size_t> next_{0};
+    // Tasks queued but not yet taken; workers sleep while it is zero.
+    std::atomic<size_t> pending_{0};
+    absl::Mutex sleep_mutex_;
+    absl::CondVar wake_;
+    bool stopping_ ABSL_GUARDED_BY(sleep_mutex_) = false;
+};
+
+}  // namespace pink_perilla
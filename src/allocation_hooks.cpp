@@ -0,0 +1,54 @@
+// Replaces the global allocation functions to count each thread's heap
+// traffic for PlanningStats. Build it into an executable, not into
+// pink_perilla_lib: a program may replace operator new only once, and a
+// library should not decide that for its host.
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "detail/heap_counter.hpp"
+
+namespace {
+
+void* CountedAlloc(size_t size, size_t align) {
+    pink_perilla::detail::HeapCounter& counter =
+        pink_perilla::detail::thread_heap_counter;
+    ++counter.allocations;
+    counter.bytes += size;
+    // malloc(0) may return null, which operator new must not.
+    size = size == 0 ? 1 : size;
+    void* ptr = align <= alignof(std::max_align_t)
+                    ? std::malloc(size)
+                    : std::aligned_alloc(align, (size + align - 1) / align * align);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+}  // namespace
+
+void* operator new(size_t size) {
+    return CountedAlloc(size, alignof(std::max_align_t));
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    return CountedAlloc(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
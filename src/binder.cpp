@@ -0,0 +1,1007 @@
+#include "detail/binder.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+#include <limits>
+
+#include "absl/container/inlined_vector.h"
+#include "absl/strings/match.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "detail/literal.hpp"
+
+namespace pink_perilla::binder {
+
+namespace {
+
+// Fills `schema` from the table's definition the first time the table is
+// seen. Tables without one keep an inferred schema that grows on demand.
+// Column names point into the definition, which outlives the statement.
+void LoadSchema(Symbol table, const Catalog& catalog, TableSchema* schema) {
+    if (!schema->inferred || !schema->columns.empty()) {
+        return;
+    }
+    const TableDefinition* definition = catalog.Find(table);
+    if (definition == nullptr) {
+        return;
+    }
+    schema->inferred = false;
+    const std::vector<Symbol>& symbols = catalog.column_symbols(table);
+    for (size_t i = 0; i < definition->columns.size(); ++i) {
+        const ColumnDefinition& column = definition->columns[i];
+        schema->columns.push_back(
+            {column.name, symbols[i], column.type, column.nullable});
+    }
+}
+
+// Whether `column` is the one `name`, interned as `symbol`, refers to.
+// Columns from a definition compare by symbol; inferred ones have none and
+// compare by name. Either way case does not matter.
+bool Matches(const BoundColumn& column, std::string_view name, Symbol symbol) {
+    if (column.symbol != kNoSymbol) {
+        return column.symbol == symbol;
+    }
+    return absl::EqualsIgnoreCase(column.name, name);
+}
+
+bool IsStarItem(const SelectItem& item) {
+    return item.expr == kNoExpr && item.expression == "*";
+}
+
+// The input row of a SELECT: its FROM source followed by cross-joined and
+// joined tables, each occupying a contiguous run of fields.
+class FromScope {
+public:
+    struct Binding {
+        int32_t field;
+        DataType type;
+    };
+
+    FromScope(SelectInfo& info, const SymbolTable& symbols, bool* shifted,
+              bool nested)
+        : symbols_(symbols), shifted_(shifted), nested_(nested) {
+        if (info.from_subquery) {
+            this->sources_.push_back({{}, nullptr, info.from_subquery->get()});
+        } else if (info.from_table) {
+            this->sources_.push_back(
+                {info.from_table->name, &info.from_table->schema, nullptr});
+        }
+        for (TableRef& table : info.cross_join_tables) {
+            this->sources_.push_back({table.name, &table.schema, nullptr});
+        }
+        for (JoinInfo& join : info.joins) {
+            this->sources_.push_back(
+                {join.table.name, &join.table.schema, nullptr});
+        }
+    }
+
+    FromScope(std::string_view table, TableSchema* schema,
+              const SymbolTable& symbols, bool* shifted)
+        : symbols_(symbols), shifted_(shifted), nested_(false) {
+        this->sources_.push_back({table, schema, nullptr});
+    }
+
+    size_t size() const {
+        return this->sources_.size();
+    }
+
+    uint32_t Width() const {
+        uint32_t width = 0;
+        for (const Source& source : this->sources_) {
+            width += this->SourceWidth(source);
+        }
+        return width;
+    }
+
+    // Resolves [qualifier.]column among the first `visible` sources. An
+    // unqualified column that no source knows is appended to the first
+    // source whose schema is inferred.
+    absl::StatusOr<Binding> Lookup(std::string_view qualifier,
+                                   std::string_view column, size_t visible,
+                                   bool allow_grow) {
+        visible = std::min(visible, this->sources_.size());
+        const Symbol symbol = this->symbols_.Find(column);
+        if (!qualifier.empty()) {
+            for (size_t i = 0; i < visible; ++i) {
+                Source& source = this->sources_[i];
+                if (source.subquery != nullptr ||
+                    !absl::EqualsIgnoreCase(source.name, qualifier)) {
+                    continue;
+                }
+                std::optional<Binding> found = this->Find(source, column, symbol);
+                if (!found && allow_grow) {
+                    found = this->Grow(i, column);
+                }
+                if (!found) {
+                    return absl::InvalidArgumentError(absl::StrCat(
+                        "Column not found: ", qualifier, ".", column));
+                }
+                found->field += this->Offset(i);
+                return *found;
+            }
+            return absl::InvalidArgumentError(
+                absl::StrCat("Unknown table '", qualifier, "'"));
+        }
+
+        std::optional<Binding> match;
+        for (size_t i = 0; i < visible; ++i) {
+            std::optional<Binding> found =
+                this->Find(this->sources_[i], column, symbol);
+            if (!found) {
+                continue;
+            }
+            if (match) {
+                return absl::InvalidArgumentError(
+                    absl::StrCat("Ambiguous column reference '", column, "'"));
+            }
+            match = Binding{
+                static_cast<int32_t>(found->field + this->Offset(i)),
+                found->type};
+        }
+        if (match) {
+            return *match;
+        }
+        if (allow_grow) {
+            if (std::optional<Binding> grown = this->GrowAny(column, visible)) {
+                return *grown;
+            }
+        }
+        return absl::InvalidArgumentError(
+            absl::StrCat("Column not found: ", column));
+    }
+
+private:
+    struct Source {
+        std::string_view name;
+        TableSchema* schema;
+        SelectInfo* subquery;
+    };
+
+    uint32_t SourceWidth(const Source& source) const {
+        if (source.schema != nullptr) {
+            return static_cast<uint32_t>(source.schema->columns.size());
+        }
+        // A subquery is bound before the query that reads it.
+        const SelectInfo& subquery = *source.subquery;
+        if (!subquery.select_items.empty() &&
+            IsStarItem(subquery.select_items.front())) {
+            return subquery.from_width;
+        }
+        return static_cast<uint32_t>(subquery.select_items.size());
+    }
+
+    uint32_t Offset(size_t index) const {
+        uint32_t offset = 0;
+        for (size_t i = 0; i < index; ++i) {
+            offset += this->SourceWidth(this->sources_[i]);
+        }
+        return offset;
+    }
+
+    std::optional<Binding> Find(const Source& source, std::string_view column,
+                                Symbol symbol) const {
+        if (source.schema != nullptr) {
+            const auto& columns = source.schema->columns;
+            for (size_t i = 0; i < columns.size(); ++i) {
+                if (Matches(columns[i], column, symbol)) {
+                    return Binding{static_cast<int32_t>(i), columns[i].type};
+                }
+            }
+            return std::nullopt;
+        }
+        SelectInfo& subquery = *source.subquery;
+        if (!subquery.select_items.empty() &&
+            IsStarItem(subquery.select_items.front())) {
+            absl::StatusOr<Binding> inner =
+                FromScope(subquery, this->symbols_, this->shifted_, true)
+                    .Lookup({}, column, std::numeric_limits<size_t>::max(),
+                            /*allow_grow=*/false);
+            if (!inner.ok()) {
+                return std::nullopt;
+            }
+            return *inner;
+        }
+        // A projected subquery exposes its items by alias, or by column name
+        // for bare column items.
+        for (size_t i = 0; i < subquery.select_items.size(); ++i) {
+            const SelectItem& item = subquery.select_items[i];
+            std::string_view name = item.alias;
+            if (name.empty() && item.expr != kNoExpr &&
+                subquery.expressions[item.expr].kind == ExprKind::kColumn) {
+                name = subquery.expressions[item.expr].text;
+            }
+            if (absl::EqualsIgnoreCase(name, column)) {
+                const DataType type = item.expr == kNoExpr
+                                          ? DataType::kUnknown
+                                          : subquery.expressions[item.expr].type;
+                return Binding{static_cast<int32_t>(i), type};
+            }
+        }
+        return std::nullopt;
+    }
+
+    // Appends `column`, which none of the first `visible` sources has, to
+    // the first one whose schema is inferred.
+    std::optional<Binding> GrowAny(std::string_view column, size_t visible) {
+        for (size_t i = 0; i < visible; ++i) {
+            if (std::optional<Binding> grown = this->Grow(i, column)) {
+                grown->field += this->Offset(i);
+                return grown;
+            }
+        }
+        return std::nullopt;
+    }
+
+    // Callers have already failed to Find() `column` in the source, which
+    // searched every source of a SELECT * subquery, so a subquery is grown
+    // without searching it again. Searching at each level would make a
+    // chain of nested subqueries quadratic.
+    std::optional<Binding> Grow(size_t index, std::string_view column) {
+        Source& source = this->sources_[index];
+        std::optional<Binding> grown;
+        if (source.schema != nullptr) {
+            if (!source.schema->inferred) {
+                return std::nullopt;
+            }
+            source.schema->columns.push_back({column});
+            grown = Binding{
+                static_cast<int32_t>(source.schema->columns.size() - 1),
+                DataType::kUnknown};
+        } else {
+            SelectInfo& subquery = *source.subquery;
+            if (subquery.select_items.empty() ||
+                !IsStarItem(subquery.select_items.front())) {
+                return std::nullopt;
+            }
+            grown = FromScope(subquery, this->symbols_, this->shifted_, true)
+                         .GrowAny(column, std::numeric_limits<size_t>::max());
+            if (!grown) {
+                return std::nullopt;
+            }
+        }
+        // Fields already bound to later sources are now off by one.
+        if (this->nested_ || index + 1 < this->sources_.size()) {
+            *this->shifted_ = true;
+        }
+        return grown;
+    }
+
+    // Statements rarely join more than a handful of tables.
+    absl::InlinedVector<Source, 4> sources_;
+    // Column references are interned here once and then compared by symbol.
+    const SymbolTable& symbols_;
+    bool* shifted_;
+    bool nested_;
+};
+
+struct ExprContext {
+    // Null where column references are not allowed (INSERT ... VALUES).
+    FromScope* from = nullptr;
+    size_t visible = std::numeric_limits<size_t>::max();
+    // Non-null above an aggregation: only GROUP BY expressions and aggregate
+    // calls may be referenced, and calls are recorded as measures.
+    SelectInfo* aggregate = nullptr;
+};
+
+bool IsNumeric(DataType type) {
+    switch (type) {
+        case DataType::kI8:
+        case DataType::kI16:
+        case DataType::kI32:
+        case DataType::kI64:
+        case DataType::kFp32:
+        case DataType::kFp64:
+        case DataType::kDecimal:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// The type both operands of an arithmetic operator are promoted to.
+// Decimals are approximated as fp64 until the planner tracks precision.
+DataType CommonNumericType(DataType lhs, DataType rhs) {
+    if (lhs == DataType::kUnknown) {
+        return rhs;
+    }
+    if (rhs == DataType::kUnknown) {
+        return lhs;
+    }
+    if (!IsNumeric(lhs) || !IsNumeric(rhs)) {
+        return DataType::kUnknown;
+    }
+    if (lhs == DataType::kDecimal || rhs == DataType::kDecimal) {
+        return DataType::kFp64;
+    }
+    // kI8 .. kFp64 are declared in widening order.
+    return std::max(lhs, rhs);
+}
+
+DataType LiteralType(const ExprNode& node) {
+    switch (node.literal) {
+        case LiteralKind::kBoolean:
+            return DataType::kBoolean;
+        case LiteralKind::kString:
+            return DataType::kString;
+        case LiteralKind::kDecimal:
+            return DataType::kFp64;
+        case LiteralKind::kDate:
+            return DataType::kDate;
+        case LiteralKind::kTimestamp:
+            return DataType::kTimestamp;
+        case LiteralKind::kInteger: {
+            const std::optional<int64_t> value =
+                literal::ParseInteger(node.text, node.negated);
+            if (!value) {
+                return DataType::kFp64;
+            }
+            return *value >= std::numeric_limits<int32_t>::min() &&
+                           *value <= std::numeric_limits<int32_t>::max()
+                       ? DataType::kI32
+                       : DataType::kI64;
+        }
+        case LiteralKind::kNull:
+            break;
+    }
+    return DataType::kUnknown;
+}
+
+template <typename T>
+bool IntegerFits(const ExprNode& node) {
+    const std::optional<int64_t> value =
+        literal::ParseInteger(node.text, node.negated);
+    return value && *value >= std::numeric_limits<T>::min() &&
+           *value <= std::numeric_limits<T>::max();
+}
+
+// Retypes a literal stored into a column of type `target` when its value
+// converts exactly, so the plan carries e.g. an i64 or a date rather than
+// whatever the literal's spelling suggests. NULL takes the column type.
+// Literals that do not convert keep their own type.
+void CoerceLiteral(ExprNode& node, DataType target) {
+    if (node.kind != ExprKind::kLiteral || target == DataType::kUnknown) {
+        return;
+    }
+    bool converts = false;
+    switch (node.literal) {
+        case LiteralKind::kNull:
+            converts = true;
+            break;
+        case LiteralKind::kInteger:
+            switch (target) {
+                case DataType::kI8:
+                    converts = IntegerFits<int8_t>(node);
+                    break;
+                case DataType::kI16:
+                    converts = IntegerFits<int16_t>(node);
+                    break;
+                case DataType::kI32:
+                    converts = IntegerFits<int32_t>(node);
+                    break;
+                case DataType::kI64:
+                    converts = IntegerFits<int64_t>(node);
+                    break;
+                case DataType::kFp32:
+                case DataType::kFp64:
+                    converts = true;
+                    break;
+                case DataType::kDecimal:
+                    converts =
+                        literal::ParseDecimal(node.text, node.negated).has_value();
+                    break;
+                default:
+                    break;
+            }
+            break;
+        case LiteralKind::kDecimal:
+            converts = target == DataType::kFp32 || target == DataType::kFp64 ||
+                       (target == DataType::kDecimal &&
+                        literal::ParseDecimal(node.text, node.negated));
+            break;
+        case LiteralKind::kString: {
+            const std::string_view body = literal::StringBody(node.text);
+            converts = (target == DataType::kDate &&
+                        literal::ParseDate(body)) ||
+                       (target == DataType::kTimestamp &&
+                        literal::ParseTimestamp(body));
+            break;
+        }
+        case LiteralKind::kBoolean:
+        case LiteralKind::kDate:
+        case LiteralKind::kTimestamp:
+            break;
+    }
+    if (converts) {
+        node.type = target;
+    }
+}
+
+bool NameIsOneOf(std::string_view name,
+                 std::initializer_list<std::string_view> candidates) {
+    for (std::string_view candidate : candidates) {
+        if (absl::EqualsIgnoreCase(name, candidate)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+DataType FunctionType(const ExpressionTree& tree, const ExprNode& node) {
+    const std::string_view name = node.text;
+    const DataType first = node.arg_count == 0
+                               ? DataType::kUnknown
+                               : tree[tree.arg(node, 0)].type;
+    if (NameIsOneOf(name, {"count", "row_number", "rank", "dense_rank",
+                           "length", "char_length"})) {
+        return DataType::kI64;
+    }
+    if (absl::EqualsIgnoreCase(name, "avg")) {
+        return DataType::kFp64;
+    }
+    if (absl::EqualsIgnoreCase(name, "sum")) {
+        if (first == DataType::kFp32 || first == DataType::kFp64 ||
+            first == DataType::kDecimal) {
+            return DataType::kFp64;
+        }
+        return IsNumeric(first) ? DataType::kI64 : DataType::kUnknown;
+    }
+    if (NameIsOneOf(name, {"min", "max", "abs"})) {
+        return first;
+    }
+    if (NameIsOneOf(name, {"lower", "upper", "trim", "substring", "replace",
+                           "concat", "left"})) {
+        return DataType::kString;
+    }
+    if (absl::EqualsIgnoreCase(name, "coalesce")) {
+        for (uint32_t i = 0; i < node.arg_count; ++i) {
+            const DataType type = tree[tree.arg(node, i)].type;
+            if (type != DataType::kUnknown) {
+                return type;
+            }
+        }
+    }
+    return DataType::kUnknown;
+}
+
+DataType CaseType(const ExpressionTree& tree, const ExprNode& node) {
+    const uint32_t first_result = node.case_has_operand ? 2 : 1;
+    for (uint32_t i = first_result; i < node.arg_count; i += 2) {
+        const DataType type = tree[tree.arg(node, i)].type;
+        if (type != DataType::kUnknown) {
+            return type;
+        }
+    }
+    if (node.case_has_else) {
+        return tree[tree.arg(node, node.arg_count - 1)].type;
+    }
+    return DataType::kUnknown;
+}
+
+// A placeholder takes the type of the value it is compared or combined
+// with, so `id = ?` binds as the type of `id`.
+void InferParameterTypes(ExpressionTree& tree, ExprId id) {
+    const ExprNode& node = tree[id];
+    DataType known = DataType::kUnknown;
+    for (uint32_t i = 0; i < node.arg_count && known == DataType::kUnknown;
+         ++i) {
+        known = tree[tree.arg(node, i)].type;
+    }
+    if (known == DataType::kUnknown) {
+        return;
+    }
+    for (uint32_t i = 0; i < node.arg_count; ++i) {
+        ExprNode& arg = tree[tree.arg(node, i)];
+        if (arg.kind == ExprKind::kParameter && arg.type == DataType::kUnknown) {
+            arg.type = known;
+        }
+    }
+}
+
+// Source text identifies an expression unless it holds a ? placeholder: two
+// `a + ?` are different expressions.
+bool SameExpression(const ExprNode& lhs, const ExprNode& rhs) {
+    return lhs.source == rhs.source &&
+           lhs.source.find('?') == std::string_view::npos;
+}
+
+bool IsAggregateCall(const ExprNode& node) {
+    return node.kind == ExprKind::kFunction && IsAggregateFunction(node.text);
+}
+
+bool ContainsAggregate(const ExpressionTree& tree, ExprId id) {
+    const ExprNode& node = tree[id];
+    if (IsAggregateCall(node)) {
+        return true;
+    }
+    for (uint32_t i = 0; i < node.arg_count; ++i) {
+        if (ContainsAggregate(tree, tree.arg(node, i))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+absl::Status BindExpr(ExpressionTree& tree, ExprId id,
+                      const ExprContext& context);
+
+absl::Status BindArgs(ExpressionTree& tree, ExprId id,
+                      const ExprContext& context) {
+    const ExprNode node = tree[id];
+    for (uint32_t i = 0; i < node.arg_count; ++i) {
+        if (absl::Status status = BindExpr(tree, tree.arg(node, i), context);
+            !status.ok()) {
+            return status;
+        }
+    }
+    return absl::OkStatus();
+}
+
+// Binds an aggregate call above the aggregation: its arguments are evaluated
+// against the FROM scope, and the call itself becomes a reference to its
+// measure in the AggregateRel output.
+absl::Status BindAggregateCall(ExpressionTree& tree, ExprId id,
+                               const ExprContext& context) {
+    const ExprContext input{context.from, context.visible, nullptr};
+    const ExprNode& node = tree[id];
+    for (uint32_t i = 0; i < node.arg_count; ++i) {
+        const ExprId arg = tree.arg(node, i);
+        if (ContainsAggregate(tree, arg)) {
+            return absl::InvalidArgumentError(absl::StrCat(
+                "Aggregate function calls cannot be nested: ", node.source));
+        }
+        if (absl::Status status = BindExpr(tree, arg, input); !status.ok()) {
+            return status;
+        }
+    }
+    tree[id].type = FunctionType(tree, tree[id]);
+
+    SelectInfo& info = *context.aggregate;
+    size_t measure = 0;
+    while (measure < info.measures.size() &&
+           !SameExpression(tree[info.measures[measure]], tree[id])) {
+        ++measure;
+    }
+    if (measure == info.measures.size()) {
+        info.measures.push_back(id);
+    }
+    tree[id].field = static_cast<int32_t>(info.group_by.size() + measure);
+    return absl::OkStatus();
+}
+
+absl::Status BindExpr(ExpressionTree& tree, ExprId id,
+                      const ExprContext& context) {
+    tree[id].field = -1;
+    if (context.aggregate != nullptr && tree[id].kind != ExprKind::kLiteral &&
+        tree[id].kind != ExprKind::kParameter) {
+        const SelectInfo& info = *context.aggregate;
+        for (size_t i = 0; i < info.group_by.size(); ++i) {
+            const ExprNode& group = tree[info.group_by[i]];
+            if (SameExpression(group, tree[id])) {
+                tree[id].field = static_cast<int32_t>(i);
+                tree[id].type = group.type;
+                return absl::OkStatus();
+            }
+        }
+    }
+
+    ExprNode& node = tree[id];
+    switch (node.kind) {
+        case ExprKind::kColumn: {
+            if (context.from == nullptr) {
+                return absl::InvalidArgumentError(absl::StrCat(
+                    "Column references are not allowed here: ", node.source));
+            }
+            if (context.aggregate != nullptr) {
+                return absl::InvalidArgumentError(absl::StrCat(
+                    "Column '", node.source,
+                    "' must appear in the GROUP BY clause or be used in an "
+                    "aggregate function"));
+            }
+            absl::StatusOr<FromScope::Binding> binding = context.from->Lookup(
+                node.qualifier, node.text, context.visible,
+                /*allow_grow=*/true);
+            if (!binding.ok()) {
+                return binding.status();
+            }
+            tree[id].field = binding->field;
+            tree[id].type = binding->type;
+            return absl::OkStatus();
+        }
+        case ExprKind::kLiteral:
+            node.type = LiteralType(node);
+            return absl::OkStatus();
+        case ExprKind::kStar:
+        case ExprKind::kParameter:
+            return absl::OkStatus();
+        case ExprKind::kFunction:
+            if (IsAggregateFunction(node.text)) {
+                if (context.aggregate == nullptr) {
+                    return absl::InvalidArgumentError(absl::StrCat(
+                        "Aggregate functions are not allowed here: ",
+                        node.source));
+                }
+                return BindAggregateCall(tree, id, context);
+            }
+            break;
+        default:
+            break;
+    }
+
+    if (absl::Status status = BindArgs(tree, id, context); !status.ok()) {
+        return status;
+    }
+    if (node.kind == ExprKind::kBinary || node.kind == ExprKind::kBetween ||
+        node.kind == ExprKind::kInList) {
+        InferParameterTypes(tree, id);
+    }
+    ExprNode& bound = tree[id];
+    switch (bound.kind) {
+        case ExprKind::kUnary:
+            bound.type = bound.op == ExprOp::kNot
+                             ? DataType::kBoolean
+                             : tree[tree.arg(bound, 0)].type;
+            break;
+        case ExprKind::kBinary:
+            switch (bound.op) {
+                case ExprOp::kConcat:
+                    bound.type = DataType::kString;
+                    break;
+                case ExprOp::kAdd:
+                case ExprOp::kSubtract:
+                case ExprOp::kMultiply:
+                case ExprOp::kDivide:
+                case ExprOp::kModulo:
+                    bound.type = CommonNumericType(tree[tree.arg(bound, 0)].type,
+                                                   tree[tree.arg(bound, 1)].type);
+                    break;
+                default:
+                    bound.type = DataType::kBoolean;
+                    break;
+            }
+            break;
+        case ExprKind::kIsNull:
+        case ExprKind::kBetween:
+        case ExprKind::kInList:
+            bound.type = DataType::kBoolean;
+            break;
+        case ExprKind::kCase:
+            bound.type = CaseType(tree, bound);
+            break;
+        case ExprKind::kCast:
+            bound.type = ParseTypeSpec(bound.text)->type;
+            break;
+        case ExprKind::kFunction:
+            bound.type = FunctionType(tree, bound);
+            break;
+        default:
+            break;
+    }
+    return absl::OkStatus();
+}
+
+// ORDER BY may name a select item by alias or by 1-based position. A `*`
+// item takes up one position for each of the `from_width` input columns it
+// expands to; a key naming one of those becomes a reference to that column.
+absl::StatusOr<ExprId> ResolveSortKey(SelectInfo& info, ExprId key,
+                                      uint32_t from_width) {
+    for (const SelectItem& item : info.select_items) {
+        if (item.expr == key) {
+            return key;  // Resolved by an earlier binding pass.
+        }
+    }
+    ExprNode& node = info.expressions[key];
+    if (node.kind == ExprKind::kColumn && node.qualifier.empty()) {
+        for (const SelectItem& item : info.select_items) {
+            if (!item.alias.empty() && item.alias == node.text) {
+                return item.expr;
+            }
+        }
+    }
+    if (node.kind != ExprKind::kLiteral ||
+        node.literal != LiteralKind::kInteger) {
+        return key;
+    }
+    size_t position = 0;
+    if (!node.negated && absl::SimpleAtoi(node.text, &position) &&
+        position >= 1) {
+        // The position of the current item's first column.
+        size_t first = 1;
+        for (const SelectItem& item : info.select_items) {
+            const size_t width = IsStarItem(item) ? from_width : 1;
+            if (position < first + width) {
+                if (!IsStarItem(item)) {
+                    return item.expr;
+                }
+                node.field = static_cast<int32_t>(position - first);
+                node.type = DataType::kUnknown;
+                return key;
+            }
+            first += width;
+        }
+    }
+    return absl::InvalidArgumentError(absl::StrCat(
+        "ORDER BY position ", node.source, " is not in the select list"));
+}
+
+bool IsWindowItem(const SelectInfo& info, ExprId id) {
+    return std::any_of(info.select_items.begin(), info.select_items.end(),
+                       [id](const SelectItem& item) {
+                           return item.type == SelectItemType::WINDOW_FUNCTION &&
+                                  item.expr == id;
+                       });
+}
+
+absl::Status BindSelect(SelectInfo& info, const Catalog& catalog,
+                        bool* shifted) {
+    if (info.from_subquery) {
+        if (absl::Status status =
+                BindSelect(**info.from_subquery, catalog, shifted);
+            !status.ok()) {
+            return status;
+        }
+    } else if (info.from_table) {
+        LoadSchema(info.from_table->symbol, catalog, &info.from_table->schema);
+    }
+    for (TableRef& table : info.cross_join_tables) {
+        LoadSchema(table.symbol, catalog, &table.schema);
+    }
+    for (JoinInfo& join : info.joins) {
+        LoadSchema(join.table.symbol, catalog, &join.table.schema);
+    }
+
+    ExpressionTree& tree = info.expressions;
+    FromScope from(info, catalog.symbols(), shifted, /*nested=*/false);
+    const ExprContext input{&from};
+
+    const size_t joins_begin = from.size() - info.joins.size();
+    for (size_t i = 0; i < info.joins.size(); ++i) {
+        // ON sees the tables joined so far, including this one.
+        const ExprContext on{&from, joins_begin + i + 1};
+        if (absl::Status status = BindExpr(tree, info.joins[i].on_condition, on);
+            !status.ok()) {
+            return status;
+        }
+    }
+    if (info.where_condition != kNoExpr) {
+        if (ContainsAggregate(tree, info.where_condition)) {
+            return absl::InvalidArgumentError(
+                "Aggregate functions are not allowed in WHERE");
+        }
+        if (absl::Status status = BindExpr(tree, info.where_condition, input);
+            !status.ok()) {
+            return status;
+        }
+    }
+    for (ExprId group : info.group_by) {
+        if (absl::Status status = BindExpr(tree, group, input); !status.ok()) {
+            return status;
+        }
+    }
+
+    bool aggregated = !info.group_by.empty();
+    bool has_star = false;
+    for (const SelectItem& item : info.select_items) {
+        if (IsStarItem(item)) {
+            has_star = true;
+        } else if (item.type != SelectItemType::WINDOW_FUNCTION) {
+            aggregated = aggregated || ContainsAggregate(tree, item.expr);
+        }
+    }
+    for (SortInfo& sort : info.order_by_columns) {
+        absl::StatusOr<ExprId> key =
+            ResolveSortKey(info, sort.expr, from.Width());
+        if (!key.ok()) {
+            return key.status();
+        }
+        sort.expr = *key;
+        if (!IsWindowItem(info, sort.expr)) {
+            aggregated = aggregated || ContainsAggregate(tree, sort.expr);
+        }
+    }
+    if (aggregated && has_star) {
+        return absl::InvalidArgumentError(
+            "SELECT * cannot be combined with aggregation");
+    }
+
+    info.measures.clear();
+    const ExprContext output{&from, std::numeric_limits<size_t>::max(),
+                             aggregated ? &info : nullptr};
+    uint32_t window_count = 0;
+    for (const SelectItem& item : info.select_items) {
+        if (IsStarItem(item)) {
+            continue;
+        }
+        if (item.type != SelectItemType::WINDOW_FUNCTION) {
+            if (absl::Status status = BindExpr(tree, item.expr, output);
+                !status.ok()) {
+                return status;
+            }
+            continue;
+        }
+        // The window call itself is evaluated by the WindowRel; only its
+        // arguments and partition keys are expressions over the input.
+        ++window_count;
+        if (absl::Status status = BindArgs(tree, item.expr, output);
+            !status.ok()) {
+            return status;
+        }
+        for (ExprId partition : item.win_info->partition_by) {
+            if (absl::Status status = BindExpr(tree, partition, output);
+                !status.ok()) {
+                return status;
+            }
+        }
+    }
+    for (const SortInfo& sort : info.order_by_columns) {
+        // A window item is bound above; its field is assigned below. A
+        // position within `*` already references its column.
+        if (IsWindowItem(info, sort.expr) ||
+            (tree[sort.expr].kind == ExprKind::kLiteral &&
+             tree[sort.expr].field >= 0)) {
+            continue;
+        }
+        if (absl::Status status = BindExpr(tree, sort.expr, output);
+            !status.ok()) {
+            return status;
+        }
+    }
+
+    // Window results are appended after the aggregation (or FROM) output, in
+    // select-list order.
+    info.from_width = from.Width();
+    const uint32_t base_width =
+        aggregated ? static_cast<uint32_t>(info.group_by.size() +
+                                           info.measures.size())
+                   : info.from_width;
+    uint32_t window_field = base_width;
+    for (const SelectItem& item : info.select_items) {
+        if (item.type == SelectItemType::WINDOW_FUNCTION) {
+            ExprNode& call = tree[item.expr];
+            call.type = FunctionType(tree, call);
+            call.field = static_cast<int32_t>(window_field++);
+        }
+    }
+    info.project_input_width = base_width + window_count;
+    return absl::OkStatus();
+}
+
+absl::Status BindDelete(DeleteInfo& info, const Catalog& catalog,
+                        bool* shifted) {
+    LoadSchema(info.table_symbol, catalog, &info.schema);
+    if (info.where_clause == kNoExpr) {
+        return absl::OkStatus();
+    }
+    FromScope from(info.table_name, &info.schema, catalog.symbols(), shifted);
+    return BindExpr(info.expressions, info.where_clause, ExprContext{&from});
+}
+
+absl::Status BindUpdate(UpdateInfo& info, const Catalog& catalog,
+                        bool* shifted) {
+    LoadSchema(info.table_symbol, catalog, &info.schema);
+    FromScope from(info.table_name, &info.schema, catalog.symbols(), shifted);
+    const ExprContext input{&from};
+    for (SetClause& set_clause : info.set_clauses) {
+        absl::StatusOr<FromScope::Binding> target = from.Lookup(
+            {}, set_clause.column_name, 1, /*allow_grow=*/true);
+        if (!target.ok()) {
+            return target.status();
+        }
+        set_clause.column_index = target->field;
+    }
+    for (const SetClause& set_clause : info.set_clauses) {
+        if (absl::Status status =
+                BindExpr(info.expressions, set_clause.value, input);
+            !status.ok()) {
+            return status;
+        }
+        ExprNode& value = info.expressions[set_clause.value];
+        const DataType target = info.schema.columns[set_clause.column_index].type;
+        if (value.kind == ExprKind::kParameter) {
+            value.type = target;
+        }
+        CoerceLiteral(value, target);
+    }
+    if (info.where_clause != kNoExpr) {
+        return BindExpr(info.expressions, info.where_clause, input);
+    }
+    return absl::OkStatus();
+}
+
+absl::Status BindInsert(InsertInfo& info, const Catalog& catalog) {
+    LoadSchema(info.table_symbol, catalog, &info.schema);
+    // The type of each listed column, resolved once for all rows into
+    // column_types. A placeholder takes the type of the column it is inserted into, and a
+    // literal converts to it where it can. A defined table must have every
+    // listed column; an inferred one leaves them untyped.
+    std::pmr::vector<DataType>& targets = info.column_types;
+    targets.assign(info.columns.size(), DataType::kUnknown);
+    for (size_t i = 0; i < info.columns.size(); ++i) {
+        if (info.schema.inferred) {
+            continue;
+        }
+        const Symbol symbol = catalog.symbol(info.columns[i]);
+        auto it = std::find_if(info.schema.columns.begin(),
+                               info.schema.columns.end(),
+                               [&](const BoundColumn& column) {
+                                   return Matches(column, info.columns[i], symbol);
+                               });
+        if (it == info.schema.columns.end()) {
+            return absl::NotFoundError(
+                absl::StrCat("Column not found: ", info.columns[i]));
+        }
+        targets[i] = it->type;
+    }
+    for (size_t i = 0; i < info.values.size(); ++i) {
+        if (absl::Status status =
+                BindExpr(info.expressions, info.values[i], ExprContext{});
+            !status.ok()) {
+            return status;
+        }
+        const size_t position = i % info.row_width;
+        ExprNode& value = info.expressions[info.values[i]];
+        if (value.kind == ExprKind::kParameter) {
+            value.type = targets[position];
+        }
+        CoerceLiteral(value, targets[position]);
+    }
+    return absl::OkStatus();
+}
+
+// A COPY reads the listed columns, or every column, in that order. Columns
+// come typed from the table's definition, which must have every listed one.
+absl::Status BindCopy(CopyInfo& info, const Catalog& catalog,
+                      std::pmr::memory_resource* arena) {
+    TableSchema table(arena);
+    LoadSchema(info.table_symbol, catalog, &table);
+    if (info.columns.empty()) {
+        info.schema = std::move(table);
+        return absl::OkStatus();
+    }
+    info.schema.inferred = table.inferred;
+    for (const std::string_view name : info.columns) {
+        if (table.inferred) {
+            info.schema.columns.push_back({name});
+            continue;
+        }
+        const Symbol symbol = catalog.symbol(name);
+        auto it = std::find_if(table.columns.begin(), table.columns.end(),
+                               [&](const BoundColumn& column) {
+                                   return Matches(column, name, symbol);
+                               });
+        if (it == table.columns.end()) {
+            return absl::NotFoundError(absl::StrCat("Column not found: ", name));
+        }
+        info.schema.columns.push_back(*it);
+    }
+    return absl::OkStatus();
+}
+
+}  // namespace
+
+absl::Status Bind(Statement& statement, const Catalog& catalog,
+                  std::pmr::memory_resource* arena) {
+    // Inferred schemas grow as columns are bound. When a table that is not
+    // the last input grows, fields bound before the growth point past it, so
+    // the statement is bound once more against the now complete schemas.
+    for (int pass = 0; pass < 2; ++pass) {
+        bool shifted = false;
+        absl::Status status = absl::OkStatus();
+        if (auto* select = std::get_if<SelectInfo>(&statement)) {
+            status = BindSelect(*select, catalog, &shifted);
+        } else if (auto* update = std::get_if<UpdateInfo>(&statement)) {
+            status = BindUpdate(*update, catalog, &shifted);
+        } else if (auto* del = std::get_if<DeleteInfo>(&statement)) {
+            status = BindDelete(*del, catalog, &shifted);
+        } else if (auto* insert = std::get_if<InsertInfo>(&statement)) {
+            status = BindInsert(*insert, catalog);
+        } else if (auto* copy = std::get_if<CopyInfo>(&statement)) {
+            status = BindCopy(*copy, catalog, arena);
+        }
+        if (!status.ok() || !shifted) {
+            return status;
+        }
+    }
+    return absl::OkStatus();
+}
+
+}  // namespace pink_perilla::binder
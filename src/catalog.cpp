@@ -0,0 +1,57 @@
+#include "catalog.hpp"
+
+#include <atomic>
+#include <utility>
+
+#include "absl/hash/hash.h"
+
+namespace pink_perilla {
+
+Catalog::Catalog(std::vector<TableDefinition> table_definitions)
+    : owned_(std::move(table_definitions)) {
+    this->Index(this->owned_);
+}
+
+Catalog Catalog::Borrow(const std::vector<TableDefinition>& table_definitions) {
+    Catalog catalog(std::vector<TableDefinition>{});
+    catalog.Index(table_definitions);
+    return catalog;
+}
+
+void Catalog::Index(const std::vector<TableDefinition>& table_definitions) {
+    size_t hash = absl::HashOf(table_definitions.size());
+    for (const TableDefinition& table : table_definitions) {
+        const Symbol symbol = this->symbols_.Intern(table.name);
+        if (symbol >= this->tables_.size()) {
+            this->tables_.resize(symbol + 1);
+        }
+        // The first definition of a name wins.
+        Table& entry = this->tables_[symbol];
+        if (entry.definition == nullptr) {
+            entry.definition = &table;
+            entry.columns.reserve(table.columns.size());
+            for (const ColumnDefinition& column : table.columns) {
+                entry.columns.push_back(this->symbols_.Intern(column.name));
+            }
+            ++this->size_;
+        }
+        hash = absl::HashOf(hash, table.name, table.columns.size());
+        for (const ColumnDefinition& column : table.columns) {
+            hash = absl::HashOf(hash, column.name, static_cast<int>(column.type),
+                                column.nullable, column.attributes);
+        }
+    }
+    this->fingerprint_ = hash;
+}
+
+std::shared_ptr<const Catalog> CatalogHandle::Load() const {
+    return std::atomic_load_explicit(&this->catalog_, std::memory_order_acquire);
+}
+
+std::shared_ptr<const Catalog> CatalogHandle::Swap(
+    std::shared_ptr<const Catalog> catalog) {
+    return std::atomic_exchange_explicit(&this->catalog_, std::move(catalog),
+                                         std::memory_order_acq_rel);
+}
+
+}  // namespace pink_perilla
@@ -0,0 +1,347 @@
+#include "digest_stats.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <limits>
+#include <variant>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/hash/hash.h"
+#include "absl/strings/ascii.h"
+#include "detail/arena.hpp"
+#include "detail/lexer.hpp"
+#include "detail/sql_parser.hpp"
+#include "detail/substrait_converter.hpp"
+#include "pink_perilla.hpp"
+
+namespace pink_perilla {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using lexer::Keyword;
+using lexer::Token;
+using lexer::TokenType;
+
+// Log-linear histogram buckets: values below 4 get their own bucket, larger
+// ones four buckets per power of two.
+constexpr size_t kBuckets = 4 + 62 * 4;
+
+size_t BucketOf(uint64_t value) {
+    if (value < 4) {
+        return value;
+    }
+    const int exponent = 63 - __builtin_clzll(value);
+    const uint64_t sub = (value >> (exponent - 2)) & 3;
+    return 4 + (exponent - 2) * 4 + sub;
+}
+
+uint64_t BucketUpperBound(size_t bucket) {
+    if (bucket < 4) {
+        return bucket;
+    }
+    const int shift = static_cast<int>((bucket - 4) / 4);
+    const uint64_t lower = (4 + (bucket - 4) % 4) << shift;
+    return lower + ((uint64_t{1} << shift) - 1);
+}
+
+// A counter written only by its owning thread, so updates are plain relaxed
+// loads and stores; readers on other threads see a recent value.
+class OwnedCounter {
+public:
+    explicit OwnedCounter(uint64_t initial = 0) : value_(initial) {}
+
+    uint64_t load() const { return this->value_.load(std::memory_order_relaxed); }
+    void Add(uint64_t delta) {
+        this->value_.store(this->load() + delta, std::memory_order_relaxed);
+    }
+    void Min(uint64_t value) {
+        if (value < this->load()) {
+            this->value_.store(value, std::memory_order_relaxed);
+        }
+    }
+    void Max(uint64_t value) {
+        if (value > this->load()) {
+            this->value_.store(value, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    std::atomic<uint64_t> value_;
+};
+
+struct Latency {
+    OwnedCounter total;
+    OwnedCounter min{std::numeric_limits<uint64_t>::max()};
+    OwnedCounter max;
+    std::array<OwnedCounter, kBuckets> histogram;
+
+    void Record(uint64_t ns) {
+        this->total.Add(ns);
+        this->min.Min(ns);
+        this->max.Max(ns);
+        this->histogram[BucketOf(ns)].Add(1);
+    }
+};
+
+// Latency merged across threads.
+struct MergedLatency {
+    LatencySummary summary;
+    std::array<uint64_t, kBuckets> histogram{};
+    bool seen = false;
+
+    void Merge(const Latency& latency) {
+        const uint64_t min = latency.min.load();
+        if (min == std::numeric_limits<uint64_t>::max()) {
+            return;
+        }
+        this->summary.total_ns += latency.total.load();
+        this->summary.min_ns =
+            this->seen ? std::min(this->summary.min_ns, min) : min;
+        this->summary.max_ns = std::max(this->summary.max_ns, latency.max.load());
+        for (size_t i = 0; i < kBuckets; ++i) {
+            this->histogram[i] += latency.histogram[i].load();
+        }
+        this->seen = true;
+    }
+
+    LatencySummary Finish() {
+        uint64_t count = 0;
+        for (uint64_t n : this->histogram) {
+            count += n;
+        }
+        // Smallest bucket with at least 99% of the samples at or below it.
+        const uint64_t rank = count - count / 100;
+        uint64_t seen = 0;
+        for (size_t i = 0; i < kBuckets && count > 0; ++i) {
+            seen += this->histogram[i];
+            if (seen >= rank) {
+                this->summary.p99_ns =
+                    std::min(BucketUpperBound(i), this->summary.max_ns);
+                break;
+            }
+        }
+        return this->summary;
+    }
+};
+
+uint64_t Fingerprint(const std::pmr::vector<Token>& tokens) {
+    uint64_t hash = 0;
+    for (const Token& token : tokens) {
+        const bool literal = token.type == TokenType::kNumber ||
+                             token.type == TokenType::kString;
+        // Keywords hash by identity so `select` and `SELECT` are one shape,
+        // and every literal hashes alike whatever its type or value.
+        const std::string_view text =
+            literal || token.keyword != Keyword::kNone ? std::string_view()
+                                                        : token.text;
+        const TokenType type = literal ? TokenType::kNumber : token.type;
+        hash = absl::HashOf(hash, static_cast<int>(type),
+                            static_cast<int>(token.keyword), text);
+    }
+    return hash;
+}
+
+std::string Normalize(const std::pmr::vector<Token>& tokens) {
+    std::string normalized;
+    for (const Token& token : tokens) {
+        if (token.type == TokenType::kEnd) {
+            break;
+        }
+        if (!normalized.empty()) {
+            normalized.push_back(' ');
+        }
+        if (token.type == TokenType::kNumber ||
+            token.type == TokenType::kString) {
+            normalized.push_back('?');
+        } else if (token.keyword != Keyword::kNone) {
+            normalized.append(absl::AsciiStrToUpper(token.text));
+        } else {
+            normalized.append(token.text);
+        }
+    }
+    return normalized;
+}
+
+uint64_t ElapsedNs(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+        .count();
+}
+
+uint64_t NextInstanceId() {
+    static std::atomic<uint64_t> next{1};
+    return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+}  // anonymous namespace
+
+struct DigestStats::Digest {
+    uint64_t fingerprint = 0;
+    std::string normalized_sql;
+    // Older digests of the same thread; fixed before this one is published.
+    Digest* next = nullptr;
+
+    OwnedCounter calls;
+    OwnedCounter errors;
+    Latency parse;
+    Latency convert;
+    OwnedCounter plan_bytes_total;
+    OwnedCounter plan_bytes_min{std::numeric_limits<uint64_t>::max()};
+    OwnedCounter plan_bytes_max;
+};
+
+// The digests one thread writes. Only that thread touches `index`; readers
+// reach the digests through `head`, which only ever grows at the front.
+struct DigestStats::ThreadDigests {
+    absl::flat_hash_map<uint64_t, Digest*> index;
+    std::atomic<Digest*> head{nullptr};
+    ThreadDigests* next = nullptr;
+
+    ~ThreadDigests() {
+        Digest* digest = this->head.load(std::memory_order_relaxed);
+        while (digest != nullptr) {
+            Digest* next = digest->next;
+            delete digest;
+            digest = next;
+        }
+    }
+
+    Digest& Find(uint64_t fingerprint, const std::pmr::vector<Token>& tokens) {
+        auto [it, inserted] = this->index.try_emplace(fingerprint, nullptr);
+        if (inserted) {
+            auto* digest = new Digest();
+            digest->fingerprint = fingerprint;
+            digest->normalized_sql = Normalize(tokens);
+            digest->next = this->head.load(std::memory_order_relaxed);
+            this->head.store(digest, std::memory_order_release);
+            it->second = digest;
+        }
+        return *it->second;
+    }
+};
+
+DigestStats::DigestStats() : id_(NextInstanceId()) {}
+
+DigestStats::~DigestStats() {
+    ThreadDigests* thread = this->threads_.load(std::memory_order_acquire);
+    while (thread != nullptr) {
+        ThreadDigests* next = thread->next;
+        delete thread;
+        thread = next;
+    }
+}
+
+DigestStats::ThreadDigests& DigestStats::ForThisThread() {
+    thread_local absl::flat_hash_map<uint64_t, ThreadDigests*> mine;
+    ThreadDigests*& thread = mine[this->id_];
+    if (thread == nullptr) {
+        thread = new ThreadDigests();
+        thread->next = this->threads_.load(std::memory_order_relaxed);
+        while (!this->threads_.compare_exchange_weak(
+            thread->next, thread, std::memory_order_release,
+            std::memory_order_relaxed)) {
+        }
+    }
+    return *thread;
+}
+
+absl::StatusOr<substrait::Plan> DigestStats::Parse(
+    std::string_view sql,
+    const std::vector<TableDefinition>& table_definitions) {
+    return this->Parse(sql, Catalog::Borrow(table_definitions));
+}
+
+absl::StatusOr<substrait::Plan> DigestStats::Parse(std::string_view sql,
+                                                   const Catalog& catalog) {
+    StatementArena arena;
+    absl::StatusOr<std::pmr::vector<Token>> tokens =
+        lexer::Tokenize(sql, arena.resource());
+    if (!tokens.ok()) {
+        return tokens.status();
+    }
+    Digest& digest =
+        this->ForThisThread().Find(Fingerprint(*tokens), *tokens);
+    digest.calls.Add(1);
+
+    const Clock::time_point parse_start = Clock::now();
+    absl::StatusOr<Statement> statement =
+        SqlParser::Parse(sql, catalog, arena.resource());
+    const Clock::time_point parse_end = Clock::now();
+    digest.parse.Record(ElapsedNs(parse_start, parse_end));
+    if (!statement.ok()) {
+        digest.errors.Add(1);
+        return statement.status();
+    }
+
+    substrait::Plan plan = std::visit(
+        [](const auto& info) { return converter::ToSubstrait(info); },
+        *statement);
+    digest.convert.Record(ElapsedNs(parse_end, Clock::now()));
+    const uint64_t bytes = plan.ByteSizeLong();
+    digest.plan_bytes_total.Add(bytes);
+    digest.plan_bytes_min.Min(bytes);
+    digest.plan_bytes_max.Max(bytes);
+    return plan;
+}
+
+std::vector<DigestSnapshot> DigestStats::Snapshot() const {
+    struct Merged {
+        DigestSnapshot snapshot;
+        MergedLatency parse;
+        MergedLatency convert;
+    };
+    absl::flat_hash_map<uint64_t, Merged> merged;
+    for (const ThreadDigests* thread =
+             this->threads_.load(std::memory_order_acquire);
+         thread != nullptr; thread = thread->next) {
+        for (const Digest* digest =
+                 thread->head.load(std::memory_order_acquire);
+             digest != nullptr; digest = digest->next) {
+            auto [it, inserted] = merged.try_emplace(digest->fingerprint);
+            DigestSnapshot& snapshot = it->second.snapshot;
+            if (inserted) {
+                snapshot.fingerprint = digest->fingerprint;
+                snapshot.normalized_sql = digest->normalized_sql;
+                snapshot.plan_bytes_min = std::numeric_limits<uint64_t>::max();
+            }
+            snapshot.calls += digest->calls.load();
+            snapshot.errors += digest->errors.load();
+            snapshot.plan_bytes_total += digest->plan_bytes_total.load();
+            snapshot.plan_bytes_min =
+                std::min(snapshot.plan_bytes_min, digest->plan_bytes_min.load());
+            snapshot.plan_bytes_max =
+                std::max(snapshot.plan_bytes_max, digest->plan_bytes_max.load());
+            it->second.parse.Merge(digest->parse);
+            it->second.convert.Merge(digest->convert);
+        }
+    }
+
+    std::vector<DigestSnapshot> snapshots;
+    snapshots.reserve(merged.size());
+    for (auto& [fingerprint, entry] : merged) {
+        entry.snapshot.parse = entry.parse.Finish();
+        entry.snapshot.convert = entry.convert.Finish();
+        if (entry.snapshot.plan_bytes_min ==
+            std::numeric_limits<uint64_t>::max()) {
+            entry.snapshot.plan_bytes_min = 0;
+        }
+        snapshots.push_back(std::move(entry.snapshot));
+    }
+    std::sort(snapshots.begin(), snapshots.end(),
+              [](const DigestSnapshot& lhs, const DigestSnapshot& rhs) {
+                  return lhs.parse.total_ns + lhs.convert.total_ns >
+                         rhs.parse.total_ns + rhs.convert.total_ns;
+              });
+    return snapshots;
+}
+
+std::vector<DigestSnapshot> DigestStats::Top(size_t n) const {
+    std::vector<DigestSnapshot> snapshots = this->Snapshot();
+    if (snapshots.size() > n) {
+        snapshots.resize(n);
+    }
+    return snapshots;
+}
+
+}  // namespace pink_perilla
@@ -0,0 +1,125 @@
+#include "detail/expression.hpp"
+
+#include <array>
+
+#include "absl/strings/ascii.h"
+#include "absl/strings/match.h"
+#include "absl/strings/numbers.h"
+
+using pink_perilla::DataType;
+
+namespace {
+
+struct TypeName {
+    std::string_view name;
+    DataType type;
+};
+
+constexpr std::array<TypeName, 26> kTypeNames = {{
+    {"BOOLEAN", DataType::kBoolean},
+    {"BOOL", DataType::kBoolean},
+    {"TINYINT", DataType::kI8},
+    {"SMALLINT", DataType::kI16},
+    {"INT2", DataType::kI16},
+    {"INT", DataType::kI32},
+    {"INTEGER", DataType::kI32},
+    {"INT4", DataType::kI32},
+    {"BIGINT", DataType::kI64},
+    {"INT8", DataType::kI64},
+    {"REAL", DataType::kFp32},
+    {"FLOAT4", DataType::kFp32},
+    {"FLOAT", DataType::kFp64},
+    {"FLOAT8", DataType::kFp64},
+    {"DOUBLE", DataType::kFp64},
+    {"TEXT", DataType::kString},
+    {"STRING", DataType::kString},
+    {"VARCHAR", DataType::kVarChar},
+    {"CHAR", DataType::kFixedChar},
+    {"BINARY", DataType::kBinary},
+    {"BYTEA", DataType::kBinary},
+    {"DATE", DataType::kDate},
+    {"TIME", DataType::kTime},
+    {"TIMESTAMP", DataType::kTimestamp},
+    {"DECIMAL", DataType::kDecimal},
+    {"NUMERIC", DataType::kDecimal},
+}};
+
+}  // namespace
+
+std::optional<TypeSpec> ParseTypeSpec(std::string_view type_name) {
+    type_name = absl::StripAsciiWhitespace(type_name);
+    const size_t paren = type_name.find('(');
+    const std::string_view name =
+        absl::StripAsciiWhitespace(type_name.substr(0, paren));
+
+    TypeSpec spec;
+    for (const TypeName& entry : kTypeNames) {
+        if (absl::EqualsIgnoreCase(entry.name, name)) {
+            spec.type = entry.type;
+            break;
+        }
+    }
+    if (spec.type == DataType::kUnknown) {
+        return std::nullopt;
+    }
+
+    std::vector<int32_t> params;
+    if (paren != std::string_view::npos) {
+        if (type_name.back() != ')') {
+            return std::nullopt;
+        }
+        std::string_view inner =
+            type_name.substr(paren + 1, type_name.size() - paren - 2);
+        while (true) {
+            const size_t comma = inner.find(',');
+            int32_t value;
+            if (!absl::SimpleAtoi(inner.substr(0, comma), &value) ||
+                value < 0) {
+                return std::nullopt;
+            }
+            params.push_back(value);
+            if (comma == std::string_view::npos) {
+                break;
+            }
+            inner.remove_prefix(comma + 1);
+        }
+    }
+
+    switch (spec.type) {
+        case DataType::kVarChar:
+        case DataType::kFixedChar:
+            if (params.size() > 1) {
+                return std::nullopt;
+            }
+            // A bare CHAR is CHAR(1); a bare VARCHAR has no limit.
+            if (!params.empty()) {
+                spec.length = params[0];
+            } else if (spec.type == DataType::kFixedChar) {
+                spec.length = 1;
+            } else {
+                spec.type = DataType::kString;
+            }
+            break;
+        case DataType::kDecimal:
+            if (params.size() > 2) {
+                return std::nullopt;
+            }
+            spec.precision = params.empty() ? 38 : params[0];
+            spec.scale = params.size() < 2 ? 0 : params[1];
+            break;
+        default:
+            if (!params.empty()) {
+                return std::nullopt;
+            }
+            break;
+    }
+    return spec;
+}
+
+bool IsAggregateFunction(std::string_view name) {
+    return absl::EqualsIgnoreCase(name, "count") ||
+           absl::EqualsIgnoreCase(name, "sum") ||
+           absl::EqualsIgnoreCase(name, "avg") ||
+           absl::EqualsIgnoreCase(name, "min") ||
+           absl::EqualsIgnoreCase(name, "max");
+}
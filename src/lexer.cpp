@@ -0,0 +1,57 @@
+#include "detail/lexer.hpp"
+
+#include "absl/strings/str_cat.h"
+#include "detail/cancellation.hpp"
+#include "detail/structural_index.hpp"
+
+namespace pink_perilla::lexer {
+
+namespace {
+
+// Tokens between two checks for cancellation and the deadline: a few
+// microseconds of scanning.
+constexpr size_t kTokensPerCheckpoint = 4096;
+
+}  // anonymous namespace
+
+absl::StatusOr<std::pmr::vector<Token>> Tokenize(
+    std::string_view sql, std::pmr::memory_resource* resource) {
+    // Whitespace, comments, quoted literals and identifier runs are resolved
+    // up front, so the loop below only ever lands on token starts.
+    absl::StatusOr<StructuralIndex> index_status =
+        StructuralIndex::Build(sql, DetectScanKernel(), resource);
+    if (!index_status.ok()) {
+        return index_status.status();
+    }
+    const StructuralIndex &index = *index_status;
+
+    std::pmr::vector<Token> tokens(resource);
+    // Typical statements average one token per five or six bytes.
+    tokens.reserve(sql.size() / 4 + 2);
+
+    const size_t n = sql.size();
+    for (size_t i = index.NextSignificant(0); i < n;
+         i = index.NextSignificant(i)) {
+        Token token;
+        size_t end;
+        if (!internal::ScanToken(
+                sql, i, [&index](size_t pos) { return index.WordEnd(pos); },
+                [&index](size_t pos) { return index.QuoteEnd(pos); }, &token,
+                &end)) {
+            return absl::InvalidArgumentError(
+                absl::StrCat("Unexpected character '", sql.substr(i, 1),
+                             "' at offset ", i));
+        }
+        tokens.push_back(token);
+        if (tokens.size() % kTokensPerCheckpoint == 0 &&
+            pink_perilla::detail::Interrupted()) {
+            return pink_perilla::detail::InterruptionError();
+        }
+        i = end;
+    }
+
+    tokens.push_back(Token{TokenType::kEnd, Keyword::kNone, sql.substr(n)});
+    return tokens;
+}
+
+}  // namespace pink_perilla::lexer
@@ -0,0 +1,221 @@
+#include "detail/literal.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <limits>
+
+namespace pink_perilla::literal {
+
+namespace {
+
+constexpr int kMaxDecimalDigits = 38;
+
+bool IsDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+// Exactly `count` digits of `text` starting at `*pos`, advancing past them.
+std::optional<int> Digits(std::string_view text, size_t* pos, size_t count) {
+    if (*pos + count > text.size()) {
+        return std::nullopt;
+    }
+    int value = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const char c = text[*pos + i];
+        if (!IsDigit(c)) {
+            return std::nullopt;
+        }
+        value = value * 10 + (c - '0');
+    }
+    *pos += count;
+    return value;
+}
+
+bool Consume(std::string_view text, size_t* pos, char c) {
+    if (*pos < text.size() && text[*pos] == c) {
+        ++*pos;
+        return true;
+    }
+    return false;
+}
+
+bool IsLeapYear(int year) {
+    return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+}
+
+int DaysInMonth(int year, int month) {
+    static constexpr int kDays[] = {31, 28, 31, 30, 31, 30,
+                                    31, 31, 30, 31, 30, 31};
+    return month == 2 && IsLeapYear(year) ? 29 : kDays[month - 1];
+}
+
+// Days from 1970-01-01 to a proleptic Gregorian date; see
+// http://howardhinnant.github.io/date_algorithms.html#days_from_civil.
+int64_t DaysFromCivil(int year, int month, int day) {
+    year -= month <= 2;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const int64_t year_of_era = year - era * 400;
+    const int64_t day_of_year =
+        (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const int64_t day_of_era =
+        year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + day_of_era - 719468;
+}
+
+// Parses the date at the start of `text` into *days, advancing *pos.
+bool ParseDatePrefix(std::string_view text, size_t* pos, int64_t* days) {
+    const std::optional<int> year = Digits(text, pos, 4);
+    if (!year || !Consume(text, pos, '-')) {
+        return false;
+    }
+    const std::optional<int> month = Digits(text, pos, 2);
+    if (!month || *month < 1 || *month > 12 || !Consume(text, pos, '-')) {
+        return false;
+    }
+    const std::optional<int> day = Digits(text, pos, 2);
+    if (!day || *day < 1 || *day > DaysInMonth(*year, *month)) {
+        return false;
+    }
+    *days = DaysFromCivil(*year, *month, *day);
+    return true;
+}
+
+}  // anonymous namespace
+
+std::optional<int64_t> ParseInteger(std::string_view digits, bool negated) {
+    uint64_t magnitude = 0;
+    const char* end = digits.data() + digits.size();
+    const auto [ptr, error] = std::from_chars(digits.data(), end, magnitude);
+    if (error != std::errc() || ptr != end) {
+        return std::nullopt;
+    }
+    constexpr uint64_t kMax = std::numeric_limits<int64_t>::max();
+    if (negated) {
+        if (magnitude > kMax + 1) {
+            return std::nullopt;
+        }
+        // Negating in unsigned arithmetic keeps INT64_MIN well defined.
+        return static_cast<int64_t>(0 - magnitude);
+    }
+    if (magnitude > kMax) {
+        return std::nullopt;
+    }
+    return static_cast<int64_t>(magnitude);
+}
+
+std::optional<double> ParseDouble(std::string_view text, bool negated) {
+    double value = 0;
+    const char* end = text.data() + text.size();
+    const auto [ptr, error] = std::from_chars(text.data(), end, value);
+    // Out-of-range text is still a number; from_chars leaves `value` alone
+    // for it, so report the overflow as infinity like strtod does.
+    if (error == std::errc::result_out_of_range && ptr == end) {
+        value = std::numeric_limits<double>::infinity();
+    } else if (error != std::errc() || ptr != end) {
+        return std::nullopt;
+    }
+    return negated ? -value : value;
+}
+
+std::optional<Decimal> ParseDecimal(std::string_view text, bool negated) {
+    Decimal decimal;
+    int digits = 0;
+    bool fraction = false;
+    for (const char c : text) {
+        if (c == '.' && !fraction) {
+            fraction = true;
+            continue;
+        }
+        if (!IsDigit(c)) {
+            return std::nullopt;
+        }
+        if (fraction) {
+            ++decimal.scale;
+        }
+        // Leading zeros of the integer part are not significant.
+        if (digits == 0 && c == '0' && !fraction) {
+            continue;
+        }
+        if (++digits > kMaxDecimalDigits) {
+            return std::nullopt;
+        }
+        decimal.value = decimal.value * 10 + (c - '0');
+    }
+    if (decimal.scale > kMaxDecimalDigits) {
+        return std::nullopt;
+    }
+    decimal.precision = std::max({digits, decimal.scale, 1});
+    if (negated) {
+        decimal.value = -decimal.value;
+    }
+    return decimal;
+}
+
+std::string DecimalBytes(const Decimal& decimal) {
+    const absl::uint128 bits = static_cast<absl::uint128>(decimal.value);
+    const uint64_t low = absl::Uint128Low64(bits);
+    const uint64_t high = absl::Uint128High64(bits);
+    std::string bytes(16, '\0');
+    for (int i = 0; i < 8; ++i) {
+        bytes[i] = static_cast<char>(low >> (8 * i));
+        bytes[8 + i] = static_cast<char>(high >> (8 * i));
+    }
+    return bytes;
+}
+
+std::optional<int32_t> ParseDate(std::string_view text) {
+    size_t pos = 0;
+    int64_t days;
+    if (!ParseDatePrefix(text, &pos, &days) || pos != text.size()) {
+        return std::nullopt;
+    }
+    return static_cast<int32_t>(days);
+}
+
+std::optional<int64_t> ParseTimestamp(std::string_view text) {
+    size_t pos = 0;
+    int64_t days;
+    if (!ParseDatePrefix(text, &pos, &days)) {
+        return std::nullopt;
+    }
+    int64_t micros = days * 86400 * 1000000;
+    if (pos == text.size()) {
+        return micros;
+    }
+    if (!Consume(text, &pos, ' ') && !Consume(text, &pos, 'T')) {
+        return std::nullopt;
+    }
+    const std::optional<int> hour = Digits(text, &pos, 2);
+    if (!hour || *hour > 23 || !Consume(text, &pos, ':')) {
+        return std::nullopt;
+    }
+    const std::optional<int> minute = Digits(text, &pos, 2);
+    if (!minute || *minute > 59 || !Consume(text, &pos, ':')) {
+        return std::nullopt;
+    }
+    const std::optional<int> second = Digits(text, &pos, 2);
+    if (!second || *second > 59) {
+        return std::nullopt;
+    }
+    micros += ((*hour * 60 + *minute) * 60 + *second) * int64_t{1000000};
+    if (Consume(text, &pos, '.')) {
+        int64_t fraction = 0;
+        int64_t unit = 100000;
+        const size_t begin = pos;
+        for (; pos < text.size() && IsDigit(text[pos]); ++pos) {
+            // Digits past microseconds are truncated.
+            fraction += (text[pos] - '0') * unit;
+            unit /= 10;
+        }
+        if (pos == begin) {
+            return std::nullopt;
+        }
+        micros += fraction;
+    }
+    if (pos != text.size()) {
+        return std::nullopt;
+    }
+    return micros;
+}
+
+}  // namespace pink_perilla::literal
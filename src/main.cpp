@@ -1,16 +1,369 @@
+#include <unistd.h>
+
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "absl/status/statusor.h"
+#include "absl/strings/match.h"
+#include "digest_stats.hpp"
+#include "google/protobuf/io/zero_copy_stream_impl.h"
+#include "google/protobuf/util/delimited_message_util.h"
 #include "google/protobuf/util/json_util.h"
 #include "pink_perilla.hpp"
+#include "script_reader.hpp"
 #include "substrait/plan.pb.h"
 
+#ifdef __linux__
+#include <csignal>
+
+#include "plan_server.hpp"
+#endif
+
+namespace {
+
+// Writes one line per query shape to stderr, most planning time first.
+void PrintDigests(const pink_perilla::DigestStats& stats, size_t top) {
+    for (const pink_perilla::DigestSnapshot& digest : stats.Top(top)) {
+        std::cerr << "calls=" << digest.calls << " errors=" << digest.errors
+                  << " parse_ns(total/min/max/p99)=" << digest.parse.total_ns
+                  << "/" << digest.parse.min_ns << "/" << digest.parse.max_ns
+                  << "/" << digest.parse.p99_ns
+                  << " convert_ns(total/min/max/p99)="
+                  << digest.convert.total_ns << "/" << digest.convert.min_ns
+                  << "/" << digest.convert.max_ns << "/"
+                  << digest.convert.p99_ns
+                  << " plan_bytes(total/min/max)=" << digest.plan_bytes_total
+                  << "/" << digest.plan_bytes_min << "/"
+                  << digest.plan_bytes_max << " sql=" << digest.normalized_sql
+                  << std::endl;
+    }
+}
+
+void PrintStats(const pink_perilla::PlanningStats& stats) {
+    std::cerr << "tokenize_ns=" << stats.tokenize_ns
+              << " parse_ns=" << stats.parse_ns
+              << " convert_ns=" << stats.convert_ns
+              << " heap_allocations=" << stats.heap_allocations
+              << " heap_bytes=" << stats.heap_bytes
+              << " tokens=" << stats.tokens << " ir_nodes=" << stats.ir_nodes
+              << " plan_bytes=" << stats.plan_bytes << std::endl;
+}
+
+enum class OutputFormat {
+    // One indented JSON document per plan.
+    kJson,
+    // One compact JSON object per line.
+    kJsonLines,
+    // Varint-length-prefixed binary substrait::Plan messages.
+    kBinaryDelimited,
+};
+
+std::optional<OutputFormat> ParseFormat(std::string_view name) {
+    if (name == "json") {
+        return OutputFormat::kJson;
+    }
+    if (name == "jsonl") {
+        return OutputFormat::kJsonLines;
+    }
+    if (name == "binary-delimited") {
+        return OutputFormat::kBinaryDelimited;
+    }
+    return std::nullopt;
+}
+
+// Writes plans to stdout in one format. Binary output goes straight from the
+// serializer into the stream's buffer, with no intermediate string.
+class PlanWriter {
+public:
+    explicit PlanWriter(OutputFormat format)
+        : format_(format), stdout_(STDOUT_FILENO) {
+        this->json_options_.add_whitespace = format == OutputFormat::kJson;
+    }
+    ~PlanWriter() { this->Flush(); }
+
+    OutputFormat format() const { return this->format_; }
+
+    // Returns false if the plan could not be written.
+    bool Write(const substrait::Plan& plan) {
+        if (this->format_ == OutputFormat::kBinaryDelimited) {
+            return google::protobuf::util::SerializeDelimitedToZeroCopyStream(
+                plan, &this->stdout_);
+        }
+        this->json_.clear();
+        if (!google::protobuf::util::MessageToJsonString(plan, &this->json_,
+                                                         this->json_options_)
+                 .ok()) {
+            return false;
+        }
+        std::cout << this->json_ << '\n';
+        return true;
+    }
+
+    void Flush() {
+        if (this->format_ == OutputFormat::kBinaryDelimited) {
+            this->stdout_.Flush();
+        } else {
+            std::cout.flush();
+        }
+    }
+
+private:
+    const OutputFormat format_;
+    google::protobuf::io::FileOutputStream stdout_;
+    google::protobuf::util::JsonPrintOptions json_options_;
+    std::string json_;
+};
+
+// Plans `sql` with pink_perilla::ParseChunked(), writing every plan it
+// yields: several for a multi-row INSERT longer than the chunk size.
+absl::Status WriteChunked(std::string_view sql, PlanWriter& writer,
+                          const pink_perilla::ParseOptions& options) {
+    return pink_perilla::ParseChunked(
+        sql, pink_perilla::Catalog({}), options,
+        [&writer](const substrait::Plan& plan) {
+            return writer.Write(plan)
+                       ? absl::OkStatus()
+                       : absl::InternalError("Failed to write plan.");
+        });
+}
+
+// Writes the plan of the script statement at `offset`, or reports to stderr
+// why planning it failed and sets `exit_code`. In the streaming formats a
+// failed statement still gets a record, an empty plan, so the Nth record
+// always answers the Nth statement. Returns false if writing failed.
+bool WriteScriptPlan(uint64_t offset,
+                     const absl::StatusOr<substrait::Plan>& plan,
+                     PlanWriter& writer, int* exit_code) {
+    if (!plan.ok()) {
+        std::cerr << "offset " << offset << ": " << plan.status().message()
+                  << std::endl;
+        *exit_code = 1;
+        if (writer.format() != OutputFormat::kJson) {
+            writer.Write(substrait::Plan());
+        }
+        return true;
+    }
+    if (!writer.Write(*plan)) {
+        std::cerr << "Failed to write plan." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Plans every statement of the script at `path` ("-" for stdin) as it is
+// read, writing each plan and reporting each failure, with its byte offset, to
+// stderr. With `digest_top`, statements are planned through DigestStats and
+// the costliest shapes are reported once the script is done. Returns the
+// process exit code.
+int PlanScript(const std::string& path, PlanWriter& writer,
+               const pink_perilla::ParseOptions& options,
+               std::optional<size_t> digest_top) {
+    std::unique_ptr<pink_perilla::ScriptReader> reader;
+    const bool from_stdin = path == "-";
+    if (from_stdin) {
+        reader = std::make_unique<pink_perilla::ScriptReader>(std::cin);
+    } else {
+        absl::StatusOr<std::unique_ptr<pink_perilla::ScriptReader>> opened =
+            pink_perilla::ScriptReader::Open(path);
+        if (!opened.ok()) {
+            std::cerr << opened.status().message() << std::endl;
+            return 1;
+        }
+        reader = *std::move(opened);
+    }
+
+    const pink_perilla::Catalog catalog({});
+    const bool streaming = writer.format() != OutputFormat::kJson;
+    int exit_code = 0;
+    if (options.insert_chunk_rows > 0) {
+        while (std::optional<pink_perilla::ScriptStatement> statement =
+                   reader->Next()) {
+            if (absl::Status status =
+                    WriteChunked(statement->sql, writer, options);
+                !status.ok()) {
+                std::cerr << "offset " << statement->offset << ": "
+                          << status.message() << std::endl;
+                exit_code = 1;
+                if (streaming) {
+                    writer.Write(substrait::Plan());
+                }
+            }
+            if (from_stdin && std::cin.rdbuf()->in_avail() <= 0) {
+                writer.Flush();
+            }
+        }
+        if (!reader->status().ok()) {
+            std::cerr << reader->status().message() << std::endl;
+            return 1;
+        }
+        return exit_code;
+    }
+
+    if (digest_top) {
+        pink_perilla::DigestStats digests;
+        while (std::optional<pink_perilla::ScriptStatement> statement =
+                   reader->Next()) {
+            if (!WriteScriptPlan(statement->offset,
+                                 digests.Parse(statement->sql, catalog),
+                                 writer, &exit_code)) {
+                return 1;
+            }
+            if (from_stdin && std::cin.rdbuf()->in_avail() <= 0) {
+                writer.Flush();
+            }
+        }
+        writer.Flush();
+        PrintDigests(digests, *digest_top);
+    } else {
+        pink_perilla::ScriptPlanner planner(*reader, catalog, options);
+        while (std::optional<absl::StatusOr<substrait::Plan>> plan =
+                   planner.Next()) {
+            if (options.collect_stats) {
+                std::cerr << "offset " << planner.statement().offset << ": ";
+                PrintStats(planner.stats());
+            }
+            if (!WriteScriptPlan(planner.statement().offset, *plan, writer,
+                                 &exit_code)) {
+                return 1;
+            }
+            // A caller feeding stdin may wait for each answer before sending
+            // the next statement, so flush whenever no more input is
+            // buffered.
+            if (from_stdin && std::cin.rdbuf()->in_avail() <= 0) {
+                writer.Flush();
+            }
+        }
+    }
+    if (!reader->status().ok()) {
+        std::cerr << reader->status().message() << std::endl;
+        return 1;
+    }
+    return exit_code;
+}
+
+#ifdef __linux__
+pink_perilla::PlanServer* serving = nullptr;
+
+void StopServing(int) {
+    serving->Shutdown();
+}
+
+// Answers plan requests on the Unix domain socket at `path` until SIGINT or
+// SIGTERM. Returns the process exit code.
+int Serve(const std::string& path, size_t threads, size_t timeout_ms) {
+    const pink_perilla::CatalogHandle catalog(
+        std::make_shared<const pink_perilla::Catalog>(
+            std::vector<pink_perilla::TableDefinition>{}));
+    pink_perilla::PlanServerOptions options;
+    if (threads > 0) {
+        options.threads = threads;
+    }
+    options.request_timeout = std::chrono::milliseconds(timeout_ms);
+    absl::StatusOr<std::unique_ptr<pink_perilla::PlanServer>> server =
+        pink_perilla::PlanServer::Listen(path, catalog, options);
+    if (!server.ok()) {
+        std::cerr << server.status().message() << std::endl;
+        return 1;
+    }
+    serving = server->get();
+    struct sigaction action = {};
+    action.sa_handler = StopServing;
+    sigaction(SIGINT, &action, nullptr);
+    sigaction(SIGTERM, &action, nullptr);
+    std::cerr << "Serving plans on " << path << std::endl;
+    if (absl::Status status = (*server)->Run(); !status.ok()) {
+        std::cerr << status.message() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+#endif
+
+}  // namespace
+
 int main(int argc, char* argv[]) {
+    std::ios::sync_with_stdio(false);
     std::string sql;
-    if (argc > 2 && std::string(argv[1]) == "--sql") {
-        sql = argv[2];
-    } else {
+    bool have_sql = false;
+    // --digest-top N: after planning the statement or script, dump the N
+    // costliest query shapes.
+    std::optional<size_t> digest_top;
+    // --script PATH: plan every statement of a file, or of stdin with "-".
+    std::optional<std::string> script;
+    // --format=json|jsonl|binary-delimited. The streaming formats read
+    // statements from stdin until it closes unless --sql or --script is given.
+    OutputFormat format = OutputFormat::kJson;
+    // --stats: write per-phase timings and counts for each statement to
+    // stderr.
+    // --insert-chunk-rows N: write a multi-row INSERT as a sequence of plans
+    // of at most N rows each. Not combined with --stats or --digest-top.
+    pink_perilla::ParseOptions options;
+    // --serve PATH: run as a daemon answering requests on a Unix domain
+    // socket (Linux only), planning on --threads N workers. With
+    // --timeout-ms N, requests not planned within N ms of arriving are
+    // answered with kDeadlineExceeded.
+    std::optional<std::string> serve;
+    size_t threads = 0;
+    size_t timeout_ms = 0;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--sql" && i + 1 < argc) {
+            sql = argv[++i];
+            have_sql = true;
+        } else if (arg == "--digest-top" && i + 1 < argc) {
+            digest_top = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--stats") {
+            options.collect_stats = true;
+        } else if (arg == "--insert-chunk-rows" && i + 1 < argc) {
+            options.insert_chunk_rows = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--serve" && i + 1 < argc) {
+            serve = argv[++i];
+        } else if (arg == "--threads" && i + 1 < argc) {
+            threads = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--timeout-ms" && i + 1 < argc) {
+            timeout_ms = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--script" && i + 1 < argc) {
+            script = argv[++i];
+        } else if (absl::StartsWith(arg, "--format=")) {
+            std::optional<OutputFormat> parsed =
+                ParseFormat(std::string_view(arg).substr(strlen("--format=")));
+            if (!parsed) {
+                std::cerr << "Unknown format: " << arg << std::endl;
+                return 1;
+            }
+            format = *parsed;
+        } else {
+            std::cerr << "Unknown argument: " << arg << std::endl;
+            return 1;
+        }
+    }
+    if (serve) {
+#ifdef __linux__
+        return Serve(*serve, threads, timeout_ms);
+#else
+        std::cerr << "--serve is only supported on Linux." << std::endl;
+        return 1;
+#endif
+    }
+    if (digest_top && options.insert_chunk_rows > 0) {
+        std::cerr << "--digest-top cannot be combined with --insert-chunk-rows."
+                  << std::endl;
+        return 1;
+    }
+    PlanWriter writer(format);
+    if (script) {
+        return PlanScript(*script, writer, options, digest_top);
+    }
+    if (!have_sql && format != OutputFormat::kJson) {
+        return PlanScript("-", writer, options, digest_top);
+    }
+    if (!have_sql) {
         std::getline(std::cin, sql);
     }
 
@@ -19,24 +372,36 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(sql);
+    if (options.insert_chunk_rows > 0) {
+        if (absl::Status status = WriteChunked(sql, writer, options);
+            !status.ok()) {
+            std::cerr << status.message() << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    pink_perilla::DigestStats digests;
+    pink_perilla::PlanningStats stats;
+    absl::StatusOr<substrait::Plan> plan =
+        digest_top ? digests.Parse(sql)
+                   : pink_perilla::Parse(sql, pink_perilla::Catalog({}),
+                                         options, &stats);
+    if (digest_top) {
+        PrintDigests(digests, *digest_top);
+    } else if (options.collect_stats) {
+        PrintStats(stats);
+    }
 
     if (!plan.ok()) {
         std::cerr << plan.status().message() << std::endl;
         return 1;
     }
 
-    std::string json_output;
-    google::protobuf::util::JsonPrintOptions options;
-    options.add_whitespace = true;
-    if (google::protobuf::util::MessageToJsonString(*plan, &json_output, options).ok()) {
-        std::cout << json_output << std::endl;
-    } else {
+    if (!writer.Write(*plan)) {
         std::cerr << "Failed to parse JSON string." << std::endl;
         return 1;
     }
 
-    std::cout << json_output << std::endl;
-
     return 0;
 }
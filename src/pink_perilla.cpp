@@ -2,38 +2,377 @@
 
 #include <substrait/plan.pb.h>
 
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+#include "absl/strings/str_cat.h"
+#include "absl/synchronization/blocking_counter.h"
+#include "detail/arena.hpp"
+#include "detail/cancellation.hpp"
+#include "detail/heap_counter.hpp"
 #include "detail/sql_parser.hpp"
 #include "detail/substrait_converter.hpp"
 
 namespace pink_perilla {
 
+namespace detail {
+thread_local HeapCounter thread_heap_counter;
+thread_local const std::atomic<bool>* thread_cancellation = nullptr;
+thread_local const ParseOptions* thread_limits = nullptr;
+thread_local uint32_t thread_deadline_countdown = 1;
+}  // namespace detail
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+uint64_t ElapsedNs(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+        .count();
+}
+
+// Calls `convert` with the statement's concrete alternative.
+template <typename Convert>
+auto Dispatch(const Statement& statement, Convert convert)
+    -> absl::StatusOr<decltype(convert(std::declval<const SelectInfo&>()))> {
+    if (std::holds_alternative<CreateTableInfo>(statement)) {
+        return convert(std::get<CreateTableInfo>(statement));
+    }
+    if (std::holds_alternative<DropTableInfo>(statement)) {
+        return convert(std::get<DropTableInfo>(statement));
+    }
+    if (std::holds_alternative<DeleteInfo>(statement)) {
+        return convert(std::get<DeleteInfo>(statement));
+    }
+    if (std::holds_alternative<SelectInfo>(statement)) {
+        return convert(std::get<SelectInfo>(statement));
+    }
+    if (std::holds_alternative<InsertInfo>(statement)) {
+        return convert(std::get<InsertInfo>(statement));
+    }
+    if (std::holds_alternative<UpdateInfo>(statement)) {
+        return convert(std::get<UpdateInfo>(statement));
+    }
+    if (std::holds_alternative<CopyInfo>(statement)) {
+        return convert(std::get<CopyInfo>(statement));
+    }
+    return absl::Status(absl::StatusCode::kInternal, "Unknown statement type");
+}
+
+template <typename Info>
+uint64_t CountNodes(const Info& info) {
+    return info.expressions.nodes.size();
+}
+
+uint64_t CountNodes(const SelectInfo& info) {
+    return info.expressions.nodes.size() +
+           (info.from_subquery ? CountNodes(**info.from_subquery) : 0);
+}
+
+uint64_t CountNodes(const CreateTableInfo&) {
+    return 0;
+}
+
+uint64_t CountNodes(const DropTableInfo&) {
+    return 0;
+}
+
+uint64_t CountNodes(const CopyInfo&) {
+    return 0;
+}
+
+const substrait::Plan& PlanOf(const substrait::Plan& plan) {
+    return plan;
+}
+
+const substrait::Plan& PlanOf(const substrait::Plan* plan) {
+    return *plan;
+}
+
+// Fails if `plan` would serialize to more than the planning's
+// max_plan_bytes. Without that limit the plan is not measured.
+absl::Status CheckPlanBytes(const substrait::Plan& plan) {
+    const size_t max_bytes = detail::MaxPlanBytes();
+    if (max_bytes != 0 && plan.ByteSizeLong() > max_bytes) {
+        return absl::ResourceExhaustedError(
+            absl::StrCat("Plan is larger than ", max_bytes, " bytes"));
+    }
+    return absl::OkStatus();
+}
+
+// What planning returns once the converter is done with `result`. The
+// converter stops early when interrupted or over the plan size limit,
+// leaving a partial plan that must not be handed out.
+template <typename Plan>
+absl::StatusOr<Plan> FinishConversion(absl::StatusOr<Plan> result) {
+    if (detail::Interrupted()) {
+        return detail::InterruptionError();
+    }
+    if (result.ok()) {
+        if (absl::Status status = CheckPlanBytes(PlanOf(*result));
+            !status.ok()) {
+            return status;
+        }
+    }
+    return result;
+}
+
+// Parses `sql` and hands the IR to `convert`, which is called with the
+// statement's concrete alternative. The IR only lives until it has been
+// converted, so it borrows from `sql` and draws from `arena`, which the caller
+// may reset as soon as this returns. With `stats`, each phase is timed and
+// counted; without, nothing is.
+template <typename Convert>
+auto ParseAndConvert(std::string_view sql, const Catalog& catalog,
+                     StatementArena& arena, Convert convert,
+                     PlanningStats* stats = nullptr)
+    -> absl::StatusOr<decltype(convert(std::declval<const SelectInfo&>()))> {
+    if (stats == nullptr) {
+        absl::StatusOr<Statement> plan =
+            SqlParser::Parse(sql, catalog, arena.resource());
+        if (!plan.ok()) {
+            return plan.status();
+        }
+        return FinishConversion(Dispatch(*plan, convert));
+    }
+
+    const detail::HeapCounter heap_before = detail::thread_heap_counter;
+    const Clock::time_point parse_start = Clock::now();
+    absl::StatusOr<Statement> plan =
+        SqlParser::Parse(sql, catalog, arena.resource(), stats);
+    const Clock::time_point parse_end = Clock::now();
+    stats->parse_ns = ElapsedNs(parse_start, parse_end) - stats->tokenize_ns;
+    const auto record_heap = [&] {
+        stats->heap_allocations =
+            detail::thread_heap_counter.allocations - heap_before.allocations;
+        stats->heap_bytes =
+            detail::thread_heap_counter.bytes - heap_before.bytes;
+    };
+    if (!plan.ok()) {
+        record_heap();
+        return plan.status();
+    }
+    stats->ir_nodes =
+        std::visit([](const auto& info) { return CountNodes(info); }, *plan);
+    auto result = Dispatch(*plan, convert);
+    stats->convert_ns = ElapsedNs(parse_end, Clock::now());
+    record_heap();
+    return FinishConversion(std::move(result));
+}
+
+// Same as ParseAndConvert() without stats, for a statement PP_SQL has
+// already tokenized.
+template <typename Convert>
+auto ParseCompiledAndConvert(const CompiledSql& sql, const Catalog& catalog,
+                             StatementArena& arena, Convert convert)
+    -> absl::StatusOr<decltype(convert(std::declval<const SelectInfo&>()))> {
+    absl::StatusOr<Statement> plan =
+        SqlParser::Parse(sql.sql(), sql.tokens(), catalog, arena.resource());
+    if (!plan.ok()) {
+        return plan.status();
+    }
+    return FinishConversion(Dispatch(*plan, convert));
+}
+
+}  // namespace
+
 // --- Main Parse Function ---
 absl::StatusOr<substrait::Plan> Parse(
     std::string_view sql,
     const std::vector<TableDefinition>& table_definitions) {
-    absl::StatusOr<Statement> plan = SqlParser::Parse(sql, table_definitions);
-    if (!plan.ok()) {
-        return absl::Status(absl::StatusCode::kInternal, "Failed to parse SQL");
+    StatementArena arena;
+    return ParseAndConvert(sql, Catalog::Borrow(table_definitions), arena,
+                           [](const auto& info) {
+                               return converter::ToSubstrait(info);
+                           });
+}
+
+absl::StatusOr<substrait::Plan*> Parse(
+    std::string_view sql,
+    const std::vector<TableDefinition>& table_definitions,
+    google::protobuf::Arena* arena) {
+    StatementArena statement_arena;
+    return ParseAndConvert(sql, Catalog::Borrow(table_definitions), statement_arena,
+                           [arena](const auto& info) {
+                               return converter::ToSubstrait(info, arena);
+                           });
+}
+
+absl::StatusOr<substrait::Plan> Parse(std::string_view sql,
+                                      const Catalog& catalog) {
+    StatementArena arena;
+    return ParseAndConvert(sql, catalog, arena, [](const auto& info) {
+        return converter::ToSubstrait(info);
+    });
+}
+
+absl::StatusOr<substrait::Plan*> Parse(std::string_view sql,
+                                       const Catalog& catalog,
+                                       google::protobuf::Arena* arena) {
+    StatementArena statement_arena;
+    return ParseAndConvert(sql, catalog, statement_arena,
+                           [arena](const auto& info) {
+                               return converter::ToSubstrait(info, arena);
+                           });
+}
+
+absl::StatusOr<substrait::Plan> Parse(std::string_view sql,
+                                      const Catalog& catalog,
+                                      const ParseOptions& options,
+                                      PlanningStats* stats) {
+    const detail::LimitsScope limits(options);
+    StatementArena arena;
+    const auto convert = [](const auto& info) {
+        return converter::ToSubstrait(info);
+    };
+    if (!options.collect_stats || stats == nullptr) {
+        return ParseAndConvert(sql, catalog, arena, convert);
     }
-    if (std::holds_alternative<CreateTableInfo>(*plan)) {
-        return converter::ToSubstrait(std::get<CreateTableInfo>(*plan));
+    *stats = PlanningStats();
+    absl::StatusOr<substrait::Plan> plan =
+        ParseAndConvert(sql, catalog, arena, convert, stats);
+    if (plan.ok()) {
+        stats->plan_bytes = plan->ByteSizeLong();
     }
-    if (std::holds_alternative<DropTableInfo>(*plan)) {
-        return converter::ToSubstrait(std::get<DropTableInfo>(*plan));
+    return plan;
+}
+
+absl::Status ParseChunked(
+    std::string_view sql, const Catalog& catalog, const ParseOptions& options,
+    absl::FunctionRef<absl::Status(const substrait::Plan&)> sink) {
+    const detail::LimitsScope limits(options);
+    StatementArena arena;
+    absl::StatusOr<Statement> statement =
+        SqlParser::Parse(sql, catalog, arena.resource());
+    if (!statement.ok()) {
+        return statement.status();
     }
-    if (std::holds_alternative<DeleteInfo>(*plan)) {
-        return converter::ToSubstrait(std::get<DeleteInfo>(*plan));
+    google::protobuf::Arena plan_arena;
+    const auto* insert = std::get_if<InsertInfo>(&*statement);
+    if (insert == nullptr || options.insert_chunk_rows == 0) {
+        absl::StatusOr<substrait::Plan*> plan = FinishConversion(
+            Dispatch(*statement, [&plan_arena](const auto& info) {
+                return converter::ToSubstrait(info, &plan_arena);
+            }));
+        if (!plan.ok()) {
+            return plan.status();
+        }
+        return sink(**plan);
     }
-    if (std::holds_alternative<SelectInfo>(*plan)) {
-        return converter::ToSubstrait(std::get<SelectInfo>(*plan));
+    const size_t rows = insert->row_count();
+    for (size_t first = 0; first < rows; first += options.insert_chunk_rows) {
+        const substrait::Plan* plan = converter::ToSubstrait(
+            *insert, first, std::min(options.insert_chunk_rows, rows - first),
+            &plan_arena);
+        if (detail::Interrupted()) {
+            return detail::InterruptionError();
+        }
+        if (absl::Status status = CheckPlanBytes(*plan); !status.ok()) {
+            return status;
+        }
+        if (absl::Status status = sink(*plan); !status.ok()) {
+            return status;
+        }
+        plan_arena.Reset();
     }
-    if (std::holds_alternative<InsertInfo>(*plan)) {
-        return converter::ToSubstrait(std::get<InsertInfo>(*plan));
+    return absl::OkStatus();
+}
+
+ParseHandle ParseAsync(
+    std::string sql, std::shared_ptr<const Catalog> catalog, Executor& executor,
+    std::function<void(absl::StatusOr<substrait::Plan>)> callback) {
+    auto cancelled = std::make_shared<std::atomic<bool>>(false);
+    executor.Schedule([sql = std::move(sql), catalog = std::move(catalog),
+                       callback = std::move(callback), cancelled] {
+        if (cancelled->load(std::memory_order_relaxed)) {
+            callback(detail::CancellationError());
+            return;
+        }
+        absl::StatusOr<substrait::Plan> plan;
+        {
+            const detail::CancellationScope scope(cancelled.get());
+            plan = Parse(sql, *catalog);
+        }
+        callback(std::move(plan));
+    });
+    return ParseHandle(std::move(cancelled));
+}
+
+std::vector<absl::StatusOr<substrait::Plan>> ParseBatch(
+    absl::Span<const std::string_view> statements, const Catalog& catalog,
+    ThreadPool& pool) {
+    std::vector<absl::StatusOr<substrait::Plan>> plans(statements.size());
+    if (statements.empty()) {
+        return plans;
     }
-    if (std::holds_alternative<UpdateInfo>(*plan)) {
-        return converter::ToSubstrait(std::get<UpdateInfo>(*plan));
+    // Enough chunks per worker that stealing can even out slow statements,
+    // few enough that scheduling stays negligible.
+    const size_t chunk = std::clamp<size_t>(
+        statements.size() / (pool.size() * 8), 1, 64);
+    const size_t chunks = (statements.size() + chunk - 1) / chunk;
+    absl::BlockingCounter remaining(static_cast<int>(chunks));
+    for (size_t begin = 0; begin < statements.size(); begin += chunk) {
+        const size_t end = std::min(begin + chunk, statements.size());
+        pool.Schedule([&, begin, end] {
+            StatementArena arena;
+            for (size_t i = begin; i < end; ++i) {
+                plans[i] = ParseAndConvert(statements[i], catalog, arena,
+                                           [](const auto& info) {
+                                               return converter::ToSubstrait(
+                                                   info);
+                                           });
+                arena.Reset();
+            }
+            remaining.DecrementCount();
+        });
     }
-    return absl::Status(absl::StatusCode::kInternal, "Unknown statement type");
+    remaining.Wait();
+    return plans;
+}
+
+absl::StatusOr<PreparedPlan> Prepare(
+    std::string_view sql,
+    const std::vector<TableDefinition>& table_definitions) {
+    return Prepare(sql, Catalog::Borrow(table_definitions));
+}
+
+absl::StatusOr<PreparedPlan> Prepare(std::string_view sql,
+                                     const Catalog& catalog) {
+    absl::StatusOr<substrait::Plan> plan = Parse(sql, catalog);
+    if (!plan.ok()) {
+        return plan.status();
+    }
+    return PreparedPlan::FromPlan(*std::move(plan));
+}
+
+absl::StatusOr<substrait::Plan> Parse(
+    const CompiledSql& sql,
+    const std::vector<TableDefinition>& table_definitions) {
+    return Parse(sql, Catalog::Borrow(table_definitions));
+}
+
+absl::StatusOr<substrait::Plan> Parse(const CompiledSql& sql,
+                                      const Catalog& catalog) {
+    StatementArena arena;
+    return ParseCompiledAndConvert(sql, catalog, arena, [](const auto& info) {
+        return converter::ToSubstrait(info);
+    });
+}
+
+absl::StatusOr<PreparedPlan> Prepare(
+    const CompiledSql& sql,
+    const std::vector<TableDefinition>& table_definitions) {
+    return Prepare(sql, Catalog::Borrow(table_definitions));
+}
+
+absl::StatusOr<PreparedPlan> Prepare(const CompiledSql& sql,
+                                     const Catalog& catalog) {
+    absl::StatusOr<substrait::Plan> plan = Parse(sql, catalog);
+    if (!plan.ok()) {
+        return plan.status();
+    }
+    return PreparedPlan::FromPlan(*std::move(plan));
 }
 
 }  // namespace pink_perilla
@@ -0,0 +1,425 @@
+#include "plan_cache.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/hash/hash.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_replace.h"
+#include "absl/synchronization/mutex.h"
+#include "detail/arena.hpp"
+#include "detail/lexer.hpp"
+#include "detail/literal.hpp"
+#include "detail/sql_parser.hpp"
+#include "detail/substrait_converter.hpp"
+#include "pink_perilla.hpp"
+#include "prepared_plan.hpp"
+
+namespace pink_perilla {
+
+namespace {
+
+using lexer::Token;
+using lexer::TokenType;
+
+// The numeric and string literal tokens of one statement, in source order.
+// A literal's ordinal in this list is the parameter it becomes in the cached
+// plan.
+class LiteralScan {
+public:
+    struct Literal {
+        std::string_view text;
+        // What the binder types the literal as; part of the cache key.
+        DataType type;
+    };
+
+    void Add(std::string_view text, DataType type) {
+        this->literals_.push_back(Literal{text, type});
+    }
+
+    size_t size() const { return this->literals_.size(); }
+    const Literal& operator[](size_t i) const { return this->literals_[i]; }
+
+    // Ordinal of the literal `source` is exactly, or -1 if it is not one.
+    int Find(std::string_view source) const {
+        const size_t i = this->LowerBound(source.data());
+        if (i < this->literals_.size() &&
+            this->literals_[i].text.data() == source.data() &&
+            this->literals_[i].text.size() == source.size()) {
+            return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    // Marks every literal inside `source` in `pinned`.
+    void PinWithin(std::string_view source, std::vector<bool>* pinned) const {
+        const char* end = source.data() + source.size();
+        for (size_t i = this->LowerBound(source.data());
+             i < this->literals_.size() &&
+             this->literals_[i].text.data() < end;
+             ++i) {
+            (*pinned)[i] = true;
+        }
+    }
+
+    ParameterValue Value(size_t i) const {
+        const Literal& scanned = this->literals_[i];
+        switch (scanned.type) {
+            case DataType::kI32:
+            case DataType::kI64:
+                return literal::ParseInteger(scanned.text, false).value_or(0);
+            case DataType::kFp64:
+                return literal::ParseDouble(scanned.text, false).value_or(0.0);
+            default:
+                return absl::StrReplaceAll(literal::StringBody(scanned.text),
+                                           {{"''", "'"}});
+        }
+    }
+
+private:
+    size_t LowerBound(const char* position) const {
+        return std::lower_bound(this->literals_.begin(), this->literals_.end(),
+                                position,
+                                [](const Literal& literal, const char* p) {
+                                    return literal.text.data() < p;
+                                }) -
+               this->literals_.begin();
+    }
+
+    std::vector<Literal> literals_;
+};
+
+// The type the binder gives a numeric literal; see binder::LiteralType.
+DataType NumberType(std::string_view text) {
+    for (char c : text) {
+        if (c < '0' || c > '9') {
+            return DataType::kFp64;
+        }
+    }
+    int64_t value;
+    if (!absl::SimpleAtoi(text, &value)) {
+        return DataType::kFp64;
+    }
+    return value <= std::numeric_limits<int32_t>::max() ? DataType::kI32
+                                                        : DataType::kI64;
+}
+
+std::string_view TypeMarker(DataType type) {
+    switch (type) {
+        case DataType::kI32:
+            return "?i32";
+        case DataType::kI64:
+            return "?i64";
+        case DataType::kFp64:
+            return "?fp64";
+        default:
+            return "?str";
+    }
+}
+
+// Builds the cache key: the schema fingerprint, then `sql` with each literal
+// token replaced by a marker for its type. Everything else is kept byte for
+// byte, since the binder compares expression text (GROUP BY matching, measure
+// reuse) and whitespace can change the outcome. Returns false for SQL that
+// already has placeholders; those bypass the cache.
+bool BuildKey(std::string_view sql, const std::pmr::vector<Token>& tokens,
+              const Catalog& catalog, LiteralScan* scan, std::string* key) {
+    const size_t fingerprint = catalog.fingerprint();
+    key->reserve(sizeof(fingerprint) + sql.size());
+    key->append(reinterpret_cast<const char*>(&fingerprint),
+                sizeof(fingerprint));
+    size_t copied = 0;
+    for (const Token& token : tokens) {
+        if (token.type == TokenType::kParameter) {
+            return false;
+        }
+        if (token.type != TokenType::kNumber &&
+            token.type != TokenType::kString) {
+            continue;
+        }
+        const DataType type = token.type == TokenType::kNumber
+                                  ? NumberType(token.text)
+                                  : DataType::kString;
+        const size_t begin = token.text.data() - sql.data();
+        key->append(sql.substr(copied, begin - copied));
+        key->append(TypeMarker(type));
+        copied = begin + token.text.size();
+        scan->Add(token.text, type);
+    }
+    key->append(sql.substr(copied));
+    return true;
+}
+
+// Whether every value the key's marker for `scanned` admits binds to a
+// literal of the binder's type `bound`, as Parse() would type it. A literal
+// the binder narrowed (an i32 into an i16 column) or retyped (a string into
+// a date) would fail or change on a later hit, so it stays a literal.
+bool BindsLikeParse(DataType scanned, DataType bound) {
+    return bound == scanned ||
+           (scanned == DataType::kI32 && bound == DataType::kI64);
+}
+
+// Turns each unpinned literal into a placeholder numbered by its ordinal, so
+// the converted plan holds a slot wherever a literal value lands. Negated
+// literals span two tokens and stay literals, which pins them.
+void ParameterizeLiterals(ExpressionTree& tree, const LiteralScan& scan,
+                          const std::vector<bool>& pinned) {
+    for (ExprNode& node : tree.nodes) {
+        if (node.kind != ExprKind::kLiteral || node.negated ||
+            node.literal == LiteralKind::kNull ||
+            node.literal == LiteralKind::kBoolean) {
+            continue;
+        }
+        const int ordinal = scan.Find(node.source);
+        if (ordinal < 0 || pinned[ordinal] ||
+            !BindsLikeParse(scan[ordinal].type, node.type)) {
+            continue;
+        }
+        node.kind = ExprKind::kParameter;
+        node.parameter = static_cast<uint32_t>(ordinal);
+    }
+}
+
+void Parameterize(SelectInfo& info, const LiteralScan& scan) {
+    std::vector<bool> pinned(scan.size());
+    // Whether an integer sort key is an ordinal depends on its value.
+    for (const SortInfo& sort : info.order_by_columns) {
+        const ExprNode& key = info.expressions[sort.expr];
+        if (key.kind == ExprKind::kLiteral) {
+            scan.PinWithin(key.source, &pinned);
+        }
+    }
+    // With aggregation the binder matches select items and sort keys against
+    // GROUP BY and earlier measures by their text, literals included.
+    if (!info.group_by.empty() || !info.measures.empty()) {
+        for (const SelectItem& item : info.select_items) {
+            if (item.expr != kNoExpr) {
+                scan.PinWithin(info.expressions[item.expr].source, &pinned);
+            }
+        }
+        for (ExprId group : info.group_by) {
+            scan.PinWithin(info.expressions[group].source, &pinned);
+        }
+        for (const SortInfo& sort : info.order_by_columns) {
+            scan.PinWithin(info.expressions[sort.expr].source, &pinned);
+        }
+    }
+    ParameterizeLiterals(info.expressions, scan, pinned);
+}
+
+// Whether the binder converts a literal to the column type `target` depends
+// on its value (5 fits an i16 column, 40000 does not), which the key does
+// not record. Pins the literal `value` unless every value with its marker
+// converts alike.
+void PinCoerced(const ExpressionTree& tree, ExprId value, DataType target,
+                const LiteralScan& scan, std::vector<bool>* pinned) {
+    const ExprNode& node = tree[value];
+    if (node.kind != ExprKind::kLiteral || target == DataType::kUnknown) {
+        return;
+    }
+    const int ordinal = scan.Find(node.source);
+    if (ordinal >= 0 && !BindsLikeParse(scan[ordinal].type, target)) {
+        (*pinned)[ordinal] = true;
+    }
+}
+
+void Parameterize(InsertInfo& info, const LiteralScan& scan) {
+    std::vector<bool> pinned(scan.size());
+    for (size_t i = 0; i < info.values.size(); ++i) {
+        PinCoerced(info.expressions, info.values[i],
+                   info.column_types[i % info.row_width], scan, &pinned);
+    }
+    ParameterizeLiterals(info.expressions, scan, pinned);
+}
+
+void Parameterize(UpdateInfo& info, const LiteralScan& scan) {
+    std::vector<bool> pinned(scan.size());
+    for (const SetClause& set_clause : info.set_clauses) {
+        PinCoerced(info.expressions, set_clause.value,
+                   info.schema.columns[set_clause.column_index].type, scan,
+                   &pinned);
+    }
+    ParameterizeLiterals(info.expressions, scan, pinned);
+}
+
+template <typename Info>
+void Parameterize(Info& info, const LiteralScan& scan) {
+    if constexpr (std::is_same_v<Info, DeleteInfo>) {
+        ParameterizeLiterals(info.expressions, scan,
+                             std::vector<bool>(scan.size()));
+    }
+}
+
+}  // anonymous namespace
+
+struct PlanCache::Entry {
+    std::string key;
+    PreparedPlan plan;
+    // Literals that stayed literals in `plan`, by ordinal, with the text a
+    // statement must repeat to reuse it.
+    std::vector<std::pair<uint32_t, std::string>> pinned;
+    size_t bytes = 0;
+};
+
+struct PlanCache::Shard {
+    using Lru = std::list<std::shared_ptr<const Entry>>;
+
+    absl::Mutex mutex;
+    Lru lru ABSL_GUARDED_BY(mutex);
+    absl::flat_hash_map<std::string_view, Lru::iterator> index
+        ABSL_GUARDED_BY(mutex);
+    size_t bytes ABSL_GUARDED_BY(mutex) = 0;
+};
+
+PlanCache::PlanCache(PlanCacheOptions options) : options_(options) {
+    this->options_.shards = std::max<size_t>(this->options_.shards, 1);
+    this->shards_ = std::make_unique<Shard[]>(this->options_.shards);
+}
+
+PlanCache::~PlanCache() = default;
+
+PlanCache::Shard& PlanCache::ShardFor(std::string_view key) {
+    return this->shards_[absl::Hash<std::string_view>{}(key) %
+                         this->options_.shards];
+}
+
+absl::StatusOr<substrait::Plan> PlanCache::Parse(
+    std::string_view sql,
+    const std::vector<TableDefinition>& table_definitions) {
+    return this->Parse(sql, Catalog::Borrow(table_definitions));
+}
+
+absl::StatusOr<substrait::Plan> PlanCache::Parse(std::string_view sql,
+                                                 const Catalog& catalog) {
+    StatementArena arena;
+    absl::StatusOr<std::pmr::vector<Token>> tokens =
+        lexer::Tokenize(sql, arena.resource());
+    LiteralScan scan;
+    std::string key;
+    if (!tokens.ok() ||
+        !BuildKey(sql, *tokens, catalog, &scan, &key)) {
+        return pink_perilla::Parse(sql, catalog);
+    }
+
+    std::vector<ParameterValue> values(scan.size());
+    for (size_t i = 0; i < scan.size(); ++i) {
+        values[i] = scan.Value(i);
+    }
+
+    std::shared_ptr<const Entry> entry;
+    {
+        Shard& shard = this->ShardFor(key);
+        absl::MutexLock lock(&shard.mutex);
+        if (auto it = shard.index.find(key); it != shard.index.end()) {
+            shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+            entry = *it->second;
+        }
+    }
+    if (entry != nullptr &&
+        std::all_of(entry->pinned.begin(), entry->pinned.end(),
+                    [&](const auto& pinned) {
+                        return scan[pinned.first].text == pinned.second;
+                    })) {
+        this->hits_.fetch_add(1, std::memory_order_relaxed);
+        values.resize(entry->plan.parameter_count());
+        return entry->plan.Bind(values);
+    }
+    this->misses_.fetch_add(1, std::memory_order_relaxed);
+
+    absl::StatusOr<Statement> statement =
+        SqlParser::Parse(sql, catalog, arena.resource());
+    if (!statement.ok()) {
+        return statement.status();
+    }
+    substrait::Plan plan = std::visit(
+        [&scan](auto& info) {
+            Parameterize(info, scan);
+            return converter::ToSubstrait(info);
+        },
+        *statement);
+    absl::StatusOr<PreparedPlan> prepared =
+        PreparedPlan::FromPlan(std::move(plan));
+    if (!prepared.ok()) {
+        return prepared.status();
+    }
+
+    auto fresh = std::make_shared<Entry>();
+    fresh->key = std::move(key);
+    fresh->plan = *std::move(prepared);
+    for (size_t i = 0; i < scan.size(); ++i) {
+        if (!fresh->plan.uses_parameter(static_cast<uint32_t>(i))) {
+            fresh->pinned.emplace_back(static_cast<uint32_t>(i),
+                                       std::string(scan[i].text));
+        }
+    }
+    fresh->bytes = sizeof(Entry) + fresh->key.size() +
+                   fresh->plan.plan_template().SpaceUsedLong();
+    for (const auto& pinned : fresh->pinned) {
+        fresh->bytes += sizeof(pinned) + pinned.second.size();
+    }
+    values.resize(fresh->plan.parameter_count());
+    absl::StatusOr<substrait::Plan> bound = fresh->plan.Bind(values);
+    if (bound.ok()) {
+        this->Insert(std::move(fresh));
+    }
+    return bound;
+}
+
+void PlanCache::Insert(std::shared_ptr<const Entry> entry) {
+    const size_t capacity = this->options_.max_bytes / this->options_.shards;
+    if (entry->bytes > capacity) {
+        return;
+    }
+    Shard& shard = this->ShardFor(entry->key);
+    absl::MutexLock lock(&shard.mutex);
+    if (auto it = shard.index.find(entry->key); it != shard.index.end()) {
+        shard.bytes -= (*it->second)->bytes;
+        Shard::Lru::iterator stale = it->second;
+        shard.index.erase(it);
+        shard.lru.erase(stale);
+    }
+    shard.bytes += entry->bytes;
+    shard.lru.push_front(std::move(entry));
+    shard.index.emplace(shard.lru.front()->key, shard.lru.begin());
+    while (shard.bytes > capacity) {
+        const Entry& victim = *shard.lru.back();
+        shard.bytes -= victim.bytes;
+        shard.index.erase(victim.key);
+        shard.lru.pop_back();
+        this->evictions_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+PlanCacheStats PlanCache::stats() const {
+    PlanCacheStats stats;
+    stats.hits = this->hits_.load(std::memory_order_relaxed);
+    stats.misses = this->misses_.load(std::memory_order_relaxed);
+    stats.evictions = this->evictions_.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < this->options_.shards; ++i) {
+        Shard& shard = this->shards_[i];
+        absl::MutexLock lock(&shard.mutex);
+        stats.entries += shard.lru.size();
+        stats.bytes += shard.bytes;
+    }
+    return stats;
+}
+
+void PlanCache::Clear() {
+    for (size_t i = 0; i < this->options_.shards; ++i) {
+        Shard& shard = this->shards_[i];
+        absl::MutexLock lock(&shard.mutex);
+        shard.index.clear();
+        shard.lru.clear();
+        shard.bytes = 0;
+    }
+}
+
+}  // namespace pink_perilla
@@ -0,0 +1,637 @@
+#include "plan_server.hpp"
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/str_cat.h"
+#include "absl/synchronization/mutex.h"
+#include "detail/cancellation.hpp"
+#include "google/protobuf/arena.h"
+#include "pink_perilla.hpp"
+#include "thread_pool.hpp"
+
+namespace pink_perilla {
+
+namespace {
+
+constexpr size_t kLengthBytes = 4;
+// Bytes taken from a socket per recv().
+constexpr size_t kReadChunk = 64 << 10;
+// Unsent answers past which a connection is no longer read from.
+constexpr size_t kMaxUnsentBytes = 16 << 20;
+// epoll keys of the two descriptors that are not connections.
+constexpr uint64_t kListenerKey = 0;
+constexpr uint64_t kWakeKey = 1;
+
+// The failure errno describes, prefixed with what failed.
+absl::Status ErrnoError(std::string_view what) {
+    const int error = errno;
+    return absl::Status(absl::ErrnoToStatusCode(error),
+                        absl::StrCat(what, ": ", std::strerror(error)));
+}
+
+uint32_t LoadLength(const char* bytes) {
+    uint32_t length = 0;
+    for (size_t i = 0; i < kLengthBytes; ++i) {
+        length |= uint32_t{static_cast<uint8_t>(bytes[i])} << (8 * i);
+    }
+    return length;
+}
+
+void StoreLength(size_t length, char* bytes) {
+    for (size_t i = 0; i < kLengthBytes; ++i) {
+        bytes[i] = static_cast<char>(length >> (8 * i));
+    }
+}
+
+std::string ErrorFrame(const absl::Status& status) {
+    std::string frame(kLengthBytes + 1, '\0');
+    StoreLength(1 + status.message().size(), frame.data());
+    frame[kLengthBytes] = static_cast<char>(status.code());
+    frame.append(status.message().data(), status.message().size());
+    return frame;
+}
+
+// Closes the descriptor it holds unless release()d.
+class FileDescriptor {
+public:
+    explicit FileDescriptor(int fd) : fd_(fd) {}
+    ~FileDescriptor() {
+        if (this->fd_ >= 0) {
+            ::close(this->fd_);
+        }
+    }
+    FileDescriptor(const FileDescriptor&) = delete;
+    FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+    int get() const { return this->fd_; }
+    int release() { return std::exchange(this->fd_, -1); }
+
+private:
+    int fd_;
+};
+
+absl::StatusOr<sockaddr_un> SocketAddress(const std::string& path) {
+    sockaddr_un address{};
+    if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+        return absl::InvalidArgumentError(
+            absl::StrCat("Invalid socket path: ", path));
+    }
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, path.data(), path.size());
+    return address;
+}
+
+bool ConnectSocket(int fd, const sockaddr_un& address) {
+    while (::connect(fd, reinterpret_cast<const sockaddr*>(&address),
+                     sizeof(address)) != 0) {
+        if (errno != EINTR) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Binds `fd` to `address`, first removing a socket file there that no one is
+// listening on any more.
+absl::Status Bind(int fd, const sockaddr_un& address) {
+    const auto* raw = reinterpret_cast<const sockaddr*>(&address);
+    if (::bind(fd, raw, sizeof(address)) == 0) {
+        return absl::OkStatus();
+    }
+    if (errno != EADDRINUSE) {
+        return ErrnoError(address.sun_path);
+    }
+    struct stat info;
+    if (::lstat(address.sun_path, &info) != 0 || !S_ISSOCK(info.st_mode)) {
+        return absl::AlreadyExistsError(
+            absl::StrCat("Not a socket: ", address.sun_path));
+    }
+    FileDescriptor probe(::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0));
+    if (probe.get() >= 0 && ConnectSocket(probe.get(), address)) {
+        return absl::AlreadyExistsError(
+            absl::StrCat("A server is already listening on ", address.sun_path));
+    }
+    ::unlink(address.sun_path);
+    if (::bind(fd, raw, sizeof(address)) != 0) {
+        return ErrnoError(address.sun_path);
+    }
+    return absl::OkStatus();
+}
+
+}  // anonymous namespace
+
+class PlanServer::Impl {
+public:
+    Impl(int listener, int epoll, int wake, std::string path,
+         const CatalogHandle& catalog, const PlanServerOptions& options)
+        : listener_(listener),
+          epoll_(epoll),
+          wake_(wake),
+          path_(std::move(path)),
+          catalog_(catalog),
+          options_(options),
+          pool_(std::make_unique<ThreadPool>(options.threads)) {}
+
+    ~Impl() {
+        // Finish planning first: workers still post to completions_ and wake_.
+        this->pool_.reset();
+        for (const auto& [id, connection] : this->connections_) {
+            ::close(connection.fd);
+        }
+        ::close(this->listener_);
+        ::close(this->epoll_);
+        ::close(this->wake_);
+        ::unlink(this->path_.c_str());
+    }
+
+    absl::Status Run();
+
+    void Shutdown() {
+        this->stopping_.store(true, std::memory_order_relaxed);
+        this->Wake();
+    }
+
+private:
+    struct Connection {
+        int fd = -1;
+        // Received bytes not yet split into requests.
+        std::string input;
+        // Answers ready to send, from output[written] on.
+        std::string output;
+        size_t written = 0;
+        // Requests are numbered in arrival order; answers go out in the same
+        // order, so one that is done early waits in `finished`.
+        uint64_t next_request = 0;
+        uint64_t next_answer = 0;
+        absl::flat_hash_map<uint64_t, std::string> finished;
+        // The peer has stopped sending; close once every answer is out.
+        bool eof = false;
+        // The connection is unusable; close it now.
+        bool failed = false;
+        uint32_t events = 0;
+
+        size_t pending() const { return this->next_request - this->next_answer; }
+        size_t unsent() const { return this->output.size() - this->written; }
+    };
+
+    struct Completion {
+        uint64_t connection;
+        uint64_t request;
+        std::string frame;
+    };
+
+    void Wake() {
+        const uint64_t one = 1;
+        [[maybe_unused]] const ssize_t written =
+            ::write(this->wake_, &one, sizeof(one));
+    }
+
+    void Accept();
+    void Receive(uint64_t id, Connection& connection);
+    // Hands every complete request in connection.input to the pool, as long
+    // as the connection has room for more pending requests.
+    void Dispatch(uint64_t id, Connection& connection);
+    void Answer(Connection& connection, uint64_t request, std::string frame);
+    void Send(Connection& connection);
+    // Closes the connection if it is done, else waits for what it needs next.
+    void Update(uint64_t id, Connection& connection);
+    void DrainCompletions();
+    // Plans `sql`, giving up at `deadline`, and returns the response frame.
+    std::string Plan(std::string_view sql,
+                     std::chrono::steady_clock::time_point deadline);
+
+    const int listener_;
+    const int epoll_;
+    // An eventfd: written when completions arrive or on Shutdown().
+    const int wake_;
+    const std::string path_;
+    const CatalogHandle& catalog_;
+    const PlanServerOptions options_;
+    std::atomic<bool> stopping_{false};
+    absl::flat_hash_map<uint64_t, Connection> connections_;
+    uint64_t next_connection_ = kWakeKey + 1;
+    absl::Mutex completions_mutex_;
+    std::vector<Completion> completions_ ABSL_GUARDED_BY(completions_mutex_);
+    std::unique_ptr<ThreadPool> pool_;
+};
+
+absl::Status PlanServer::Impl::Run() {
+    epoll_event events[64];
+    while (!this->stopping_.load(std::memory_order_relaxed)) {
+        const int count = ::epoll_wait(this->epoll_, events, 64, -1);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return ErrnoError("epoll_wait");
+        }
+        for (int i = 0; i < count; ++i) {
+            const uint64_t key = events[i].data.u64;
+            if (key == kListenerKey) {
+                this->Accept();
+                continue;
+            }
+            if (key == kWakeKey) {
+                uint64_t ignored;
+                [[maybe_unused]] const ssize_t read =
+                    ::read(this->wake_, &ignored, sizeof(ignored));
+                this->DrainCompletions();
+                continue;
+            }
+            // Connections closed earlier in this batch are gone; ids are
+            // never reused.
+            auto it = this->connections_.find(key);
+            if (it == this->connections_.end()) {
+                continue;
+            }
+            Connection& connection = it->second;
+            if (events[i].events & (EPOLLHUP | EPOLLERR)) {
+                connection.failed = true;
+            } else {
+                if (events[i].events & EPOLLIN) {
+                    this->Receive(key, connection);
+                }
+                if (events[i].events & EPOLLOUT) {
+                    this->Send(connection);
+                }
+            }
+            this->Update(key, connection);
+        }
+    }
+    return absl::OkStatus();
+}
+
+void PlanServer::Impl::Accept() {
+    for (;;) {
+        const int fd = ::accept4(this->listener_, nullptr, nullptr,
+                                 SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return;
+        }
+        const uint64_t id = this->next_connection_++;
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.u64 = id;
+        if (::epoll_ctl(this->epoll_, EPOLL_CTL_ADD, fd, &event) != 0) {
+            ::close(fd);
+            continue;
+        }
+        Connection& connection = this->connections_[id];
+        connection.fd = fd;
+        connection.events = EPOLLIN;
+    }
+}
+
+void PlanServer::Impl::Receive(uint64_t id, Connection& connection) {
+    char buffer[kReadChunk];
+    while (!connection.eof && !connection.failed &&
+           connection.pending() < this->options_.max_pending_per_connection &&
+           connection.unsent() < kMaxUnsentBytes) {
+        const ssize_t received = ::recv(connection.fd, buffer, sizeof(buffer), 0);
+        if (received > 0) {
+            connection.input.append(buffer, static_cast<size_t>(received));
+            this->Dispatch(id, connection);
+            if (static_cast<size_t>(received) < sizeof(buffer)) {
+                return;
+            }
+        } else if (received == 0) {
+            connection.eof = true;
+        } else if (errno != EINTR) {
+            connection.failed = errno != EAGAIN && errno != EWOULDBLOCK;
+            return;
+        }
+    }
+}
+
+void PlanServer::Impl::Dispatch(uint64_t id, Connection& connection) {
+    size_t begin = 0;
+    while (connection.pending() < this->options_.max_pending_per_connection &&
+           connection.input.size() - begin >= kLengthBytes) {
+        const size_t length = LoadLength(connection.input.data() + begin);
+        if (length > this->options_.max_request_bytes) {
+            // Nothing after an oversized frame can be trusted to be framed
+            // right, so answer it and stop reading.
+            this->Answer(connection, connection.next_request++,
+                         ErrorFrame(absl::ResourceExhaustedError(absl::StrCat(
+                             "Request of ", length, " bytes exceeds the limit of ",
+                             this->options_.max_request_bytes))));
+            connection.input.clear();
+            connection.eof = true;
+            return;
+        }
+        if (connection.input.size() - begin - kLengthBytes < length) {
+            break;
+        }
+        std::string sql = connection.input.substr(begin + kLengthBytes, length);
+        begin += kLengthBytes + length;
+        const uint64_t request = connection.next_request++;
+        // The clock starts when the request arrives, so time spent queued
+        // behind other requests counts against it.
+        const std::chrono::steady_clock::time_point deadline =
+            this->options_.request_timeout.count() > 0
+                ? std::chrono::steady_clock::now() +
+                      this->options_.request_timeout
+                : std::chrono::steady_clock::time_point::max();
+        this->pool_->Schedule([this, id, request, deadline,
+                               sql = std::move(sql)] {
+            std::string frame = this->Plan(sql, deadline);
+            bool was_empty;
+            {
+                absl::MutexLock lock(&this->completions_mutex_);
+                was_empty = this->completions_.empty();
+                this->completions_.push_back({id, request, std::move(frame)});
+            }
+            // One wake-up covers everything queued before it is handled.
+            if (was_empty) {
+                this->Wake();
+            }
+        });
+    }
+    connection.input.erase(0, begin);
+}
+
+void PlanServer::Impl::Answer(Connection& connection, uint64_t request,
+                              std::string frame) {
+    if (request != connection.next_answer) {
+        connection.finished.emplace(request, std::move(frame));
+        return;
+    }
+    connection.output.append(frame);
+    ++connection.next_answer;
+    for (auto it = connection.finished.find(connection.next_answer);
+         it != connection.finished.end();
+         it = connection.finished.find(connection.next_answer)) {
+        connection.output.append(it->second);
+        connection.finished.erase(it);
+        ++connection.next_answer;
+    }
+}
+
+void PlanServer::Impl::Send(Connection& connection) {
+    while (connection.unsent() > 0) {
+        const ssize_t sent =
+            ::send(connection.fd, connection.output.data() + connection.written,
+                   connection.unsent(), MSG_NOSIGNAL);
+        if (sent > 0) {
+            connection.written += static_cast<size_t>(sent);
+        } else if (errno != EINTR) {
+            connection.failed = errno != EAGAIN && errno != EWOULDBLOCK;
+            break;
+        }
+    }
+    if (connection.unsent() == 0) {
+        connection.output.clear();
+        connection.written = 0;
+    } else if (connection.written > connection.output.size() / 2) {
+        connection.output.erase(0, connection.written);
+        connection.written = 0;
+    }
+}
+
+void PlanServer::Impl::Update(uint64_t id, Connection& connection) {
+    if (!connection.failed && !connection.eof) {
+        // Requests held back by the pending limit may go out now.
+        this->Dispatch(id, connection);
+    }
+    if (connection.failed ||
+        (connection.eof && connection.pending() == 0 && connection.unsent() == 0)) {
+        ::close(connection.fd);
+        this->connections_.erase(id);
+        return;
+    }
+    uint32_t events = 0;
+    if (!connection.eof &&
+        connection.pending() < this->options_.max_pending_per_connection &&
+        connection.unsent() < kMaxUnsentBytes) {
+        events |= EPOLLIN;
+    }
+    if (connection.unsent() > 0) {
+        events |= EPOLLOUT;
+    }
+    if (events != connection.events) {
+        epoll_event event{};
+        event.events = events;
+        event.data.u64 = id;
+        ::epoll_ctl(this->epoll_, EPOLL_CTL_MOD, connection.fd, &event);
+        connection.events = events;
+    }
+}
+
+void PlanServer::Impl::DrainCompletions() {
+    std::vector<Completion> completions;
+    {
+        absl::MutexLock lock(&this->completions_mutex_);
+        completions.swap(this->completions_);
+    }
+    // Answers for one connection usually arrive together; send them once.
+    std::vector<uint64_t> touched;
+    for (Completion& completion : completions) {
+        auto it = this->connections_.find(completion.connection);
+        if (it == this->connections_.end()) {
+            continue;
+        }
+        this->Answer(it->second, completion.request, std::move(completion.frame));
+        touched.push_back(completion.connection);
+    }
+    for (const uint64_t id : touched) {
+        auto it = this->connections_.find(id);
+        if (it == this->connections_.end()) {
+            continue;
+        }
+        this->Send(it->second);
+        this->Update(id, it->second);
+    }
+}
+
+std::string PlanServer::Impl::Plan(
+    std::string_view sql, std::chrono::steady_clock::time_point deadline) {
+    // Reset after every plan, so each worker reuses the same blocks.
+    thread_local google::protobuf::Arena arena;
+    const std::shared_ptr<const Catalog> catalog = this->catalog_.Load();
+    ParseOptions limits;
+    limits.deadline = deadline;
+    limits.max_plan_bytes = this->options_.max_plan_bytes;
+    absl::StatusOr<substrait::Plan*> plan;
+    {
+        const detail::LimitsScope scope(limits);
+        plan = Parse(sql, *catalog, &arena);
+    }
+    std::string frame;
+    if (!plan.ok()) {
+        frame = ErrorFrame(plan.status());
+    } else {
+        const size_t size = (*plan)->ByteSizeLong();
+        frame.resize(kLengthBytes + 1 + size);
+        StoreLength(1 + size, frame.data());
+        frame[kLengthBytes] = static_cast<char>(absl::StatusCode::kOk);
+        (*plan)->SerializeWithCachedSizesToArray(
+            reinterpret_cast<uint8_t*>(frame.data() + kLengthBytes + 1));
+    }
+    arena.Reset();
+    return frame;
+}
+
+absl::StatusOr<std::unique_ptr<PlanServer>> PlanServer::Listen(
+    const std::string& socket_path, const CatalogHandle& catalog,
+    const PlanServerOptions& options) {
+    absl::StatusOr<sockaddr_un> address = SocketAddress(socket_path);
+    if (!address.ok()) {
+        return address.status();
+    }
+    FileDescriptor listener(
+        ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0));
+    if (listener.get() < 0) {
+        return ErrnoError("socket");
+    }
+    if (absl::Status status = Bind(listener.get(), *address); !status.ok()) {
+        return status;
+    }
+    if (::listen(listener.get(), SOMAXCONN) != 0) {
+        return ErrnoError("listen");
+    }
+    FileDescriptor epoll(::epoll_create1(EPOLL_CLOEXEC));
+    if (epoll.get() < 0) {
+        return ErrnoError("epoll_create1");
+    }
+    FileDescriptor wake(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC));
+    if (wake.get() < 0) {
+        return ErrnoError("eventfd");
+    }
+    for (const auto& [fd, key] : {std::pair{listener.get(), kListenerKey},
+                                  std::pair{wake.get(), kWakeKey}}) {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.u64 = key;
+        if (::epoll_ctl(epoll.get(), EPOLL_CTL_ADD, fd, &event) != 0) {
+            return ErrnoError("epoll_ctl");
+        }
+    }
+    return std::unique_ptr<PlanServer>(new PlanServer(std::make_unique<Impl>(
+        listener.release(), epoll.release(), wake.release(), socket_path,
+        catalog, options)));
+}
+
+PlanServer::PlanServer(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+PlanServer::~PlanServer() = default;
+
+absl::Status PlanServer::Run() {
+    return this->impl_->Run();
+}
+
+void PlanServer::Shutdown() {
+    this->impl_->Shutdown();
+}
+
+absl::StatusOr<PlanClient> PlanClient::Connect(const std::string& socket_path) {
+    absl::StatusOr<sockaddr_un> address = SocketAddress(socket_path);
+    if (!address.ok()) {
+        return address.status();
+    }
+    FileDescriptor fd(::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0));
+    if (fd.get() < 0) {
+        return ErrnoError("socket");
+    }
+    if (!ConnectSocket(fd.get(), *address)) {
+        return ErrnoError(socket_path);
+    }
+    return PlanClient(fd.release());
+}
+
+PlanClient::PlanClient(PlanClient&& other) noexcept
+    : fd_(std::exchange(other.fd_, -1)), frame_(std::move(other.frame_)) {}
+
+PlanClient& PlanClient::operator=(PlanClient&& other) noexcept {
+    std::swap(this->fd_, other.fd_);
+    std::swap(this->frame_, other.frame_);
+    return *this;
+}
+
+PlanClient::~PlanClient() {
+    if (this->fd_ >= 0) {
+        ::close(this->fd_);
+    }
+}
+
+absl::Status PlanClient::Send(std::string_view sql) {
+    this->frame_.resize(kLengthBytes);
+    StoreLength(sql.size(), this->frame_.data());
+    this->frame_.append(sql.data(), sql.size());
+    for (size_t sent = 0; sent < this->frame_.size();) {
+        const ssize_t n = ::send(this->fd_, this->frame_.data() + sent,
+                                 this->frame_.size() - sent, MSG_NOSIGNAL);
+        if (n > 0) {
+            sent += static_cast<size_t>(n);
+        } else if (errno != EINTR) {
+            return ErrnoError("send");
+        }
+    }
+    return absl::OkStatus();
+}
+
+absl::Status PlanClient::Receive(std::string* plan) {
+    const auto read_exactly = [this](char* out, size_t size) {
+        for (size_t received = 0; received < size;) {
+            const ssize_t n = ::recv(this->fd_, out + received, size - received, 0);
+            if (n > 0) {
+                received += static_cast<size_t>(n);
+            } else if (n == 0) {
+                return absl::UnavailableError("Server closed the connection");
+            } else if (errno != EINTR) {
+                return ErrnoError("recv");
+            }
+        }
+        return absl::OkStatus();
+    };
+    char header[kLengthBytes];
+    if (absl::Status status = read_exactly(header, kLengthBytes); !status.ok()) {
+        return status;
+    }
+    const size_t length = LoadLength(header);
+    if (length == 0) {
+        return absl::DataLossError("Empty response frame");
+    }
+    this->frame_.resize(length);
+    if (absl::Status status = read_exactly(this->frame_.data(), length);
+        !status.ok()) {
+        return status;
+    }
+    const auto code = static_cast<absl::StatusCode>(this->frame_[0]);
+    if (code != absl::StatusCode::kOk) {
+        return absl::Status(code, std::string_view(this->frame_).substr(1));
+    }
+    plan->assign(this->frame_, 1, std::string::npos);
+    return absl::OkStatus();
+}
+
+absl::StatusOr<substrait::Plan> PlanClient::Receive() {
+    std::string bytes;
+    if (absl::Status status = this->Receive(&bytes); !status.ok()) {
+        return status;
+    }
+    substrait::Plan plan;
+    if (!plan.ParseFromString(bytes)) {
+        return absl::DataLossError("Malformed plan in response");
+    }
+    return plan;
+}
+
+}  // namespace pink_perilla
@@ -0,0 +1,404 @@
+#include "prepared_plan.hpp"
+
+#include <substrait/algebra.pb.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <optional>
+
+#include "absl/strings/str_cat.h"
+#include "detail/literal.hpp"
+
+namespace pink_perilla {
+
+namespace {
+
+using google::protobuf::FieldDescriptor;
+using google::protobuf::Message;
+using google::protobuf::Reflection;
+
+template <typename T>
+bool Fits(int64_t value) {
+    return value >= std::numeric_limits<T>::min() &&
+           value <= std::numeric_limits<T>::max();
+}
+
+absl::Status TypeMismatch(uint32_t parameter, std::string_view value_type,
+                          const substrait::Type& type) {
+    return absl::InvalidArgumentError(absl::StrCat(
+        "Cannot bind ", value_type, " to parameter ", parameter + 1,
+        " of type ",
+        type.GetDescriptor()->FindFieldByNumber(type.kind_case())->name()));
+}
+
+// Sets `literal` to the decimal `text`, optionally signed, with the
+// precision and scale of the value itself, as the converter writes a decimal
+// literal. The placeholder's type only bounds it at 38 digits.
+absl::Status SetDecimal(std::string_view text, uint32_t parameter,
+                        substrait::Expression::Literal* literal) {
+    std::string_view digits = text;
+    const bool negated = !digits.empty() && digits.front() == '-';
+    if (negated || (!digits.empty() && digits.front() == '+')) {
+        digits.remove_prefix(1);
+    }
+    const std::optional<pink_perilla::literal::Decimal> decimal =
+        pink_perilla::literal::ParseDecimal(digits, negated);
+    if (!decimal) {
+        return absl::InvalidArgumentError(absl::StrCat(
+            "Invalid decimal '", text, "' for parameter ", parameter + 1));
+    }
+    substrait::Expression::Literal::Decimal* value = literal->mutable_decimal();
+    value->set_value(pink_perilla::literal::DecimalBytes(*decimal));
+    value->set_precision(decimal->precision);
+    value->set_scale(decimal->scale);
+    return absl::OkStatus();
+}
+
+// Sets `literal` to `value`, coerced to the placeholder's `type`. An untyped
+// placeholder takes the narrowest literal that holds the value.
+absl::Status SetLiteral(const ParameterValue& value, const substrait::Type& type,
+                        uint32_t parameter,
+                        substrait::Expression::Literal* literal) {
+    const substrait::Type::KindCase kind = type.kind_case();
+    const bool untyped = kind == substrait::Type::KIND_NOT_SET;
+    if (std::holds_alternative<std::monostate>(value)) {
+        *literal->mutable_null() = type;
+        return absl::OkStatus();
+    }
+    if (const bool* boolean = std::get_if<bool>(&value)) {
+        if (!untyped && kind != substrait::Type::kBool) {
+            return TypeMismatch(parameter, "a boolean", type);
+        }
+        literal->set_boolean(*boolean);
+        return absl::OkStatus();
+    }
+    if (const int64_t* integer = std::get_if<int64_t>(&value)) {
+        bool fits = true;
+        switch (kind) {
+            case substrait::Type::kI8:
+                fits = Fits<int8_t>(*integer);
+                literal->set_i8(static_cast<int32_t>(*integer));
+                break;
+            case substrait::Type::kI16:
+                fits = Fits<int16_t>(*integer);
+                literal->set_i16(static_cast<int32_t>(*integer));
+                break;
+            case substrait::Type::kI32:
+                fits = Fits<int32_t>(*integer);
+                literal->set_i32(static_cast<int32_t>(*integer));
+                break;
+            case substrait::Type::kI64:
+                literal->set_i64(*integer);
+                break;
+            case substrait::Type::kFp32:
+                literal->set_fp32(static_cast<float>(*integer));
+                break;
+            case substrait::Type::kFp64:
+                literal->set_fp64(static_cast<double>(*integer));
+                break;
+            case substrait::Type::kDecimal:
+                return SetDecimal(absl::StrCat(*integer), parameter, literal);
+            case substrait::Type::KIND_NOT_SET:
+                if (Fits<int32_t>(*integer)) {
+                    literal->set_i32(static_cast<int32_t>(*integer));
+                } else {
+                    literal->set_i64(*integer);
+                }
+                break;
+            default:
+                return TypeMismatch(parameter, "an integer", type);
+        }
+        if (!fits) {
+            return absl::OutOfRangeError(absl::StrCat(
+                "Value ", *integer, " is out of range for parameter ",
+                parameter + 1));
+        }
+        return absl::OkStatus();
+    }
+    if (const double* real = std::get_if<double>(&value)) {
+        if (kind == substrait::Type::kFp32) {
+            literal->set_fp32(static_cast<float>(*real));
+        } else if (untyped || kind == substrait::Type::kFp64) {
+            literal->set_fp64(*real);
+        } else {
+            return TypeMismatch(parameter, "a double", type);
+        }
+        return absl::OkStatus();
+    }
+    const std::string& text = std::get<std::string>(value);
+    switch (kind) {
+        case substrait::Type::KIND_NOT_SET:
+        case substrait::Type::kString:
+            literal->set_string(text);
+            return absl::OkStatus();
+        case substrait::Type::kVarchar: {
+            // A negative length is malformed, and no value fits it.
+            const int32_t length = type.varchar().length();
+            if (length < 0 || text.size() > static_cast<size_t>(length)) {
+                return absl::OutOfRangeError(absl::StrCat(
+                    "Value is longer than VARCHAR(", length,
+                    ") for parameter ", parameter + 1));
+            }
+            substrait::Expression::Literal::VarChar* varchar =
+                literal->mutable_var_char();
+            varchar->set_value(text);
+            varchar->set_length(length);
+            return absl::OkStatus();
+        }
+        case substrait::Type::kDate:
+            if (const std::optional<int32_t> date =
+                    pink_perilla::literal::ParseDate(text)) {
+                literal->set_date(*date);
+                return absl::OkStatus();
+            }
+            return absl::InvalidArgumentError(absl::StrCat(
+                "Invalid date '", text, "' for parameter ", parameter + 1));
+        case substrait::Type::kDecimal:
+            return SetDecimal(text, parameter, literal);
+        case substrait::Type::kTimestamp:
+            if (const std::optional<int64_t> timestamp =
+                    pink_perilla::literal::ParseTimestamp(text)) {
+                literal->set_timestamp(*timestamp);
+                return absl::OkStatus();
+            }
+            return absl::InvalidArgumentError(absl::StrCat(
+                "Invalid timestamp '", text, "' for parameter ", parameter + 1));
+        default:
+            return TypeMismatch(parameter, "a string", type);
+    }
+}
+
+}  // anonymous namespace
+
+absl::StatusOr<PreparedPlan> PreparedPlan::FromPlan(substrait::Plan plan) {
+    PreparedPlan prepared;
+    prepared.template_ = std::move(plan);
+    std::vector<PathStep> path;
+    FindSlots(prepared.template_, &path, &prepared.slots_);
+    if (prepared.slots_.empty()) {
+        return prepared;
+    }
+
+    for (const Slot& slot : prepared.slots_) {
+        prepared.parameter_count_ = std::max<size_t>(
+            prepared.parameter_count_, size_t{slot.parameter} + 1);
+    }
+
+    // The path prefix every slot shares, as a number of steps.
+    size_t common = prepared.slots_[0].path.size();
+    for (const Slot& slot : prepared.slots_) {
+        size_t i = 0;
+        while (i < common && i < slot.path.size() &&
+               slot.path[i].field == prepared.slots_[0].path[i].field &&
+               slot.path[i].index == prepared.slots_[0].path[i].index) {
+            ++i;
+        }
+        common = i;
+    }
+    if (common == 0) {
+        return absl::InvalidArgumentError(
+            "Placeholders span more than one relation");
+    }
+    const FieldDescriptor* values_row =
+        substrait::ReadRel::VirtualTable::descriptor()->FindFieldByName(
+            "expressions");
+    prepared.batch_unit_depth_ = 1;
+    for (size_t i = 0; i < common; ++i) {
+        if (prepared.slots_[0].path[i].field == values_row) {
+            prepared.batch_unit_depth_ = i + 1;
+        }
+    }
+    return prepared;
+}
+
+bool PreparedPlan::uses_parameter(uint32_t parameter) const {
+    for (const Slot& slot : this->slots_) {
+        if (slot.parameter == parameter) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void PreparedPlan::FindSlots(const Message& message,
+                             std::vector<PathStep>* path,
+                             std::vector<Slot>* slots) {
+    if (message.GetDescriptor() == substrait::Expression::descriptor()) {
+        const auto& expression =
+            static_cast<const substrait::Expression&>(message);
+        if (expression.has_dynamic_parameter()) {
+            slots->push_back(Slot{
+                expression.dynamic_parameter().parameter_reference(), *path});
+            return;
+        }
+    }
+    const Reflection* reflection = message.GetReflection();
+    std::vector<const FieldDescriptor*> fields;
+    reflection->ListFields(message, &fields);
+    for (const FieldDescriptor* field : fields) {
+        if (field->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE) {
+            continue;
+        }
+        if (!field->is_repeated()) {
+            path->push_back(PathStep{field, -1});
+            FindSlots(reflection->GetMessage(message, field), path, slots);
+            path->pop_back();
+            continue;
+        }
+        const int size = reflection->FieldSize(message, field);
+        for (int i = 0; i < size; ++i) {
+            path->push_back(PathStep{field, i});
+            FindSlots(reflection->GetRepeatedMessage(message, field, i), path,
+                      slots);
+            path->pop_back();
+        }
+    }
+}
+
+absl::Status PreparedPlan::BindSlots(
+    Message* root, size_t path_offset,
+    absl::FunctionRef<const ParameterValue&(uint32_t)> value_of) const {
+    for (const Slot& slot : this->slots_) {
+        Message* message = root;
+        for (size_t i = path_offset; i < slot.path.size(); ++i) {
+            const PathStep& step = slot.path[i];
+            const Reflection* reflection = message->GetReflection();
+            message = step.index < 0 ? reflection->MutableMessage(message,
+                                                                 step.field)
+                                     : reflection->MutableRepeatedMessage(
+                                           message, step.field, step.index);
+        }
+        auto* expression = static_cast<substrait::Expression*>(message);
+        // Setting the literal clears the placeholder, type included.
+        const substrait::Type type = expression->dynamic_parameter().type();
+        if (absl::Status status = SetLiteral(value_of(slot.parameter), type,
+                                             slot.parameter,
+                                             expression->mutable_literal());
+            !status.ok()) {
+            return status;
+        }
+    }
+    return absl::OkStatus();
+}
+
+absl::Status PreparedPlan::CheckCount(size_t count) const {
+    if (count != this->parameter_count_) {
+        return absl::InvalidArgumentError(
+            absl::StrCat("Expected ", this->parameter_count_,
+                         " parameters, got ", count));
+    }
+    return absl::OkStatus();
+}
+
+absl::StatusOr<substrait::Plan> PreparedPlan::Bind(
+    const std::vector<ParameterValue>& parameters) const {
+    if (absl::Status status = this->CheckCount(parameters.size());
+        !status.ok()) {
+        return status;
+    }
+    substrait::Plan plan = this->template_;
+    if (absl::Status status = this->BindSlots(
+            &plan, 0,
+            [&](uint32_t parameter) -> const ParameterValue& {
+                return parameters[parameter];
+            });
+        !status.ok()) {
+        return status;
+    }
+    return plan;
+}
+
+absl::StatusOr<substrait::Plan*> PreparedPlan::Bind(
+    const std::vector<ParameterValue>& parameters,
+    google::protobuf::Arena* arena) const {
+    if (absl::Status status = this->CheckCount(parameters.size());
+        !status.ok()) {
+        return status;
+    }
+    auto* plan = google::protobuf::Arena::CreateMessage<substrait::Plan>(arena);
+    plan->CopyFrom(this->template_);
+    if (absl::Status status = this->BindSlots(
+            plan, 0,
+            [&](uint32_t parameter) -> const ParameterValue& {
+                return parameters[parameter];
+            });
+        !status.ok()) {
+        if (arena == nullptr) {
+            delete plan;
+        }
+        return status;
+    }
+    return plan;
+}
+
+absl::StatusOr<substrait::Plan> PreparedPlan::BindBatch(
+    const std::vector<ParameterColumn>& columns) const {
+    if (absl::Status status = this->CheckCount(columns.size()); !status.ok()) {
+        return status;
+    }
+    if (this->slots_.empty()) {
+        return this->template_;
+    }
+    const size_t rows = columns[0].size();
+    for (size_t i = 0; i < columns.size(); ++i) {
+        if (columns[i].size() != rows) {
+            return absl::InvalidArgumentError(absl::StrCat(
+                "Parameter ", i + 1, " has ", columns[i].size(),
+                " values, expected ", rows));
+        }
+    }
+    if (rows == 0) {
+        return absl::InvalidArgumentError("Batch has no rows");
+    }
+
+    // Find the unit to replicate (a VALUES row or the relation) and the
+    // repeated field of its parent that holds it.
+    substrait::Plan plan = this->template_;
+    const std::vector<PathStep>& path = this->slots_[0].path;
+    const PathStep& unit_step = path[this->batch_unit_depth_ - 1];
+    Message* parent = &plan;
+    for (size_t i = 0; i + 1 < this->batch_unit_depth_; ++i) {
+        const Reflection* reflection = parent->GetReflection();
+        parent = path[i].index < 0
+                     ? reflection->MutableMessage(parent, path[i].field)
+                     : reflection->MutableRepeatedMessage(parent, path[i].field,
+                                                          path[i].index);
+    }
+    const Reflection* reflection = parent->GetReflection();
+
+    // Detach whatever follows the unit so the copies land right after it.
+    std::vector<std::unique_ptr<Message>> tail;
+    while (reflection->FieldSize(*parent, unit_step.field) >
+           unit_step.index + 1) {
+        tail.emplace_back(reflection->ReleaseLast(parent, unit_step.field));
+    }
+    Message* first =
+        reflection->MutableRepeatedMessage(parent, unit_step.field,
+                                           unit_step.index);
+    std::unique_ptr<Message> prototype(first->New());
+    prototype->CopyFrom(*first);
+
+    for (size_t row = 0; row < rows; ++row) {
+        Message* unit = row == 0 ? first
+                                 : reflection->AddMessage(parent,
+                                                          unit_step.field);
+        if (row != 0) {
+            unit->CopyFrom(*prototype);
+        }
+        if (absl::Status status = this->BindSlots(
+                unit, this->batch_unit_depth_,
+                [&](uint32_t parameter) -> const ParameterValue& {
+                    return columns[parameter][row];
+                });
+            !status.ok()) {
+            return status;
+        }
+    }
+    for (auto it = tail.rbegin(); it != tail.rend(); ++it) {
+        reflection->AddAllocatedMessage(parent, unit_step.field, it->release());
+    }
+    return plan;
+}
+
+}  // namespace pink_perilla
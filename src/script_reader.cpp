@@ -0,0 +1,255 @@
+#include "script_reader.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "absl/strings/ascii.h"
+#include "absl/strings/str_cat.h"
+#include "pink_perilla.hpp"
+
+namespace pink_perilla {
+
+namespace {
+
+// Mapped pages behind the statement being planned are handed back to the
+// kernel in steps of this size, so resident memory stays flat however long
+// the script is.
+constexpr size_t kReleaseStep = 64 << 20;
+
+absl::Status ErrnoError(std::string_view action, const std::string& path) {
+    const std::string message =
+        absl::StrCat("Cannot ", action, " ", path, ": ", std::strerror(errno));
+    return errno == ENOENT ? absl::NotFoundError(message)
+                           : absl::InternalError(message);
+}
+
+// Position of the first `c` in text[from, end), or end.
+size_t Find(std::string_view text, size_t from, char c) {
+    const void* hit =
+        std::memchr(text.data() + from, c, text.size() - from);
+    return hit == nullptr ? text.size()
+                          : static_cast<const char*>(hit) - text.data();
+}
+
+}  // anonymous namespace
+
+absl::StatusOr<std::unique_ptr<ScriptReader>> ScriptReader::Open(
+    const std::string& path) {
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return ErrnoError("open", path);
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        absl::Status status = ErrnoError("stat", path);
+        ::close(fd);
+        return status;
+    }
+    std::unique_ptr<ScriptReader> reader(new ScriptReader());
+    reader->at_eof_ = true;
+    if (info.st_size > 0) {
+        const size_t size = static_cast<size_t>(info.st_size);
+        void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            absl::Status status = ErrnoError("map", path);
+            ::close(fd);
+            return status;
+        }
+        ::madvise(mapping, size, MADV_SEQUENTIAL);
+        reader->mapping_ = mapping;
+        reader->mapping_size_ = size;
+        reader->window_ = {static_cast<const char*>(mapping), size};
+    }
+    ::close(fd);
+    return reader;
+}
+
+ScriptReader::ScriptReader(std::string_view script) : window_(script) {
+    this->at_eof_ = true;
+}
+
+ScriptReader::ScriptReader(std::istream& input, size_t chunk_size)
+    : input_(&input), chunk_size_(std::max<size_t>(chunk_size, 2)) {}
+
+ScriptReader::~ScriptReader() {
+    if (this->mapping_ != nullptr) {
+        ::munmap(this->mapping_, this->mapping_size_);
+    }
+}
+
+size_t ScriptReader::Scan() {
+    const std::string_view text = this->window_;
+    size_t i = this->scanned_;
+    while (i < text.size()) {
+        const char c = text[i];
+        // A '-', '/' or '*' may start a two-byte delimiter; wait for the next
+        // byte rather than guess.
+        const bool has_next = i + 1 < text.size();
+        if (!has_next && !this->at_eof_ && (c == '-' || c == '/' || c == '*')) {
+            break;
+        }
+        const char next = has_next ? text[i + 1] : '\0';
+        switch (this->state_) {
+            case State::kCode:
+                if (c == ';' && this->depth_ == 0) {
+                    this->scanned_ = i;
+                    return i;
+                }
+                if (c == '-' && next == '-') {
+                    this->state_ = State::kLineComment;
+                    i += 2;
+                    continue;
+                }
+                if (c == '/' && next == '*') {
+                    this->state_ = State::kBlockComment;
+                    i += 2;
+                    continue;
+                }
+                if (c == '\'') {
+                    this->state_ = State::kSingleQuote;
+                } else if (c == '"') {
+                    this->state_ = State::kDoubleQuote;
+                } else if (c == '(') {
+                    ++this->depth_;
+                } else if (c == ')' && this->depth_ > 0) {
+                    --this->depth_;
+                }
+                if (!absl::ascii_isspace(static_cast<unsigned char>(c))) {
+                    this->significant_ = true;
+                }
+                ++i;
+                break;
+            // A doubled quote inside a literal closes and reopens it, which
+            // leaves the state where it should be.
+            case State::kSingleQuote:
+                i = Find(text, i, '\'');
+                if (i < text.size()) {
+                    this->state_ = State::kCode;
+                    ++i;
+                }
+                break;
+            case State::kDoubleQuote:
+                i = Find(text, i, '"');
+                if (i < text.size()) {
+                    this->state_ = State::kCode;
+                    ++i;
+                }
+                break;
+            case State::kLineComment:
+                i = Find(text, i, '\n');
+                if (i < text.size()) {
+                    this->state_ = State::kCode;
+                    ++i;
+                }
+                break;
+            case State::kBlockComment:
+                if (c == '*' && next == '/') {
+                    this->state_ = State::kCode;
+                    i += 2;
+                } else {
+                    ++i;
+                }
+                break;
+        }
+    }
+    this->scanned_ = i;
+    return std::string_view::npos;
+}
+
+bool ScriptReader::Refill() {
+    if (this->input_ == nullptr || this->at_eof_) {
+        this->at_eof_ = true;
+        return false;
+    }
+    // Only the unfinished statement is kept; everything before it has been
+    // handed out already.
+    if (this->begin_ > 0) {
+        this->buffer_.erase(0, this->begin_);
+        this->window_offset_ += this->begin_;
+        this->scanned_ -= this->begin_;
+        this->begin_ = 0;
+    }
+    // Read up to a newline so an interactive stream yields each statement as
+    // soon as its line arrives.
+    const size_t old_size = this->buffer_.size();
+    this->buffer_.resize(old_size + this->chunk_size_);
+    this->input_->getline(&this->buffer_[old_size], this->chunk_size_);
+    size_t read = static_cast<size_t>(this->input_->gcount());
+    if (this->input_->bad()) {
+        this->status_ = absl::DataLossError("Failed to read script");
+        read = 0;
+        this->at_eof_ = true;
+    } else if (this->input_->eof()) {
+        this->at_eof_ = true;
+    } else if (this->input_->fail()) {
+        // The chunk filled up before the line ended.
+        this->input_->clear();
+    } else {
+        // getline consumed the newline and stored a terminator in its place.
+        this->buffer_[old_size + read - 1] = '\n';
+    }
+    this->buffer_.resize(old_size + read);
+    this->window_ = this->buffer_;
+    return read > 0 || !this->at_eof_;
+}
+
+void ScriptReader::ReleaseConsumedPages() {
+    if (this->mapping_ == nullptr || this->begin_ - this->released_ < kReleaseStep) {
+        return;
+    }
+    const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    const size_t end = this->begin_ / page * page;
+    ::madvise(static_cast<char*>(this->mapping_) + this->released_,
+              end - this->released_, MADV_DONTNEED);
+    this->released_ = end;
+}
+
+std::optional<ScriptStatement> ScriptReader::Next() {
+    while (this->status_.ok()) {
+        size_t end = this->Scan();
+        if (end == std::string_view::npos && this->at_eof_) {
+            end = this->window_.size();
+            if (this->begin_ >= end) {
+                return std::nullopt;
+            }
+        }
+        if (end != std::string_view::npos) {
+            this->ReleaseConsumedPages();
+            std::string_view sql =
+                this->window_.substr(this->begin_, end - this->begin_);
+            const bool significant = this->significant_;
+            const size_t leading =
+                sql.size() - absl::StripLeadingAsciiWhitespace(sql).size();
+            const ScriptStatement statement{
+                absl::StripAsciiWhitespace(sql),
+                this->window_offset_ + this->begin_ + leading};
+            this->begin_ = this->scanned_ = std::min(end + 1, this->window_.size());
+            this->state_ = State::kCode;
+            this->depth_ = 0;
+            this->significant_ = false;
+            if (significant) {
+                return statement;
+            }
+            continue;
+        }
+        this->Refill();
+    }
+    return std::nullopt;
+}
+
+std::optional<absl::StatusOr<substrait::Plan>> ScriptPlanner::Next() {
+    std::optional<ScriptStatement> statement = this->reader_.Next();
+    if (!statement) {
+        return std::nullopt;
+    }
+    this->statement_ = *statement;
+    return Parse(statement->sql, this->catalog_, this->options_,
+                 &this->stats_);
+}
+
+}  // namespace pink_perilla
@@ -1,175 +1,312 @@
 #include "detail/sql_parser.hpp"
 
-#include <cctype>
-
+#include <chrono>
+#include <limits>
+
+#include "absl/strings/match.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_replace.h"
+#include "detail/arena.hpp"
+#include "detail/binder.hpp"
+#include "detail/cancellation.hpp"
+#include "detail/literal.hpp"
 #include "detail/utils.hpp"
 #include "substrait/algebra.pb.h"
 
+using pink_perilla::lexer::Keyword;
+using pink_perilla::lexer::Token;
+using pink_perilla::lexer::TokenType;
+
 namespace {
 
-// A utility to trim whitespace and semicolons from the right.
-void TrimRight(std::string_view &sv) {
-    if (const size_t last = sv.find_last_not_of(" \t\n\r;");
-        last != std::string_view::npos) {
-        sv.remove_suffix(sv.length() - (last + 1));
-    } else {
-        sv.remove_suffix(sv.length());
+// Binding strength of infix operators, loosest first. Zero means the token
+// does not continue an expression.
+enum Precedence : int {
+    kNoPrecedence = 0,
+    kOrPrecedence,
+    kAndPrecedence,
+    kNotPrecedence,
+    kComparisonPrecedence,  // = <> < <= > >= IS BETWEEN IN LIKE
+    kConcatPrecedence,
+    kAdditivePrecedence,
+    kMultiplicativePrecedence,
+    kUnaryPrecedence,
+};
+
+// Byte ranges a single COPY may be split into. The plan holds one item per
+// range, so this bounds its size however small SPLIT_SIZE is.
+constexpr size_t kMaxCopySplits = 65536;
+
+struct InfixOperator {
+    int precedence = kNoPrecedence;
+    ExprOp op = ExprOp::kNone;
+};
+
+InfixOperator ClassifyInfix(const Token &token) {
+    switch (token.type) {
+        case TokenType::kEq:
+            return {kComparisonPrecedence, ExprOp::kEq};
+        case TokenType::kNe:
+            return {kComparisonPrecedence, ExprOp::kNe};
+        case TokenType::kLt:
+            return {kComparisonPrecedence, ExprOp::kLt};
+        case TokenType::kLe:
+            return {kComparisonPrecedence, ExprOp::kLe};
+        case TokenType::kGt:
+            return {kComparisonPrecedence, ExprOp::kGt};
+        case TokenType::kGe:
+            return {kComparisonPrecedence, ExprOp::kGe};
+        case TokenType::kConcat:
+            return {kConcatPrecedence, ExprOp::kConcat};
+        case TokenType::kPlus:
+            return {kAdditivePrecedence, ExprOp::kAdd};
+        case TokenType::kMinus:
+            return {kAdditivePrecedence, ExprOp::kSubtract};
+        case TokenType::kStar:
+            return {kMultiplicativePrecedence, ExprOp::kMultiply};
+        case TokenType::kSlash:
+            return {kMultiplicativePrecedence, ExprOp::kDivide};
+        case TokenType::kPercent:
+            return {kMultiplicativePrecedence, ExprOp::kModulo};
+        default:
+            break;
+    }
+    switch (token.keyword) {
+        case Keyword::kOr:
+            return {kOrPrecedence, ExprOp::kOr};
+        case Keyword::kAnd:
+            return {kAndPrecedence, ExprOp::kAnd};
+        case Keyword::kLike:
+            return {kComparisonPrecedence, ExprOp::kLike};
+        case Keyword::kIs:
+        case Keyword::kBetween:
+        case Keyword::kIn:
+            return {kComparisonPrecedence, ExprOp::kNone};
+        default:
+            return {};
     }
 }
 
+// Counts one more level of nesting while a construct is parsed. Restores
+// the depth on exit, including levels an operator chain added on top.
+class NestingScope {
+public:
+    explicit NestingScope(size_t *depth) : depth_(depth), saved_(*depth) {
+        ++*depth;
+    }
+    ~NestingScope() {
+        *this->depth_ = this->saved_;
+    }
+    NestingScope(const NestingScope &) = delete;
+    NestingScope &operator=(const NestingScope &) = delete;
+
+private:
+    size_t *depth_;
+    size_t saved_;
+};
+
+// Upper bound on $n, so a typo cannot make a caller bind millions of slots.
+constexpr uint32_t kMaxParameters = 65535;
+
+bool IsIntegerText(std::string_view text) {
+    for (char c : text) {
+        if (c < '0' || c > '9') {
+            return false;
+        }
+    }
+    return true;
+}
+
 }  // anonymous namespace
 
 SqlParser::SqlParser(std::string_view sql,
-                   const std::vector<pink_perilla::TableDefinition>& table_definitions)
-    : sql_view_(sql) {
-    for (const auto& table_def : table_definitions) {
-        table_definitions_.emplace(table_def.name, table_def);
-    }
+                   const pink_perilla::Catalog& catalog,
+                   std::pmr::memory_resource* arena,
+                   pink_perilla::PlanningStats* stats)
+    : sql_view_(sql), arena_(arena), tokens_(arena), catalog_(&catalog),
+      stats_(stats) {
+    const size_t max_ir_nodes = pink_perilla::detail::MaxIrNodes();
+    this->max_ir_nodes_ =
+        max_ir_nodes != 0 ? max_ir_nodes : std::numeric_limits<size_t>::max();
 }
 
 absl::StatusOr<Statement> SqlParser::Parse(
     std::string_view sql,
-    const std::vector<pink_perilla::TableDefinition>& table_definitions) {
-    SqlParser parser(sql, table_definitions);
+    const std::vector<pink_perilla::TableDefinition>& table_definitions,
+    std::pmr::memory_resource* arena) {
+    return Parse(sql, pink_perilla::Catalog::Borrow(table_definitions), arena);
+}
+
+absl::StatusOr<Statement> SqlParser::Parse(
+    std::string_view sql,
+    const pink_perilla::Catalog& catalog,
+    std::pmr::memory_resource* arena,
+    pink_perilla::PlanningStats* stats) {
+    SqlParser parser(sql, catalog, arena, stats);
     return parser.Parse();
 }
 
-void SqlParser::ConsumeWhitespace() {
-    while (true) {
-        if (size_t first = this->sql_view_.find_first_not_of(" \t\n\r");
-            first != std::string_view::npos) {
-            this->sql_view_.remove_prefix(first);
-        } else {
-            this->sql_view_.remove_prefix(this->sql_view_.length());  // Consume all if only whitespace
-            return;
-        }
+absl::StatusOr<Statement> SqlParser::Parse(
+    std::string_view sql,
+    absl::Span<const pink_perilla::lexer::Token> tokens,
+    const pink_perilla::Catalog& catalog,
+    std::pmr::memory_resource* arena) {
+    SqlParser parser(sql, catalog, arena, nullptr);
+    parser.tokens_.assign(tokens.begin(), tokens.end());
+    return parser.ParseTokens();
+}
 
-        if (this->sql_view_.rfind("--", 0) == 0) {
-            if (size_t end_of_line = this->sql_view_.find('\n');
-                end_of_line != std::string_view::npos) {
-                this->sql_view_.remove_prefix(end_of_line + 1);
-            } else {
-                this->sql_view_.remove_prefix(this->sql_view_.length());
-            }
-            continue;
-        }
+const Token &SqlParser::Peek(size_t ahead) const {
+    // The stream always ends with kEnd, so clamping never leaves the vector.
+    const size_t index = std::min(this->pos_ + ahead, this->tokens_.size() - 1);
+    return this->tokens_[index];
+}
 
-        if (this->sql_view_.rfind("/*", 0) == 0) {
-            if (size_t end_of_comment = this->sql_view_.find("*/");
-                end_of_comment != std::string_view::npos) {
-                this->sql_view_.remove_prefix(end_of_comment + 2);
-            } else {
-                // Unclosed comment, treat as end of string
-                this->sql_view_.remove_prefix(this->sql_view_.length());
-            }
-            continue;
-        }
-        return;
+bool SqlParser::AtEnd() const {
+    return this->Peek().type == TokenType::kEnd;
+}
+
+bool SqlParser::ConsumeKeyword(Keyword keyword) {
+    if (this->Peek().keyword == keyword) {
+        ++this->pos_;
+        return true;
     }
+    return false;
 }
 
-bool SqlParser::ConsumeKeyword(const std::string &keyword) {
-    this->ConsumeWhitespace();
-    if (this->sql_view_.length() >= keyword.length() &&
-        (this->sql_view_.length() == keyword.length() ||
-         !std::isalnum(this->sql_view_[keyword.length()]))) {
-        if (strncasecmp(this->sql_view_.data(), keyword.data(), keyword.length()) == 0) {
-            this->sql_view_.remove_prefix(keyword.length());
-            return true;
-        }
+bool SqlParser::ConsumeToken(TokenType type) {
+    if (this->Peek().type == type) {
+        ++this->pos_;
+        return true;
     }
     return false;
 }
 
-absl::StatusOr<std::string> SqlParser::ParseIdentifier() {
-    this->ConsumeWhitespace();
-    size_t i = 0;
-    if (i < this->sql_view_.length() && (std::isalpha(this->sql_view_[i]) || this->sql_view_[i] == '_')) {
-        i++;
-        while (i < this->sql_view_.length() && (std::isalnum(this->sql_view_[i]) || this->sql_view_[i] == '_')) {
-            i++;
-        }
+absl::Status SqlParser::CheckDepth() const {
+    if (this->depth_ > kMaxNestingDepth) {
+        return absl::ResourceExhaustedError(absl::StrCat(
+            "Statement nests deeper than ", kMaxNestingDepth, " levels"));
     }
-    if (i > 0) {
-        std::string identifier = std::string(this->sql_view_.substr(0, i));
-        this->sql_view_.remove_prefix(i);
-        return identifier;
+    return absl::OkStatus();
+}
+
+absl::Status SqlParser::CheckIrNodes() const {
+    if (this->ir_nodes_ > this->max_ir_nodes_) {
+        return absl::ResourceExhaustedError(absl::StrCat(
+            "Statement has more than ", this->max_ir_nodes_,
+            " expression nodes"));
     }
-    return absl::InvalidArgumentError("Failed to parse identifier");
+    return absl::OkStatus();
 }
 
-bool SqlParser::ConsumeChar(char c) {
-    this->ConsumeWhitespace();
-    if (!this->sql_view_.empty() && this->sql_view_.front() == c) {
-        this->sql_view_.remove_prefix(1);
-        return true;
+std::string_view SqlParser::TextBetween(size_t begin, size_t end) const {
+    if (begin >= end) {
+        return {};
     }
-    return false;
+    const char *first = this->tokens_[begin].text.data();
+    const std::string_view last = this->tokens_[end - 1].text;
+    return {first, static_cast<size_t>(last.data() + last.size() - first)};
 }
 
-absl::StatusOr<std::string> SqlParser::ParseType() {
-    this->ConsumeWhitespace();
-    absl::StatusOr<std::string> type_name_status = this->ParseIdentifier();
-    if (!type_name_status.ok()) {
-        return type_name_status.status();
+std::optional<std::string_view> SqlParser::ParseIdentifier() {
+    // Keywords are accepted as identifiers (e.g. a table named "table"); the
+    // grammar only probes for identifiers where a keyword cannot appear.
+    const Token &token = this->Peek();
+    if (token.type == TokenType::kIdentifier) {
+        ++this->pos_;
+        return token.text;
+    }
+    if (token.type == TokenType::kQuotedIdentifier) {
+        ++this->pos_;
+        const std::string_view body = token.text.substr(1, token.text.size() - 2);
+        if (body.find('"') == std::string_view::npos) {
+            return body;
+        }
+        // Only identifiers with escaped quotes need a copy, unescaped
+        // straight into the arena.
+        char *identifier = static_cast<char *>(this->arena_->allocate(body.size(), 1));
+        size_t size = 0;
+        for (size_t i = 0; i < body.size(); ++i) {
+            identifier[size++] = body[i];
+            if (body[i] == '"') {
+                ++i;  // Skip the second quote of an escaped pair.
+            }
+        }
+        return std::string_view(identifier, size);
     }
-    const std::string &type_name = *type_name_status;
+    return std::nullopt;
+}
 
-    std::string full_type = type_name;
-    if (this->ConsumeChar('(')) {
-        full_type += '(';
-        size_t i = 0;
+absl::Status SqlParser::ExpectedIdentifier() const {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Expected identifier before '", this->Peek().text, "'"));
+}
+
+absl::StatusOr<TableName> SqlParser::ParseTableName() {
+    const std::optional<std::string_view> name = this->ParseIdentifier();
+    if (!name) {
+        return this->ExpectedIdentifier();
+    }
+    const pink_perilla::Symbol symbol = this->catalog_->symbol(*name);
+    // An empty catalog means no schemas are known; tables are then inferred
+    // from how the statement uses them.
+    if (!this->catalog_->empty() && this->catalog_->Find(symbol) == nullptr) {
+        return absl::NotFoundError(absl::StrCat("Table not found: ", *name));
+    }
+    return TableName{*name, symbol};
+}
+
+absl::StatusOr<std::string_view> SqlParser::ParseType() {
+    const size_t begin = this->pos_;
+    if (!this->ParseIdentifier()) {
+        return this->ExpectedIdentifier();
+    }
+
+    if (this->ConsumeToken(TokenType::kLParen)) {
         int paren_level = 1;
-        while (i < this->sql_view_.length()) {
-            if (this->sql_view_[i] == '(') {
+        while (!this->AtEnd() && paren_level > 0) {
+            if (this->Peek().type == TokenType::kLParen) {
                 paren_level++;
-            }
-            if (this->sql_view_[i] == ')') {
+            } else if (this->Peek().type == TokenType::kRParen) {
                 paren_level--;
             }
-            if (paren_level == 0) {
-                break;
-            }
-            i++;
+            ++this->pos_;
         }
 
-        if (paren_level == 0) {
-            full_type += std::string(this->sql_view_.substr(0, i));
-            full_type += ')';
-            this->sql_view_.remove_prefix(i + 1);
-        } else {
+        if (paren_level != 0) {
             return absl::InvalidArgumentError(
                 "Mismatched parentheses in type definition");
         }
     }
-    return full_type;
+    return this->TextBetween(begin, this->pos_);
 }
 
 absl::StatusOr<ColumnDef> SqlParser::ParseColumnDef() {
-    auto name_status = this->ParseIdentifier();
-    if (!name_status.ok())
-        return name_status.status();
+    const std::optional<std::string_view> name = this->ParseIdentifier();
+    if (!name)
+        return this->ExpectedIdentifier();
 
     auto type_status = this->ParseType();
     if (!type_status.ok())
         return type_status.status();
 
-    return ColumnDef{*name_status, *type_status};
+    return ColumnDef{*name, *type_status};
 }
 
 absl::StatusOr<CreateTableInfo> SqlParser::ParseCreateTable() {
-    if (!this->ConsumeKeyword("CREATE") || !this->ConsumeKeyword("TABLE")) {
+    if (!this->ConsumeKeyword(Keyword::kCreate) || !this->ConsumeKeyword(Keyword::kTable)) {
         return absl::InvalidArgumentError("Expected 'CREATE TABLE'");
     }
 
-    auto table_name_status = this->ParseIdentifier();
-    if (!table_name_status.ok())
-        return table_name_status.status();
+    const std::optional<std::string_view> table_name = this->ParseIdentifier();
+    if (!table_name)
+        return this->ExpectedIdentifier();
 
-    if (!this->ConsumeChar('('))
+    if (!this->ConsumeToken(TokenType::kLParen))
         return absl::InvalidArgumentError("Expected '(' after table name");
 
-    std::vector<ColumnDef> columns;
+    std::pmr::vector<ColumnDef> columns(this->arena_);
     do {
         auto col_def_status = this->ParseColumnDef();
         if (col_def_status.ok()) {
@@ -177,329 +314,918 @@ absl::StatusOr<CreateTableInfo> SqlParser::ParseCreateTable() {
         } else {
             return col_def_status.status();
         }
-    } while (this->ConsumeChar(','));
+    } while (this->ConsumeToken(TokenType::kComma));
 
-    if (!this->ConsumeChar(')'))
+    if (!this->ConsumeToken(TokenType::kRParen))
         return absl::InvalidArgumentError(
             "Expected ')' after column definitions");
 
-    this->ConsumeWhitespace();
-    if (!this->sql_view_.empty())
+    if (!this->AtEnd())
         return absl::InvalidArgumentError("Unexpected characters after ')'");
 
-    return CreateTableInfo{*table_name_status, columns};
+    return CreateTableInfo{*table_name, std::move(columns)};
 }
 
 absl::StatusOr<DropTableInfo> SqlParser::ParseDropTable() {
-    if (!this->ConsumeKeyword("DROP") || !this->ConsumeKeyword("TABLE")) {
+    if (!this->ConsumeKeyword(Keyword::kDrop) || !this->ConsumeKeyword(Keyword::kTable)) {
         return absl::InvalidArgumentError("Expected 'DROP TABLE'");
     }
-    auto table_name_status = this->ParseIdentifier();
-    if (!table_name_status.ok())
-        return table_name_status.status();
+    const std::optional<std::string_view> table_name = this->ParseIdentifier();
+    if (!table_name)
+        return this->ExpectedIdentifier();
 
-    this->ConsumeWhitespace();
-    if (!this->sql_view_.empty())
+    if (!this->AtEnd())
         return absl::InvalidArgumentError(
             "Unexpected characters after table name");
 
-    return DropTableInfo{*table_name_status};
+    return DropTableInfo{*table_name};
 }
 
-absl::StatusOr<DeleteInfo> SqlParser::ParseDeleteStatement() {
-    if (!this->ConsumeKeyword("DELETE") || !this->ConsumeKeyword("FROM")) {
-        return absl::InvalidArgumentError("Expected 'DELETE FROM'");
+TableRef SqlParser::MakeTableRef(const TableName &table) const {
+    return TableRef{table.name, table.symbol, TableSchema(this->arena_)};
+}
+
+ExprId SqlParser::AddExpr(ExprNode node, size_t begin,
+                          const std::pmr::vector<ExprId> &args) {
+    ExpressionTree &tree = *this->expressions_;
+    node.source = this->TextBetween(begin, this->pos_);
+    node.first_arg = static_cast<uint32_t>(tree.args.size());
+    node.arg_count = static_cast<uint32_t>(args.size());
+    tree.args.insert(tree.args.end(), args.begin(), args.end());
+    tree.nodes.push_back(node);
+    ++this->ir_nodes_;
+    return static_cast<ExprId>(tree.nodes.size() - 1);
+}
+
+absl::StatusOr<ExprId> SqlParser::ParseExpression(int min_precedence) {
+    // Every list the grammar repeats (VALUES rows, select items, operands)
+    // is a list of expressions, so this is the parser's checkpoint.
+    if (pink_perilla::detail::Interrupted()) {
+        return pink_perilla::detail::InterruptionError();
     }
-    auto table_name_status = this->ParseIdentifier();
-    if (!table_name_status.ok())
-        return table_name_status.status();
+    const NestingScope nesting(&this->depth_);
+    if (absl::Status status = this->CheckDepth(); !status.ok()) {
+        return status;
+    }
+    if (absl::Status status = this->CheckIrNodes(); !status.ok()) {
+        return status;
+    }
+    const size_t begin = this->pos_;
+    absl::StatusOr<ExprId> lhs_status = this->ParseUnary();
+    if (!lhs_status.ok()) {
+        return lhs_status.status();
+    }
+    ExprId lhs = *lhs_status;
+
+    while (true) {
+        // NOT only continues an expression as NOT BETWEEN, NOT IN or NOT LIKE.
+        size_t lookahead = 0;
+        if (this->Peek().keyword == Keyword::kNot) {
+            const Keyword next = this->Peek(1).keyword;
+            if (next != Keyword::kBetween && next != Keyword::kIn &&
+                next != Keyword::kLike) {
+                break;
+            }
+            lookahead = 1;
+        }
+        const Token &op_token = this->Peek(lookahead);
+        const InfixOperator infix = ClassifyInfix(op_token);
+        if (infix.precedence == kNoPrecedence ||
+            infix.precedence < min_precedence) {
+            break;
+        }
+        const Keyword keyword = op_token.keyword;
+        this->pos_ += lookahead + 1;
+        // Each operator of a chain puts the nodes so far one level deeper.
+        ++this->depth_;
+        if (absl::Status status = this->CheckDepth(); !status.ok()) {
+            return status;
+        }
+
+        ExprNode node;
+        node.negated = lookahead != 0;
+        std::pmr::vector<ExprId> args(this->arena_);
+        args.push_back(lhs);
+        if (keyword == Keyword::kIs) {
+            node.kind = ExprKind::kIsNull;
+            node.negated = this->ConsumeKeyword(Keyword::kNot);
+            if (!this->ConsumeKeyword(Keyword::kNull)) {
+                return absl::InvalidArgumentError("Expected NULL after IS");
+            }
+        } else if (keyword == Keyword::kBetween) {
+            node.kind = ExprKind::kBetween;
+            for (int bound = 0; bound < 2; ++bound) {
+                if (bound == 1 && !this->ConsumeKeyword(Keyword::kAnd)) {
+                    return absl::InvalidArgumentError(
+                        "Expected AND in BETWEEN");
+                }
+                auto bound_status =
+                    this->ParseExpression(kComparisonPrecedence + 1);
+                if (!bound_status.ok()) {
+                    return bound_status.status();
+                }
+                args.push_back(*bound_status);
+            }
+        } else if (keyword == Keyword::kIn) {
+            node.kind = ExprKind::kInList;
+            if (!this->ConsumeToken(TokenType::kLParen)) {
+                return absl::InvalidArgumentError("Expected '(' after IN");
+            }
+            if (this->Peek().keyword == Keyword::kSelect) {
+                return absl::InvalidArgumentError(
+                    "Subqueries are not supported in IN");
+            }
+            do {
+                auto option_status = this->ParseExpression();
+                if (!option_status.ok()) {
+                    return option_status.status();
+                }
+                args.push_back(*option_status);
+            } while (this->ConsumeToken(TokenType::kComma));
+            if (!this->ConsumeToken(TokenType::kRParen)) {
+                return absl::InvalidArgumentError("Expected ')' after IN list");
+            }
+        } else {
+            // Left-associative: the right operand only takes operators that
+            // bind tighter than this one. AND and OR are variadic, so a run
+            // of either becomes one node instead of a chain as deep as it is
+            // long.
+            node.kind = ExprKind::kBinary;
+            node.op = infix.op;
+            const bool variadic =
+                infix.op == ExprOp::kAnd || infix.op == ExprOp::kOr;
+            do {
+                auto rhs_status = this->ParseExpression(infix.precedence + 1);
+                if (!rhs_status.ok()) {
+                    return rhs_status.status();
+                }
+                args.push_back(*rhs_status);
+            } while (variadic && this->ConsumeKeyword(keyword));
+        }
+        lhs = this->AddExpr(node, begin, args);
+    }
+    return lhs;
+}
 
-    std::optional<std::string> where_clause;
-    if (this->ConsumeKeyword("WHERE")) {
-        this->ConsumeWhitespace();
-        where_clause = std::string(this->sql_view_);
+absl::StatusOr<ExprId> SqlParser::ParseUnary() {
+    const size_t begin = this->pos_;
+    ExprNode node;
+    node.kind = ExprKind::kUnary;
+    int operand_precedence;
+    if (this->ConsumeKeyword(Keyword::kNot)) {
+        node.op = ExprOp::kNot;
+        operand_precedence = kNotPrecedence;
+    } else if (this->ConsumeToken(TokenType::kMinus)) {
+        node.op = ExprOp::kNegate;
+        operand_precedence = kUnaryPrecedence;
+    } else if (this->ConsumeToken(TokenType::kPlus)) {
+        return this->ParseExpression(kUnaryPrecedence);
     } else {
-        this->ConsumeWhitespace();
-        if (!this->sql_view_.empty())
-            return absl::InvalidArgumentError(
-                "Unexpected characters after table name");
+        return this->ParsePrimary();
     }
 
-    return DeleteInfo{*table_name_status, where_clause};
+    auto operand_status = this->ParseExpression(operand_precedence);
+    if (!operand_status.ok()) {
+        return operand_status.status();
+    }
+    ExprNode &operand = (*this->expressions_)[*operand_status];
+    // Fold "-5" into a literal so constants stay constants.
+    if (node.op == ExprOp::kNegate && operand.kind == ExprKind::kLiteral &&
+        (operand.literal == LiteralKind::kInteger ||
+         operand.literal == LiteralKind::kDecimal) &&
+        !operand.negated) {
+        operand.negated = true;
+        operand.source = this->TextBetween(begin, this->pos_);
+        return *operand_status;
+    }
+    std::pmr::vector<ExprId> args(1, *operand_status, this->arena_);
+    return this->AddExpr(node, begin, args);
 }
 
-absl::StatusOr<std::string> SqlParser::ParseSetValue() {
-    this->ConsumeWhitespace();
-    size_t expr_end = 0;
-    int paren_level = 0;
-    while (expr_end < this->sql_view_.length()) {
-        if (this->sql_view_[expr_end] == '(') {
-            paren_level++;
-        } else if (this->sql_view_[expr_end] == ')') {
-            paren_level--;
-        } else if (paren_level == 0 && (this->sql_view_[expr_end] == ',' || this->sql_view_[expr_end] == ';')) {
-            break;
+absl::StatusOr<ExprId> SqlParser::ParsePrimary() {
+    const size_t begin = this->pos_;
+    const Token &token = this->Peek();
+    const std::pmr::vector<ExprId> no_args(this->arena_);
+    ExprNode node;
+
+    switch (token.type) {
+        case TokenType::kNumber:
+            ++this->pos_;
+            node.kind = ExprKind::kLiteral;
+            node.literal = IsIntegerText(token.text) ? LiteralKind::kInteger
+                                                     : LiteralKind::kDecimal;
+            node.text = token.text;
+            return this->AddExpr(node, begin, no_args);
+        case TokenType::kString:
+            ++this->pos_;
+            node.kind = ExprKind::kLiteral;
+            node.literal = LiteralKind::kString;
+            node.text = token.text;
+            return this->AddExpr(node, begin, no_args);
+        case TokenType::kParameter: {
+            ++this->pos_;
+            node.kind = ExprKind::kParameter;
+            node.text = token.text;
+            if (token.text == "?") {
+                if (this->numbered_parameters_) {
+                    return absl::InvalidArgumentError(
+                        "Cannot mix ? and $n placeholders");
+                }
+                node.parameter = this->positional_parameters_++;
+                return this->AddExpr(node, begin, no_args);
+            }
+            if (this->positional_parameters_ != 0) {
+                return absl::InvalidArgumentError(
+                    "Cannot mix ? and $n placeholders");
+            }
+            uint32_t number;
+            if (!absl::SimpleAtoi(token.text.substr(1), &number) ||
+                number == 0 || number > kMaxParameters) {
+                return absl::InvalidArgumentError(
+                    absl::StrCat("Invalid placeholder ", token.text));
+            }
+            this->numbered_parameters_ = true;
+            node.parameter = number - 1;
+            return this->AddExpr(node, begin, no_args);
         }
-        if (paren_level == 0 && (strncasecmp(this->sql_view_.substr(expr_end).data(), "WHERE", 5) == 0)) {
+        case TokenType::kLParen: {
+            ++this->pos_;
+            if (this->Peek().keyword == Keyword::kSelect) {
+                return absl::InvalidArgumentError(
+                    "Subqueries are not supported in expressions");
+            }
+            auto inner_status = this->ParseExpression();
+            if (!inner_status.ok()) {
+                return inner_status.status();
+            }
+            if (!this->ConsumeToken(TokenType::kRParen)) {
+                return absl::InvalidArgumentError(
+                    "Expected ')' after expression");
+            }
+            return *inner_status;
+        }
+        case TokenType::kIdentifier:
+        case TokenType::kQuotedIdentifier:
             break;
+        default:
+            return absl::InvalidArgumentError(absl::StrCat(
+                "Expected expression before '", token.text, "'"));
+    }
+
+    switch (token.keyword) {
+        case Keyword::kNull:
+        case Keyword::kTrue:
+        case Keyword::kFalse:
+            ++this->pos_;
+            node.kind = ExprKind::kLiteral;
+            node.literal = token.keyword == Keyword::kNull
+                               ? LiteralKind::kNull
+                               : LiteralKind::kBoolean;
+            node.text = token.text;
+            return this->AddExpr(node, begin, no_args);
+        case Keyword::kCase:
+            return this->ParseCase();
+        case Keyword::kCast:
+            return this->ParseCast();
+        case Keyword::kNone:
+            break;
+        case Keyword::kLeft:
+            // LEFT(str, n) is a function; anywhere else LEFT starts a join.
+            if (this->Peek(1).type == TokenType::kLParen) {
+                break;
+            }
+            [[fallthrough]];
+        default:
+            return absl::InvalidArgumentError(absl::StrCat(
+                "Expected expression before '", token.text, "'"));
+    }
+
+    if (token.type == TokenType::kIdentifier &&
+        this->Peek(1).type == TokenType::kString) {
+        return this->ParseTypedLiteral();
+    }
+
+    const std::optional<std::string_view> name = this->ParseIdentifier();
+    if (!name) {
+        return this->ExpectedIdentifier();
+    }
+    if (this->Peek().type == TokenType::kLParen) {
+        return this->ParseFunctionCall(*name, begin);
+    }
+    node.kind = ExprKind::kColumn;
+    node.text = *name;
+    if (this->ConsumeToken(TokenType::kDot)) {
+        const std::optional<std::string_view> column = this->ParseIdentifier();
+        if (!column) {
+            return this->ExpectedIdentifier();
         }
-        expr_end++;
+        node.qualifier = *name;
+        node.text = *column;
     }
+    return this->AddExpr(node, begin, no_args);
+}
 
-    if (paren_level != 0) {
-        return absl::InvalidArgumentError("Mismatched parentheses in expression");
+absl::StatusOr<ExprId> SqlParser::ParseTypedLiteral() {
+    const size_t begin = this->pos_;
+    const std::string_view type = this->tokens_[this->pos_++].text;
+    const std::string_view text = this->tokens_[this->pos_++].text;
+    const std::string_view body = pink_perilla::literal::StringBody(text);
+    ExprNode node;
+    node.kind = ExprKind::kLiteral;
+    node.text = text;
+    if (absl::EqualsIgnoreCase(type, "DATE")) {
+        node.literal = LiteralKind::kDate;
+        if (!pink_perilla::literal::ParseDate(body)) {
+            return absl::InvalidArgumentError(
+                absl::StrCat("Invalid DATE literal ", text));
+        }
+    } else if (absl::EqualsIgnoreCase(type, "TIMESTAMP")) {
+        node.literal = LiteralKind::kTimestamp;
+        if (!pink_perilla::literal::ParseTimestamp(body)) {
+            return absl::InvalidArgumentError(
+                absl::StrCat("Invalid TIMESTAMP literal ", text));
+        }
+    } else {
+        return absl::InvalidArgumentError(
+            absl::StrCat("Unsupported typed literal ", type, " ", text));
     }
+    return this->AddExpr(node, begin, std::pmr::vector<ExprId>(this->arena_));
+}
+
+absl::StatusOr<ExprId> SqlParser::ParseFunctionCall(std::string_view name,
+                                                    size_t begin) {
+    if (!this->ConsumeToken(TokenType::kLParen)) {
+        return absl::InvalidArgumentError("Expected '(' after function name");
+    }
+    std::pmr::vector<ExprId> args(this->arena_);
+    if (this->Peek().type == TokenType::kStar) {
+        const size_t star = this->pos_++;
+        ExprNode star_node;
+        star_node.kind = ExprKind::kStar;
+        args.push_back(
+            this->AddExpr(star_node, star, std::pmr::vector<ExprId>(this->arena_)));
+    } else if (this->Peek().type != TokenType::kRParen) {
+        do {
+            auto arg_status = this->ParseExpression();
+            if (!arg_status.ok()) {
+                return arg_status.status();
+            }
+            args.push_back(*arg_status);
+        } while (this->ConsumeToken(TokenType::kComma));
+    }
+    if (!this->ConsumeToken(TokenType::kRParen)) {
+        return absl::InvalidArgumentError(
+            "Expected ')' after function argument");
+    }
+    ExprNode node;
+    node.kind = ExprKind::kFunction;
+    node.text = name;
+    return this->AddExpr(node, begin, args);
+}
+
+absl::StatusOr<ExprId> SqlParser::ParseCase() {
+    const size_t begin = this->pos_;
+    if (!this->ConsumeKeyword(Keyword::kCase)) {
+        return absl::InvalidArgumentError("Expected 'CASE'");
+    }
+    ExprNode node;
+    node.kind = ExprKind::kCase;
+    std::pmr::vector<ExprId> args(this->arena_);
+    if (this->Peek().keyword != Keyword::kWhen) {
+        auto operand_status = this->ParseExpression();
+        if (!operand_status.ok()) {
+            return operand_status.status();
+        }
+        node.case_has_operand = true;
+        args.push_back(*operand_status);
+    }
+    if (this->Peek().keyword != Keyword::kWhen) {
+        return absl::InvalidArgumentError("Expected WHEN in CASE");
+    }
+    while (this->ConsumeKeyword(Keyword::kWhen)) {
+        auto when_status = this->ParseExpression();
+        if (!when_status.ok()) {
+            return when_status.status();
+        }
+        if (!this->ConsumeKeyword(Keyword::kThen)) {
+            return absl::InvalidArgumentError("Expected THEN in CASE");
+        }
+        auto then_status = this->ParseExpression();
+        if (!then_status.ok()) {
+            return then_status.status();
+        }
+        args.push_back(*when_status);
+        args.push_back(*then_status);
+    }
+    if (this->ConsumeKeyword(Keyword::kElse)) {
+        auto else_status = this->ParseExpression();
+        if (!else_status.ok()) {
+            return else_status.status();
+        }
+        node.case_has_else = true;
+        args.push_back(*else_status);
+    }
+    if (!this->ConsumeKeyword(Keyword::kEnd)) {
+        return absl::InvalidArgumentError("Expected END after CASE");
+    }
+    return this->AddExpr(node, begin, args);
+}
+
+absl::StatusOr<ExprId> SqlParser::ParseCast() {
+    const size_t begin = this->pos_;
+    if (!this->ConsumeKeyword(Keyword::kCast) ||
+        !this->ConsumeToken(TokenType::kLParen)) {
+        return absl::InvalidArgumentError("Expected 'CAST('");
+    }
+    auto input_status = this->ParseExpression();
+    if (!input_status.ok()) {
+        return input_status.status();
+    }
+    if (!this->ConsumeKeyword(Keyword::kAs)) {
+        return absl::InvalidArgumentError("Expected AS in CAST");
+    }
+    auto type_status = this->ParseType();
+    if (!type_status.ok()) {
+        return type_status.status();
+    }
+    if (!ParseTypeSpec(*type_status)) {
+        return absl::InvalidArgumentError(
+            absl::StrCat("Unsupported type in CAST: ", *type_status));
+    }
+    if (!this->ConsumeToken(TokenType::kRParen)) {
+        return absl::InvalidArgumentError("Expected ')' after CAST");
+    }
+    ExprNode node;
+    node.kind = ExprKind::kCast;
+    node.text = *type_status;
+    std::pmr::vector<ExprId> args(1, *input_status, this->arena_);
+    return this->AddExpr(node, begin, args);
+}
 
-    std::string expression = std::string(this->sql_view_.substr(0, expr_end));
-    size_t last = expression.find_last_not_of(" \t\n\r");
-    if (last != std::string::npos) {
-        expression = expression.substr(0, last + 1);
+absl::StatusOr<DeleteInfo> SqlParser::ParseDeleteStatement() {
+    if (!this->ConsumeKeyword(Keyword::kDelete) || !this->ConsumeKeyword(Keyword::kFrom)) {
+        return absl::InvalidArgumentError("Expected 'DELETE FROM'");
     }
+    auto table_name_status = this->ParseTableName();
+    if (!table_name_status.ok())
+        return table_name_status.status();
 
-    this->sql_view_.remove_prefix(expr_end);
-    return expression;
+    DeleteInfo info{table_name_status->name, table_name_status->symbol,
+                    kNoExpr, ExpressionTree(this->arena_),
+                    TableSchema(this->arena_)};
+    this->expressions_ = &info.expressions;
+    if (this->ConsumeKeyword(Keyword::kWhere)) {
+        auto where_status = this->ParseExpression();
+        if (!where_status.ok())
+            return where_status.status();
+        info.where_clause = *where_status;
+    }
+    if (!this->AtEnd())
+        return absl::InvalidArgumentError(
+            "Unexpected characters after table name");
+
+    return info;
 }
 
 absl::StatusOr<UpdateInfo> SqlParser::ParseUpdateStatement() {
-    if (!this->ConsumeKeyword("UPDATE"))
+    if (!this->ConsumeKeyword(Keyword::kUpdate))
         return absl::InvalidArgumentError("Expected 'UPDATE'");
 
-    auto table_name_status = this->ParseIdentifier();
+    auto table_name_status = this->ParseTableName();
     if (!table_name_status.ok())
         return table_name_status.status();
 
-    if (!this->ConsumeKeyword("SET"))
+    if (!this->ConsumeKeyword(Keyword::kSet))
         return absl::InvalidArgumentError("Expected 'SET'");
 
-    std::vector<SetClause> set_clauses;
+    UpdateInfo info{table_name_status->name, table_name_status->symbol,
+                    std::pmr::vector<SetClause>(this->arena_),
+                    kNoExpr, ExpressionTree(this->arena_),
+                    TableSchema(this->arena_)};
+    this->expressions_ = &info.expressions;
     do {
-        auto column_name_status = this->ParseIdentifier();
-        if (!column_name_status.ok())
-            return column_name_status.status();
+        const std::optional<std::string_view> column_name =
+            this->ParseIdentifier();
+        if (!column_name)
+            return this->ExpectedIdentifier();
 
-        if (!this->ConsumeChar('='))
+        if (!this->ConsumeToken(TokenType::kEq))
             return absl::InvalidArgumentError("Expected '=' after column name");
 
-        auto value_status = this->ParseSetValue();
+        auto value_status = this->ParseExpression();
         if (!value_status.ok())
             return value_status.status();
 
-        set_clauses.push_back({*column_name_status, *value_status});
-    } while (this->ConsumeChar(','));
+        info.set_clauses.push_back({*column_name, *value_status});
+    } while (this->ConsumeToken(TokenType::kComma));
 
-    std::optional<std::string> where_clause;
-    if (this->ConsumeKeyword("WHERE")) {
+    if (this->ConsumeKeyword(Keyword::kWhere)) {
         auto where_status = this->ParseExpression();
         if (!where_status.ok()) {
             return where_status.status();
         }
-        where_clause = *where_status;
+        info.where_clause = *where_status;
     }
 
-    return UpdateInfo{*table_name_status, set_clauses, where_clause};
+    return info;
 }
 
 
 
 absl::StatusOr<InsertInfo> SqlParser::ParseInsertStatement() {
-    if (!this->ConsumeKeyword("INSERT") || !this->ConsumeKeyword("INTO")) {
+    if (!this->ConsumeKeyword(Keyword::kInsert) || !this->ConsumeKeyword(Keyword::kInto)) {
         return absl::InvalidArgumentError("Expected 'INSERT INTO'");
     }
 
-    auto table_name_status = this->ParseIdentifier();
+    auto table_name_status = this->ParseTableName();
     if (!table_name_status.ok())
         return table_name_status.status();
 
-    if (!this->ConsumeChar('(')) {
+    if (!this->ConsumeToken(TokenType::kLParen)) {
         return absl::InvalidArgumentError("Expected '(' after table name");
     }
 
-    std::vector<std::string> columns;
+    InsertInfo info{table_name_status->name, table_name_status->symbol,
+                    std::pmr::vector<std::string_view>(this->arena_),
+                    std::pmr::vector<ExprId>(this->arena_),
+                    ExpressionTree(this->arena_), TableSchema(this->arena_),
+                    std::pmr::vector<pink_perilla::DataType>(this->arena_)};
+    this->expressions_ = &info.expressions;
     do {
-        auto col_status = this->ParseIdentifier();
-        if (!col_status.ok()) {
-            return col_status.status();
+        const std::optional<std::string_view> column = this->ParseIdentifier();
+        if (!column) {
+            return this->ExpectedIdentifier();
         }
-        columns.push_back(*col_status);
-    } while (this->ConsumeChar(','));
+        info.columns.push_back(*column);
+    } while (this->ConsumeToken(TokenType::kComma));
 
-    if (!this->ConsumeChar(')')) {
+    if (!this->ConsumeToken(TokenType::kRParen)) {
         return absl::InvalidArgumentError("Expected ')' after column list");
     }
 
-    if (!this->ConsumeKeyword("VALUES")) {
+    if (!this->ConsumeKeyword(Keyword::kValues)) {
         return absl::InvalidArgumentError("Expected 'VALUES'");
     }
 
-    if (!this->ConsumeChar('(')) {
-        return absl::InvalidArgumentError("Expected '(' before values");
-    }
-
-    std::vector<std::string> values;
+    // Every row holds one value per listed column.
+    info.row_width = static_cast<uint32_t>(info.columns.size());
     do {
-        this->ConsumeWhitespace();
-        size_t value_end = this->sql_view_.find_first_of(",)");
-        if (value_end == std::string_view::npos) {
-            return absl::InvalidArgumentError("Unterminated values list");
+        if (!this->ConsumeToken(TokenType::kLParen)) {
+            return absl::InvalidArgumentError("Expected '(' before values");
         }
-        values.emplace_back(this->sql_view_.substr(0, value_end));
-        this->sql_view_.remove_prefix(value_end);
-    } while (this->ConsumeChar(','));
+        const size_t row_begin = info.values.size();
+        do {
+            auto value_status = this->ParseExpression();
+            if (!value_status.ok()) {
+                return value_status.status();
+            }
+            info.values.push_back(*value_status);
+        } while (this->ConsumeToken(TokenType::kComma));
+
+        if (!this->ConsumeToken(TokenType::kRParen))
+            return absl::InvalidArgumentError("Expected ')' after values");
 
-    if (!this->ConsumeChar(')'))
-        return absl::InvalidArgumentError("Expected ')' after values");
+        const size_t width = info.values.size() - row_begin;
+        if (width != info.row_width) {
+            return absl::InvalidArgumentError(
+                absl::StrCat("VALUES row has ", width, " values, expected ",
+                             info.row_width));
+        }
+    } while (this->ConsumeToken(TokenType::kComma));
 
-    return InsertInfo{*table_name_status, columns, values};
+    return info;
 }
 
-absl::StatusOr<SelectItem> SqlParser::ParseSelectItem() {
-    this->ConsumeWhitespace();
-    std::string_view original_sv = this->sql_view_;
-
-    auto id1_status = this->ParseIdentifier();
-    if (!id1_status.ok())
-        return id1_status.status();
-    std::string id1 = *id1_status;
-
-    if (this->ConsumeChar('(')) {
-        std::optional<std::string> arg_id;
-        if (!this->ConsumeChar(')')) {
-            auto arg_id_status = this->ParseIdentifier();
-            if (!arg_id_status.ok()) {
-                return arg_id_status.status();
+absl::StatusOr<CopyInfo> SqlParser::ParseCopyStatement() {
+    if (!this->ConsumeKeyword(Keyword::kCopy)) {
+        return absl::InvalidArgumentError("Expected 'COPY'");
+    }
+    absl::StatusOr<TableName> table = this->ParseTableName();
+    if (!table.ok()) {
+        return table.status();
+    }
+    CopyInfo info(this->arena_);
+    info.table_name = table->name;
+    info.table_symbol = table->symbol;
+    if (this->ConsumeToken(TokenType::kLParen)) {
+        do {
+            const std::optional<std::string_view> column = this->ParseIdentifier();
+            if (!column) {
+                return this->ExpectedIdentifier();
             }
-            arg_id = *arg_id_status;
-            if (!this->ConsumeChar(')')) {
+            info.columns.push_back(*column);
+        } while (this->ConsumeToken(TokenType::kComma));
+        if (!this->ConsumeToken(TokenType::kRParen)) {
+            return absl::InvalidArgumentError("Expected ')' after column list");
+        }
+    }
+    if (!this->ConsumeKeyword(Keyword::kFrom)) {
+        return absl::InvalidArgumentError("Expected 'FROM' after table name");
+    }
+    absl::StatusOr<std::string_view> path = this->ParseString();
+    if (!path.ok()) {
+        return path.status();
+    }
+    info.path = *path;
+    // WITH is optional before the option list, as in PostgreSQL.
+    if (this->ConsumeKeyword(Keyword::kWith) ||
+        this->Peek().type == TokenType::kLParen) {
+        if (absl::Status status = this->ParseCopyOptions(&info); !status.ok()) {
+            return status;
+        }
+    }
+    return info;
+}
+
+absl::Status SqlParser::ParseCopyOptions(CopyInfo* info) {
+    if (!this->ConsumeToken(TokenType::kLParen)) {
+        return absl::InvalidArgumentError("Expected '(' after WITH");
+    }
+    // The first option that only makes sense for CSV, if any.
+    std::string_view csv_option;
+    do {
+        const Token& option = this->Peek();
+        if (option.type != TokenType::kIdentifier) {
+            return absl::InvalidArgumentError(
+                absl::StrCat("Expected COPY option before '", option.text, "'"));
+        }
+        ++this->pos_;
+        const std::string_view name = option.text;
+        if (absl::EqualsIgnoreCase(name, "FORMAT")) {
+            const Token& value = this->Peek();
+            std::string_view format;
+            if (value.type == TokenType::kIdentifier) {
+                format = value.text;
+            } else if (value.type == TokenType::kString) {
+                format = pink_perilla::literal::StringBody(value.text);
+            } else {
+                return absl::InvalidArgumentError("Expected format after FORMAT");
+            }
+            ++this->pos_;
+            if (absl::EqualsIgnoreCase(format, "csv")) {
+                info->format = CopyFormat::kCsv;
+            } else if (absl::EqualsIgnoreCase(format, "parquet")) {
+                info->format = CopyFormat::kParquet;
+            } else if (absl::EqualsIgnoreCase(format, "arrow")) {
+                info->format = CopyFormat::kArrow;
+            } else {
                 return absl::InvalidArgumentError(
-                    "Expected ')' after function argument");
+                    absl::StrCat("Unsupported COPY format '", format, "'"));
             }
+            continue;
         }
+        if (absl::EqualsIgnoreCase(name, "SPLIT_SIZE") ||
+            absl::EqualsIgnoreCase(name, "FILE_SIZE")) {
+            absl::StatusOr<uint64_t> size = this->ParseCount();
+            if (!size.ok()) {
+                return size.status();
+            }
+            if (*size == 0) {
+                return absl::InvalidArgumentError(
+                    absl::StrCat(name, " must be positive"));
+            }
+            if (absl::EqualsIgnoreCase(name, "SPLIT_SIZE")) {
+                info->split_size = *size;
+            } else {
+                info->file_size = *size;
+            }
+            continue;
+        }
+        if (csv_option.empty()) {
+            csv_option = name;
+        }
+        if (absl::EqualsIgnoreCase(name, "HEADER")) {
+            if (this->Peek().type == TokenType::kNumber) {
+                absl::StatusOr<uint64_t> lines = this->ParseCount();
+                if (!lines.ok()) {
+                    return lines.status();
+                }
+                info->header_lines = *lines;
+            } else if (this->ConsumeKeyword(Keyword::kFalse)) {
+                info->header_lines = 0;
+            } else {
+                this->ConsumeKeyword(Keyword::kTrue);
+                info->header_lines = 1;
+            }
+            continue;
+        }
+        std::string_view* target = nullptr;
+        if (absl::EqualsIgnoreCase(name, "DELIMITER")) {
+            target = &info->delimiter;
+        } else if (absl::EqualsIgnoreCase(name, "QUOTE")) {
+            target = &info->quote;
+        } else if (absl::EqualsIgnoreCase(name, "ESCAPE")) {
+            target = &info->escape;
+        } else if (absl::EqualsIgnoreCase(name, "NULL")) {
+            absl::StatusOr<std::string_view> null_string = this->ParseString();
+            if (!null_string.ok()) {
+                return null_string.status();
+            }
+            info->null_string = *null_string;
+            continue;
+        } else {
+            return absl::InvalidArgumentError(
+                absl::StrCat("Unknown COPY option '", name, "'"));
+        }
+        absl::StatusOr<std::string_view> value = this->ParseString();
+        if (!value.ok()) {
+            return value.status();
+        }
+        if (value->empty()) {
+            return absl::InvalidArgumentError(
+                absl::StrCat(name, " must not be empty"));
+        }
+        *target = *value;
+    } while (this->ConsumeToken(TokenType::kComma));
+    if (!this->ConsumeToken(TokenType::kRParen)) {
+        return absl::InvalidArgumentError("Expected ')' after COPY options");
+    }
 
-        std::string_view sv_after_func = this->sql_view_;
-        size_t len = original_sv.length() - sv_after_func.length();
-        std::string func_expr = std::string(original_sv.substr(0, len));
+    if (!csv_option.empty() && info->format != CopyFormat::kCsv) {
+        return absl::InvalidArgumentError(
+            absl::StrCat(csv_option, " only applies to FORMAT csv"));
+    }
+    if (info->split_size != 0) {
+        // The planner never opens the file, so it cannot learn its size.
+        if (info->file_size == 0) {
+            return absl::InvalidArgumentError("SPLIT_SIZE requires FILE_SIZE");
+        }
+        if (info->format == CopyFormat::kArrow) {
+            return absl::InvalidArgumentError(
+                "Arrow files cannot be split; drop SPLIT_SIZE");
+        }
+        if (info->split_count() > kMaxCopySplits) {
+            return absl::InvalidArgumentError(absl::StrCat(
+                "SPLIT_SIZE yields more than ", kMaxCopySplits, " splits"));
+        }
+    }
+    return absl::OkStatus();
+}
 
-        if (this->ConsumeKeyword("OVER")) {
-            if (!this->ConsumeChar('('))
-                return absl::InvalidArgumentError("Expected '(' after OVER");
-            if (!this->ConsumeKeyword("PARTITION") || !this->ConsumeKeyword("BY")) {
-                return absl::InvalidArgumentError("Expected 'PARTITION BY'");
-            }
-            std::vector<std::string> partition_cols;
-            do {
-                auto col_status = this->ParseIdentifier();
-                if (!col_status.ok())
-                    return col_status.status();
-                partition_cols.push_back(*col_status);
-            } while (this->ConsumeChar(','));
+absl::StatusOr<std::string_view> SqlParser::ParseString() {
+    const Token& token = this->Peek();
+    if (token.type != TokenType::kString) {
+        return absl::InvalidArgumentError(
+            absl::StrCat("Expected string literal before '", token.text, "'"));
+    }
+    ++this->pos_;
+    const std::string_view body = pink_perilla::literal::StringBody(token.text);
+    if (body.find('\'') == std::string_view::npos) {
+        return body;
+    }
+    return pink_perilla::CopyToArena(this->arena_,
+                                     absl::StrReplaceAll(body, {{"''", "'"}}));
+}
 
-            if (!this->ConsumeChar(')'))
-                return absl::InvalidArgumentError(
-                    "Expected ')' after PARTITION BY clause");
+absl::StatusOr<uint64_t> SqlParser::ParseCount() {
+    const Token& token = this->Peek();
+    std::optional<int64_t> value;
+    if (token.type == TokenType::kNumber) {
+        value = pink_perilla::literal::ParseInteger(token.text, false);
+    }
+    if (!value) {
+        return absl::InvalidArgumentError(
+            absl::StrCat("Expected unsigned integer before '", token.text, "'"));
+    }
+    ++this->pos_;
+    return static_cast<uint64_t>(*value);
+}
 
-            size_t full_len = original_sv.length() - this->sql_view_.length();
-            std::string full_expr =
-                std::string(original_sv.substr(0, full_len));
-            this->ConsumeWhitespace();
-            return SelectItem{SelectItemType::WINDOW_FUNCTION,
-                              full_expr,
-                              std::nullopt,
-                              WindowFunctionInfo{id1, partition_cols}};
+absl::StatusOr<SelectItem> SqlParser::ParseSelectItem() {
+    const size_t begin = this->pos_;
+
+    auto expr_status = this->ParseExpression();
+    if (!expr_status.ok())
+        return expr_status.status();
+    const ExprId expr = *expr_status;
+    const std::string_view expression = this->TextBetween(begin, this->pos_);
+    const ExprNode &node = (*this->expressions_)[expr];
+    const bool is_call = node.kind == ExprKind::kFunction;
+    const std::string_view function_name = node.text;
+
+    if (this->ConsumeKeyword(Keyword::kOver)) {
+        if (!is_call)
+            return absl::InvalidArgumentError(
+                "OVER must follow a function call");
+        if (!this->ConsumeToken(TokenType::kLParen))
+            return absl::InvalidArgumentError("Expected '(' after OVER");
+        if (!this->ConsumeKeyword(Keyword::kPartition) || !this->ConsumeKeyword(Keyword::kBy)) {
+            return absl::InvalidArgumentError("Expected 'PARTITION BY'");
         }
+        std::pmr::vector<ExprId> partition_by(this->arena_);
+        do {
+            auto partition_status = this->ParseExpression();
+            if (!partition_status.ok())
+                return partition_status.status();
+            partition_by.push_back(*partition_status);
+        } while (this->ConsumeToken(TokenType::kComma));
 
-        this->ConsumeWhitespace();
-        return SelectItem{SelectItemType::AGGREGATE_FUNCTION,
-                          func_expr,
-                          AggregateFunctionInfo{id1, arg_id.value_or("")},
-                          std::nullopt};
+        if (!this->ConsumeToken(TokenType::kRParen))
+            return absl::InvalidArgumentError(
+                "Expected ')' after PARTITION BY clause");
+
+        const std::string_view full_expr =
+            this->TextBetween(begin, this->pos_);
+        return SelectItem{SelectItemType::WINDOW_FUNCTION,
+                          full_expr,
+                          expr,
+                          WindowFunctionInfo{function_name, std::move(partition_by)},
+                          /*alias=*/{}};
     }
 
-    std::string expression = id1;
-    if (this->ConsumeKeyword("AS")) {
-        auto alias_status = this->ParseIdentifier();
-        if (!alias_status.ok())
-            return alias_status.status();
-        expression += " AS " + *alias_status;
+    std::string_view alias;
+    const Token &next = this->Peek();
+    if (this->ConsumeKeyword(Keyword::kAs) ||
+        (next.type == TokenType::kIdentifier && next.keyword == Keyword::kNone) ||
+        next.type == TokenType::kQuotedIdentifier) {
+        const std::optional<std::string_view> alias_name =
+            this->ParseIdentifier();
+        if (!alias_name)
+            return this->ExpectedIdentifier();
+        alias = *alias_name;
     }
 
-    this->ConsumeWhitespace();
-    return SelectItem{
-        SelectItemType::COLUMN, expression, std::nullopt, std::nullopt};
+    const SelectItemType type = is_call && IsAggregateFunction(function_name)
+                                    ? SelectItemType::AGGREGATE_FUNCTION
+                                    : SelectItemType::COLUMN;
+    return SelectItem{type, expression, expr, std::nullopt, alias};
 }
 
 absl::StatusOr<SelectInfo> SqlParser::ParseSelectStatement() {
-    if (!this->ConsumeKeyword("SELECT"))
+    if (!this->ConsumeKeyword(Keyword::kSelect))
         return absl::InvalidArgumentError("Expected 'SELECT'");
+    const NestingScope nesting(&this->depth_);
+    if (absl::Status status = this->CheckDepth(); !status.ok()) {
+        return status;
+    }
 
-    std::vector<SelectItem> select_items;
-    if (this->ConsumeChar('*')) {
-        select_items.push_back(
-            {SelectItemType::COLUMN, "*", std::nullopt, std::nullopt});
+    SelectInfo result_info(this->arena_);
+    // A subquery in FROM parses into its own tree; restore ours afterwards.
+    ExpressionTree *const outer_expressions = this->expressions_;
+    this->expressions_ = &result_info.expressions;
+
+    if (this->ConsumeToken(TokenType::kStar)) {
+        result_info.select_items.push_back(
+            {SelectItemType::COLUMN, "*", kNoExpr, std::nullopt, /*alias=*/{}});
     } else {
         do {
             auto item_status = this->ParseSelectItem();
             if (!item_status.ok())
                 return item_status.status();
-            select_items.push_back(*item_status);
-        } while (this->ConsumeChar(','));
+            result_info.select_items.push_back(std::move(*item_status));
+        } while (this->ConsumeToken(TokenType::kComma));
     }
 
-    if (!this->ConsumeKeyword("FROM")) {
+    if (!this->ConsumeKeyword(Keyword::kFrom)) {
         return absl::InvalidArgumentError("Expected 'FROM'");
     }
-    SelectInfo result_info;
-    result_info.select_items = select_items;
 
-    this->ConsumeWhitespace();
-    if (this->ConsumeChar('(')) {
+    if (this->ConsumeToken(TokenType::kLParen)) {
         auto subquery_status = this->ParseSelectStatement();
+        this->expressions_ = &result_info.expressions;
         if (!subquery_status.ok())
             return subquery_status.status();
-        if (!this->ConsumeChar(')'))
+        if (!this->ConsumeToken(TokenType::kRParen))
             return absl::InvalidArgumentError("Expected ')' after subquery");
         result_info.from_subquery =
             std::make_unique<SelectInfo>(std::move(*subquery_status));
     } else {
-        auto table_name_status = this->ParseIdentifier();
+        auto table_name_status = this->ParseTableName();
         if (!table_name_status.ok())
             return table_name_status.status();
-        result_info.from_table = *table_name_status;
-        if (this->table_definitions_.find(*result_info.from_table) == this->table_definitions_.end()) {
-            // We don't have table definitions for all tests, so we'll just check for the ones that do.
-            // return absl::NotFoundError(absl::StrCat("Table not found: ", *result_info.from_table));
-        }
+        result_info.from_table = this->MakeTableRef(*table_name_status);
     }
 
     while (true) {
-        this->ConsumeWhitespace();
-        if (this->sql_view_.empty()) break;
+        if (this->AtEnd()) break;
 
-        if (this->ConsumeChar(',')) {
-            auto next_table_status = this->ParseIdentifier();
+        if (this->ConsumeToken(TokenType::kComma)) {
+            auto next_table_status = this->ParseTableName();
             if (!next_table_status.ok())
                 return next_table_status.status();
-            result_info.cross_join_tables.push_back(*next_table_status);
+            result_info.cross_join_tables.push_back(
+                this->MakeTableRef(*next_table_status));
             continue;
         }
 
         JoinType join_type;
-        if (this->ConsumeKeyword("INNER")) {
+        if (this->ConsumeKeyword(Keyword::kInner)) {
             join_type = JoinType::INNER;
-        } else if (this->ConsumeKeyword("LEFT")) {
-            this->ConsumeKeyword("OUTER");
+        } else if (this->ConsumeKeyword(Keyword::kLeft)) {
+            this->ConsumeKeyword(Keyword::kOuter);
             join_type = JoinType::LEFT;
         } else {
             break;
         }
 
-        if (!this->ConsumeKeyword("JOIN"))
+        if (!this->ConsumeKeyword(Keyword::kJoin))
             return absl::InvalidArgumentError("Expected 'JOIN'");
 
-        auto join_table_status = this->ParseIdentifier();
+        auto join_table_status = this->ParseTableName();
         if (!join_table_status.ok())
             return join_table_status.status();
 
-        if (!this->ConsumeKeyword("ON"))
+        if (!this->ConsumeKeyword(Keyword::kOn))
             return absl::InvalidArgumentError("Expected 'ON'");
 
         auto on_condition_status = this->ParseExpression();
@@ -507,10 +1233,11 @@ absl::StatusOr<SelectInfo> SqlParser::ParseSelectStatement() {
             return on_condition_status.status();
 
         result_info.joins.push_back(
-            {join_type, *join_table_status, *on_condition_status});
+            {join_type, this->MakeTableRef(*join_table_status),
+             *on_condition_status});
     }
 
-    if (this->ConsumeKeyword("WHERE")) {
+    if (this->ConsumeKeyword(Keyword::kWhere)) {
         auto where_status = this->ParseExpression();
         if (!where_status.ok()) {
             return where_status.status();
@@ -518,80 +1245,127 @@ absl::StatusOr<SelectInfo> SqlParser::ParseSelectStatement() {
         result_info.where_condition = *where_status;
     }
 
-    if (this->ConsumeKeyword("GROUP") && this->ConsumeKeyword("BY")) {
+    if (this->ConsumeKeyword(Keyword::kGroup) && this->ConsumeKeyword(Keyword::kBy)) {
         do {
-            auto col_name_status = this->ParseIdentifier();
-            if (!col_name_status.ok())
-                return col_name_status.status();
-            result_info.group_by_columns.push_back(*col_name_status);
-        } while (this->ConsumeChar(','));
+            auto group_status = this->ParseExpression();
+            if (!group_status.ok())
+                return group_status.status();
+            result_info.group_by.push_back(*group_status);
+        } while (this->ConsumeToken(TokenType::kComma));
     }
 
-    if (this->ConsumeKeyword("ORDER") && this->ConsumeKeyword("BY")) {
+    if (this->ConsumeKeyword(Keyword::kOrder) && this->ConsumeKeyword(Keyword::kBy)) {
         do {
-            auto col_name_status = this->ParseIdentifier();
-            if (!col_name_status.ok())
-                return col_name_status.status();
+            auto sort_status = this->ParseExpression();
+            if (!sort_status.ok())
+                return sort_status.status();
 
             SortInfo sort_info;
-            sort_info.column = *col_name_status;
-            if (this->ConsumeKeyword("DESC")) {
+            sort_info.expr = *sort_status;
+            if (this->ConsumeKeyword(Keyword::kDesc)) {
                 sort_info.direction = SortDirection::DESC_NULLS_LAST;
             } else {
-                this->ConsumeKeyword("ASC");
+                this->ConsumeKeyword(Keyword::kAsc);
                 sort_info.direction = SortDirection::ASC_NULLS_FIRST;
             }
             result_info.order_by_columns.push_back(sort_info);
-        } while (this->ConsumeChar(','));
+        } while (this->ConsumeToken(TokenType::kComma));
     }
 
-    if (this->ConsumeKeyword("LIMIT")) {
-        this->ConsumeWhitespace();
-        size_t i = 0;
-        while (i < this->sql_view_.length() && std::isdigit(this->sql_view_[i])) {
-            i++;
-        }
-        if (i > 0) {
+    if (this->ConsumeKeyword(Keyword::kLimit)) {
+        const Token &limit_token = this->Peek();
+        if (limit_token.type == TokenType::kNumber) {
             auto limit_val_status =
-                pink_perilla::utils::StringToLongOptional(this->sql_view_.substr(0, i));
+                pink_perilla::utils::StringToLongOptional(limit_token.text);
             if (!limit_val_status)
                 return absl::InvalidArgumentError(
                     "Failed to parse LIMIT value");
             result_info.limit = *limit_val_status;
-            this->sql_view_.remove_prefix(i);
+            ++this->pos_;
         } else {
             return absl::InvalidArgumentError(
                 "LIMIT must be followed by a number");
         }
     }
 
-    this->ConsumeWhitespace();
+    this->expressions_ = outer_expressions;
     return result_info;
 }
 
 absl::StatusOr<Statement> SqlParser::Parse() {
-    this->ConsumeWhitespace();
-    TrimRight(this->sql_view_);
+    // A request that waited out its deadline in a queue does no work at all.
+    if (pink_perilla::detail::Interrupted()) {
+        return pink_perilla::detail::InterruptionError();
+    }
+    std::chrono::steady_clock::time_point tokenize_start;
+    if (this->stats_ != nullptr) {
+        tokenize_start = std::chrono::steady_clock::now();
+    }
+    auto tokens_status = pink_perilla::lexer::Tokenize(this->sql_view_, this->arena_);
+    if (this->stats_ != nullptr) {
+        this->stats_->tokenize_ns =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - tokenize_start)
+                .count();
+    }
+    if (!tokens_status.ok()) {
+        return tokens_status.status();
+    }
+    this->tokens_ = std::move(*tokens_status);
+    if (this->stats_ != nullptr) {
+        this->stats_->tokens = this->tokens_.size() - 1;
+    }
+    return this->ParseTokens();
+}
 
-    if (strncasecmp(this->sql_view_.data(), "SELECT", 6) == 0) {
-        return this->ParseSelectStatement();
+absl::StatusOr<Statement> SqlParser::ParseTokens() {
+    // Trailing semicolons terminate the statement; they are not part of it.
+    while (this->tokens_.size() > 1 &&
+           this->tokens_[this->tokens_.size() - 2].type ==
+               TokenType::kSemicolon) {
+        this->tokens_.erase(this->tokens_.end() - 2);
     }
-    if (strncasecmp(this->sql_view_.data(), "CREATE", 6) == 0) {
-        return this->ParseCreateTable();
+
+    if (pink_perilla::detail::Interrupted()) {
+        return pink_perilla::detail::InterruptionError();
     }
-    if (strncasecmp(this->sql_view_.data(), "DROP", 4) == 0) {
-        return this->ParseDropTable();
+    absl::StatusOr<Statement> statement = this->ParseStatement();
+    if (!statement.ok()) {
+        return statement;
     }
-    if (strncasecmp(this->sql_view_.data(), "DELETE", 6) == 0) {
-        return this->ParseDeleteStatement();
+    if (!this->AtEnd()) {
+        return absl::InvalidArgumentError(
+            absl::StrCat("Unexpected token '", this->Peek().text, "'"));
     }
-    if (strncasecmp(this->sql_view_.data(), "UPDATE", 6) == 0) {
-        return this->ParseUpdateStatement();
+    if (pink_perilla::detail::Interrupted()) {
+        return pink_perilla::detail::InterruptionError();
     }
-    if (strncasecmp(this->sql_view_.data(), "INSERT", 6) == 0) {
-        return this->ParseInsertStatement();
+    if (absl::Status status = pink_perilla::binder::Bind(
+            *statement, *this->catalog_, this->arena_);
+        !status.ok()) {
+        return status;
     }
+    return statement;
+}
 
-    return absl::InvalidArgumentError(
-        "Failed to parse SQL statement or statement not supported.");
-}
\ No newline at end of file
+absl::StatusOr<Statement> SqlParser::ParseStatement() {
+    switch (this->Peek().keyword) {
+        case Keyword::kSelect:
+            return this->ParseSelectStatement();
+        case Keyword::kCreate:
+            return this->ParseCreateTable();
+        case Keyword::kDrop:
+            return this->ParseDropTable();
+        case Keyword::kDelete:
+            return this->ParseDeleteStatement();
+        case Keyword::kUpdate:
+            return this->ParseUpdateStatement();
+        case Keyword::kInsert:
+            return this->ParseInsertStatement();
+        case Keyword::kCopy:
+            return this->ParseCopyStatement();
+        default:
+            return absl::InvalidArgumentError(
+                "Failed to parse SQL statement or statement not supported.");
+    }
+}
@@ -0,0 +1,429 @@
+#include "detail/structural_index.hpp"
+
+#include <array>
+#include <cstring>
+
+#include "absl/strings/str_cat.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define PINK_PERILLA_HAVE_X86_SIMD 1
+#endif
+
+namespace pink_perilla::lexer {
+
+namespace {
+
+constexpr size_t kBlockSize = 64;
+
+// Per-block character classes, bit i describing byte i of the block.
+struct BlockMasks {
+    uint64_t whitespace = 0;
+    uint64_t single_quote = 0;
+    uint64_t double_quote = 0;
+    uint64_t dash = 0;
+    uint64_t slash = 0;
+    uint64_t star = 0;
+    uint64_t newline = 0;
+    uint64_t word = 0;
+};
+
+using ClassifyFn = void (*)(const char *block, BlockMasks *masks);
+
+enum CharClass : uint8_t {
+    kWhitespace = 1 << 0,
+    kSingleQuote = 1 << 1,
+    kDoubleQuote = 1 << 2,
+    kDash = 1 << 3,
+    kSlash = 1 << 4,
+    kStar = 1 << 5,
+    kNewline = 1 << 6,
+    kWord = 1 << 7,
+};
+
+constexpr std::array<uint8_t, 256> BuildCharClassTable() {
+    std::array<uint8_t, 256> table{};
+    table[' '] = kWhitespace;
+    table['\t'] = kWhitespace;
+    table['\r'] = kWhitespace;
+    table['\n'] = kWhitespace | kNewline;
+    table['\''] = kSingleQuote;
+    table['"'] = kDoubleQuote;
+    table['-'] = kDash;
+    table['/'] = kSlash;
+    table['*'] = kStar;
+    table['_'] = kWord;
+    for (int c = '0'; c <= '9'; ++c) {
+        table[c] = kWord;
+    }
+    for (int c = 'a'; c <= 'z'; ++c) {
+        table[c] = kWord;
+        table[c - 'a' + 'A'] = kWord;
+    }
+    return table;
+}
+
+constexpr std::array<uint8_t, 256> kCharClass = BuildCharClassTable();
+
+void ClassifyScalar(const char *block, BlockMasks *masks) {
+    *masks = BlockMasks{};
+    for (size_t i = 0; i < kBlockSize; ++i) {
+        const uint8_t cls = kCharClass[static_cast<uint8_t>(block[i])];
+        if (cls == 0) {
+            continue;
+        }
+        const uint64_t bit = uint64_t{1} << i;
+        if (cls & kWhitespace) masks->whitespace |= bit;
+        if (cls & kSingleQuote) masks->single_quote |= bit;
+        if (cls & kDoubleQuote) masks->double_quote |= bit;
+        if (cls & kDash) masks->dash |= bit;
+        if (cls & kSlash) masks->slash |= bit;
+        if (cls & kStar) masks->star |= bit;
+        if (cls & kNewline) masks->newline |= bit;
+        if (cls & kWord) masks->word |= bit;
+    }
+}
+
+#ifdef PINK_PERILLA_HAVE_X86_SIMD
+
+__attribute__((target("sse2"))) inline uint64_t MoveMask(__m128i m,
+                                                          size_t offset) {
+    return static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(m)))
+           << offset;
+}
+
+__attribute__((target("avx2"))) inline uint64_t MoveMask(__m256i m,
+                                                          size_t offset) {
+    return static_cast<uint64_t>(
+               static_cast<uint32_t>(_mm256_movemask_epi8(m)))
+           << offset;
+}
+
+__attribute__((target("sse2"))) void ClassifySse2(const char *block,
+                                                   BlockMasks *masks) {
+    *masks = BlockMasks{};
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i cr = _mm_set1_epi8('\r');
+    const __m128i lf = _mm_set1_epi8('\n');
+    const __m128i single_quote = _mm_set1_epi8('\'');
+    const __m128i double_quote = _mm_set1_epi8('"');
+    const __m128i dash = _mm_set1_epi8('-');
+    const __m128i slash = _mm_set1_epi8('/');
+    const __m128i star = _mm_set1_epi8('*');
+    const __m128i underscore = _mm_set1_epi8('_');
+    const __m128i case_bit = _mm_set1_epi8(0x20);
+    const __m128i lower_a = _mm_set1_epi8('a');
+    const __m128i digit_zero = _mm_set1_epi8('0');
+    const __m128i max_letter = _mm_set1_epi8(25);
+    const __m128i max_digit = _mm_set1_epi8(9);
+
+    for (size_t offset = 0; offset < kBlockSize; offset += 16) {
+        const __m128i v = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(block + offset));
+        const __m128i is_lf = _mm_cmpeq_epi8(v, lf);
+        masks->whitespace |= MoveMask(_mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, tab)),
+            _mm_or_si128(_mm_cmpeq_epi8(v, cr), is_lf)), offset);
+        masks->newline |= MoveMask(is_lf, offset);
+        masks->single_quote |=
+            MoveMask(_mm_cmpeq_epi8(v, single_quote), offset);
+        masks->double_quote |=
+            MoveMask(_mm_cmpeq_epi8(v, double_quote), offset);
+        masks->dash |= MoveMask(_mm_cmpeq_epi8(v, dash), offset);
+        masks->slash |= MoveMask(_mm_cmpeq_epi8(v, slash), offset);
+        masks->star |= MoveMask(_mm_cmpeq_epi8(v, star), offset);
+        // Unsigned range checks: x <= k  <=>  min(x, k) == x.
+        const __m128i letter =
+            _mm_sub_epi8(_mm_or_si128(v, case_bit), lower_a);
+        const __m128i digit = _mm_sub_epi8(v, digit_zero);
+        masks->word |= MoveMask(_mm_or_si128(
+            _mm_or_si128(
+                _mm_cmpeq_epi8(_mm_min_epu8(letter, max_letter), letter),
+                _mm_cmpeq_epi8(_mm_min_epu8(digit, max_digit), digit)),
+            _mm_cmpeq_epi8(v, underscore)), offset);
+    }
+}
+
+__attribute__((target("avx2"))) void ClassifyAvx2(const char *block,
+                                                   BlockMasks *masks) {
+    *masks = BlockMasks{};
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i cr = _mm256_set1_epi8('\r');
+    const __m256i lf = _mm256_set1_epi8('\n');
+    const __m256i single_quote = _mm256_set1_epi8('\'');
+    const __m256i double_quote = _mm256_set1_epi8('"');
+    const __m256i dash = _mm256_set1_epi8('-');
+    const __m256i slash = _mm256_set1_epi8('/');
+    const __m256i star = _mm256_set1_epi8('*');
+    const __m256i underscore = _mm256_set1_epi8('_');
+    const __m256i case_bit = _mm256_set1_epi8(0x20);
+    const __m256i lower_a = _mm256_set1_epi8('a');
+    const __m256i digit_zero = _mm256_set1_epi8('0');
+    const __m256i max_letter = _mm256_set1_epi8(25);
+    const __m256i max_digit = _mm256_set1_epi8(9);
+
+    for (size_t offset = 0; offset < kBlockSize; offset += 32) {
+        const __m256i v = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i *>(block + offset));
+        const __m256i is_lf = _mm256_cmpeq_epi8(v, lf);
+        masks->whitespace |= MoveMask(_mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, space),
+                            _mm256_cmpeq_epi8(v, tab)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, cr), is_lf)), offset);
+        masks->newline |= MoveMask(is_lf, offset);
+        masks->single_quote |=
+            MoveMask(_mm256_cmpeq_epi8(v, single_quote), offset);
+        masks->double_quote |=
+            MoveMask(_mm256_cmpeq_epi8(v, double_quote), offset);
+        masks->dash |= MoveMask(_mm256_cmpeq_epi8(v, dash), offset);
+        masks->slash |= MoveMask(_mm256_cmpeq_epi8(v, slash), offset);
+        masks->star |= MoveMask(_mm256_cmpeq_epi8(v, star), offset);
+        const __m256i letter =
+            _mm256_sub_epi8(_mm256_or_si256(v, case_bit), lower_a);
+        const __m256i digit = _mm256_sub_epi8(v, digit_zero);
+        masks->word |= MoveMask(_mm256_or_si256(
+            _mm256_or_si256(
+                _mm256_cmpeq_epi8(_mm256_min_epu8(letter, max_letter),
+                                  letter),
+                _mm256_cmpeq_epi8(_mm256_min_epu8(digit, max_digit), digit)),
+            _mm256_cmpeq_epi8(v, underscore)), offset);
+    }
+}
+
+#endif  // PINK_PERILLA_HAVE_X86_SIMD
+
+ClassifyFn SelectClassifier(ScanKernel kernel) {
+#ifdef PINK_PERILLA_HAVE_X86_SIMD
+    switch (kernel) {
+        case ScanKernel::kAvx2:
+            if (__builtin_cpu_supports("avx2")) {
+                return ClassifyAvx2;
+            }
+            [[fallthrough]];
+        case ScanKernel::kSse2:
+            if (__builtin_cpu_supports("sse2")) {
+                return ClassifySse2;
+            }
+            [[fallthrough]];
+        case ScanKernel::kScalar:
+            break;
+    }
+#endif
+    (void)kernel;
+    return ClassifyScalar;
+}
+
+void SetRange(std::pmr::vector<uint64_t> &bits, size_t begin, size_t end) {
+    for (size_t pos = begin; pos < end;) {
+        const size_t word = pos / 64;
+        const size_t bit = pos % 64;
+        const size_t count = std::min<size_t>(64 - bit, end - pos);
+        const uint64_t mask =
+            count == 64 ? ~uint64_t{0} : ((uint64_t{1} << count) - 1) << bit;
+        bits[word] |= mask;
+        pos += count;
+    }
+}
+
+void ClearRange(std::pmr::vector<uint64_t> &bits, size_t begin, size_t end) {
+    for (size_t pos = begin; pos < end;) {
+        const size_t word = pos / 64;
+        const size_t bit = pos % 64;
+        const size_t count = std::min<size_t>(64 - bit, end - pos);
+        const uint64_t mask =
+            count == 64 ? ~uint64_t{0} : ((uint64_t{1} << count) - 1) << bit;
+        bits[word] &= ~mask;
+        pos += count;
+    }
+}
+
+// First position >= pos whose bit is clear, capped at `limit`.
+size_t NextClearBit(const std::pmr::vector<uint64_t> &bits, size_t pos,
+                    size_t limit) {
+    if (pos >= limit) {
+        return limit;
+    }
+    size_t word = pos / 64;
+    uint64_t inverted = ~bits[word] & (~uint64_t{0} << (pos % 64));
+    while (inverted == 0) {
+        if (++word == bits.size()) {
+            return limit;
+        }
+        inverted = ~bits[word];
+    }
+    return std::min(word * 64 + __builtin_ctzll(inverted), limit);
+}
+
+// First position >= pos whose bit is set, capped at `limit`.
+size_t NextSetBit(const std::pmr::vector<uint64_t> &bits, size_t pos,
+                  size_t limit) {
+    if (pos >= limit) {
+        return limit;
+    }
+    size_t word = pos / 64;
+    uint64_t set = bits[word] & (~uint64_t{0} << (pos % 64));
+    while (set == 0) {
+        if (++word == bits.size()) {
+            return limit;
+        }
+        set = bits[word];
+    }
+    return std::min(word * 64 + __builtin_ctzll(set), limit);
+}
+
+enum class ScanState { kCode, kSingleQuote, kDoubleQuote, kLineComment,
+                       kBlockComment };
+
+}  // anonymous namespace
+
+ScanKernel DetectScanKernel() {
+#ifdef PINK_PERILLA_HAVE_X86_SIMD
+    static const ScanKernel kernel = [] {
+        if (__builtin_cpu_supports("avx2")) {
+            return ScanKernel::kAvx2;
+        }
+        if (__builtin_cpu_supports("sse2")) {
+            return ScanKernel::kSse2;
+        }
+        return ScanKernel::kScalar;
+    }();
+    return kernel;
+#else
+    return ScanKernel::kScalar;
+#endif
+}
+
+absl::StatusOr<StructuralIndex> StructuralIndex::Build(std::string_view sql) {
+    return Build(sql, DetectScanKernel());
+}
+
+absl::StatusOr<StructuralIndex> StructuralIndex::Build(
+    std::string_view sql, ScanKernel kernel,
+    std::pmr::memory_resource* resource) {
+    const ClassifyFn classify = SelectClassifier(kernel);
+    const size_t n = sql.size();
+    const size_t blocks = (n + kBlockSize - 1) / kBlockSize;
+
+    StructuralIndex index(resource);
+    index.size_ = n;
+    index.skip_.assign(blocks, 0);
+    index.word_.assign(blocks, 0);
+    index.quote_close_.assign(blocks, 0);
+
+    auto at = [sql, n](size_t pos) { return pos < n ? sql[pos] : '\0'; };
+
+    ScanState state = ScanState::kCode;
+    size_t span_begin = 0;
+    // Candidates before this position belong to a delimiter already handled,
+    // e.g. the second '-' of "--" or the '*' of "/*".
+    size_t resume = 0;
+    char tail[kBlockSize];
+
+    for (size_t b = 0; b < blocks; ++b) {
+        const size_t base = b * kBlockSize;
+        const char *block = sql.data() + base;
+        if (n - base < kBlockSize) {
+            std::memset(tail, 0, sizeof(tail));
+            std::memcpy(tail, block, n - base);
+            block = tail;
+        }
+        BlockMasks masks;
+        classify(block, &masks);
+        // |= keeps the '/' of a "*/" that closed a comment in the previous
+        // block.
+        index.skip_[b] |= masks.whitespace;
+        index.word_[b] = masks.word;
+
+        uint64_t candidates = masks.single_quote | masks.double_quote |
+                              masks.dash | masks.slash | masks.star |
+                              masks.newline;
+        while (candidates != 0) {
+            const size_t pos = base + __builtin_ctzll(candidates);
+            candidates &= candidates - 1;
+            if (pos < resume) {
+                continue;
+            }
+            const char c = sql[pos];
+            switch (state) {
+                case ScanState::kCode:
+                    if (c == '\'' || c == '"') {
+                        state = c == '\'' ? ScanState::kSingleQuote
+                                          : ScanState::kDoubleQuote;
+                        span_begin = pos;
+                    } else if (c == '-' && at(pos + 1) == '-') {
+                        state = ScanState::kLineComment;
+                        span_begin = pos;
+                        resume = pos + 2;
+                    } else if (c == '/' && at(pos + 1) == '*') {
+                        state = ScanState::kBlockComment;
+                        span_begin = pos;
+                        resume = pos + 2;
+                    }
+                    break;
+                case ScanState::kSingleQuote:
+                case ScanState::kDoubleQuote: {
+                    const char quote =
+                        state == ScanState::kSingleQuote ? '\'' : '"';
+                    if (c != quote) {
+                        break;
+                    }
+                    if (at(pos + 1) == quote) {
+                        resume = pos + 2;  // Escaped quote.
+                        break;
+                    }
+                    index.quote_close_[pos / 64] |= uint64_t{1} << (pos % 64);
+                    ClearRange(index.skip_, span_begin, pos + 1);
+                    state = ScanState::kCode;
+                    break;
+                }
+                case ScanState::kLineComment:
+                    if (c == '\n') {
+                        SetRange(index.skip_, span_begin, pos + 1);
+                        state = ScanState::kCode;
+                    }
+                    break;
+                case ScanState::kBlockComment:
+                    if (c == '*' && at(pos + 1) == '/') {
+                        SetRange(index.skip_, span_begin, pos + 2);
+                        resume = pos + 2;
+                        state = ScanState::kCode;
+                    }
+                    break;
+            }
+        }
+    }
+
+    switch (state) {
+        case ScanState::kSingleQuote:
+        case ScanState::kDoubleQuote:
+            return absl::InvalidArgumentError(absl::StrCat(
+                "Unterminated quoted literal at offset ", span_begin));
+        case ScanState::kLineComment:
+        case ScanState::kBlockComment:
+            // Unclosed comment, treat as end of string
+            SetRange(index.skip_, span_begin, n);
+            break;
+        case ScanState::kCode:
+            break;
+    }
+    return index;
+}
+
+size_t StructuralIndex::NextSignificant(size_t pos) const {
+    return NextClearBit(this->skip_, pos, this->size_);
+}
+
+size_t StructuralIndex::WordEnd(size_t pos) const {
+    return NextClearBit(this->word_, pos, this->size_);
+}
+
+size_t StructuralIndex::QuoteEnd(size_t pos) const {
+    // Escaped quotes are never marked, so the next mark is this literal's
+    // own closing quote, even when another literal follows without a gap.
+    const size_t close = NextSetBit(this->quote_close_, pos + 1, this->size_);
+    return close < this->size_ ? close + 1 : this->size_;
+}
+
+}  // namespace pink_perilla::lexer
@@ -2,7 +2,20 @@
 
 #include <absl/log/log.h>
 
-#include "detail/utils.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/match.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_replace.h"
+#include "detail/cancellation.hpp"
+#include "detail/literal.hpp"
 #include "substrait/algebra.pb.h"
 #include "substrait/type.pb.h"
 
@@ -26,184 +39,854 @@ substrait::SortField_SortDirection ConvertSortDirection(SortDirection direction)
     }
 }
 
+constexpr std::string_view kExtensionsBase =
+    "https://github.com/substrait-io/substrait/blob/main/extensions/";
+// Functions the planner emits but no standard extension file declares.
+constexpr std::string_view kUnresolvedUri = "urn:pink_perilla:unresolved";
+
+// How a function's declaration types its arguments, which decides the
+// compound name ("name:arg_arg") it is declared under.
+enum class DeclaredArguments {
+    // Declared once over `any`: "equal:any_any".
+    kAny,
+    // Declared once over booleans: "and:bool".
+    kBoolean,
+    // Declared once per argument type: "add:i32_i32", "add:fp64_fp64".
+    kTyped,
+};
+
+struct FunctionDeclaration {
+    std::string_view function;
+    std::string_view file;
+    DeclaredArguments arguments;
+    // For a variadic function, how many arguments its declaration lists.
+    // Calls with more still use that compound name. 0 if not variadic.
+    size_t variadic_arguments = 0;
+};
+
+// The standard extension file that declares each function the planner emits,
+// and how that file names it.
+constexpr FunctionDeclaration kFunctionDeclarations[] = {
+    {"equal", "functions_comparison.yaml", DeclaredArguments::kAny},
+    {"not_equal", "functions_comparison.yaml", DeclaredArguments::kAny},
+    {"lt", "functions_comparison.yaml", DeclaredArguments::kAny},
+    {"lte", "functions_comparison.yaml", DeclaredArguments::kAny},
+    {"gt", "functions_comparison.yaml", DeclaredArguments::kAny},
+    {"gte", "functions_comparison.yaml", DeclaredArguments::kAny},
+    {"is_null", "functions_comparison.yaml", DeclaredArguments::kAny},
+    {"is_not_null", "functions_comparison.yaml", DeclaredArguments::kAny},
+    {"between", "functions_comparison.yaml", DeclaredArguments::kAny},
+    {"coalesce", "functions_comparison.yaml", DeclaredArguments::kAny, 2},
+    {"and", "functions_boolean.yaml", DeclaredArguments::kBoolean, 1},
+    {"or", "functions_boolean.yaml", DeclaredArguments::kBoolean, 1},
+    {"not", "functions_boolean.yaml", DeclaredArguments::kBoolean},
+    {"add", "functions_arithmetic.yaml", DeclaredArguments::kTyped},
+    {"subtract", "functions_arithmetic.yaml", DeclaredArguments::kTyped},
+    {"multiply", "functions_arithmetic.yaml", DeclaredArguments::kTyped},
+    {"divide", "functions_arithmetic.yaml", DeclaredArguments::kTyped},
+    {"modulus", "functions_arithmetic.yaml", DeclaredArguments::kTyped},
+    {"negate", "functions_arithmetic.yaml", DeclaredArguments::kTyped},
+    {"abs", "functions_arithmetic.yaml", DeclaredArguments::kTyped},
+    {"sum", "functions_arithmetic.yaml", DeclaredArguments::kTyped},
+    {"avg", "functions_arithmetic.yaml", DeclaredArguments::kTyped},
+    {"min", "functions_arithmetic.yaml", DeclaredArguments::kTyped},
+    {"max", "functions_arithmetic.yaml", DeclaredArguments::kTyped},
+    {"row_number", "functions_arithmetic.yaml", DeclaredArguments::kTyped},
+    {"rank", "functions_arithmetic.yaml", DeclaredArguments::kTyped},
+    {"dense_rank", "functions_arithmetic.yaml", DeclaredArguments::kTyped},
+    {"concat", "functions_string.yaml", DeclaredArguments::kTyped, 1},
+    {"like", "functions_string.yaml", DeclaredArguments::kTyped},
+    {"lower", "functions_string.yaml", DeclaredArguments::kTyped},
+    {"upper", "functions_string.yaml", DeclaredArguments::kTyped},
+    {"trim", "functions_string.yaml", DeclaredArguments::kTyped},
+    {"substring", "functions_string.yaml", DeclaredArguments::kTyped},
+    {"char_length", "functions_string.yaml", DeclaredArguments::kTyped},
+    {"replace", "functions_string.yaml", DeclaredArguments::kTyped},
+    {"count", "functions_aggregate_generic.yaml", DeclaredArguments::kAny},
+};
+
+const FunctionDeclaration* FindDeclaration(std::string_view function) {
+    for (const FunctionDeclaration& declaration : kFunctionDeclarations) {
+        if (declaration.function == function) {
+            return &declaration;
+        }
+    }
+    return nullptr;
 }
 
-substrait::Plan ToSubstrait(const SelectInfo& info) {
-    substrait::Plan plan;
-    substrait::Rel* current_rel;
+// Substrait's short type names, used to build compound function names such
+// as "add:i32_i32".
+std::string_view ShortTypeName(DataType type) {
+    switch (type) {
+        case DataType::kBoolean:
+            return "bool";
+        case DataType::kI8:
+            return "i8";
+        case DataType::kI16:
+            return "i16";
+        case DataType::kI32:
+            return "i32";
+        case DataType::kI64:
+            return "i64";
+        case DataType::kFp32:
+            return "fp32";
+        case DataType::kFp64:
+            return "fp64";
+        case DataType::kString:
+            return "str";
+        case DataType::kVarChar:
+            return "vchar";
+        case DataType::kFixedChar:
+            return "fchar";
+        case DataType::kBinary:
+            return "vbin";
+        case DataType::kFixedBinary:
+            return "fbin";
+        case DataType::kDate:
+            return "date";
+        case DataType::kTime:
+            return "time";
+        case DataType::kTimestamp:
+            return "ts";
+        case DataType::kTimestampTz:
+            return "tstz";
+        case DataType::kIntervalYear:
+            return "iyear";
+        case DataType::kIntervalDay:
+            return "iday";
+        case DataType::kDecimal:
+            return "dec";
+        case DataType::kUuid:
+            return "uuid";
+        default:
+            return "any";
+    }
+}
 
-    if (info.from_subquery) {
-        substrait::Plan sub_plan = ToSubstrait(**info.from_subquery);
-        if (sub_plan.relations_size() > 0 && sub_plan.relations(0).has_root()) {
-            current_rel = new substrait::Rel(sub_plan.relations(0).root().input());
-        } else {
-            return {};
-        }
-    } else if (info.from_table) {
-        substrait::ReadRel* read_rel = new substrait::ReadRel();
-        read_rel->mutable_named_table()->add_names(*info.from_table);
-        current_rel = new substrait::Rel();
-        current_rel->set_allocated_read(read_rel);
-    } else {
-        return {};
-    }
-
-    for (const auto& cross_join_table : info.cross_join_tables) {
-        substrait::CrossRel* cross_rel = new substrait::CrossRel();
-        cross_rel->set_allocated_left(current_rel);
-        substrait::ReadRel* right_read = new substrait::ReadRel();
-        right_read->mutable_named_table()->add_names(cross_join_table);
-        substrait::Rel* right_rel = new substrait::Rel();
-        right_rel->set_allocated_read(right_read);
-        cross_rel->set_allocated_right(right_rel);
-        current_rel = new substrait::Rel();
-        current_rel->set_allocated_cross(cross_rel);
-    }
-
-    for (const auto& join_info : info.joins) {
-        substrait::JoinRel* join_rel = new substrait::JoinRel();
-        if (join_info.type == JoinType::INNER) {
-            join_rel->set_type(substrait::JoinRel::JOIN_TYPE_INNER);
-        } else {
-            join_rel->set_type(substrait::JoinRel::JOIN_TYPE_LEFT);
+// Sets `out` to `spec`. Returns false, leaving `out` untouched, for types
+// Substrait cannot express without more information than the IR carries.
+bool SetType(const TypeSpec& spec, bool nullable, substrait::Type* out) {
+    const auto nullability = nullable
+                                 ? substrait::Type::NULLABILITY_NULLABLE
+                                 : substrait::Type::NULLABILITY_REQUIRED;
+    switch (spec.type) {
+        case DataType::kBoolean:
+            out->mutable_bool_()->set_nullability(nullability);
+            return true;
+        case DataType::kI8:
+            out->mutable_i8()->set_nullability(nullability);
+            return true;
+        case DataType::kI16:
+            out->mutable_i16()->set_nullability(nullability);
+            return true;
+        case DataType::kI32:
+            out->mutable_i32()->set_nullability(nullability);
+            return true;
+        case DataType::kI64:
+            out->mutable_i64()->set_nullability(nullability);
+            return true;
+        case DataType::kFp32:
+            out->mutable_fp32()->set_nullability(nullability);
+            return true;
+        case DataType::kFp64:
+            out->mutable_fp64()->set_nullability(nullability);
+            return true;
+        case DataType::kString:
+            out->mutable_string()->set_nullability(nullability);
+            return true;
+        case DataType::kBinary:
+            out->mutable_binary()->set_nullability(nullability);
+            return true;
+        case DataType::kDate:
+            out->mutable_date()->set_nullability(nullability);
+            return true;
+        case DataType::kTime:
+            out->mutable_time()->set_nullability(nullability);
+            return true;
+        case DataType::kTimestamp:
+            out->mutable_timestamp()->set_nullability(nullability);
+            return true;
+        case DataType::kTimestampTz:
+            out->mutable_timestamp_tz()->set_nullability(nullability);
+            return true;
+        case DataType::kIntervalYear:
+            out->mutable_interval_year()->set_nullability(nullability);
+            return true;
+        case DataType::kIntervalDay:
+            out->mutable_interval_day()->set_nullability(nullability);
+            return true;
+        case DataType::kUuid:
+            out->mutable_uuid()->set_nullability(nullability);
+            return true;
+        case DataType::kVarChar: {
+            if (spec.length <= 0) {
+                out->mutable_string()->set_nullability(nullability);
+                return true;
+            }
+            substrait::Type::VarChar* varchar = out->mutable_varchar();
+            varchar->set_length(spec.length);
+            varchar->set_nullability(nullability);
+            return true;
         }
-        join_rel->set_allocated_left(current_rel);
-        join_rel->set_allocated_right(new substrait::Rel());
-        join_rel->mutable_right()->set_allocated_read(new substrait::ReadRel());
-        join_rel->mutable_right()->mutable_read()->mutable_named_table()->add_names(join_info.table);
-        substrait::Expression* condition = new substrait::Expression();
-        substrait::Expression::ScalarFunction* scalar_fn = condition->mutable_scalar_function();
-        scalar_fn->set_function_reference(0);
-        substrait::FunctionArgument* arg = scalar_fn->add_arguments();
-        arg->mutable_value()->mutable_literal()->set_string(join_info.on_condition);
-        join_rel->set_allocated_expression(condition);
-        current_rel = new substrait::Rel();
-        current_rel->set_allocated_join(join_rel);
-    }
-
-    if (info.where_condition.has_value()) {
-        substrait::FilterRel* filter_rel = new substrait::FilterRel();
-        filter_rel->set_allocated_input(current_rel);
-
-        substrait::Expression* condition = filter_rel->mutable_condition();
-        substrait::Expression::ScalarFunction* scalar_fn =
-            condition->mutable_scalar_function();
-        scalar_fn->set_function_reference(0);  // Placeholder
-        substrait::FunctionArgument* arg = scalar_fn->add_arguments();
-        arg->mutable_value()->mutable_literal()->set_string(
-            *info.where_condition);
-
-        current_rel = new substrait::Rel();
-        current_rel->set_allocated_filter(filter_rel);
-    }
-
-    bool has_aggregates = false;
-    for (const auto& item : info.select_items) {
-        if (item.type == SelectItemType::AGGREGATE_FUNCTION) {
-            has_aggregates = true;
-            break;
+        case DataType::kFixedChar: {
+            if (spec.length <= 0) {
+                return false;
+            }
+            substrait::Type::FixedChar* fixed_char = out->mutable_fixed_char();
+            fixed_char->set_length(spec.length);
+            fixed_char->set_nullability(nullability);
+            return true;
+        }
+        case DataType::kDecimal: {
+            if (spec.precision <= 0) {
+                return false;
+            }
+            substrait::Type::Decimal* decimal = out->mutable_decimal();
+            decimal->set_precision(spec.precision);
+            decimal->set_scale(spec.scale);
+            decimal->set_nullability(nullability);
+            return true;
         }
+        default:
+            return false;
     }
+}
 
-    if (has_aggregates) {
-        substrait::AggregateRel* agg_rel = new substrait::AggregateRel();
-        agg_rel->set_allocated_input(current_rel);
-        if (!info.group_by_columns.empty()) {
-            substrait::AggregateRel::Grouping* grouping = agg_rel->add_groupings();
-            for (uint32_t i = 0; i < info.group_by_columns.size(); ++i) {
-                substrait::Expression* expr = agg_rel->add_grouping_expressions();
-                expr->mutable_literal()->set_string(info.group_by_columns[i]);
-                grouping->add_expression_references(i);
+// A DECIMAL from the catalog or the binder carries no precision; it gets
+// DECIMAL(38, 0), as a bare DECIMAL does in CAST.
+bool SetType(DataType type, bool nullable, substrait::Type* out) {
+    TypeSpec spec;
+    spec.type = type;
+    if (type == DataType::kDecimal) {
+        spec.precision = 38;
+    }
+    return SetType(spec, nullable, out);
+}
+
+// Sets the output type of a function call, leaving it unset when SetType()
+// cannot express the type rather than emitting an empty one.
+template <typename Function>
+void SetOutputType(DataType type, Function* out) {
+    if (!SetType(type, true, out->mutable_output_type())) {
+        out->clear_output_type();
+    }
+}
+
+// Declares extension functions in the plan as the emitters first use them and
+// hands out their anchors. URI and function anchors both start at 1.
+class ExtensionRegistry {
+public:
+    explicit ExtensionRegistry(substrait::Plan* plan) : plan_(plan) {}
+
+    // `name` is the plain function name; `signature` the compound name the
+    // function is declared under.
+    uint32_t FunctionAnchor(std::string_view name, std::string_view signature) {
+        const auto known = this->functions_.find(signature);
+        if (known != this->functions_.end()) {
+            return known->second;
+        }
+        const uint32_t anchor =
+            static_cast<uint32_t>(this->functions_.size() + 1);
+        this->functions_.emplace(signature, anchor);
+
+        substrait::extensions::SimpleExtensionDeclaration::ExtensionFunction*
+            function = this->plan_->add_extensions()->mutable_extension_function();
+        function->set_extension_uri_reference(this->UriAnchor(name));
+        function->set_function_anchor(anchor);
+        function->set_name(signature.data(), signature.size());
+        return anchor;
+    }
+
+private:
+    uint32_t UriAnchor(std::string_view function) {
+        const FunctionDeclaration* declaration = FindDeclaration(function);
+        std::string uri =
+            declaration != nullptr
+                ? absl::StrCat(kExtensionsBase, declaration->file)
+                : std::string(kUnresolvedUri);
+        const auto known = this->uris_.find(uri);
+        if (known != this->uris_.end()) {
+            return known->second;
+        }
+        const uint32_t anchor = static_cast<uint32_t>(this->uris_.size() + 1);
+        substrait::extensions::SimpleExtensionURI* extension_uri =
+            this->plan_->add_extension_uris();
+        extension_uri->set_extension_uri_anchor(anchor);
+        extension_uri->set_uri(uri);
+        this->uris_.emplace(std::move(uri), anchor);
+        return anchor;
+    }
+
+    substrait::Plan* plan_;
+    absl::flat_hash_map<std::string, uint32_t> functions_;
+    absl::flat_hash_map<std::string, uint32_t> uris_;
+};
+
+std::string_view BinaryFunctionName(ExprOp op) {
+    switch (op) {
+        case ExprOp::kAnd:
+            return "and";
+        case ExprOp::kOr:
+            return "or";
+        case ExprOp::kEq:
+            return "equal";
+        case ExprOp::kNe:
+            return "not_equal";
+        case ExprOp::kLt:
+            return "lt";
+        case ExprOp::kLe:
+            return "lte";
+        case ExprOp::kGt:
+            return "gt";
+        case ExprOp::kGe:
+            return "gte";
+        case ExprOp::kLike:
+            return "like";
+        case ExprOp::kConcat:
+            return "concat";
+        case ExprOp::kAdd:
+            return "add";
+        case ExprOp::kSubtract:
+            return "subtract";
+        case ExprOp::kMultiply:
+            return "multiply";
+        case ExprOp::kDivide:
+            return "divide";
+        case ExprOp::kModulo:
+            return "modulus";
+        default:
+            return "unknown";
+    }
+}
+
+// Turns bound IR expressions of one statement into Substrait expressions.
+class ExpressionEmitter {
+public:
+    ExpressionEmitter(const ExpressionTree& tree, ExtensionRegistry* registry)
+        : tree_(tree), registry_(registry) {}
+
+    void Emit(ExprId id, substrait::Expression* out) const {
+        const ExprNode& node = this->tree_[id];
+        if (node.field >= 0) {
+            EmitFieldReference(node.field, out);
+            return;
+        }
+        switch (node.kind) {
+            case ExprKind::kLiteral:
+                this->EmitLiteral(node, out->mutable_literal());
+                return;
+            case ExprKind::kUnary:
+                if (node.op == ExprOp::kNot) {
+                    this->EmitCall("not", {this->tree_.arg(node, 0)},
+                                   DataType::kBoolean, out);
+                } else {
+                    this->EmitCall("negate", {this->tree_.arg(node, 0)},
+                                   node.type, out);
+                }
+                return;
+            case ExprKind::kBinary:
+                this->EmitBinary(node, out);
+                return;
+            case ExprKind::kIsNull:
+                this->EmitCall(node.negated ? "is_not_null" : "is_null",
+                               this->Args(node), DataType::kBoolean, out);
+                return;
+            case ExprKind::kBetween:
+                this->EmitNegatable(node, "between", out);
+                return;
+            case ExprKind::kInList:
+                this->EmitInList(node, out);
+                return;
+            case ExprKind::kCase:
+                this->EmitCase(node, out);
+                return;
+            case ExprKind::kCast: {
+                substrait::Expression::Cast* cast = out->mutable_cast();
+                SetType(*ParseTypeSpec(node.text), true, cast->mutable_type());
+                this->Emit(this->tree_.arg(node, 0), cast->mutable_input());
+                return;
+            }
+            case ExprKind::kFunction:
+                this->EmitCall(absl::AsciiStrToLower(node.text),
+                               this->Args(node), node.type, out);
+                return;
+            case ExprKind::kParameter: {
+                substrait::Expression::DynamicParameter* parameter =
+                    out->mutable_dynamic_parameter();
+                parameter->set_parameter_reference(node.parameter);
+                SetType(node.type, true, parameter->mutable_type());
+                return;
             }
+            case ExprKind::kColumn:
+            case ExprKind::kStar:
+                break;
         }
-        for (const auto& item : info.select_items) {
-            if (item.type == SelectItemType::AGGREGATE_FUNCTION) {
-                substrait::AggregateRel::Measure* measure = agg_rel->add_measures();
-                measure->mutable_measure()->set_function_reference(0);
+        // Unbound leaves cannot be evaluated; keep their text visible.
+        out->mutable_literal()->set_string(node.source.data(),
+                                           node.source.size());
+    }
+
+    // Emits an aggregate call as an AggregateRel measure.
+    void EmitMeasure(ExprId id, substrait::AggregateFunction* out) const {
+        const ExprNode& node = this->tree_[id];
+        const std::vector<ExprId> args = this->ValueArgs(node);
+        const std::string name = absl::AsciiStrToLower(node.text);
+        out->set_function_reference(this->Anchor(name, args));
+        for (ExprId arg : args) {
+            this->Emit(arg, out->add_arguments()->mutable_value());
+        }
+        SetOutputType(node.type, out);
+        out->set_phase(substrait::AGGREGATION_PHASE_INITIAL_TO_RESULT);
+        out->set_invocation(substrait::AggregateFunction::AGGREGATION_INVOCATION_ALL);
+    }
+
+    // Emits the call under OVER as a window function.
+    void EmitWindowFunction(
+        ExprId id,
+        substrait::ConsistentPartitionWindowRel::WindowRelFunction* out) const {
+        const ExprNode& node = this->tree_[id];
+        const std::vector<ExprId> args = this->ValueArgs(node);
+        const std::string name = absl::AsciiStrToLower(node.text);
+        out->set_function_reference(this->Anchor(name, args));
+        for (ExprId arg : args) {
+            this->Emit(arg, out->add_arguments()->mutable_value());
+        }
+        SetOutputType(node.type, out);
+        out->set_phase(substrait::AGGREGATION_PHASE_INITIAL_TO_RESULT);
+        out->set_invocation(substrait::AggregateFunction::AGGREGATION_INVOCATION_ALL);
+    }
+
+    static void EmitFieldReference(int32_t field, substrait::Expression* out) {
+        substrait::Expression::FieldReference* selection =
+            out->mutable_selection();
+        selection->mutable_direct_reference()->mutable_struct_field()->set_field(
+            field);
+        selection->mutable_root_reference();
+    }
+
+private:
+    std::vector<ExprId> Args(const ExprNode& node) const {
+        std::vector<ExprId> args;
+        args.reserve(node.arg_count);
+        for (uint32_t i = 0; i < node.arg_count; ++i) {
+            args.push_back(this->tree_.arg(node, i));
+        }
+        return args;
+    }
+
+    // Arguments other than the `*` of COUNT(*).
+    std::vector<ExprId> ValueArgs(const ExprNode& node) const {
+        std::vector<ExprId> args = this->Args(node);
+        args.erase(std::remove_if(args.begin(), args.end(),
+                                  [this](ExprId arg) {
+                                      return this->tree_[arg].kind ==
+                                             ExprKind::kStar;
+                                  }),
+                   args.end());
+        return args;
+    }
+
+    // The anchor of `name` under the compound name its declaration gives
+    // it for `args`. Functions no standard file declares are named after
+    // the types of their arguments.
+    uint32_t Anchor(std::string_view name,
+                    const std::vector<ExprId>& args) const {
+        const FunctionDeclaration* declaration = FindDeclaration(name);
+        size_t count = args.size();
+        if (declaration != nullptr && declaration->variadic_arguments != 0) {
+            count = std::min(count, declaration->variadic_arguments);
+        }
+        std::string signature(name);
+        for (size_t i = 0; i < count; ++i) {
+            std::string_view type = ShortTypeName(this->tree_[args[i]].type);
+            if (declaration != nullptr &&
+                declaration->arguments == DeclaredArguments::kAny) {
+                type = "any";
+            } else if (declaration != nullptr &&
+                       declaration->arguments == DeclaredArguments::kBoolean) {
+                type = "bool";
             }
+            absl::StrAppend(&signature, i == 0 ? ":" : "_", type);
         }
-        current_rel = new substrait::Rel();
-        current_rel->set_allocated_aggregate(agg_rel);
+        return this->registry_->FunctionAnchor(name, signature);
     }
 
-    std::vector<WindowFunctionInfo> window_functions;
-    for (const auto& item : info.select_items) {
-        if (item.type == SelectItemType::WINDOW_FUNCTION && item.win_info) {
-            window_functions.push_back(*item.win_info);
+    void EmitCall(std::string_view name, const std::vector<ExprId>& args,
+                  DataType output_type, substrait::Expression* out) const {
+        substrait::Expression::ScalarFunction* function =
+            out->mutable_scalar_function();
+        function->set_function_reference(this->Anchor(name, args));
+        for (ExprId arg : args) {
+            this->Emit(arg, function->add_arguments()->mutable_value());
+        }
+        SetOutputType(output_type, function);
+    }
+
+    // Emits `name(args)`, wrapped in not() for the NOT form.
+    void EmitNegatable(const ExprNode& node, std::string_view name,
+                       substrait::Expression* out) const {
+        if (node.negated) {
+            out = this->WrapInNot(out);
+        }
+        this->EmitCall(name, this->Args(node), DataType::kBoolean, out);
+    }
+
+    substrait::Expression* WrapInNot(substrait::Expression* out) const {
+        substrait::Expression::ScalarFunction* function =
+            out->mutable_scalar_function();
+        function->set_function_reference(
+            this->registry_->FunctionAnchor("not", "not:bool"));
+        SetType(DataType::kBoolean, true, function->mutable_output_type());
+        return function->add_arguments()->mutable_value();
+    }
+
+    void EmitBinary(const ExprNode& node, substrait::Expression* out) const {
+        if (node.op == ExprOp::kLike) {
+            this->EmitNegatable(node, "like", out);
+            return;
+        }
+        if (node.op != ExprOp::kAnd && node.op != ExprOp::kOr) {
+            this->EmitCall(BinaryFunctionName(node.op), this->Args(node),
+                           node.type, out);
+            return;
+        }
+        // and/or are variadic: a AND b AND c becomes one call.
+        std::vector<ExprId> operands;
+        this->Flatten(node, node.op, &operands);
+        const std::string_view name = BinaryFunctionName(node.op);
+        substrait::Expression::ScalarFunction* function =
+            out->mutable_scalar_function();
+        function->set_function_reference(
+            this->registry_->FunctionAnchor(name, absl::StrCat(name, ":bool")));
+        for (ExprId operand : operands) {
+            this->Emit(operand, function->add_arguments()->mutable_value());
+        }
+        SetType(DataType::kBoolean, true, function->mutable_output_type());
+    }
+
+    void Flatten(const ExprNode& node, ExprOp op,
+                 std::vector<ExprId>* operands) const {
+        for (uint32_t i = 0; i < node.arg_count; ++i) {
+            const ExprId arg = this->tree_.arg(node, i);
+            const ExprNode& child = this->tree_[arg];
+            if (child.kind == ExprKind::kBinary && child.op == op &&
+                child.field < 0) {
+                this->Flatten(child, op, operands);
+            } else {
+                operands->push_back(arg);
+            }
+        }
+    }
+
+    void EmitInList(const ExprNode& node, substrait::Expression* out) const {
+        if (node.negated) {
+            out = this->WrapInNot(out);
+        }
+        substrait::Expression::SingularOrList* list =
+            out->mutable_singular_or_list();
+        this->Emit(this->tree_.arg(node, 0), list->mutable_value());
+        for (uint32_t i = 1; i < node.arg_count; ++i) {
+            this->Emit(this->tree_.arg(node, i), list->add_options());
+        }
+    }
+
+    void EmitCase(const ExprNode& node, substrait::Expression* out) const {
+        substrait::Expression::IfThen* if_then = out->mutable_if_then();
+        const uint32_t first_when = node.case_has_operand ? 1 : 0;
+        const uint32_t end = node.arg_count - (node.case_has_else ? 1 : 0);
+        for (uint32_t i = first_when; i + 1 < end; i += 2) {
+            substrait::Expression::IfThen::IfClause* clause =
+                if_then->add_ifs();
+            const ExprId when = this->tree_.arg(node, i);
+            if (node.case_has_operand) {
+                // CASE x WHEN v is CASE WHEN x = v.
+                this->EmitCall("equal", {this->tree_.arg(node, 0), when},
+                               DataType::kBoolean, clause->mutable_if_());
+            } else {
+                this->Emit(when, clause->mutable_if_());
+            }
+            this->Emit(this->tree_.arg(node, i + 1), clause->mutable_then());
+        }
+        if (node.case_has_else) {
+            this->Emit(this->tree_.arg(node, node.arg_count - 1),
+                       if_then->mutable_else_());
+        } else {
+            substrait::Expression::Literal* null_literal =
+                if_then->mutable_else_()->mutable_literal();
+            if (!SetType(node.type, true, null_literal->mutable_null())) {
+                null_literal->mutable_null();
+            }
         }
     }
 
-    if (!window_functions.empty()) {
-        substrait::ConsistentPartitionWindowRel* window_rel = new substrait::ConsistentPartitionWindowRel();
-        window_rel->set_allocated_input(current_rel);
-        if (!window_functions.front().partition_by.empty()) {
-            for (const auto& col : window_functions.front().partition_by) {
-                substrait::Expression* expr = window_rel->add_partition_expressions();
-                expr->mutable_literal()->set_string(col);
+    // Emits a literal as node.type, which the binder either derived from the
+    // literal or coerced to a column type the value converts to exactly.
+    void EmitLiteral(const ExprNode& node,
+                     substrait::Expression::Literal* out) const {
+        switch (node.literal) {
+            case LiteralKind::kNull:
+                if (!SetType(node.type, true, out->mutable_null())) {
+                    out->mutable_null();
+                }
+                return;
+            case LiteralKind::kBoolean:
+                out->set_boolean(absl::EqualsIgnoreCase(node.text, "true"));
+                return;
+            case LiteralKind::kInteger:
+            case LiteralKind::kDecimal:
+                EmitNumber(node, out);
+                return;
+            case LiteralKind::kString: {
+                const std::string_view body = literal::StringBody(node.text);
+                if (node.type == DataType::kDate) {
+                    out->set_date(*literal::ParseDate(body));
+                } else if (node.type == DataType::kTimestamp) {
+                    out->set_timestamp(*literal::ParseTimestamp(body));
+                } else if (body.find('\'') == std::string_view::npos) {
+                    out->set_string(body.data(), body.size());
+                } else {
+                    out->set_string(absl::StrReplaceAll(body, {{"''", "'"}}));
+                }
+                return;
             }
+            case LiteralKind::kDate:
+                out->set_date(*literal::ParseDate(literal::StringBody(node.text)));
+                return;
+            case LiteralKind::kTimestamp:
+                out->set_timestamp(
+                    *literal::ParseTimestamp(literal::StringBody(node.text)));
+                return;
         }
-        for (const auto& win_func_info : window_functions) {
-            substrait::ConsistentPartitionWindowRel::WindowRelFunction* win_func = window_rel->add_window_functions();
-            win_func->set_function_reference(0);
+    }
+
+    static void EmitNumber(const ExprNode& node,
+                           substrait::Expression::Literal* out) {
+        if (node.type == DataType::kDecimal) {
+            const literal::Decimal decimal =
+                *literal::ParseDecimal(node.text, node.negated);
+            substrait::Expression::Literal::Decimal* value =
+                out->mutable_decimal();
+            value->set_value(literal::DecimalBytes(decimal));
+            value->set_precision(decimal.precision);
+            value->set_scale(decimal.scale);
+            return;
+        }
+        const std::optional<int64_t> integer =
+            node.literal == LiteralKind::kInteger
+                ? literal::ParseInteger(node.text, node.negated)
+                : std::nullopt;
+        // Integers beyond int64 fall through to a double like a decimal.
+        if (integer) {
+            switch (node.type) {
+                case DataType::kI8:
+                    out->set_i8(static_cast<int32_t>(*integer));
+                    return;
+                case DataType::kI16:
+                    out->set_i16(static_cast<int32_t>(*integer));
+                    return;
+                case DataType::kI32:
+                    out->set_i32(static_cast<int32_t>(*integer));
+                    return;
+                case DataType::kI64:
+                    out->set_i64(*integer);
+                    return;
+                case DataType::kFp32:
+                case DataType::kFp64:
+                    break;
+                default:
+                    if (*integer >= std::numeric_limits<int32_t>::min() &&
+                        *integer <= std::numeric_limits<int32_t>::max()) {
+                        out->set_i32(static_cast<int32_t>(*integer));
+                    } else {
+                        out->set_i64(*integer);
+                    }
+                    return;
+            }
+        }
+        const double value =
+            literal::ParseDouble(node.text, node.negated).value_or(0.0);
+        if (node.type == DataType::kFp32) {
+            out->set_fp32(static_cast<float>(value));
+        } else {
+            out->set_fp64(value);
         }
-        current_rel = new substrait::Rel();
-        current_rel->set_allocated_window(window_rel);
     }
 
+    const ExpressionTree& tree_;
+    ExtensionRegistry* registry_;
+};
+
+void SetBaseSchema(const TableSchema& schema, substrait::NamedStruct* out) {
+    for (const BoundColumn& column : schema.columns) {
+        out->add_names(column.name.data(), column.name.size());
+    }
+    // Inferred schemas only know names; their types are left to the consumer.
+    // So are those of a defined table with a column type Substrait cannot
+    // express from the catalog alone, such as CHAR without a length.
+    if (schema.inferred) {
+        return;
+    }
+    substrait::Type::Struct* types = out->mutable_struct_();
+    types->set_nullability(substrait::Type::NULLABILITY_REQUIRED);
+    for (const BoundColumn& column : schema.columns) {
+        if (!SetType(column.type, column.nullable, types->add_types())) {
+            out->clear_struct_();
+            return;
+        }
+    }
+}
+
+void AddNamedTableRead(std::string_view table, const TableSchema& schema,
+                       substrait::Rel* rel) {
+    substrait::ReadRel* read = rel->mutable_read();
+    if (!schema.columns.empty()) {
+        SetBaseSchema(schema, read->mutable_base_schema());
+    }
+    read->mutable_named_table()->add_names(table.data(), table.size());
+}
+
+// Fills `rel` with the operator tree for `info`. The tree is built from the
+// outermost operator inwards, so every node is created in place through
+// mutable_* and lands on whatever arena owns `rel`. Returns false when the
+// query has no FROM source.
+//
+// Operators from the top: fetch, project, sort, window, aggregate, filter,
+// joins, reads. Field references are resolved by the binder against the
+// input of the operator they appear in.
+bool BuildSelectRel(const SelectInfo& info, ExtensionRegistry* registry,
+                    substrait::Rel* rel) {
+    if (!info.from_subquery && !info.from_table) {
+        return false;
+    }
+    // A cancelled plan is thrown away by the caller, so stop building it.
+    if (detail::Interrupted()) {
+        return false;
+    }
+    const ExpressionEmitter emitter(info.expressions, registry);
+
+    std::vector<const SelectItem*> window_items;
+    for (const auto& item : info.select_items) {
+        if (item.type == SelectItemType::WINDOW_FUNCTION && item.win_info) {
+            window_items.push_back(&item);
+        }
+    }
     bool is_select_star = info.select_items.size() == 1 && info.select_items[0].expression == "*";
 
+    if (info.limit != -1) {
+        substrait::FetchRel* fetch_rel = rel->mutable_fetch();
+        fetch_rel->mutable_count_expr()->mutable_literal()->set_i64(info.limit);
+        rel = fetch_rel->mutable_input();
+    }
+
     if (!is_select_star) {
-        substrait::ProjectRel* project_rel = new substrait::ProjectRel();
-        project_rel->set_allocated_input(current_rel);
+        // ProjectRel appends its expressions to its input; emit keeps just
+        // the select list, with window results taken from the input.
+        substrait::ProjectRel* project_rel = rel->mutable_project();
+        substrait::RelCommon::Emit* emit =
+            project_rel->mutable_common()->mutable_emit();
+        int32_t next_expression = static_cast<int32_t>(info.project_input_width);
         for (const auto& item : info.select_items) {
-            if (item.type != SelectItemType::WINDOW_FUNCTION) {
-                substrait::Expression* expr = project_rel->add_expressions();
-                expr->mutable_literal()->set_string(item.expression);
+            if (item.type == SelectItemType::WINDOW_FUNCTION) {
+                emit->add_output_mapping(info.expressions[item.expr].field);
+                continue;
             }
+            emitter.Emit(item.expr, project_rel->add_expressions());
+            emit->add_output_mapping(next_expression++);
         }
-        if (project_rel->expressions_size() > 0) {
-            current_rel = new substrait::Rel();
-            current_rel->set_allocated_project(project_rel);
-        } else {
-            delete project_rel;
-        }
+        rel = project_rel->mutable_input();
     }
 
     if (!info.order_by_columns.empty()) {
-        substrait::SortRel* sort_rel = new substrait::SortRel();
-        sort_rel->set_allocated_input(current_rel);
+        substrait::SortRel* sort_rel = rel->mutable_sort();
         for (const auto& sort_info : info.order_by_columns) {
             substrait::SortField* sort_field = sort_rel->add_sorts();
             sort_field->set_direction(ConvertSortDirection(sort_info.direction));
-            sort_field->mutable_expr()->mutable_literal()->set_string(sort_info.column);
+            emitter.Emit(sort_info.expr, sort_field->mutable_expr());
         }
-        current_rel = new substrait::Rel();
-        current_rel->set_allocated_sort(sort_rel);
+        rel = sort_rel->mutable_input();
     }
 
-    if (info.limit != -1) {
-        substrait::FetchRel* fetch_rel = new substrait::FetchRel();
-        fetch_rel->set_allocated_input(current_rel);
-        fetch_rel->mutable_count_expr()->mutable_literal()->set_i64(info.limit);
-        current_rel = new substrait::Rel();
-        current_rel->set_allocated_fetch(fetch_rel);
+    if (!window_items.empty()) {
+        substrait::ConsistentPartitionWindowRel* window_rel = rel->mutable_window();
+        for (ExprId partition : window_items.front()->win_info->partition_by) {
+            emitter.Emit(partition, window_rel->add_partition_expressions());
+        }
+        for (const SelectItem* item : window_items) {
+            emitter.EmitWindowFunction(item->expr,
+                                       window_rel->add_window_functions());
+        }
+        rel = window_rel->mutable_input();
     }
 
-    substrait::RelRoot* root = new substrait::RelRoot();
-    root->set_allocated_input(current_rel);
-    plan.add_relations()->set_allocated_root(root);
-    return plan;
+    if (!info.group_by.empty() || !info.measures.empty()) {
+        substrait::AggregateRel* agg_rel = rel->mutable_aggregate();
+        if (!info.group_by.empty()) {
+            substrait::AggregateRel::Grouping* grouping = agg_rel->add_groupings();
+            for (uint32_t i = 0; i < info.group_by.size(); ++i) {
+                emitter.Emit(info.group_by[i],
+                             agg_rel->add_grouping_expressions());
+                grouping->add_expression_references(i);
+            }
+        }
+        for (ExprId measure : info.measures) {
+            emitter.EmitMeasure(measure,
+                                agg_rel->add_measures()->mutable_measure());
+        }
+        rel = agg_rel->mutable_input();
+    }
+
+    if (info.where_condition != kNoExpr) {
+        substrait::FilterRel* filter_rel = rel->mutable_filter();
+        emitter.Emit(info.where_condition, filter_rel->mutable_condition());
+        rel = filter_rel->mutable_input();
+    }
+
+    // The last join is the outermost one; each join's left input is the
+    // join (or table) written before it.
+    for (auto it = info.joins.rbegin(); it != info.joins.rend(); ++it) {
+        substrait::JoinRel* join_rel = rel->mutable_join();
+        if (it->type == JoinType::INNER) {
+            join_rel->set_type(substrait::JoinRel::JOIN_TYPE_INNER);
+        } else {
+            join_rel->set_type(substrait::JoinRel::JOIN_TYPE_LEFT);
+        }
+        AddNamedTableRead(it->table.name, it->table.schema, join_rel->mutable_right());
+        emitter.Emit(it->on_condition, join_rel->mutable_expression());
+        rel = join_rel->mutable_left();
+    }
+
+    for (auto it = info.cross_join_tables.rbegin();
+         it != info.cross_join_tables.rend(); ++it) {
+        substrait::CrossRel* cross_rel = rel->mutable_cross();
+        AddNamedTableRead(it->name, it->schema, cross_rel->mutable_right());
+        rel = cross_rel->mutable_left();
+    }
+
+    if (info.from_subquery) {
+        return BuildSelectRel(**info.from_subquery, registry, rel);
+    }
+    AddNamedTableRead(info.from_table->name, info.from_table->schema, rel);
+    return true;
 }
 
-substrait::Plan ToSubstrait(const CreateTableInfo& info) {
-    substrait::Plan plan;
-    substrait::DdlRel* ddl_rel = new substrait::DdlRel();
+void BuildPlan(const SelectInfo& info, substrait::Plan* plan) {
+    ExtensionRegistry registry(plan);
+    if (!BuildSelectRel(info, &registry,
+                        plan->add_relations()->mutable_root()->mutable_input())) {
+        plan->Clear();
+    }
+}
+
+void BuildPlan(const CreateTableInfo& info, substrait::Plan* plan) {
+    substrait::DdlRel* ddl_rel =
+        plan->add_relations()->mutable_root()->mutable_input()->mutable_ddl();
     ddl_rel->set_op(substrait::DdlRel::DDL_OP_CREATE);
     ddl_rel->set_object(substrait::DdlRel::DDL_OBJECT_TABLE);
-    ddl_rel->mutable_named_object()->add_names(info.table_name);
+    ddl_rel->mutable_named_object()->add_names(
+        info.table_name.data(), info.table_name.size());
     substrait::NamedStruct* schema = ddl_rel->mutable_table_schema();
     for (const auto& col : info.columns) {
-        schema->add_names(col.name);
+        schema->add_names(col.name.data(), col.name.size());
         substrait::Type* type =
             schema->mutable_struct_()->mutable_types()->Add();
         if (col.type == "integer") {
@@ -214,137 +897,247 @@ substrait::Plan ToSubstrait(const CreateTableInfo& info) {
                 substrait::Type::NULLABILITY_NULLABLE);
         }
     }
-    substrait::Rel* rel = new substrait::Rel();
-    rel->set_allocated_ddl(ddl_rel);
-    substrait::RelRoot* root = new substrait::RelRoot();
-    root->set_allocated_input(rel);
-    plan.add_relations()->set_allocated_root(root);
-    return plan;
 }
 
-substrait::Plan ToSubstrait(const DropTableInfo& info) {
-    substrait::Plan plan;
-    substrait::DdlRel* ddl_rel = new substrait::DdlRel();
+void BuildPlan(const DropTableInfo& info, substrait::Plan* plan) {
+    substrait::DdlRel* ddl_rel =
+        plan->add_relations()->mutable_root()->mutable_input()->mutable_ddl();
     ddl_rel->set_op(substrait::DdlRel::DDL_OP_DROP);
     ddl_rel->set_object(substrait::DdlRel::DDL_OBJECT_TABLE);
-    ddl_rel->mutable_named_object()->add_names(info.table_name);
-    substrait::Rel* rel = new substrait::Rel();
-    rel->set_allocated_ddl(ddl_rel);
-    substrait::RelRoot* root = new substrait::RelRoot();
-    root->set_allocated_input(rel);
-    plan.add_relations()->set_allocated_root(root);
-    return plan;
+    ddl_rel->mutable_named_object()->add_names(
+        info.table_name.data(), info.table_name.size());
 }
 
-substrait::Plan ToSubstrait(const DeleteInfo& info) {
-    substrait::Plan plan;
-    auto* root = plan.add_relations()->mutable_root();
+void BuildPlan(const DeleteInfo& info, substrait::Plan* plan) {
+    ExtensionRegistry registry(plan);
+    const ExpressionEmitter emitter(info.expressions, &registry);
+    auto* root = plan->add_relations()->mutable_root();
     auto* write_rel = root->mutable_input()->mutable_write();
     write_rel->set_op(substrait::WriteRel::WRITE_OP_DELETE);
-    write_rel->mutable_named_table()->add_names(info.table_name);
-
-    substrait::ReadRel* read_rel = new substrait::ReadRel();
-    read_rel->mutable_named_table()->add_names(info.table_name);
-
-    substrait::Rel* input_rel = new substrait::Rel();
-    input_rel->set_allocated_read(read_rel);
-
-    if (info.where_clause) {
-        substrait::FilterRel* filter_rel = new substrait::FilterRel();
-        filter_rel->set_allocated_input(input_rel);
-
-        substrait::Expression* condition = filter_rel->mutable_condition();
-        substrait::Expression::ScalarFunction* scalar_fn =
-            condition->mutable_scalar_function();
-        scalar_fn->set_function_reference(0);  // Placeholder
-        substrait::FunctionArgument* arg = scalar_fn->add_arguments();
-        arg->mutable_value()->mutable_literal()->set_string(
-            *info.where_clause);
+    write_rel->mutable_named_table()->add_names(
+        info.table_name.data(), info.table_name.size());
 
-        substrait::Rel* filter_rel_container = new substrait::Rel();
-        filter_rel_container->set_allocated_filter(filter_rel);
-        write_rel->set_allocated_input(filter_rel_container);
-    } else {
-        write_rel->set_allocated_input(input_rel);
+    substrait::Rel* input_rel = write_rel->mutable_input();
+    if (info.where_clause != kNoExpr) {
+        substrait::FilterRel* filter_rel = input_rel->mutable_filter();
+        emitter.Emit(info.where_clause, filter_rel->mutable_condition());
+        input_rel = filter_rel->mutable_input();
     }
-
-    return plan;
+    AddNamedTableRead(info.table_name, info.schema, input_rel);
 }
 
-substrait::Plan ToSubstrait(const UpdateInfo& info) {
-    substrait::Plan plan;
-    auto* root = plan.add_relations()->mutable_root();
+void BuildPlan(const UpdateInfo& info, substrait::Plan* plan) {
+    ExtensionRegistry registry(plan);
+    const ExpressionEmitter emitter(info.expressions, &registry);
+    auto* root = plan->add_relations()->mutable_root();
     auto* update_rel = root->mutable_input()->mutable_update();
-    update_rel->mutable_named_table()->add_names(info.table_name);
+    update_rel->mutable_named_table()->add_names(
+        info.table_name.data(), info.table_name.size());
+    if (!info.schema.columns.empty()) {
+        SetBaseSchema(info.schema, update_rel->mutable_table_schema());
+    }
 
-    if (info.where_clause) {
-        substrait::Expression* condition = update_rel->mutable_condition();
-        substrait::Expression::ScalarFunction* scalar_fn =
-            condition->mutable_scalar_function();
-        scalar_fn->set_function_reference(0);  // Placeholder
-        substrait::FunctionArgument* arg = scalar_fn->add_arguments();
-        arg->mutable_value()->mutable_literal()->set_string(
-            *info.where_clause);
+    if (info.where_clause != kNoExpr) {
+        emitter.Emit(info.where_clause, update_rel->mutable_condition());
     }
 
-    int col_idx = 0;
     for (const auto& set_clause : info.set_clauses) {
         substrait::UpdateRel::TransformExpression* transform =
             update_rel->add_transformations();
-        transform->set_column_target(
-            col_idx++);  // FIXME: This is a placeholder
-        substrait::Expression* literal_expr =
-            transform->mutable_transformation();
-        substrait::Expression::Literal* literal =
-            literal_expr->mutable_literal();
-        try {
-            literal->set_i32(std::stoi(set_clause.value));
-        } catch (...) {
-            std::string s = set_clause.value;
-            if (s.front() == '\'' && s.back() == '\'') {
-                s = s.substr(1, s.length() - 2);
-            }
-            literal->set_string(s);
-        }
+        transform->set_column_target(set_clause.column_index);
+        emitter.Emit(set_clause.value, transform->mutable_transformation());
     }
-
-    return plan;
 }
 
-substrait::Plan ToSubstrait(const InsertInfo& info) {
-    substrait::Plan plan;
-    auto* root = plan.add_relations()->mutable_root();
+// Writes rows [first_row, first_row + row_count) of `info`, each emitted
+// straight from the IR into its VirtualTable struct. Stops early, leaving the
+// caller to discard the plan, when planning is interrupted or the rows
+// outgrow ParseOptions::max_plan_bytes.
+void BuildPlan(const InsertInfo& info, size_t first_row, size_t row_count,
+               substrait::Plan* plan) {
+    ExtensionRegistry registry(plan);
+    const ExpressionEmitter emitter(info.expressions, &registry);
+    auto* root = plan->add_relations()->mutable_root();
     auto* write_rel = root->mutable_input()->mutable_write();
-    write_rel->mutable_named_table()->add_names(info.table_name);
+    write_rel->mutable_named_table()->add_names(
+        info.table_name.data(), info.table_name.size());
 
-    substrait::ReadRel* read_rel = new substrait::ReadRel();
+    substrait::ReadRel* read_rel = write_rel->mutable_input()->mutable_read();
     substrait::ReadRel::VirtualTable* virtual_table =
         read_rel->mutable_virtual_table();
-    substrait::Expression::Nested::Struct* row =
-        virtual_table->add_expressions();
-
-    for (const auto& val : info.values) {
-        substrait::Expression* field = row->add_fields();
-        if (auto int_val = utils::StringToIntOptional(val)) {
-            field->mutable_literal()->set_i32(*int_val);
-        } else {
-            std::string s = val;
-            if (s.front() == '\'' && s.back() == '\'') {
-                s = s.substr(1, s.length() - 2);
+    virtual_table->mutable_expressions()->Reserve(static_cast<int>(row_count));
+    const size_t width = info.row_width;
+    const size_t max_bytes = detail::MaxPlanBytes();
+    size_t row_bytes = 0;
+    for (size_t i = first_row; i < first_row + row_count; ++i) {
+        if (detail::Interrupted()) {
+            break;
+        }
+        substrait::Expression::Nested::Struct* row =
+            virtual_table->add_expressions();
+        row->mutable_fields()->Reserve(static_cast<int>(width));
+        for (size_t j = i * width; j < (i + 1) * width; ++j) {
+            emitter.Emit(info.values[j], row->add_fields());
+        }
+        // Rows are nearly all of an INSERT plan, so their sizes alone tell
+        // when it has outgrown the limit.
+        if (max_bytes != 0) {
+            row_bytes += row->ByteSizeLong();
+            if (row_bytes > max_bytes) {
+                break;
             }
-            field->mutable_literal()->set_string(s);
         }
     }
 
     substrait::NamedStruct* schema = read_rel->mutable_base_schema();
     for (const auto& col : info.columns) {
-        schema->add_names(col);
+        schema->add_names(col.data(), col.size());
+    }
+}
+
+void BuildPlan(const InsertInfo& info, substrait::Plan* plan) {
+    BuildPlan(info, 0, info.row_count(), plan);
+}
+
+void SetFileFormat(const CopyInfo& info,
+                   substrait::ReadRel::LocalFiles::FileOrFiles* file) {
+    switch (info.format) {
+        case CopyFormat::kParquet:
+            file->mutable_parquet();
+            return;
+        case CopyFormat::kArrow:
+            file->mutable_arrow();
+            return;
+        case CopyFormat::kCsv:
+            break;
     }
+    auto* text = file->mutable_text();
+    text->set_field_delimiter(info.delimiter.data(), info.delimiter.size());
+    text->set_quote(info.quote.data(), info.quote.size());
+    text->set_escape(info.escape.data(), info.escape.size());
+    text->set_header_lines_to_skip(info.header_lines);
+    if (info.null_string) {
+        text->set_value_treated_as_null(info.null_string->data(),
+                                        info.null_string->size());
+    }
+}
+
+// Writes the file into the table through a ReadRel of LocalFiles, one item
+// per split. The plan only says where the data is, so its size does not
+// depend on the file's.
+void BuildPlan(const CopyInfo& info, substrait::Plan* plan) {
+    auto* root = plan->add_relations()->mutable_root();
+    auto* write_rel = root->mutable_input()->mutable_write();
+    write_rel->set_op(substrait::WriteRel::WRITE_OP_INSERT);
+    write_rel->mutable_named_table()->add_names(
+        info.table_name.data(), info.table_name.size());
+
+    substrait::ReadRel* read_rel = write_rel->mutable_input()->mutable_read();
+    if (!info.schema.columns.empty()) {
+        SetBaseSchema(info.schema, read_rel->mutable_base_schema());
+    }
+    auto* items = read_rel->mutable_local_files()->mutable_items();
+    const size_t splits = info.split_count();
+    items->Reserve(static_cast<int>(splits));
+    for (size_t i = 0; i < splits; ++i) {
+        substrait::ReadRel::LocalFiles::FileOrFiles* file = items->Add();
+        file->set_uri_file(info.path.data(), info.path.size());
+        if (info.file_size != 0) {
+            const uint64_t start = i * info.split_size;
+            file->set_partition_index(i);
+            file->set_start(start);
+            file->set_length(info.split_size == 0
+                                 ? info.file_size
+                                 : std::min(info.split_size,
+                                            info.file_size - start));
+        }
+        SetFileFormat(info, file);
+    }
+}
+
+template <typename Info>
+substrait::Plan BuildOnHeap(const Info& info) {
+    substrait::Plan plan;
+    BuildPlan(info, &plan);
+    return plan;
+}
+
+template <typename Info>
+substrait::Plan* BuildOnArena(const Info& info, google::protobuf::Arena* arena) {
+    auto* plan = google::protobuf::Arena::CreateMessage<substrait::Plan>(arena);
+    BuildPlan(info, plan);
+    return plan;
+}
+
+}  // namespace
+
+substrait::Plan ToSubstrait(const SelectInfo& info) {
+    return BuildOnHeap(info);
+}
+
+substrait::Plan ToSubstrait(const CreateTableInfo& info) {
+    return BuildOnHeap(info);
+}
+
+substrait::Plan ToSubstrait(const DropTableInfo& info) {
+    return BuildOnHeap(info);
+}
+
+substrait::Plan ToSubstrait(const DeleteInfo& info) {
+    return BuildOnHeap(info);
+}
 
-    substrait::Rel* input_rel = new substrait::Rel();
-    input_rel->set_allocated_read(read_rel);
-    write_rel->set_allocated_input(input_rel);
+substrait::Plan ToSubstrait(const UpdateInfo& info) {
+    return BuildOnHeap(info);
+}
+
+substrait::Plan ToSubstrait(const InsertInfo& info) {
+    return BuildOnHeap(info);
+}
+
+substrait::Plan* ToSubstrait(const SelectInfo& info,
+                             google::protobuf::Arena* arena) {
+    return BuildOnArena(info, arena);
+}
+
+substrait::Plan* ToSubstrait(const CreateTableInfo& info,
+                             google::protobuf::Arena* arena) {
+    return BuildOnArena(info, arena);
+}
+
+substrait::Plan* ToSubstrait(const DropTableInfo& info,
+                             google::protobuf::Arena* arena) {
+    return BuildOnArena(info, arena);
+}
+
+substrait::Plan* ToSubstrait(const DeleteInfo& info,
+                             google::protobuf::Arena* arena) {
+    return BuildOnArena(info, arena);
+}
+
+substrait::Plan* ToSubstrait(const UpdateInfo& info,
+                             google::protobuf::Arena* arena) {
+    return BuildOnArena(info, arena);
+}
+
+substrait::Plan* ToSubstrait(const InsertInfo& info,
+                             google::protobuf::Arena* arena) {
+    return BuildOnArena(info, arena);
+}
+
+substrait::Plan ToSubstrait(const CopyInfo& info) {
+    return BuildOnHeap(info);
+}
+
+substrait::Plan* ToSubstrait(const CopyInfo& info,
+                             google::protobuf::Arena* arena) {
+    return BuildOnArena(info, arena);
+}
 
+substrait::Plan* ToSubstrait(const InsertInfo& info, size_t first_row,
+                             size_t row_count, google::protobuf::Arena* arena) {
+    auto* plan = google::protobuf::Arena::CreateMessage<substrait::Plan>(arena);
+    BuildPlan(info, first_row, row_count, plan);
     return plan;
 }
 
@@ -0,0 +1,35 @@
+#include "symbol_table.hpp"
+
+#include "absl/hash/hash.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/match.h"
+
+namespace pink_perilla {
+
+Symbol SymbolTable::Intern(std::string_view name) {
+    if (const Symbol symbol = this->Find(name); symbol != kNoSymbol) {
+        return symbol;
+    }
+    const Symbol symbol = static_cast<Symbol>(this->names_.size());
+    this->names_.push_back(this->index_.emplace(name, symbol).first->first);
+    return symbol;
+}
+
+size_t SymbolTable::FoldedHash::operator()(std::string_view name) const {
+    // FNV-1a over the lowercased bytes, so no folded copy is needed; absl
+    // then mixes the result for the table's benefit.
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (const char c : name) {
+        hash ^= static_cast<unsigned char>(
+            absl::ascii_tolower(static_cast<unsigned char>(c)));
+        hash *= 0x100000001b3ull;
+    }
+    return absl::HashOf(hash);
+}
+
+bool SymbolTable::FoldedEq::operator()(std::string_view a,
+                                       std::string_view b) const {
+    return absl::EqualsIgnoreCase(a, b);
+}
+
+}  // namespace pink_perilla
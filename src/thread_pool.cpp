@@ -0,0 +1,108 @@
+#include "thread_pool.hpp"
+
+#include <deque>
+#include <utility>
+
+namespace pink_perilla {
+
+namespace {
+
+// Identifies the pool and worker index of the current thread, if it is a
+// pool worker.
+thread_local const ThreadPool* current_pool = nullptr;
+thread_local size_t current_worker = 0;
+
+}  // anonymous namespace
+
+struct ThreadPool::Worker {
+    absl::Mutex mutex;
+    std::deque<std::function<void()>> tasks ABSL_GUARDED_BY(mutex);
+};
+
+ThreadPool::ThreadPool(size_t threads) {
+    if (threads == 0) {
+        threads = 1;
+    }
+    this->workers_.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        this->workers_.push_back(std::make_unique<Worker>());
+    }
+    this->threads_.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        this->threads_.emplace_back([this, i] { this->Run(i); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        absl::MutexLock lock(&this->sleep_mutex_);
+        this->stopping_ = true;
+    }
+    this->wake_.SignalAll();
+    for (std::thread& thread : this->threads_) {
+        thread.join();
+    }
+}
+
+void ThreadPool::Schedule(std::function<void()> task) {
+    const size_t target =
+        current_pool == this
+            ? current_worker
+            : this->next_.fetch_add(1, std::memory_order_relaxed) %
+                  this->workers_.size();
+    {
+        Worker& worker = *this->workers_[target];
+        absl::MutexLock lock(&worker.mutex);
+        worker.tasks.push_back(std::move(task));
+    }
+    // Count the task only once it can be taken, so a woken worker finds it.
+    this->pending_.fetch_add(1, std::memory_order_release);
+    absl::MutexLock lock(&this->sleep_mutex_);
+    this->wake_.Signal();
+}
+
+std::function<void()> ThreadPool::Take(size_t self) {
+    {
+        Worker& own = *this->workers_[self];
+        absl::MutexLock lock(&own.mutex);
+        if (!own.tasks.empty()) {
+            std::function<void()> task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            return task;
+        }
+    }
+    const size_t n = this->workers_.size();
+    for (size_t i = 1; i < n; ++i) {
+        Worker& victim = *this->workers_[(self + i) % n];
+        absl::MutexLock lock(&victim.mutex);
+        if (!victim.tasks.empty()) {
+            std::function<void()> task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+void ThreadPool::Run(size_t self) {
+    current_pool = this;
+    current_worker = self;
+    while (true) {
+        if (std::function<void()> task = this->Take(self)) {
+            this->pending_.fetch_sub(1, std::memory_order_relaxed);
+            task();
+            continue;
+        }
+        absl::MutexLock lock(&this->sleep_mutex_);
+        while (this->pending_.load(std::memory_order_acquire) == 0 &&
+               !this->stopping_) {
+            this->wake_.Wait(&this->sleep_mutex_);
+        }
+        if (this->stopping_ &&
+            this->pending_.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+    }
+}
+
+}  // namespace pink_perilla
@@ -0,0 +1,86 @@
+#include <google/protobuf/text_format.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string_view>
+
+#include "absl/status/statusor.h"
+#include "catalog.hpp"
+#include "detail/arena.hpp"
+#include "detail/heap_counter.hpp"
+#include "detail/sql_parser.hpp"
+
+// Built with src/allocation_hooks.cpp, so thread_heap_counter sees every
+// operator new of this thread. Each test pins how many heap allocations a
+// planning step may make; raising a budget should be a deliberate decision.
+namespace {
+
+const pink_perilla::Catalog kCatalog({
+    {"users",
+     {{"id", pink_perilla::DataType::kI64, false},
+      {"name", pink_perilla::DataType::kString},
+      {"email", pink_perilla::DataType::kString},
+      {"age", pink_perilla::DataType::kI32},
+      {"city", pink_perilla::DataType::kString},
+      {"country", pink_perilla::DataType::kString},
+      {"zip", pink_perilla::DataType::kString},
+      {"phone", pink_perilla::DataType::kString},
+      {"created_at", pink_perilla::DataType::kTimestamp},
+      {"updated_at", pink_perilla::DataType::kTimestamp}}},
+});
+
+constexpr std::string_view kPointSelect =
+    "SELECT id, name, email, age, city, country, zip, phone, created_at, "
+    "updated_at FROM users WHERE id = 42";
+
+// Heap allocations made by parsing `sql` into a fresh StatementArena.
+uint64_t ParseAllocations(std::string_view sql, bool expect_ok = true) {
+    pink_perilla::StatementArena arena;
+    const uint64_t before =
+        pink_perilla::detail::thread_heap_counter.allocations;
+    {
+        absl::StatusOr<Statement> statement =
+            SqlParser::Parse(sql, kCatalog, arena.resource());
+        EXPECT_EQ(statement.ok(), expect_ok) << sql;
+    }
+    return pink_perilla::detail::thread_heap_counter.allocations - before;
+}
+
+}  // namespace
+
+TEST(AllocationBudget, HooksAreLinked) {
+    const uint64_t before =
+        pink_perilla::detail::thread_heap_counter.allocations;
+    ::operator delete(::operator new(16));
+    EXPECT_EQ(pink_perilla::detail::thread_heap_counter.allocations, before + 1);
+}
+
+TEST(AllocationBudget, PointSelectParsesWithoutAllocating) {
+    EXPECT_EQ(ParseAllocations(kPointSelect), 0u);
+}
+
+TEST(AllocationBudget, OltpStatementsParseWithoutAllocating) {
+    constexpr std::string_view kStatements[] = {
+        "SELECT * FROM users WHERE age > 30 ORDER BY created_at DESC LIMIT 20",
+        "INSERT INTO users (id, name, email) VALUES (1001, 'ann', 'a@x')",
+        "UPDATE users SET age = 31, updated_at = TIMESTAMP "
+        "'2024-01-31 12:00:00' WHERE id = 3",
+        "DELETE FROM users WHERE created_at < DATE '2020-01-01'",
+        "SELECT city, COUNT(id) FROM users GROUP BY city",
+        "CREATE TABLE \"odd\"\"name\" (\"a\"\"b\" INT, c VARCHAR(20))",
+    };
+    for (std::string_view sql : kStatements) {
+        EXPECT_EQ(ParseAllocations(sql), 0u) << sql;
+    }
+}
+
+TEST(AllocationBudget, FailuresAllocateOnlyTheirError) {
+    // Formatting the message, and the status that keeps its own copy.
+    constexpr uint64_t kErrorBudget = 3;
+    EXPECT_LE(ParseAllocations("SELECT id FROM users WHERE", false),
+              kErrorBudget);
+    EXPECT_LE(ParseAllocations("SELECT users. FROM users", false),
+              kErrorBudget);
+    EXPECT_LE(ParseAllocations("INSERT INTO users (1) VALUES (1)", false),
+              kErrorBudget);
+}
@@ -0,0 +1,169 @@
+#include <google/protobuf/text_format.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "catalog.hpp"
+#include "pink_perilla.hpp"
+#include "substrait/plan.pb.h"
+#include "symbol_table.hpp"
+
+namespace {
+
+std::vector<pink_perilla::TableDefinition> Users(pink_perilla::DataType id) {
+    return {{"users",
+             {{"id", id, false}, {"name", pink_perilla::DataType::kString}}}};
+}
+
+}  // namespace
+
+TEST(Catalog, BorrowIndexesWithoutCopying) {
+    const std::vector<pink_perilla::TableDefinition> tables =
+        Users(pink_perilla::DataType::kI64);
+    const pink_perilla::Catalog borrowed = pink_perilla::Catalog::Borrow(tables);
+    EXPECT_EQ(borrowed.Find("users"), &tables[0]);
+    EXPECT_EQ(borrowed.Find("orders"), nullptr);
+
+    const pink_perilla::Catalog owned(tables);
+    EXPECT_NE(owned.Find("users"), &tables[0]);
+    EXPECT_EQ(owned.fingerprint(), borrowed.fingerprint());
+    EXPECT_NE(owned.fingerprint(),
+              pink_perilla::Catalog(Users(pink_perilla::DataType::kI32))
+                  .fingerprint());
+}
+
+TEST(Catalog, UndefinedTableIsNotFound) {
+    const pink_perilla::Catalog catalog(Users(pink_perilla::DataType::kI64));
+    for (const char* sql :
+         {"SELECT id FROM orders", "SELECT users.id FROM users INNER JOIN "
+                                   "orders ON users.id = orders.user_id",
+          "DELETE FROM orders WHERE id = 1",
+          "UPDATE orders SET id = 2 WHERE id = 1",
+          "INSERT INTO orders (id) VALUES (1)"}) {
+        absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(sql, catalog);
+        ASSERT_FALSE(plan.ok()) << sql;
+        EXPECT_EQ(plan.status().code(), absl::StatusCode::kNotFound) << sql;
+        EXPECT_EQ(plan.status().message(), "Table not found: orders") << sql;
+    }
+    // Without any definitions, tables are inferred from their use.
+    EXPECT_TRUE(
+        pink_perilla::Parse("SELECT id FROM orders", pink_perilla::Catalog({}))
+            .ok());
+}
+
+TEST(Catalog, ColumnTypesWithoutParametersStayValid) {
+    const std::vector<pink_perilla::TableDefinition> decimals = {
+        {"t", {{"d", pink_perilla::DataType::kDecimal}}}};
+    absl::StatusOr<substrait::Plan> plan =
+        pink_perilla::Parse("SELECT d FROM t WHERE d > 1", decimals);
+    ASSERT_TRUE(plan.ok()) << plan.status();
+    const substrait::Rel* rel = &plan->relations(0).root().input();
+    while (!rel->has_read()) {
+        rel = rel->has_project() ? &rel->project().input()
+                                 : &rel->filter().input();
+    }
+    // A DECIMAL column without precision reads as DECIMAL(38, 0).
+    const substrait::Type& type = rel->read().base_schema().struct_().types(0);
+    ASSERT_TRUE(type.has_decimal());
+    EXPECT_EQ(type.decimal().precision(), 38);
+    EXPECT_EQ(type.decimal().scale(), 0);
+
+    // CHAR has no default length to use, so the types are left out, as for
+    // an inferred table.
+    const std::vector<pink_perilla::TableDefinition> chars = {
+        {"t",
+         {{"id", pink_perilla::DataType::kI64},
+          {"c", pink_perilla::DataType::kFixedChar}}}};
+    plan = pink_perilla::Parse("SELECT id FROM t", chars);
+    ASSERT_TRUE(plan.ok()) << plan.status();
+    rel = &plan->relations(0).root().input();
+    while (!rel->has_read()) {
+        rel = &rel->project().input();
+    }
+    EXPECT_EQ(rel->read().base_schema().names_size(), 2);
+    EXPECT_FALSE(rel->read().base_schema().has_struct_());
+}
+
+TEST(SymbolTable, InternsIgnoringCase) {
+    pink_perilla::SymbolTable symbols;
+    const pink_perilla::Symbol users = symbols.Intern("Users");
+    const pink_perilla::Symbol id = symbols.Intern("id");
+    EXPECT_EQ(users, 0u);
+    EXPECT_EQ(id, 1u);
+    EXPECT_EQ(symbols.Intern("USERS"), users);
+    EXPECT_EQ(symbols.Find("users"), users);
+    EXPECT_EQ(symbols.Find("ID"), id);
+    EXPECT_EQ(symbols.Find("name"), pink_perilla::kNoSymbol);
+    EXPECT_EQ(symbols.name(users), "Users");
+    EXPECT_EQ(symbols.size(), 2u);
+}
+
+TEST(Catalog, NamesIgnoreCase) {
+    const pink_perilla::Catalog catalog(Users(pink_perilla::DataType::kI64));
+    EXPECT_EQ(catalog.Find("USERS"), catalog.Find("users"));
+    EXPECT_EQ(catalog.Find(catalog.symbol("Users")), catalog.Find("users"));
+    // Column names are interned too, but name no table.
+    EXPECT_NE(catalog.symbol("Name"), pink_perilla::kNoSymbol);
+    EXPECT_EQ(catalog.Find(catalog.symbol("name")), nullptr);
+    EXPECT_EQ(catalog.size(), 1u);
+
+    EXPECT_TRUE(pink_perilla::Parse(
+                    "SELECT Users.NAME FROM USERS WHERE Id = 1", catalog)
+                    .ok());
+    EXPECT_TRUE(pink_perilla::Parse("UPDATE Users SET NAME = 'a' WHERE ID = 1",
+                                    catalog)
+                    .ok());
+    absl::StatusOr<substrait::Plan> plan =
+        pink_perilla::Parse("SELECT email FROM Users", catalog);
+    EXPECT_EQ(plan.status().code(), absl::StatusCode::kInvalidArgument);
+}
+
+TEST(CatalogHandle, SwapLeavesLoadedSnapshotsIntact) {
+    pink_perilla::CatalogHandle handle(std::make_shared<const pink_perilla::Catalog>(
+        Users(pink_perilla::DataType::kI64)));
+    std::shared_ptr<const pink_perilla::Catalog> before = handle.Load();
+
+    std::shared_ptr<const pink_perilla::Catalog> replaced =
+        handle.Swap(std::make_shared<const pink_perilla::Catalog>(
+            Users(pink_perilla::DataType::kI32)));
+    EXPECT_EQ(replaced, before);
+    EXPECT_EQ(before->Find("users")->columns[0].type,
+              pink_perilla::DataType::kI64);
+    EXPECT_EQ(handle.Load()->Find("users")->columns[0].type,
+              pink_perilla::DataType::kI32);
+}
+
+TEST(CatalogHandle, PlannersKeepRunningAcrossSwaps) {
+    pink_perilla::CatalogHandle handle(std::make_shared<const pink_perilla::Catalog>(
+        Users(pink_perilla::DataType::kI64)));
+    std::atomic<bool> done{false};
+    std::atomic<int> failures{0};
+    std::vector<std::thread> planners;
+    for (int i = 0; i < 4; ++i) {
+        planners.emplace_back([&] {
+            while (!done.load()) {
+                std::shared_ptr<const pink_perilla::Catalog> catalog =
+                    handle.Load();
+                if (!pink_perilla::Parse("SELECT name FROM users WHERE id = 1",
+                                         *catalog)
+                         .ok()) {
+                    failures.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (int i = 0; i < 200; ++i) {
+        handle.Swap(std::make_shared<const pink_perilla::Catalog>(
+            Users(i % 2 == 0 ? pink_perilla::DataType::kI32
+                             : pink_perilla::DataType::kI64)));
+    }
+    done.store(true);
+    for (std::thread& planner : planners) {
+        planner.join();
+    }
+    EXPECT_EQ(failures.load(), 0);
+}
@@ -0,0 +1,126 @@
+#include <google/protobuf/text_format.h>
+#include <gtest/gtest.h>
+
+#include <string_view>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "compiled_sql.hpp"
+#include "detail/lexer.hpp"
+#include "pink_perilla.hpp"
+#include "substrait/plan.pb.h"
+
+namespace {
+
+using pink_perilla::ParameterValue;
+using pink_perilla::detail::CompiledSqlError;
+
+const std::vector<pink_perilla::TableDefinition> kTables = {
+    {"users",
+     {{"id", pink_perilla::DataType::kI64, false},
+      {"name", pink_perilla::DataType::kString},
+      {"age", pink_perilla::DataType::kI32}}},
+};
+
+// What CheckCompiledSql() makes of `sql`, evaluated by the compiler.
+template <size_t kCount>
+constexpr CompiledSqlError Check(std::string_view sql) {
+    const auto tokens = pink_perilla::lexer::TokenizeStatically<kCount>(sql);
+    return pink_perilla::detail::CheckCompiledSql(
+        pink_perilla::lexer::ScanStatically(sql).error, tokens.data(),
+        tokens.size());
+}
+
+#define PP_CHECK(sql) \
+    Check<pink_perilla::lexer::ScanStatically(sql).tokens>(sql)
+
+// Expects `sql`'s compile-time tokens to be what the runtime lexer produces.
+void ExpectRuntimeTokens(const pink_perilla::CompiledSql& sql) {
+    auto runtime = pink_perilla::lexer::Tokenize(sql.sql());
+
+    ASSERT_TRUE(runtime.ok()) << runtime.status();
+    ASSERT_EQ(sql.tokens().size(), runtime->size()) << sql.sql();
+    for (size_t i = 0; i < runtime->size(); ++i) {
+        EXPECT_EQ(sql.tokens()[i].type, (*runtime)[i].type) << i;
+        EXPECT_EQ(sql.tokens()[i].keyword, (*runtime)[i].keyword) << i;
+        EXPECT_EQ(sql.tokens()[i].text, (*runtime)[i].text) << i;
+    }
+}
+
+}  // namespace
+
+TEST(CompiledSql, PlansLikeRuntimeSql) {
+    const pink_perilla::CompiledSql sql = PP_SQL(
+        "SELECT name, age + 1 FROM users WHERE age >= 18 AND name <> 'x' "
+        "ORDER BY age DESC LIMIT 10;");
+    absl::StatusOr<substrait::Plan> compiled =
+        pink_perilla::Parse(sql, kTables);
+    absl::StatusOr<substrait::Plan> runtime =
+        pink_perilla::Parse(sql.sql(), kTables);
+
+    ASSERT_TRUE(compiled.ok()) << compiled.status();
+    ASSERT_TRUE(runtime.ok()) << runtime.status();
+    EXPECT_EQ(compiled->SerializeAsString(), runtime->SerializeAsString());
+}
+
+TEST(CompiledSql, TokensMatchRuntimeLexer) {
+    ExpectRuntimeTokens(PP_SQL(
+        "SELECT /* note */ \"q\"\"id\", 'it''s', .5, 1e10 -- trailing\n"
+        "FROM t WHERE a <> $1 OR b || c >= 2"));
+}
+
+TEST(CompiledSql, AdjacentQuotedLiteralsMatchRuntimeLexer) {
+    ExpectRuntimeTokens(PP_SQL("SELECT 'x'\"y\" FROM t"));
+    ExpectRuntimeTokens(PP_SQL("SELECT \"a\"'b''c' FROM t"));
+    ExpectRuntimeTokens(PP_SQL("SELECT 'a''b'\"c\"\"d\"'e' FROM t"));
+}
+
+TEST(CompiledSql, RejectsMalformedStatementsAtCompileTime) {
+    static_assert(PP_CHECK("SELECT a FROM t") == CompiledSqlError::kNone);
+    static_assert(PP_CHECK("SELECT a FROM t;;") == CompiledSqlError::kNone);
+    static_assert(PP_CHECK("SELECT # FROM t") ==
+                  CompiledSqlError::kUnexpectedCharacter);
+    static_assert(PP_CHECK("SELECT 'a FROM t") ==
+                  CompiledSqlError::kUnterminatedQuote);
+    static_assert(PP_CHECK(" -- nothing") == CompiledSqlError::kEmpty);
+    static_assert(PP_CHECK("FROM t SELECT a") ==
+                  CompiledSqlError::kNotAStatement);
+    static_assert(PP_CHECK("SELECT (a FROM t") ==
+                  CompiledSqlError::kUnbalancedParentheses);
+    static_assert(PP_CHECK("SELECT a) FROM t") ==
+                  CompiledSqlError::kUnbalancedParentheses);
+    static_assert(PP_CHECK("SELECT a FROM t WHERE a = ? AND b = $2") ==
+                  CompiledSqlError::kMixedPlaceholders);
+    static_assert(PP_CHECK("SELECT a FROM t; SELECT b FROM t") ==
+                  CompiledSqlError::kMultipleStatements);
+}
+
+TEST(CompiledSql, BindsPlaceholdersAtRuntime) {
+    const pink_perilla::CompiledSql sql =
+        PP_SQL("SELECT name FROM users WHERE age > ? AND name = ?");
+    absl::StatusOr<pink_perilla::PreparedPlan> compiled =
+        pink_perilla::Prepare(sql, kTables);
+    absl::StatusOr<pink_perilla::PreparedPlan> runtime =
+        pink_perilla::Prepare(sql.sql(), kTables);
+    ASSERT_TRUE(compiled.ok()) << compiled.status();
+    ASSERT_TRUE(runtime.ok()) << runtime.status();
+    EXPECT_EQ(compiled->parameter_count(), 2);
+
+    const std::vector<ParameterValue> values = {int64_t{30},
+                                                std::string("alice")};
+    absl::StatusOr<substrait::Plan> bound = compiled->Bind(values);
+    absl::StatusOr<substrait::Plan> expected = runtime->Bind(values);
+    ASSERT_TRUE(bound.ok()) << bound.status();
+    ASSERT_TRUE(expected.ok()) << expected.status();
+    EXPECT_EQ(bound->SerializeAsString(), expected->SerializeAsString());
+}
+
+TEST(CompiledSql, ReportsGrammarAndBindingErrorsWhenPlanned) {
+    EXPECT_EQ(pink_perilla::Parse(PP_SQL("SELECT FROM users"), kTables)
+                  .status()
+                  .code(),
+              absl::StatusCode::kInvalidArgument);
+    EXPECT_FALSE(
+        pink_perilla::Parse(PP_SQL("SELECT missing FROM users"), kTables).ok());
+}
@@ -0,0 +1,169 @@
+#include <google/protobuf/text_format.h>
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "absl/status/statusor.h"
+#include "catalog.hpp"
+#include "pink_perilla.hpp"
+#include "proto_tools.h"
+#include "substrait/plan.pb.h"
+
+namespace {
+
+using pink_perilla::DataType;
+
+const pink_perilla::Catalog& Events() {
+    static const pink_perilla::Catalog catalog({
+        {"events",
+         {{"id", DataType::kI64, false},
+          {"day", DataType::kDate},
+          {"note", DataType::kString}}},
+    });
+    return catalog;
+}
+
+const substrait::ReadRel::LocalFiles& LoadedFiles(const substrait::Plan& plan) {
+    return plan.relations(0).root().input().write().input().read().local_files();
+}
+
+}  // namespace
+
+TEST(Copy, CsvWithCatalogTypes) {
+    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(
+        "COPY events FROM 'file:///data/events.csv' "
+        "WITH (FORMAT csv, HEADER, DELIMITER '|', NULL '')",
+        Events());
+
+    ASSERT_TRUE(plan.ok()) << plan.status();
+    ProtoEqual(*plan,
+        R"pb(relations {
+               root {
+                 input {
+                   write {
+                     named_table { names: "events" }
+                     op: WRITE_OP_INSERT
+                     input {
+                       read {
+                         base_schema {
+                           names: "id"
+                           names: "day"
+                           names: "note"
+                           struct {
+                             types { i64 { nullability: NULLABILITY_REQUIRED } }
+                             types { date { nullability: NULLABILITY_NULLABLE } }
+                             types { string { nullability: NULLABILITY_NULLABLE } }
+                             nullability: NULLABILITY_REQUIRED
+                           }
+                         }
+                         local_files {
+                           items {
+                             uri_file: "file:///data/events.csv"
+                             text {
+                               field_delimiter: "|"
+                               quote: "\""
+                               header_lines_to_skip: 1
+                               value_treated_as_null: ""
+                             }
+                           }
+                         }
+                       }
+                     }
+                   }
+                 }
+               }
+             }
+        )pb");
+}
+
+TEST(Copy, SplitsIntoFileRanges) {
+    // A 50 GB load plans as quickly as a small one: only the ranges are
+    // computed, and the file is never opened.
+    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(
+        "COPY events (note, id) FROM 's3://bucket/events.parquet' "
+        "(FORMAT parquet, FILE_SIZE 53687091200, SPLIT_SIZE 1073741824)",
+        Events());
+    ASSERT_TRUE(plan.ok()) << plan.status();
+    const substrait::ReadRel::LocalFiles& files = LoadedFiles(*plan);
+    ASSERT_EQ(files.items_size(), 50);
+    for (int i = 0; i < files.items_size(); ++i) {
+        EXPECT_EQ(files.items(i).uri_file(), "s3://bucket/events.parquet");
+        EXPECT_TRUE(files.items(i).has_parquet());
+        EXPECT_EQ(files.items(i).partition_index(), static_cast<uint64_t>(i));
+        EXPECT_EQ(files.items(i).start(), uint64_t{1073741824} * i);
+        EXPECT_EQ(files.items(i).length(), 1073741824u);
+    }
+    const substrait::NamedStruct& schema =
+        plan->relations(0).root().input().write().input().read().base_schema();
+    ASSERT_EQ(schema.names_size(), 2);
+    EXPECT_EQ(schema.names(0), "note");
+    EXPECT_EQ(schema.names(1), "id");
+    EXPECT_TRUE(schema.struct_().types(0).has_string());
+    EXPECT_TRUE(schema.struct_().types(1).has_i64());
+
+    // The last range is cut short at the end of the file.
+    absl::StatusOr<substrait::Plan> uneven = pink_perilla::Parse(
+        "COPY events FROM 'events.csv' WITH (FILE_SIZE 250, SPLIT_SIZE 100)",
+        Events());
+    ASSERT_TRUE(uneven.ok()) << uneven.status();
+    const substrait::ReadRel::LocalFiles& ranges = LoadedFiles(*uneven);
+    ASSERT_EQ(ranges.items_size(), 3);
+    EXPECT_EQ(ranges.items(2).start(), 200u);
+    EXPECT_EQ(ranges.items(2).length(), 50u);
+}
+
+TEST(Copy, WithoutCatalog) {
+    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(
+        "COPY logs (ts, line) FROM '/tmp/it''s.arrow' WITH (FORMAT 'arrow')");
+
+    ASSERT_TRUE(plan.ok()) << plan.status();
+    ProtoEqual(*plan,
+        R"pb(relations {
+               root {
+                 input {
+                   write {
+                     named_table { names: "logs" }
+                     op: WRITE_OP_INSERT
+                     input {
+                       read {
+                         base_schema { names: "ts" names: "line" }
+                         local_files {
+                           items { uri_file: "/tmp/it's.arrow" arrow {} }
+                         }
+                       }
+                     }
+                   }
+                 }
+               }
+             }
+        )pb");
+}
+
+TEST(Copy, RejectsInvalidStatements) {
+    for (const char* sql : {
+             "COPY events FROM 'a.csv' WITH (COMPRESSION 'gzip')",
+             "COPY events FROM 'a.csv' WITH (FORMAT orc)",
+             "COPY events FROM 'a.parquet' WITH (FORMAT parquet, HEADER)",
+             "COPY events FROM 'a.csv' WITH (SPLIT_SIZE 100)",
+             "COPY events FROM 'a.csv' WITH (FILE_SIZE 0)",
+             "COPY events FROM 'a.csv' WITH (DELIMITER '')",
+             "COPY events FROM 'a.arrow' "
+             "WITH (FORMAT arrow, FILE_SIZE 10, SPLIT_SIZE 5)",
+             "COPY events FROM 'a.csv' WITH (FILE_SIZE 1000000, SPLIT_SIZE 1)",
+             "COPY events FROM a.csv",
+             "COPY events FROM 'a.csv' WITH (FORMAT csv",
+         }) {
+        EXPECT_EQ(pink_perilla::Parse(sql, Events()).status().code(),
+                  absl::StatusCode::kInvalidArgument)
+            << sql;
+    }
+    EXPECT_EQ(pink_perilla::Parse("COPY events (id, missing) FROM 'a.csv'",
+                                  Events())
+                  .status()
+                  .code(),
+              absl::StatusCode::kNotFound);
+    EXPECT_EQ(pink_perilla::Parse("COPY missing FROM 'a.csv'", Events())
+                  .status()
+                  .code(),
+              absl::StatusCode::kNotFound);
+}
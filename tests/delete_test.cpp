@@ -14,7 +14,18 @@ TEST(Delete, BasicDelete) {
     ASSERT_TRUE(plan.ok());
     ProtoEqual(
         *plan,
-        R"pb(relations {
+        R"pb(extension_uris {
+               extension_uri_anchor: 1
+               uri: "https://github.com/substrait-io/substrait/blob/main/extensions/functions_comparison.yaml"
+             }
+             extensions {
+               extension_function {
+                 extension_uri_reference: 1
+                 function_anchor: 1
+                 name: "equal:any_any"
+               }
+             }
+             relations {
                root {
                  input {
                    write {
@@ -23,13 +34,24 @@ TEST(Delete, BasicDelete) {
                      input {
                        filter {
                          input {
-                           read { named_table { names: "users" } }
+                           read {
+                             base_schema { names: "id" }
+                             named_table { names: "users" }
+                           }
                          }
                          condition {
                            scalar_function {
+                             function_reference: 1
                              arguments {
-                               value { literal { string: "id = 101" } }
+                               value {
+                                 selection {
+                                   direct_reference { struct_field { field: 0 } }
+                                   root_reference {}
+                                 }
+                               }
                              }
+                             arguments { value { literal { i32: 101 } } }
+                             output_type { bool { nullability: NULLABILITY_NULLABLE } }
                            }
                          }
                        }
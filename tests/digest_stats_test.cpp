@@ -0,0 +1,87 @@
+#include <google/protobuf/text_format.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "digest_stats.hpp"
+#include "pink_perilla.hpp"
+#include "proto_tools.h"
+#include "substrait/plan.pb.h"
+
+TEST(DigestStats, GroupsStatementsByShape) {
+    pink_perilla::DigestStats stats;
+    ASSERT_TRUE(stats.Parse("SELECT a FROM t WHERE b = 1").ok());
+    ASSERT_TRUE(stats.Parse("select a from t where b = 'two'").ok());
+    ASSERT_TRUE(stats.Parse("SELECT a FROM t WHERE c = 1").ok());
+    EXPECT_FALSE(stats.Parse("SELECT a FROM t WHERE c = 1 +").ok());
+
+    std::vector<pink_perilla::DigestSnapshot> snapshots = stats.Snapshot();
+    ASSERT_EQ(snapshots.size(), 3);
+    const pink_perilla::DigestSnapshot* shape = nullptr;
+    const pink_perilla::DigestSnapshot* failed = nullptr;
+    for (const pink_perilla::DigestSnapshot& snapshot : snapshots) {
+        if (snapshot.normalized_sql == "SELECT a FROM t WHERE b = ?") {
+            shape = &snapshot;
+        } else if (snapshot.normalized_sql ==
+                   "SELECT a FROM t WHERE c = ? +") {
+            failed = &snapshot;
+        }
+    }
+    ASSERT_NE(shape, nullptr);
+    ASSERT_NE(failed, nullptr);
+    EXPECT_EQ(failed->errors, 1);
+    EXPECT_EQ(failed->convert.total_ns, 0);
+    EXPECT_EQ(failed->plan_bytes_total, 0);
+    EXPECT_EQ(shape->calls, 2);
+    EXPECT_EQ(shape->errors, 0);
+    EXPECT_GT(shape->parse.total_ns, 0);
+    EXPECT_LE(shape->parse.min_ns, shape->parse.max_ns);
+    EXPECT_LE(shape->parse.p99_ns, shape->parse.max_ns);
+    EXPECT_GE(shape->parse.p99_ns, shape->parse.min_ns);
+    EXPECT_GT(shape->plan_bytes_min, 0);
+    EXPECT_EQ(shape->plan_bytes_total,
+              shape->plan_bytes_min + shape->plan_bytes_max);
+
+    EXPECT_EQ(stats.Top(1).size(), 1);
+    EXPECT_GE(stats.Top(1)[0].parse.total_ns + stats.Top(1)[0].convert.total_ns,
+              snapshots.back().parse.total_ns +
+                  snapshots.back().convert.total_ns);
+}
+
+TEST(DigestStats, ReturnsTheSamePlanAsParse) {
+    pink_perilla::DigestStats stats;
+    const std::string sql = "SELECT a, b FROM t WHERE a > 3 ORDER BY b";
+    absl::StatusOr<substrait::Plan> plan = stats.Parse(sql);
+    absl::StatusOr<substrait::Plan> expected = pink_perilla::Parse(sql);
+    ASSERT_TRUE(plan.ok());
+    ASSERT_TRUE(expected.ok());
+    std::string expected_text;
+    google::protobuf::TextFormat::PrintToString(*expected, &expected_text);
+    ProtoEqual(*plan, expected_text);
+}
+
+TEST(DigestStats, MergesThreadsOnRead) {
+    pink_perilla::DigestStats stats;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&stats, t] {
+            for (int i = 0; i < 100; ++i) {
+                ASSERT_TRUE(stats
+                                .Parse("SELECT a FROM t WHERE b = " +
+                                       std::to_string(t * 100 + i))
+                                .ok());
+            }
+        });
+    }
+    // Reading while writers run must be safe.
+    stats.Snapshot();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    std::vector<pink_perilla::DigestSnapshot> snapshots = stats.Snapshot();
+    ASSERT_EQ(snapshots.size(), 1);
+    EXPECT_EQ(snapshots[0].calls, 400);
+}
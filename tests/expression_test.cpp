@@ -0,0 +1,343 @@
+#include <google/protobuf/text_format.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "detail/arena.hpp"
+#include "detail/sql_parser.hpp"
+#include "pink_perilla.hpp"
+#include "proto_tools.h"
+#include "substrait/plan.pb.h"
+
+namespace {
+
+const std::vector<pink_perilla::TableDefinition> kTables = {
+    {"users",
+     {{"id", pink_perilla::DataType::kI64, false},
+      {"name", pink_perilla::DataType::kString, true},
+      {"age", pink_perilla::DataType::kI32, true}}},
+    {"orders",
+     {{"id", pink_perilla::DataType::kI64, false},
+      {"user_id", pink_perilla::DataType::kI64, false},
+      {"total", pink_perilla::DataType::kFp64, true}}},
+};
+
+// Name of the extension function `anchor` refers to.
+std::string FunctionName(const substrait::Plan& plan, uint32_t anchor) {
+    for (const auto& extension : plan.extensions()) {
+        if (extension.extension_function().function_anchor() == anchor) {
+            return extension.extension_function().name();
+        }
+    }
+    return "";
+}
+
+const substrait::ProjectRel& Project(const substrait::Plan& plan) {
+    return plan.relations(0).root().input().project();
+}
+
+std::string ParseError(std::string_view sql) {
+    pink_perilla::StatementArena arena;
+    absl::StatusOr<Statement> statement =
+        SqlParser::Parse(sql, kTables, arena.resource());
+    return statement.ok() ? "" : std::string(statement.status().message());
+}
+
+}  // namespace
+
+TEST(Expression, MultiplicationBindsTighterThanAddition) {
+    pink_perilla::StatementArena arena;
+    auto result =
+        SqlParser::Parse("SELECT a + b * 2 - c FROM t", {}, arena.resource());
+    ASSERT_TRUE(result.ok());
+    const auto& select = std::get<SelectInfo>(*result);
+    const ExpressionTree& tree = select.expressions;
+
+    // ((a + (b * 2)) - c)
+    const ExprNode& minus = tree[select.select_items[0].expr];
+    ASSERT_EQ(minus.kind, ExprKind::kBinary);
+    EXPECT_EQ(minus.op, ExprOp::kSubtract);
+    const ExprNode& plus = tree[tree.arg(minus, 0)];
+    EXPECT_EQ(plus.op, ExprOp::kAdd);
+    EXPECT_EQ(plus.source, "a + b * 2");
+    EXPECT_EQ(tree[tree.arg(plus, 1)].op, ExprOp::kMultiply);
+    EXPECT_EQ(tree[tree.arg(minus, 1)].text, "c");
+}
+
+TEST(Expression, ColumnsBecomeFieldReferences) {
+    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(
+        "SELECT name, age + 1 FROM users", kTables);
+
+    ASSERT_TRUE(plan.ok());
+    ProtoEqual(
+        *plan,
+        R"pb(extension_uris {
+               extension_uri_anchor: 1
+               uri: "https://github.com/substrait-io/substrait/blob/main/extensions/functions_arithmetic.yaml"
+             }
+             extensions {
+               extension_function {
+                 extension_uri_reference: 1
+                 function_anchor: 1
+                 name: "add:i32_i32"
+               }
+             }
+             relations {
+               root {
+                 input {
+                   project {
+                     common { emit { output_mapping: 3 output_mapping: 4 } }
+                     input {
+                       read {
+                         base_schema {
+                           names: "id"
+                           names: "name"
+                           names: "age"
+                           struct {
+                             types { i64 { nullability: NULLABILITY_REQUIRED } }
+                             types { string { nullability: NULLABILITY_NULLABLE } }
+                             types { i32 { nullability: NULLABILITY_NULLABLE } }
+                             nullability: NULLABILITY_REQUIRED
+                           }
+                         }
+                         named_table { names: "users" }
+                       }
+                     }
+                     expressions {
+                       selection {
+                         direct_reference { struct_field { field: 1 } }
+                         root_reference {}
+                       }
+                     }
+                     expressions {
+                       scalar_function {
+                         function_reference: 1
+                         arguments {
+                           value {
+                             selection {
+                               direct_reference { struct_field { field: 2 } }
+                               root_reference {}
+                             }
+                           }
+                         }
+                         arguments { value { literal { i32: 1 } } }
+                         output_type { i32 { nullability: NULLABILITY_NULLABLE } }
+                       }
+                     }
+                   }
+                 }
+               }
+             }
+        )pb");
+}
+
+TEST(Expression, AndChainIsOneCall) {
+    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(
+        "SELECT * FROM users WHERE id > 1 AND age < 30 AND name = 'x'",
+        kTables);
+
+    ASSERT_TRUE(plan.ok());
+    const auto& condition =
+        plan->relations(0).root().input().filter().condition().scalar_function();
+    EXPECT_EQ(FunctionName(*plan, condition.function_reference()), "and:bool");
+    ASSERT_EQ(condition.arguments_size(), 3);
+    EXPECT_EQ(FunctionName(*plan, condition.arguments(0)
+                                      .value()
+                                      .scalar_function()
+                                      .function_reference()),
+              "gt:any_any");
+    EXPECT_EQ(FunctionName(*plan, condition.arguments(2)
+                                      .value()
+                                      .scalar_function()
+                                      .function_reference()),
+              "equal:any_any");
+}
+
+TEST(Expression, NegatedPredicates) {
+    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(
+        "SELECT * FROM users WHERE age NOT BETWEEN 1 AND 5 OR id NOT IN (1, 2) "
+        "OR name IS NOT NULL",
+        kTables);
+
+    ASSERT_TRUE(plan.ok());
+    const auto& condition =
+        plan->relations(0).root().input().filter().condition().scalar_function();
+    ASSERT_EQ(condition.arguments_size(), 3);
+
+    const auto& not_between = condition.arguments(0).value().scalar_function();
+    EXPECT_EQ(FunctionName(*plan, not_between.function_reference()), "not:bool");
+    EXPECT_EQ(FunctionName(*plan, not_between.arguments(0)
+                                      .value()
+                                      .scalar_function()
+                                      .function_reference()),
+              "between:any_any_any");
+
+    const auto& not_in = condition.arguments(1).value().scalar_function();
+    const auto& in_list = not_in.arguments(0).value().singular_or_list();
+    EXPECT_EQ(in_list.value().selection().direct_reference().struct_field().field(), 0);
+    EXPECT_EQ(in_list.options_size(), 2);
+
+    const auto& is_not_null = condition.arguments(2).value().scalar_function();
+    EXPECT_EQ(FunctionName(*plan, is_not_null.function_reference()),
+              "is_not_null:any");
+}
+
+TEST(Expression, FunctionsUseTheirDeclaredCompoundNames) {
+    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(
+        "SELECT COALESCE(name, name, 'x'), name || name || 'x', age + 1 "
+        "FROM users",
+        kTables);
+
+    ASSERT_TRUE(plan.ok()) << plan.status();
+    const substrait::ProjectRel& project = Project(*plan);
+    ASSERT_EQ(project.expressions_size(), 3);
+    // Variadic functions are named after their declared arguments only.
+    EXPECT_EQ(FunctionName(*plan, project.expressions(0)
+                                      .scalar_function()
+                                      .function_reference()),
+              "coalesce:any_any");
+    EXPECT_EQ(FunctionName(*plan, project.expressions(1)
+                                      .scalar_function()
+                                      .function_reference()),
+              "concat:str");
+    EXPECT_EQ(FunctionName(*plan, project.expressions(2)
+                                      .scalar_function()
+                                      .function_reference()),
+              "add:i32_i32");
+}
+
+TEST(Expression, TypedLiterals) {
+    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(
+        "SELECT -5, 3000000000, -2.5, 'it''s', TRUE, NULL FROM t");
+
+    ASSERT_TRUE(plan.ok());
+    const substrait::ProjectRel& project = Project(*plan);
+    ASSERT_EQ(project.expressions_size(), 6);
+    EXPECT_EQ(project.expressions(0).literal().i32(), -5);
+    EXPECT_EQ(project.expressions(1).literal().i64(), 3000000000);
+    EXPECT_EQ(project.expressions(2).literal().fp64(), -2.5);
+    EXPECT_EQ(project.expressions(3).literal().string(), "it's");
+    EXPECT_TRUE(project.expressions(4).literal().boolean());
+    EXPECT_TRUE(project.expressions(5).literal().has_null());
+}
+
+TEST(Expression, CaseAndCast) {
+    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(
+        "SELECT CASE age WHEN 1 THEN 'one' ELSE 'many' END, "
+        "CAST(age AS DECIMAL(10, 2)) FROM users",
+        kTables);
+
+    ASSERT_TRUE(plan.ok());
+    const substrait::ProjectRel& project = Project(*plan);
+    const auto& if_then = project.expressions(0).if_then();
+    ASSERT_EQ(if_then.ifs_size(), 1);
+    EXPECT_EQ(FunctionName(*plan, if_then.ifs(0).if_().scalar_function()
+                                      .function_reference()),
+              "equal:any_any");
+    EXPECT_EQ(if_then.ifs(0).then().literal().string(), "one");
+    EXPECT_EQ(if_then.else_().literal().string(), "many");
+
+    const auto& cast = project.expressions(1).cast();
+    EXPECT_EQ(cast.type().decimal().precision(), 10);
+    EXPECT_EQ(cast.type().decimal().scale(), 2);
+    EXPECT_EQ(cast.input().selection().direct_reference().struct_field().field(), 2);
+}
+
+TEST(Expression, JoinFieldsFollowInputOrder) {
+    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(
+        "SELECT users.name, orders.total FROM users INNER JOIN orders "
+        "ON users.id = orders.user_id",
+        kTables);
+
+    ASSERT_TRUE(plan.ok());
+    const substrait::ProjectRel& project = Project(*plan);
+    EXPECT_EQ(project.expressions(0).selection().direct_reference().struct_field().field(), 1);
+    EXPECT_EQ(project.expressions(1).selection().direct_reference().struct_field().field(), 5);
+    const auto& on = project.input().join().expression().scalar_function();
+    EXPECT_EQ(on.arguments(1).value().selection().direct_reference().struct_field().field(), 4);
+}
+
+TEST(Expression, AggregatesAreMeasures) {
+    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(
+        "SELECT user_id, SUM(total) AS spent, COUNT(*) FROM orders "
+        "GROUP BY user_id ORDER BY spent DESC",
+        kTables);
+
+    ASSERT_TRUE(plan.ok());
+    const substrait::ProjectRel& project = Project(*plan);
+    // Input is (user_id, sum, count); the select list is appended after it.
+    EXPECT_EQ(project.expressions(1).selection().direct_reference().struct_field().field(), 1);
+    EXPECT_EQ(project.expressions(2).selection().direct_reference().struct_field().field(), 2);
+
+    const substrait::SortRel& sort = project.input().sort();
+    EXPECT_EQ(sort.sorts(0).expr().selection().direct_reference().struct_field().field(), 1);
+
+    const substrait::AggregateRel& aggregate = sort.input().aggregate();
+    ASSERT_EQ(aggregate.measures_size(), 2);
+    const auto& sum = aggregate.measures(0).measure();
+    EXPECT_EQ(FunctionName(*plan, sum.function_reference()), "sum:fp64");
+    EXPECT_TRUE(sum.output_type().has_fp64());
+    const auto& count = aggregate.measures(1).measure();
+    EXPECT_EQ(FunctionName(*plan, count.function_reference()), "count");
+    EXPECT_EQ(count.arguments_size(), 0);
+}
+
+TEST(Expression, SortPositionsCountStarColumns) {
+    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(
+        "SELECT * FROM users ORDER BY 3 DESC, 1", kTables);
+
+    ASSERT_TRUE(plan.ok()) << plan.status();
+    const substrait::SortRel& sort = plan->relations(0).root().input().sort();
+    ASSERT_EQ(sort.sorts_size(), 2);
+    EXPECT_EQ(sort.sorts(0).expr().selection().direct_reference().struct_field().field(), 2);
+    EXPECT_EQ(sort.sorts(1).expr().selection().direct_reference().struct_field().field(), 0);
+}
+
+TEST(Expression, WindowResultFollowsInput) {
+    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(
+        "SELECT name, row_number() OVER (PARTITION BY age) FROM users",
+        kTables);
+
+    ASSERT_TRUE(plan.ok());
+    const substrait::ProjectRel& project = Project(*plan);
+    ASSERT_EQ(project.common().emit().output_mapping_size(), 2);
+    EXPECT_EQ(project.common().emit().output_mapping(0), 4);
+    EXPECT_EQ(project.common().emit().output_mapping(1), 3);
+    const auto& window = project.input().window();
+    EXPECT_EQ(window.partition_expressions(0).selection().direct_reference().struct_field().field(), 2);
+    EXPECT_EQ(FunctionName(*plan, window.window_functions(0).function_reference()),
+              "row_number");
+}
+
+TEST(Expression, BindErrors) {
+    EXPECT_EQ(ParseError("SELECT id FROM users INNER JOIN orders ON id = user_id"),
+              "Ambiguous column reference 'id'");
+    EXPECT_EQ(ParseError("SELECT email FROM users"), "Column not found: email");
+    EXPECT_EQ(ParseError("SELECT o.id FROM users"), "Unknown table 'o'");
+    EXPECT_EQ(ParseError("SELECT name, COUNT(*) FROM users GROUP BY age"),
+              "Column 'name' must appear in the GROUP BY clause or be used in "
+              "an aggregate function");
+    EXPECT_EQ(ParseError("SELECT id FROM users WHERE SUM(age) > 1"),
+              "Aggregate functions are not allowed in WHERE");
+    EXPECT_EQ(ParseError("INSERT INTO users (id) VALUES (age)"),
+              "Column references are not allowed here: age");
+    EXPECT_EQ(ParseError("SELECT id, name FROM users ORDER BY 7"),
+              "ORDER BY position 7 is not in the select list");
+    EXPECT_EQ(ParseError("SELECT * FROM users ORDER BY 4"),
+              "ORDER BY position 4 is not in the select list");
+    EXPECT_EQ(ParseError("SELECT id FROM users ORDER BY 0"),
+              "ORDER BY position 0 is not in the select list");
+}
+
+TEST(Expression, ParseErrors) {
+    EXPECT_EQ(ParseError("SELECT a + FROM t"), "Expected expression before 'FROM'");
+    EXPECT_EQ(ParseError("SELECT id FROM users WHERE id IN (SELECT user_id FROM orders)"),
+              "Subqueries are not supported in IN");
+    EXPECT_EQ(ParseError("SELECT CAST(a AS BLOB) FROM t"),
+              "Unsupported type in CAST: BLOB");
+    EXPECT_EQ(ParseError("SELECT CASE WHEN a THEN b FROM t"),
+              "Expected END after CASE");
+}
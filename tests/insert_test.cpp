@@ -1,6 +1,10 @@
 #include <google/protobuf/text_format.h>
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "pink_perilla.hpp"
 #include "proto_tools.h"
@@ -41,3 +45,171 @@ TEST(Insert, BasicInsert) {
              }
         )pb");
 }
+
+TEST(Insert, QuotedValueContainingComma) {
+    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(
+        "INSERT INTO users (id, name) VALUES (7, 'Doe, Jane');");
+
+    ASSERT_TRUE(plan.ok());
+    ProtoEqual(*plan,
+        R"pb(relations {
+               root {
+                 input {
+                   write {
+                     named_table { names: "users" }
+                     input {
+                       read {
+                         base_schema {
+                           names: "id"
+                           names: "name"
+                         }
+                         virtual_table {
+                           expressions {
+                             fields {
+                               literal { i32: 7 }
+                             }
+                             fields {
+                               literal { string: "Doe, Jane" }
+                             }
+                           }
+                         }
+                       }
+                     }
+                   }
+                 }
+               }
+             }
+        )pb");
+}
+
+TEST(Insert, MultipleRows) {
+    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(
+        "INSERT INTO users (id, name) VALUES (1, 'a'), (2, 'b');");
+
+    ASSERT_TRUE(plan.ok());
+    ProtoEqual(*plan,
+        R"pb(relations {
+               root {
+                 input {
+                   write {
+                     named_table { names: "users" }
+                     input {
+                       read {
+                         base_schema {
+                           names: "id"
+                           names: "name"
+                         }
+                         virtual_table {
+                           expressions {
+                             fields {
+                               literal { i32: 1 }
+                             }
+                             fields {
+                               literal { string: "a" }
+                             }
+                           }
+                           expressions {
+                             fields {
+                               literal { i32: 2 }
+                             }
+                             fields {
+                               literal { string: "b" }
+                             }
+                           }
+                         }
+                       }
+                     }
+                   }
+                 }
+               }
+             }
+        )pb");
+}
+
+TEST(Insert, RowsMustHaveTheSameWidth) {
+    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(
+        "INSERT INTO users (id, name) VALUES (1, 'a'), (2);");
+
+    ASSERT_FALSE(plan.ok());
+    EXPECT_EQ(plan.status().message(), "VALUES row has 1 values, expected 2");
+}
+
+TEST(Insert, RowsMustMatchTheColumnList) {
+    absl::StatusOr<substrait::Plan> wide =
+        pink_perilla::Parse("INSERT INTO users (id) VALUES (1, 2, 3);");
+    ASSERT_FALSE(wide.ok());
+    EXPECT_EQ(wide.status().code(), absl::StatusCode::kInvalidArgument);
+    EXPECT_EQ(wide.status().message(), "VALUES row has 3 values, expected 1");
+
+    absl::StatusOr<substrait::Plan> narrow =
+        pink_perilla::Parse("INSERT INTO users (id, name) VALUES (1);");
+    ASSERT_FALSE(narrow.ok());
+    EXPECT_EQ(narrow.status().code(), absl::StatusCode::kInvalidArgument);
+    EXPECT_EQ(narrow.status().message(), "VALUES row has 1 values, expected 2");
+}
+
+TEST(Insert, ListedColumnsMustExistInADefinedTable) {
+    const std::vector<pink_perilla::TableDefinition> tables = {
+        {"users",
+         {{"id", pink_perilla::DataType::kI64, false},
+          {"name", pink_perilla::DataType::kString}}},
+    };
+    absl::StatusOr<substrait::Plan> plan =
+        pink_perilla::Parse("INSERT INTO users (zz) VALUES (1);", tables);
+    ASSERT_FALSE(plan.ok());
+    EXPECT_EQ(plan.status().code(), absl::StatusCode::kNotFound);
+    EXPECT_EQ(plan.status().message(), "Column not found: zz");
+
+    // Without a definition the listed columns are taken as given.
+    EXPECT_TRUE(pink_perilla::Parse("INSERT INTO users (zz) VALUES (1);").ok());
+}
+
+TEST(Insert, ChunkedRows) {
+    std::string sql = "INSERT INTO users (id, name) VALUES ";
+    for (int i = 0; i < 10; ++i) {
+        sql += (i == 0 ? "(" : ", (") + std::to_string(i) + ", 'n')";
+    }
+    pink_perilla::ParseOptions options;
+    options.insert_chunk_rows = 4;
+    std::vector<int> chunk_rows;
+    int next_id = 0;
+    absl::Status status = pink_perilla::ParseChunked(
+        sql, pink_perilla::Catalog({}), options,
+        [&](const substrait::Plan& plan) {
+            const auto& rows = plan.relations(0).root().input().write()
+                                   .input().read().virtual_table().expressions();
+            chunk_rows.push_back(rows.size());
+            for (const auto& row : rows) {
+                EXPECT_EQ(row.fields(0).literal().i32(), next_id++);
+            }
+            return absl::OkStatus();
+        });
+    ASSERT_TRUE(status.ok()) << status;
+    EXPECT_EQ(chunk_rows, (std::vector<int>{4, 4, 2}));
+
+    // Without a chunk size the statement plans as one, like Parse().
+    options.insert_chunk_rows = 0;
+    int plans = 0;
+    status = pink_perilla::ParseChunked(
+        sql, pink_perilla::Catalog({}), options,
+        [&](const substrait::Plan& plan) {
+            ++plans;
+            EXPECT_EQ(plan.SerializeAsString(),
+                      pink_perilla::Parse(sql)->SerializeAsString());
+            return absl::OkStatus();
+        });
+    ASSERT_TRUE(status.ok()) << status;
+    EXPECT_EQ(plans, 1);
+
+    // The sink's error stops the sequence.
+    options.insert_chunk_rows = 1;
+    plans = 0;
+    status = pink_perilla::ParseChunked(
+        sql, pink_perilla::Catalog({}), options,
+        [&](const substrait::Plan&) {
+            return ++plans == 2 ? absl::CancelledError("enough")
+                                : absl::OkStatus();
+        });
+    EXPECT_EQ(status.code(), absl::StatusCode::kCancelled);
+    EXPECT_EQ(plans, 2);
+}
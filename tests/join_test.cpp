@@ -32,17 +32,53 @@ TEST(Join, InnerJoin) {
 
     ASSERT_TRUE(plan.ok());
     ProtoEqual(*plan,
-               R"pb(relations {
+               R"pb(extension_uris {
+                      extension_uri_anchor: 1
+                      uri: "https://github.com/substrait-io/substrait/blob/main/extensions/functions_comparison.yaml"
+                    }
+                    extensions {
+                      extension_function {
+                        extension_uri_reference: 1
+                        function_anchor: 1
+                        name: "equal:any_any"
+                      }
+                    }
+                    relations {
                       root {
                         input {
                           join {
-                            left { read { named_table { names: "t1" } } }
-                            right { read { named_table { names: "t2" } } }
+                            left {
+                              read {
+                                base_schema { names: "id" }
+                                named_table { names: "t1" }
+                              }
+                            }
+                            right {
+                              read {
+                                base_schema { names: "id" }
+                                named_table { names: "t2" }
+                              }
+                            }
                             expression {
                               scalar_function {
+                                function_reference: 1
                                 arguments {
-                                  value { literal { string: "t1.id = t2.id" } }
+                                  value {
+                                    selection {
+                                      direct_reference { struct_field { field: 0 } }
+                                      root_reference {}
+                                    }
+                                  }
                                 }
+                                arguments {
+                                  value {
+                                    selection {
+                                      direct_reference { struct_field { field: 1 } }
+                                      root_reference {}
+                                    }
+                                  }
+                                }
+                                output_type { bool { nullability: NULLABILITY_NULLABLE } }
                               }
                             }
                             type: JOIN_TYPE_INNER
@@ -59,17 +95,53 @@ TEST(Join, LeftOuterJoin) {
 
     ASSERT_TRUE(plan.ok());
     ProtoEqual(*plan,
-               R"pb(relations {
+               R"pb(extension_uris {
+                      extension_uri_anchor: 1
+                      uri: "https://github.com/substrait-io/substrait/blob/main/extensions/functions_comparison.yaml"
+                    }
+                    extensions {
+                      extension_function {
+                        extension_uri_reference: 1
+                        function_anchor: 1
+                        name: "equal:any_any"
+                      }
+                    }
+                    relations {
                       root {
                         input {
                           join {
-                            left { read { named_table { names: "t1" } } }
-                            right { read { named_table { names: "t2" } } }
+                            left {
+                              read {
+                                base_schema { names: "id" }
+                                named_table { names: "t1" }
+                              }
+                            }
+                            right {
+                              read {
+                                base_schema { names: "id" }
+                                named_table { names: "t2" }
+                              }
+                            }
                             expression {
                               scalar_function {
+                                function_reference: 1
                                 arguments {
-                                  value { literal { string: "t1.id = t2.id" } }
+                                  value {
+                                    selection {
+                                      direct_reference { struct_field { field: 0 } }
+                                      root_reference {}
+                                    }
+                                  }
                                 }
+                                arguments {
+                                  value {
+                                    selection {
+                                      direct_reference { struct_field { field: 1 } }
+                                      root_reference {}
+                                    }
+                                  }
+                                }
+                                output_type { bool { nullability: NULLABILITY_NULLABLE } }
                               }
                             }
                             type: JOIN_TYPE_LEFT
@@ -88,7 +160,18 @@ TEST(Join, FourTableJoin) {
     ASSERT_TRUE(plan.ok());
     ProtoEqual(
         *plan,
-        R"pb(relations {
+        R"pb(extension_uris {
+               extension_uri_anchor: 1
+               uri: "https://github.com/substrait-io/substrait/blob/main/extensions/functions_comparison.yaml"
+             }
+             extensions {
+               extension_function {
+                 extension_uri_reference: 1
+                 function_anchor: 1
+                 name: "equal:any_any"
+               }
+             }
+             relations {
                root {
                  input {
                    join {
@@ -96,35 +179,100 @@ TEST(Join, FourTableJoin) {
                        join {
                          left {
                            join {
-                             left { read { named_table { names: "t1" } } }
-                             right { read { named_table { names: "t2" } } }
+                             left {
+                               read {
+                                 base_schema { names: "id" }
+                                 named_table { names: "t1" }
+                               }
+                             }
+                             right {
+                               read {
+                                 base_schema { names: "id" }
+                                 named_table { names: "t2" }
+                               }
+                             }
                              expression {
                                scalar_function {
+                                 function_reference: 1
                                  arguments {
-                                   value { literal { string: "t1.id = t2.id" } }
+                                   value {
+                                     selection {
+                                       direct_reference { struct_field { field: 0 } }
+                                       root_reference {}
+                                     }
+                                   }
                                  }
+                                 arguments {
+                                   value {
+                                     selection {
+                                       direct_reference { struct_field { field: 1 } }
+                                       root_reference {}
+                                     }
+                                   }
+                                 }
+                                 output_type { bool { nullability: NULLABILITY_NULLABLE } }
                                }
                              }
                              type: JOIN_TYPE_INNER
                            }
                          }
-                         right { read { named_table { names: "t3" } } }
+                         right {
+                           read {
+                             base_schema { names: "id" }
+                             named_table { names: "t3" }
+                           }
+                         }
                          expression {
                            scalar_function {
+                             function_reference: 1
+                             arguments {
+                               value {
+                                 selection {
+                                   direct_reference { struct_field { field: 1 } }
+                                   root_reference {}
+                                 }
+                               }
+                             }
                              arguments {
-                               value { literal { string: "t2.id = t3.id" } }
+                               value {
+                                 selection {
+                                   direct_reference { struct_field { field: 2 } }
+                                   root_reference {}
+                                 }
+                               }
                              }
+                             output_type { bool { nullability: NULLABILITY_NULLABLE } }
                            }
                          }
                          type: JOIN_TYPE_INNER
                        }
                      }
-                     right { read { named_table { names: "t4" } } }
+                     right {
+                       read {
+                         base_schema { names: "id" }
+                         named_table { names: "t4" }
+                       }
+                     }
                      expression {
                        scalar_function {
+                         function_reference: 1
                          arguments {
-                           value { literal { string: "t3.id = t4.id" } }
+                           value {
+                             selection {
+                               direct_reference { struct_field { field: 2 } }
+                               root_reference {}
+                             }
+                           }
+                         }
+                         arguments {
+                           value {
+                             selection {
+                               direct_reference { struct_field { field: 3 } }
+                               root_reference {}
+                             }
+                           }
                          }
+                         output_type { bool { nullability: NULLABILITY_NULLABLE } }
                        }
                      }
                      type: JOIN_TYPE_INNER
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include "detail/lexer.hpp"
+
+using pink_perilla::lexer::Keyword;
+using pink_perilla::lexer::LookupKeyword;
+using pink_perilla::lexer::Token;
+using pink_perilla::lexer::Tokenize;
+using pink_perilla::lexer::TokenType;
+
+TEST(Lexer, KeywordLookupIsCaseInsensitive) {
+    static_assert(LookupKeyword("SELECT") == Keyword::kSelect);
+    EXPECT_EQ(LookupKeyword("select"), Keyword::kSelect);
+    EXPECT_EQ(LookupKeyword("SeLeCt"), Keyword::kSelect);
+    EXPECT_EQ(LookupKeyword("partition"), Keyword::kPartition);
+    EXPECT_EQ(LookupKeyword("selects"), Keyword::kNone);
+    EXPECT_EQ(LookupKeyword("users"), Keyword::kNone);
+    EXPECT_EQ(LookupKeyword(""), Keyword::kNone);
+}
+
+TEST(Lexer, TokenizesStatement) {
+    auto tokens = Tokenize("SELECT a, b FROM t WHERE x >= 10;");
+    ASSERT_TRUE(tokens.ok());
+    std::vector<TokenType> types;
+    for (const Token &token : *tokens) {
+        types.push_back(token.type);
+    }
+    EXPECT_EQ(types,
+              (std::vector<TokenType>{TokenType::kIdentifier,
+                                      TokenType::kIdentifier,
+                                      TokenType::kComma,
+                                      TokenType::kIdentifier,
+                                      TokenType::kIdentifier,
+                                      TokenType::kIdentifier,
+                                      TokenType::kIdentifier,
+                                      TokenType::kIdentifier,
+                                      TokenType::kGe,
+                                      TokenType::kNumber,
+                                      TokenType::kSemicolon,
+                                      TokenType::kEnd}));
+    EXPECT_EQ((*tokens)[0].keyword, Keyword::kSelect);
+    EXPECT_EQ((*tokens)[1].keyword, Keyword::kNone);
+    EXPECT_EQ((*tokens)[9].text, "10");
+}
+
+TEST(Lexer, SkipsComments) {
+    auto tokens = Tokenize("a -- line\n/* block */ b /* unclosed");
+    ASSERT_TRUE(tokens.ok());
+    ASSERT_EQ(tokens->size(), 3);
+    EXPECT_EQ((*tokens)[0].text, "a");
+    EXPECT_EQ((*tokens)[1].text, "b");
+    EXPECT_EQ((*tokens)[2].type, TokenType::kEnd);
+}
+
+TEST(Lexer, QuotedLiteralsKeepDelimitersAndEscapes) {
+    auto tokens = Tokenize("'it''s, here' \"Col\"");
+    ASSERT_TRUE(tokens.ok());
+    ASSERT_EQ(tokens->size(), 3);
+    EXPECT_EQ((*tokens)[0].type, TokenType::kString);
+    EXPECT_EQ((*tokens)[0].text, "'it''s, here'");
+    EXPECT_EQ((*tokens)[1].type, TokenType::kQuotedIdentifier);
+    EXPECT_EQ((*tokens)[1].text, "\"Col\"");
+}
+
+TEST(Lexer, AdjacentQuotedLiteralsStaySeparate) {
+    auto tokens = Tokenize("'x'\"y\"");
+    ASSERT_TRUE(tokens.ok());
+    ASSERT_EQ(tokens->size(), 3);
+    EXPECT_EQ((*tokens)[0].type, TokenType::kString);
+    EXPECT_EQ((*tokens)[0].text, "'x'");
+    EXPECT_EQ((*tokens)[1].type, TokenType::kQuotedIdentifier);
+    EXPECT_EQ((*tokens)[1].text, "\"y\"");
+
+    tokens = Tokenize("\"a\"'b''c'");
+    ASSERT_TRUE(tokens.ok());
+    ASSERT_EQ(tokens->size(), 3);
+    EXPECT_EQ((*tokens)[0].type, TokenType::kQuotedIdentifier);
+    EXPECT_EQ((*tokens)[0].text, "\"a\"");
+    EXPECT_EQ((*tokens)[1].type, TokenType::kString);
+    EXPECT_EQ((*tokens)[1].text, "'b''c'");
+}
+
+TEST(Lexer, RejectsUnterminatedString) {
+    auto tokens = Tokenize("SELECT 'abc");
+    ASSERT_FALSE(tokens.ok());
+    EXPECT_EQ(tokens.status().code(), absl::StatusCode::kInvalidArgument);
+}
+
+TEST(Lexer, Numbers) {
+    auto tokens = Tokenize("1 2.5 .5 3e10 4E-2");
+    ASSERT_TRUE(tokens.ok());
+    ASSERT_EQ(tokens->size(), 6);
+    EXPECT_EQ((*tokens)[1].text, "2.5");
+    EXPECT_EQ((*tokens)[2].text, ".5");
+    EXPECT_EQ((*tokens)[3].text, "3e10");
+    EXPECT_EQ((*tokens)[4].text, "4E-2");
+}
+
+TEST(Lexer, Placeholders) {
+    auto tokens = Tokenize("a = ? AND b = $12");
+    ASSERT_TRUE(tokens.ok());
+    ASSERT_EQ(tokens->size(), 8);
+    EXPECT_EQ((*tokens)[2].type, TokenType::kParameter);
+    EXPECT_EQ((*tokens)[2].text, "?");
+    EXPECT_EQ((*tokens)[6].type, TokenType::kParameter);
+    EXPECT_EQ((*tokens)[6].text, "$12");
+    EXPECT_FALSE(Tokenize("a = $x").ok());
+}
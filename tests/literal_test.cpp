@@ -0,0 +1,144 @@
+#include <google/protobuf/text_format.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "catalog.hpp"
+#include "detail/literal.hpp"
+#include "pink_perilla.hpp"
+#include "plan_cache.hpp"
+#include "substrait/plan.pb.h"
+
+namespace {
+
+using pink_perilla::DataType;
+using substrait::Expression;
+
+const pink_perilla::Catalog& Events() {
+    static const pink_perilla::Catalog catalog({
+        {"events",
+         {{"id", DataType::kI64, false},
+          {"code", DataType::kI16},
+          {"score", DataType::kFp64},
+          {"amount", DataType::kDecimal},
+          {"day", DataType::kDate},
+          {"at", DataType::kTimestamp},
+          {"note", DataType::kString}}},
+    });
+    return catalog;
+}
+
+// The VALUES row of a planned single-row INSERT.
+const Expression::Nested::Struct& InsertedRow(const substrait::Plan& plan) {
+    return plan.relations(0).root().input().write().input().read()
+        .virtual_table().expressions(0);
+}
+
+}  // namespace
+
+TEST(Literal, ParsesNumbersWithoutExceptions) {
+    using pink_perilla::literal::ParseDouble;
+    using pink_perilla::literal::ParseInteger;
+    EXPECT_EQ(ParseInteger("9223372036854775807", false), INT64_MAX);
+    EXPECT_EQ(ParseInteger("9223372036854775808", true), INT64_MIN);
+    EXPECT_FALSE(ParseInteger("9223372036854775808", false).has_value());
+    EXPECT_FALSE(ParseInteger("12a", false).has_value());
+    EXPECT_EQ(ParseDouble("2.5e3", true), -2500.0);
+    EXPECT_EQ(ParseDouble(".5", false), 0.5);
+    EXPECT_FALSE(ParseDouble("1.5x", false).has_value());
+}
+
+TEST(Literal, ParsesDecimalsExactly) {
+    std::optional<pink_perilla::literal::Decimal> decimal =
+        pink_perilla::literal::ParseDecimal("0012.340", true);
+    ASSERT_TRUE(decimal.has_value());
+    EXPECT_EQ(decimal->value, -12340);
+    EXPECT_EQ(decimal->precision, 5);
+    EXPECT_EQ(decimal->scale, 3);
+    EXPECT_EQ(pink_perilla::literal::DecimalBytes(*decimal),
+              std::string("\xcc\xcf\xff\xff\xff\xff\xff\xff"
+                          "\xff\xff\xff\xff\xff\xff\xff\xff",
+                          16));
+    EXPECT_FALSE(pink_perilla::literal::ParseDecimal("1e5", false));
+    EXPECT_FALSE(pink_perilla::literal::ParseDecimal(std::string(39, '9'), false));
+}
+
+TEST(Literal, ParsesDatesAndTimestamps) {
+    using pink_perilla::literal::ParseDate;
+    using pink_perilla::literal::ParseTimestamp;
+    EXPECT_EQ(ParseDate("1970-01-01"), 0);
+    EXPECT_EQ(ParseDate("2000-03-01"), 11017);
+    EXPECT_EQ(ParseDate("1969-12-31"), -1);
+    EXPECT_EQ(ParseDate("2024-02-29"), 19782);
+    EXPECT_FALSE(ParseDate("2023-02-29").has_value());
+    EXPECT_FALSE(ParseDate("2024-13-01").has_value());
+    EXPECT_FALSE(ParseDate("2024-1-01").has_value());
+    EXPECT_EQ(ParseTimestamp("1970-01-02"), 86400000000);
+    EXPECT_EQ(ParseTimestamp("1970-01-01 00:00:01.5"), 1500000);
+    EXPECT_EQ(ParseTimestamp("1970-01-01T01:02:03.0000049"), 3723000004);
+    EXPECT_FALSE(ParseTimestamp("1970-01-01 24:00:00").has_value());
+    EXPECT_FALSE(ParseTimestamp("1970-01-01 00:00:00.").has_value());
+}
+
+TEST(Literal, InsertCoercesToColumnTypes) {
+    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(
+        "INSERT INTO events (id, code, score, amount, day, at, note) VALUES "
+        "(1, -2, 3, 12.50, '2024-02-29', '2024-02-29 12:00:00', NULL)",
+        Events());
+    ASSERT_TRUE(plan.ok()) << plan.status();
+    const Expression::Nested::Struct& row = InsertedRow(*plan);
+    ASSERT_EQ(row.fields_size(), 7);
+    EXPECT_EQ(row.fields(0).literal().i64(), 1);
+    EXPECT_EQ(row.fields(1).literal().i16(), -2);
+    EXPECT_EQ(row.fields(2).literal().fp64(), 3.0);
+    const Expression::Literal::Decimal& amount = row.fields(3).literal().decimal();
+    EXPECT_EQ(amount.precision(), 4);
+    EXPECT_EQ(amount.scale(), 2);
+    EXPECT_EQ(amount.value(), pink_perilla::literal::DecimalBytes({1250, 4, 2}));
+    EXPECT_EQ(row.fields(4).literal().date(), 19782);
+    EXPECT_EQ(row.fields(5).literal().timestamp(),
+              int64_t{19782} * 86400000000 + int64_t{12} * 3600000000);
+    EXPECT_TRUE(row.fields(6).literal().null().has_string());
+}
+
+TEST(Literal, UnconvertibleValuesKeepTheirOwnType) {
+    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(
+        "INSERT INTO events (id, code, day) VALUES ('x', 70000, 'soon')",
+        Events());
+    ASSERT_TRUE(plan.ok()) << plan.status();
+    const Expression::Nested::Struct& row = InsertedRow(*plan);
+    EXPECT_EQ(row.fields(0).literal().string(), "x");
+    EXPECT_EQ(row.fields(1).literal().i32(), 70000);
+    EXPECT_EQ(row.fields(2).literal().string(), "soon");
+}
+
+TEST(Literal, TypedLiterals) {
+    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(
+        "UPDATE events SET day = DATE '1970-01-02', at = TIMESTAMP "
+        "'1970-01-01 00:00:01' WHERE id = 1",
+        Events());
+    ASSERT_TRUE(plan.ok()) << plan.status();
+    const std::string text = plan->DebugString();
+    EXPECT_NE(text.find("date: 1"), std::string::npos) << text;
+    EXPECT_NE(text.find("timestamp: 1000000"), std::string::npos) << text;
+
+    absl::StatusOr<substrait::Plan> invalid = pink_perilla::Parse(
+        "SELECT id FROM events WHERE day = DATE '2023-02-29'", Events());
+    EXPECT_EQ(invalid.status().code(), absl::StatusCode::kInvalidArgument);
+}
+
+TEST(Literal, PlanCacheKeepsCoercedLiterals) {
+    pink_perilla::PlanCache cache;
+    for (const char* day : {"2024-02-29", "1970-01-01"}) {
+        const std::string sql = std::string("INSERT INTO events (id, day) "
+                                            "VALUES (1, '") +
+                                day + "')";
+        absl::StatusOr<substrait::Plan> cached = cache.Parse(sql, Events());
+        ASSERT_TRUE(cached.ok()) << cached.status();
+        absl::StatusOr<substrait::Plan> direct = pink_perilla::Parse(sql, Events());
+        ASSERT_TRUE(direct.ok()) << direct.status();
+        EXPECT_EQ(cached->SerializeAsString(), direct->SerializeAsString()) << sql;
+    }
+}
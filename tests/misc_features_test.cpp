@@ -16,13 +16,28 @@ TEST(Misc, OrderBy) {
                       root {
                         input {
                           sort {
-                            input { read { named_table { names: "my_table" } } }
+                            input {
+                              read {
+                                base_schema { names: "col1" names: "col2" }
+                                named_table { names: "my_table" }
+                              }
+                            }
                             sorts {
-                              expr { literal { string: "col1" } }
+                              expr {
+                                selection {
+                                  direct_reference { struct_field { field: 0 } }
+                                  root_reference {}
+                                }
+                              }
                               direction: SORT_DIRECTION_ASC_NULLS_FIRST
                             }
                             sorts {
-                              expr { literal { string: "col2" } }
+                              expr {
+                                selection {
+                                  direct_reference { struct_field { field: 1 } }
+                                  root_reference {}
+                                }
+                              }
                               direction: SORT_DIRECTION_DESC_NULLS_FIRST
                             }
                           }
@@ -68,41 +83,65 @@ TEST(MiscFeatures, GroupByWithCount) {
     ASSERT_TRUE(plan.ok());
     ProtoEqual(
         *plan,
-        R"pb(relations {
+        R"pb(extension_uris {
+               extension_uri_anchor: 1
+               uri: "https://github.com/substrait-io/substrait/blob/main/extensions/functions_aggregate_generic.yaml"
+             }
+             extensions {
+               extension_function {
+                 extension_uri_reference: 1
+                 function_anchor: 1
+                 name: "count:any"
+               }
+             }
+             relations {
                root {
                  input {
                    project {
+                     common { emit { output_mapping: 2 output_mapping: 3 } }
                      input {
                        aggregate {
                          input {
                            read {
-                             named_table {
-                               names: "employees"
-                             }
+                             base_schema { names: "department" names: "employee_id" }
+                             named_table { names: "employees" }
                            }
                          }
-                         groupings {
-                           expression_references: 0
-                         }
+                         groupings { expression_references: 0 }
                          measures {
                            measure {
+                             function_reference: 1
+                             arguments {
+                               value {
+                                 selection {
+                                   direct_reference { struct_field { field: 1 } }
+                                   root_reference {}
+                                 }
+                               }
+                             }
+                             output_type { i64 { nullability: NULLABILITY_NULLABLE } }
+                             phase: AGGREGATION_PHASE_INITIAL_TO_RESULT
+                             invocation: AGGREGATION_INVOCATION_ALL
                            }
                          }
                          grouping_expressions {
-                           literal {
-                             string: "department"
+                           selection {
+                             direct_reference { struct_field { field: 0 } }
+                             root_reference {}
                            }
                          }
                        }
                      }
                      expressions {
-                       literal {
-                         string: "department"
+                       selection {
+                         direct_reference { struct_field { field: 0 } }
+                         root_reference {}
                        }
                      }
                      expressions {
-                       literal {
-                         string: "COUNT(employee_id)"
+                       selection {
+                         direct_reference { struct_field { field: 1 } }
+                         root_reference {}
                        }
                      }
                    }
@@ -119,41 +158,65 @@ TEST(MiscFeatures, GroupByWithAvg) {
     ASSERT_TRUE(plan.ok());
     ProtoEqual(
         *plan,
-        R"pb(relations {
+        R"pb(extension_uris {
+               extension_uri_anchor: 1
+               uri: "https://github.com/substrait-io/substrait/blob/main/extensions/functions_arithmetic.yaml"
+             }
+             extensions {
+               extension_function {
+                 extension_uri_reference: 1
+                 function_anchor: 1
+                 name: "avg:any"
+               }
+             }
+             relations {
                root {
                  input {
                    project {
+                     common { emit { output_mapping: 2 output_mapping: 3 } }
                      input {
                        aggregate {
                          input {
                            read {
-                             named_table {
-                               names: "employees"
-                             }
+                             base_schema { names: "department" names: "salary" }
+                             named_table { names: "employees" }
                            }
                          }
-                         groupings {
-                           expression_references: 0
-                         }
+                         groupings { expression_references: 0 }
                          measures {
                            measure {
+                             function_reference: 1
+                             arguments {
+                               value {
+                                 selection {
+                                   direct_reference { struct_field { field: 1 } }
+                                   root_reference {}
+                                 }
+                               }
+                             }
+                             output_type { fp64 { nullability: NULLABILITY_NULLABLE } }
+                             phase: AGGREGATION_PHASE_INITIAL_TO_RESULT
+                             invocation: AGGREGATION_INVOCATION_ALL
                            }
                          }
                          grouping_expressions {
-                           literal {
-                             string: "department"
+                           selection {
+                             direct_reference { struct_field { field: 0 } }
+                             root_reference {}
                            }
                          }
                        }
                      }
                      expressions {
-                       literal {
-                         string: "department"
+                       selection {
+                         direct_reference { struct_field { field: 0 } }
+                         root_reference {}
                        }
                      }
                      expressions {
-                       literal {
-                         string: "AVG(salary)"
+                       selection {
+                         direct_reference { struct_field { field: 1 } }
+                         root_reference {}
                        }
                      }
                    }
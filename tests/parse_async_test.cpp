@@ -0,0 +1,121 @@
+#include <google/protobuf/text_format.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "absl/synchronization/notification.h"
+#include "catalog.hpp"
+#include "detail/cancellation.hpp"
+#include "pink_perilla.hpp"
+#include "substrait/plan.pb.h"
+#include "thread_pool.hpp"
+
+namespace {
+
+// Holds tasks until RunAll(), so a test controls when planning happens.
+class ManualExecutor : public pink_perilla::Executor {
+public:
+    void Schedule(std::function<void()> task) override {
+        this->tasks_.push_back(std::move(task));
+    }
+
+    void RunAll() {
+        while (!this->tasks_.empty()) {
+            std::function<void()> task = std::move(this->tasks_.front());
+            this->tasks_.pop_front();
+            task();
+        }
+    }
+
+private:
+    std::deque<std::function<void()>> tasks_;
+};
+
+std::shared_ptr<const pink_perilla::Catalog> EmptyCatalog() {
+    return std::make_shared<const pink_perilla::Catalog>(
+        std::vector<pink_perilla::TableDefinition>{});
+}
+
+std::string LargeInsert(int rows) {
+    std::string sql = "INSERT INTO t (a, b) VALUES ";
+    for (int i = 0; i < rows; ++i) {
+        sql += (i == 0 ? "(" : ", (") + std::to_string(i) + ", 'x')";
+    }
+    return sql;
+}
+
+}  // namespace
+
+TEST(ParseAsync, DeliversPlanOnExecutor) {
+    pink_perilla::ThreadPool pool(2);
+    const std::string sql = "SELECT a FROM t WHERE b > 1";
+    absl::Notification done;
+    absl::StatusOr<substrait::Plan> result;
+    pink_perilla::ParseAsync(sql, EmptyCatalog(), pool,
+                             [&](absl::StatusOr<substrait::Plan> plan) {
+                                 result = std::move(plan);
+                                 done.Notify();
+                             });
+    done.WaitForNotification();
+    ASSERT_TRUE(result.ok()) << result.status();
+    EXPECT_EQ(result->SerializeAsString(),
+              pink_perilla::Parse(sql)->SerializeAsString());
+}
+
+TEST(ParseAsync, DeliversErrors) {
+    ManualExecutor executor;
+    absl::StatusCode code = absl::StatusCode::kOk;
+    pink_perilla::ParseAsync("SELEC a", EmptyCatalog(), executor,
+                             [&](absl::StatusOr<substrait::Plan> plan) {
+                                 code = plan.status().code();
+                             });
+    executor.RunAll();
+    EXPECT_EQ(code, absl::StatusCode::kInvalidArgument);
+}
+
+TEST(ParseAsync, CancelBeforeStart) {
+    ManualExecutor executor;
+    int calls = 0;
+    absl::StatusCode code = absl::StatusCode::kOk;
+    pink_perilla::ParseHandle handle = pink_perilla::ParseAsync(
+        "SELECT a FROM t", EmptyCatalog(), executor,
+        [&](absl::StatusOr<substrait::Plan> plan) {
+            ++calls;
+            code = plan.status().code();
+        });
+    handle.Cancel();
+    executor.RunAll();
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(code, absl::StatusCode::kCancelled);
+}
+
+TEST(ParseAsync, CancelWhilePlanning) {
+    pink_perilla::ThreadPool pool(1);
+    const std::string sql = LargeInsert(200000);
+    absl::Notification done;
+    absl::StatusCode code = absl::StatusCode::kOk;
+    pink_perilla::ParseHandle handle = pink_perilla::ParseAsync(
+        sql, EmptyCatalog(), pool, [&](absl::StatusOr<substrait::Plan> plan) {
+            code = plan.status().code();
+            done.Notify();
+        });
+    handle.Cancel();
+    done.WaitForNotification();
+    EXPECT_EQ(code, absl::StatusCode::kCancelled);
+}
+
+TEST(ParseAsync, CheckpointsStopPlanning) {
+    // With the flag already set, the first checkpoint ends planning.
+    const std::atomic<bool> cancelled{true};
+    const pink_perilla::detail::CancellationScope scope(&cancelled);
+    EXPECT_EQ(pink_perilla::Parse(LargeInsert(10)).status().code(),
+              absl::StatusCode::kCancelled);
+    EXPECT_EQ(pink_perilla::Parse("DROP TABLE t").status().code(),
+              absl::StatusCode::kCancelled);
+}
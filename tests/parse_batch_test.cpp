@@ -0,0 +1,78 @@
+#include <google/protobuf/text_format.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "absl/synchronization/blocking_counter.h"
+#include "catalog.hpp"
+#include "pink_perilla.hpp"
+#include "proto_tools.h"
+#include "substrait/plan.pb.h"
+#include "thread_pool.hpp"
+
+namespace {
+
+const std::vector<pink_perilla::TableDefinition> kTables = {
+    {"users",
+     {{"id", pink_perilla::DataType::kI64, false},
+      {"name", pink_perilla::DataType::kString}}},
+};
+
+}  // namespace
+
+TEST(ParseBatch, MatchesParseInInputOrder) {
+    std::vector<std::string> sql;
+    for (int i = 0; i < 500; ++i) {
+        sql.push_back(i % 7 == 3 ? "SELECT FROM"
+                                 : "SELECT name FROM users WHERE id = " +
+                                       std::to_string(i));
+    }
+    const std::vector<std::string_view> statements(sql.begin(), sql.end());
+    const pink_perilla::Catalog catalog(kTables);
+    pink_perilla::ThreadPool pool(4);
+
+    std::vector<absl::StatusOr<substrait::Plan>> plans =
+        pink_perilla::ParseBatch(statements, catalog, pool);
+
+    ASSERT_EQ(plans.size(), statements.size());
+    for (size_t i = 0; i < statements.size(); ++i) {
+        absl::StatusOr<substrait::Plan> expected =
+            pink_perilla::Parse(statements[i], kTables);
+        ASSERT_EQ(plans[i].ok(), expected.ok()) << statements[i];
+        if (expected.ok()) {
+            std::string expected_text;
+            google::protobuf::TextFormat::PrintToString(*expected,
+                                                        &expected_text);
+            ProtoEqual(*plans[i], expected_text);
+        }
+    }
+}
+
+TEST(ParseBatch, EmptyBatch) {
+    const pink_perilla::Catalog catalog(kTables);
+    pink_perilla::ThreadPool pool(2);
+    EXPECT_TRUE(pink_perilla::ParseBatch({}, catalog, pool).empty());
+}
+
+TEST(ThreadPool, IdleWorkersStealQueuedTasks) {
+    pink_perilla::ThreadPool pool(4);
+    std::atomic<int> ran{0};
+    absl::BlockingCounter done(1 + 100);
+    // Everything below is queued on one worker's own deque; the rest of the
+    // pool has to steal it.
+    pool.Schedule([&] {
+        for (int i = 0; i < 100; ++i) {
+            pool.Schedule([&] {
+                ran.fetch_add(1);
+                done.DecrementCount();
+            });
+        }
+        done.DecrementCount();
+    });
+    done.Wait();
+    EXPECT_EQ(ran.load(), 100);
+}
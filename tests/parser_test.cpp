@@ -1,7 +1,32 @@
 #include <gtest/gtest.h>
+#include <string>
+#include <variant>
+
+#include "detail/arena.hpp"
 #include "detail/sql_parser.hpp"
 
 TEST(ParserTest, SimpleParse) {
-    auto result = SqlParser::Parse("SELECT * FROM t", {});
+    pink_perilla::StatementArena arena;
+    auto result = SqlParser::Parse("SELECT * FROM t", {}, arena.resource());
     ASSERT_TRUE(result.ok());
 }
+
+TEST(ParserTest, IrBorrowsTextFromSource) {
+    const std::string sql = "SELECT name, \"Quoted\"\"Id\" FROM users WHERE id = 1";
+    pink_perilla::StatementArena arena;
+    auto result = SqlParser::Parse(sql, {}, arena.resource());
+    ASSERT_TRUE(result.ok());
+    const auto& select = std::get<SelectInfo>(*result);
+    ASSERT_EQ(select.select_items.size(), 2u);
+
+    // Plain identifiers and expressions are slices of the input buffer.
+    EXPECT_EQ(select.select_items[0].expression, "name");
+    EXPECT_EQ(select.select_items[0].expression.data(), sql.data() + 7);
+    EXPECT_EQ(select.from_table->name.data(), sql.data() + sql.find("users"));
+    const ExprNode& where = select.expressions[select.where_condition];
+    EXPECT_EQ(where.source, "id = 1");
+    EXPECT_EQ(where.source.data(), sql.data() + sql.find("id = 1"));
+    // Unescaping needs a copy, which lands in the arena.
+    EXPECT_EQ(select.expressions[select.select_items[1].expr].text, "Quoted\"Id");
+    EXPECT_EQ(select.select_items.get_allocator().resource(), arena.resource());
+}
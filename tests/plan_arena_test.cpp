@@ -0,0 +1,69 @@
+#include <google/protobuf/arena.h>
+#include <google/protobuf/text_format.h>
+#include <gtest/gtest.h>
+
+#include "absl/status/statusor.h"
+#include "pink_perilla.hpp"
+#include "proto_tools.h"
+#include "substrait/plan.pb.h"
+
+namespace {
+
+constexpr const char* kQueries[] = {
+    "SELECT a, b FROM t1 INNER JOIN t2 ON t1.id = t2.id WHERE a > 1 "
+    "ORDER BY a LIMIT 5",
+    "SELECT * FROM (SELECT * FROM inner_table) WHERE x = 1",
+    "SELECT c, COUNT(x) FROM t GROUP BY c",
+    "SELECT * FROM t1, t2",
+    "INSERT INTO t (a, b) VALUES (1, 'x')",
+    "UPDATE t SET a = 1 WHERE b = 2",
+    "DELETE FROM t WHERE a = 1",
+    "CREATE TABLE t (a integer, b varchar)",
+    "DROP TABLE t",
+};
+
+}  // namespace
+
+TEST(PlanArena, MatchesHeapPlan) {
+    google::protobuf::Arena arena;
+    for (const char* sql : kQueries) {
+        SCOPED_TRACE(sql);
+        absl::StatusOr<substrait::Plan> heap_plan = pink_perilla::Parse(sql);
+        absl::StatusOr<substrait::Plan*> arena_plan =
+            pink_perilla::Parse(sql, {}, &arena);
+        ASSERT_TRUE(heap_plan.ok());
+        ASSERT_TRUE(arena_plan.ok());
+        EXPECT_EQ((*arena_plan)->GetArena(), &arena);
+        ProtoEqual(**arena_plan, heap_plan->DebugString());
+    }
+}
+
+TEST(PlanArena, ReusableAfterReset) {
+    google::protobuf::Arena arena;
+    for (int i = 0; i < 3; ++i) {
+        absl::StatusOr<substrait::Plan*> plan =
+            pink_perilla::Parse("SELECT * FROM my_table LIMIT 10", {}, &arena);
+        ASSERT_TRUE(plan.ok());
+        ProtoEqual(**plan, R"pb(relations {
+                                  root {
+                                    input {
+                                      fetch {
+                                        input {
+                                          read {
+                                            named_table { names: "my_table" }
+                                          }
+                                        }
+                                        count_expr { literal { i64: 10 } }
+                                      }
+                                    }
+                                  }
+                                })pb");
+        arena.Reset();
+    }
+}
+
+TEST(PlanArena, ParseErrorLeavesArenaUsable) {
+    google::protobuf::Arena arena;
+    EXPECT_FALSE(pink_perilla::Parse("SELEC * FROM t", {}, &arena).ok());
+    EXPECT_TRUE(pink_perilla::Parse("SELECT * FROM t", {}, &arena).ok());
+}
@@ -0,0 +1,170 @@
+#include <google/protobuf/text_format.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "pink_perilla.hpp"
+#include "plan_cache.hpp"
+#include "proto_tools.h"
+#include "substrait/plan.pb.h"
+
+namespace {
+
+const std::vector<pink_perilla::TableDefinition> kTables = {
+    {"users",
+     {{"id", pink_perilla::DataType::kI64, false},
+      {"name", pink_perilla::DataType::kString},
+      {"age", pink_perilla::DataType::kI32}}},
+};
+
+// Checks that the cache returns exactly what Parse() would.
+void ExpectSameAsParse(
+    pink_perilla::PlanCache& cache, const std::string& sql,
+    const std::vector<pink_perilla::TableDefinition>& tables = kTables) {
+    absl::StatusOr<substrait::Plan> cached = cache.Parse(sql, tables);
+    absl::StatusOr<substrait::Plan> parsed = pink_perilla::Parse(sql, tables);
+    ASSERT_EQ(cached.ok(), parsed.ok()) << sql;
+    if (!parsed.ok()) {
+        return;
+    }
+    std::string expected;
+    google::protobuf::TextFormat::PrintToString(*parsed, &expected);
+    ProtoEqual(*cached, expected);
+}
+
+}  // namespace
+
+TEST(PlanCache, HitPatchesNewLiterals) {
+    pink_perilla::PlanCache cache;
+    ExpectSameAsParse(cache,
+                      "SELECT name FROM users WHERE age > 30 AND name = 'a'");
+    ExpectSameAsParse(cache,
+                      "SELECT name FROM users WHERE age > 41 AND name = 'it''s'");
+    ExpectSameAsParse(cache, "INSERT INTO users (id, name) VALUES (1, 'x')");
+    ExpectSameAsParse(cache, "INSERT INTO users (id, name) VALUES (2, 'y')");
+
+    pink_perilla::PlanCacheStats stats = cache.stats();
+    EXPECT_EQ(stats.hits, 2);
+    EXPECT_EQ(stats.misses, 2);
+    EXPECT_EQ(stats.entries, 2);
+    EXPECT_GT(stats.bytes, 0);
+}
+
+TEST(PlanCache, LiteralTypeIsPartOfTheKey) {
+    pink_perilla::PlanCache cache;
+    ExpectSameAsParse(cache, "SELECT name FROM users WHERE age > 1");
+    ExpectSameAsParse(cache, "SELECT name FROM users WHERE age > 5000000000");
+    ExpectSameAsParse(cache, "SELECT name FROM users WHERE age > 1.5");
+    EXPECT_EQ(cache.stats().hits, 0);
+    EXPECT_EQ(cache.stats().entries, 3);
+}
+
+TEST(PlanCache, ValueSensitiveLiteralsMustMatch) {
+    pink_perilla::PlanCache cache;
+    // ORDER BY 1 and ORDER BY 2 sort by different select items.
+    ExpectSameAsParse(cache, "SELECT name, age FROM users ORDER BY 1");
+    ExpectSameAsParse(cache, "SELECT name, age FROM users ORDER BY 2");
+    ExpectSameAsParse(cache, "SELECT name FROM users LIMIT 10");
+    ExpectSameAsParse(cache, "SELECT name FROM users LIMIT 20");
+    ExpectSameAsParse(cache,
+                      "SELECT age + 1, COUNT(*) FROM users GROUP BY age + 1");
+    ExpectSameAsParse(cache,
+                      "SELECT age + 2, COUNT(*) FROM users GROUP BY age + 1");
+    ExpectSameAsParse(cache, "SELECT -5 FROM users");
+    ExpectSameAsParse(cache, "SELECT -6 FROM users");
+    EXPECT_EQ(cache.stats().hits, 0);
+}
+
+TEST(PlanCache, NarrowedLiteralsStayLiterals) {
+    const std::vector<pink_perilla::TableDefinition> tables = {
+        {"small",
+         {{"a", pink_perilla::DataType::kI16}, {"b", pink_perilla::DataType::kI8}}},
+    };
+    pink_perilla::PlanCache cache;
+    // 5 fits the column and is narrowed to it; 40000 and 300 do not, and
+    // Parse() keeps them as i32. Neither may be bound into the other's plan.
+    ExpectSameAsParse(cache, "INSERT INTO small (a) VALUES (5)", tables);
+    ExpectSameAsParse(cache, "INSERT INTO small (a) VALUES (40000)", tables);
+    ExpectSameAsParse(cache, "UPDATE small SET a = 5", tables);
+    ExpectSameAsParse(cache, "UPDATE small SET a = 40000", tables);
+    ExpectSameAsParse(cache, "UPDATE small SET b = 300", tables);
+    ExpectSameAsParse(cache, "UPDATE small SET b = 1", tables);
+    EXPECT_EQ(cache.stats().hits, 0);
+
+    // Repeating the literal exactly still hits.
+    ExpectSameAsParse(cache, "UPDATE small SET b = 1", tables);
+    EXPECT_EQ(cache.stats().hits, 1);
+}
+
+TEST(PlanCache, SchemaChangeMisses) {
+    pink_perilla::PlanCache cache;
+    std::vector<pink_perilla::TableDefinition> tables = kTables;
+    ExpectSameAsParse(cache, "SELECT name FROM users WHERE age = 3", tables);
+    tables[0].columns[2].type = pink_perilla::DataType::kI64;
+    ExpectSameAsParse(cache, "SELECT name FROM users WHERE age = 3", tables);
+    EXPECT_EQ(cache.stats().hits, 0);
+    EXPECT_EQ(cache.stats().misses, 2);
+}
+
+TEST(PlanCache, EvictsToStayUnderMemoryCap) {
+    auto sql = [](int i) {
+        return "SELECT a FROM events WHERE b > 1 AND c" + std::to_string(i) +
+               " = 'x'";
+    };
+    pink_perilla::PlanCache probe;
+    ASSERT_TRUE(probe.Parse(sql(10)).ok());
+    const size_t entry_bytes = probe.stats().bytes;
+
+    pink_perilla::PlanCacheOptions options;
+    options.shards = 1;
+    options.max_bytes = entry_bytes * 7 / 2;
+    pink_perilla::PlanCache cache(options);
+    for (int i = 0; i < 50; ++i) {
+        ExpectSameAsParse(cache, sql(i), {});
+    }
+    pink_perilla::PlanCacheStats stats = cache.stats();
+    EXPECT_LE(stats.bytes, options.max_bytes);
+    EXPECT_EQ(stats.entries, 3);
+    EXPECT_EQ(stats.evictions, 47);
+
+    cache.Clear();
+    EXPECT_EQ(cache.stats().entries, 0);
+    EXPECT_EQ(cache.stats().bytes, 0);
+}
+
+TEST(PlanCache, ErrorsAndPlaceholdersBypassTheCache) {
+    pink_perilla::PlanCache cache;
+    EXPECT_FALSE(cache.Parse("SELECT FROM", kTables).ok());
+    EXPECT_FALSE(cache.Parse("SELECT missing FROM users", kTables).ok());
+    ExpectSameAsParse(cache, "SELECT name FROM users WHERE id = ?");
+    EXPECT_EQ(cache.stats().entries, 0);
+}
+
+TEST(PlanCache, ConcurrentCallers) {
+    pink_perilla::PlanCache cache;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&cache, t] {
+            for (int i = 0; i < 200; ++i) {
+                const std::string sql =
+                    "SELECT name FROM users WHERE age > " +
+                    std::to_string(t * 1000 + i);
+                absl::StatusOr<substrait::Plan> plan =
+                    cache.Parse(sql, kTables);
+                ASSERT_TRUE(plan.ok());
+                EXPECT_EQ(plan->relations(0).root().input().project().input()
+                              .filter().condition().scalar_function()
+                              .arguments(1).value().literal().i32(),
+                          t * 1000 + i);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(cache.stats().hits + cache.stats().misses, 800);
+    EXPECT_EQ(cache.stats().entries, 1);
+}
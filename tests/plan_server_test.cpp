@@ -0,0 +1,179 @@
+#include <google/protobuf/text_format.h>
+#include <gtest/gtest.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "catalog.hpp"
+#include "pink_perilla.hpp"
+#include "plan_server.hpp"
+#include "substrait/plan.pb.h"
+
+namespace {
+
+std::string SocketPath(const char* name) {
+    return std::string("/tmp/pink_perilla_") + name + "." +
+           std::to_string(getpid()) + ".sock";
+}
+
+// A PlanServer running on its own thread for the lifetime of the fixture.
+class Serving {
+public:
+    explicit Serving(const std::string& path,
+                     const pink_perilla::PlanServerOptions& options = {})
+        : catalog_(std::make_shared<const pink_perilla::Catalog>(
+              std::vector<pink_perilla::TableDefinition>{})) {
+        absl::StatusOr<std::unique_ptr<pink_perilla::PlanServer>> server =
+            pink_perilla::PlanServer::Listen(path, this->catalog_, options);
+        EXPECT_TRUE(server.ok()) << server.status();
+        if (server.ok()) {
+            this->server_ = *std::move(server);
+            this->thread_ = std::thread(
+                [this] { EXPECT_TRUE(this->server_->Run().ok()); });
+        }
+    }
+    ~Serving() {
+        if (this->server_ != nullptr) {
+            this->server_->Shutdown();
+            this->thread_.join();
+        }
+    }
+
+private:
+    pink_perilla::CatalogHandle catalog_;
+    std::unique_ptr<pink_perilla::PlanServer> server_;
+    std::thread thread_;
+};
+
+std::string Statement(int i) {
+    return i % 3 == 0 ? "SELECT a, b FROM t WHERE a > " + std::to_string(i)
+                      : "UPDATE t SET b = " + std::to_string(i) + " WHERE a = 1";
+}
+
+}  // namespace
+
+TEST(PlanServer, AnswersPipelinedRequestsInOrder) {
+    const std::string path = SocketPath("pipelined");
+    Serving serving(path);
+    absl::StatusOr<pink_perilla::PlanClient> client =
+        pink_perilla::PlanClient::Connect(path);
+    ASSERT_TRUE(client.ok()) << client.status();
+
+    constexpr int kRequests = 200;
+    for (int i = 0; i < kRequests; ++i) {
+        ASSERT_TRUE(client->Send(i == 7 ? "SELEC nonsense" : Statement(i)).ok());
+    }
+    for (int i = 0; i < kRequests; ++i) {
+        absl::StatusOr<substrait::Plan> plan = client->Receive();
+        if (i == 7) {
+            EXPECT_EQ(plan.status().code(), absl::StatusCode::kInvalidArgument);
+            continue;
+        }
+        ASSERT_TRUE(plan.ok()) << i << ": " << plan.status();
+        absl::StatusOr<substrait::Plan> expected = pink_perilla::Parse(Statement(i));
+        ASSERT_TRUE(expected.ok());
+        EXPECT_EQ(plan->SerializeAsString(), expected->SerializeAsString()) << i;
+    }
+}
+
+TEST(PlanServer, ServesConnectionsConcurrently) {
+    const std::string path = SocketPath("concurrent");
+    pink_perilla::PlanServerOptions options;
+    options.threads = 4;
+    // Small enough that the server has to stop reading and resume.
+    options.max_pending_per_connection = 8;
+    Serving serving(path, options);
+
+    std::vector<std::thread> clients;
+    for (int c = 0; c < 8; ++c) {
+        clients.emplace_back([&path, c] {
+            absl::StatusOr<pink_perilla::PlanClient> client =
+                pink_perilla::PlanClient::Connect(path);
+            ASSERT_TRUE(client.ok()) << client.status();
+            for (int i = 0; i < 100; ++i) {
+                ASSERT_TRUE(client->Send(Statement(c * 100 + i)).ok());
+            }
+            for (int i = 0; i < 100; ++i) {
+                absl::StatusOr<substrait::Plan> plan = client->Receive();
+                ASSERT_TRUE(plan.ok()) << plan.status();
+                EXPECT_EQ(plan->SerializeAsString(),
+                          pink_perilla::Parse(Statement(c * 100 + i))
+                              ->SerializeAsString());
+            }
+        });
+    }
+    for (std::thread& client : clients) {
+        client.join();
+    }
+}
+
+TEST(PlanServer, RejectsOversizedRequests) {
+    const std::string path = SocketPath("oversized");
+    pink_perilla::PlanServerOptions options;
+    options.max_request_bytes = 16;
+    Serving serving(path, options);
+    absl::StatusOr<pink_perilla::PlanClient> client =
+        pink_perilla::PlanClient::Connect(path);
+    ASSERT_TRUE(client.ok()) << client.status();
+
+    ASSERT_TRUE(client->Send("SELECT a FROM t").ok());
+    ASSERT_TRUE(client->Send("SELECT a, b, c FROM t").ok());
+    EXPECT_TRUE(client->Receive().ok());
+    EXPECT_EQ(client->Receive().status().code(),
+              absl::StatusCode::kResourceExhausted);
+    EXPECT_EQ(client->Receive().status().code(), absl::StatusCode::kUnavailable);
+}
+
+TEST(PlanServer, AnswersLateRequestsWithDeadlineExceeded) {
+    const std::string path = SocketPath("timeout");
+    pink_perilla::PlanServerOptions options;
+    options.threads = 1;
+    options.request_timeout = std::chrono::milliseconds(50);
+    Serving serving(path, options);
+    absl::StatusOr<pink_perilla::PlanClient> client =
+        pink_perilla::PlanClient::Connect(path);
+    ASSERT_TRUE(client.ok()) << client.status();
+
+    // Takes several times the timeout to plan.
+    std::string large = "INSERT INTO t (a) VALUES (0)";
+    for (int i = 1; i < 500000; ++i) {
+        large += ", (" + std::to_string(i) + ")";
+    }
+    ASSERT_TRUE(client->Send(large).ok());
+    EXPECT_EQ(client->Receive().status().code(),
+              absl::StatusCode::kDeadlineExceeded);
+    ASSERT_TRUE(client->Send("SELECT a FROM t").ok());
+    EXPECT_TRUE(client->Receive().ok());
+}
+
+TEST(PlanServer, ReplacesStaleSocketOnly) {
+    const std::string path = SocketPath("stale");
+    {
+        // A socket file whose server is gone.
+        const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::strcpy(address.sun_path, path.c_str());
+        ASSERT_EQ(bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)),
+                  0);
+        close(fd);
+    }
+    const pink_perilla::CatalogHandle catalog(
+        std::make_shared<const pink_perilla::Catalog>(
+            std::vector<pink_perilla::TableDefinition>{}));
+    absl::StatusOr<std::unique_ptr<pink_perilla::PlanServer>> first =
+        pink_perilla::PlanServer::Listen(path, catalog);
+    ASSERT_TRUE(first.ok()) << first.status();
+    EXPECT_EQ(pink_perilla::PlanServer::Listen(path, catalog).status().code(),
+              absl::StatusCode::kAlreadyExists);
+    first->reset();
+    EXPECT_NE(access(path.c_str(), F_OK), 0);
+}
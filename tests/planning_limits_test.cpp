@@ -0,0 +1,112 @@
+#include <google/protobuf/text_format.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "catalog.hpp"
+#include "parse_options.hpp"
+#include "pink_perilla.hpp"
+#include "substrait/plan.pb.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const pink_perilla::Catalog kCatalog(
+    std::vector<pink_perilla::TableDefinition>{});
+
+std::string LargeInsert(int rows) {
+    std::string sql = "INSERT INTO t (a, b) VALUES ";
+    for (int i = 0; i < rows; ++i) {
+        sql += (i == 0 ? "(" : ", (") + std::to_string(i) + ", 'x')";
+    }
+    return sql;
+}
+
+std::string InList(int values) {
+    std::string sql = "SELECT a FROM t WHERE a IN (0";
+    for (int i = 1; i < values; ++i) {
+        sql += ", " + std::to_string(i);
+    }
+    return sql + ")";
+}
+
+absl::StatusCode PlanCode(const std::string& sql,
+                          const pink_perilla::ParseOptions& options) {
+    return pink_perilla::Parse(sql, kCatalog, options, nullptr).status().code();
+}
+
+}  // namespace
+
+TEST(PlanningLimits, NoLimitsByDefault) {
+    EXPECT_EQ(PlanCode(LargeInsert(1000), {}), absl::StatusCode::kOk);
+}
+
+TEST(PlanningLimits, PassedDeadlineSkipsPlanning) {
+    pink_perilla::ParseOptions options;
+    options.deadline = Clock::now() - std::chrono::seconds(1);
+    EXPECT_EQ(PlanCode("SELECT a FROM t", options),
+              absl::StatusCode::kDeadlineExceeded);
+}
+
+TEST(PlanningLimits, DeadlineStopsLargeStatement) {
+    const std::string sql = LargeInsert(200000);
+    pink_perilla::ParseOptions options;
+    options.deadline = Clock::now() + std::chrono::milliseconds(1);
+    EXPECT_EQ(PlanCode(sql, options), absl::StatusCode::kDeadlineExceeded);
+
+    options.deadline = Clock::now() + std::chrono::hours(1);
+    EXPECT_EQ(PlanCode(sql, options), absl::StatusCode::kOk);
+}
+
+TEST(PlanningLimits, IrNodeLimit) {
+    pink_perilla::ParseOptions options;
+    // The IN list, its 100 values and the column it tests, plus the
+    // select item.
+    options.max_ir_nodes = 103;
+    EXPECT_EQ(PlanCode(InList(100), options), absl::StatusCode::kOk);
+    options.max_ir_nodes = 50;
+    EXPECT_EQ(PlanCode(InList(100), options),
+              absl::StatusCode::kResourceExhausted);
+}
+
+TEST(PlanningLimits, PlanByteLimit) {
+    const std::string sql = LargeInsert(1000);
+    const size_t bytes = pink_perilla::Parse(sql)->ByteSizeLong();
+    pink_perilla::ParseOptions options;
+    options.max_plan_bytes = bytes;
+    EXPECT_EQ(PlanCode(sql, options), absl::StatusCode::kOk);
+    options.max_plan_bytes = bytes / 2;
+    EXPECT_EQ(PlanCode(sql, options), absl::StatusCode::kResourceExhausted);
+    // Statements other than INSERT are measured once converted.
+    options.max_plan_bytes = 16;
+    EXPECT_EQ(PlanCode(InList(100), options),
+              absl::StatusCode::kResourceExhausted);
+}
+
+TEST(PlanningLimits, ChunksAreMeasuredOneByOne) {
+    pink_perilla::ParseOptions options;
+    options.insert_chunk_rows = 100;
+    // Later chunks hold longer numbers, so leave them some room.
+    options.max_plan_bytes =
+        2 * pink_perilla::Parse(LargeInsert(100))->ByteSizeLong();
+    int chunks = 0;
+    EXPECT_TRUE(pink_perilla::ParseChunked(LargeInsert(1000), kCatalog, options,
+                                           [&](const substrait::Plan&) {
+                                               ++chunks;
+                                               return absl::OkStatus();
+                                           })
+                    .ok());
+    EXPECT_EQ(chunks, 10);
+
+    options.insert_chunk_rows = 1000;
+    EXPECT_EQ(pink_perilla::ParseChunked(
+                  LargeInsert(1000), kCatalog, options,
+                  [](const substrait::Plan&) { return absl::OkStatus(); })
+                  .code(),
+              absl::StatusCode::kResourceExhausted);
+}
@@ -0,0 +1,61 @@
+#include <google/protobuf/text_format.h>
+#include <gtest/gtest.h>
+
+#include "absl/status/statusor.h"
+#include "catalog.hpp"
+#include "parse_options.hpp"
+#include "pink_perilla.hpp"
+#include "substrait/plan.pb.h"
+
+namespace {
+
+const pink_perilla::Catalog kCatalog({
+    {"users",
+     {{"id", pink_perilla::DataType::kI64, false},
+      {"name", pink_perilla::DataType::kString}}},
+});
+
+}  // namespace
+
+TEST(PlanningStats, FilledWhenRequested) {
+    pink_perilla::PlanningStats stats;
+    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(
+        "SELECT name FROM users WHERE id = 1", kCatalog, {true}, &stats);
+    ASSERT_TRUE(plan.ok()) << plan.status();
+
+    // SELECT name FROM users WHERE id = 1
+    EXPECT_EQ(stats.tokens, 8u);
+    // name, id, 1 and the comparison.
+    EXPECT_EQ(stats.ir_nodes, 4u);
+    EXPECT_EQ(stats.plan_bytes, plan->ByteSizeLong());
+    EXPECT_GT(stats.tokenize_ns + stats.parse_ns + stats.convert_ns, 0u);
+}
+
+TEST(PlanningStats, CountsSubqueries) {
+    pink_perilla::PlanningStats stats;
+    ASSERT_TRUE(pink_perilla::Parse(
+                    "SELECT id FROM (SELECT id FROM users WHERE id > 1)",
+                    kCatalog, {true}, &stats)
+                    .ok());
+    EXPECT_EQ(stats.ir_nodes, 5u);
+}
+
+TEST(PlanningStats, FilledUpToTheFailingPhase) {
+    pink_perilla::PlanningStats stats;
+    stats.plan_bytes = 99;
+    EXPECT_FALSE(
+        pink_perilla::Parse("SELECT FROM", kCatalog, {true}, &stats).ok());
+    EXPECT_EQ(stats.tokens, 2u);
+    EXPECT_EQ(stats.ir_nodes, 0u);
+    EXPECT_EQ(stats.convert_ns, 0u);
+    EXPECT_EQ(stats.plan_bytes, 0u);
+}
+
+TEST(PlanningStats, UntouchedWhenNotRequested) {
+    pink_perilla::PlanningStats stats;
+    stats.tokens = 42;
+    ASSERT_TRUE(pink_perilla::Parse("SELECT name FROM users", kCatalog, {},
+                                    &stats)
+                    .ok());
+    EXPECT_EQ(stats.tokens, 42u);
+}
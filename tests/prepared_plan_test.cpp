@@ -0,0 +1,222 @@
+#include <google/protobuf/text_format.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "pink_perilla.hpp"
+#include "proto_tools.h"
+#include "substrait/plan.pb.h"
+
+namespace {
+
+using pink_perilla::ParameterValue;
+
+const std::vector<pink_perilla::TableDefinition> kTables = {
+    {"users",
+     {{"id", pink_perilla::DataType::kI64, false},
+      {"name", pink_perilla::DataType::kString},
+      {"age", pink_perilla::DataType::kI32}}},
+};
+
+}  // namespace
+
+TEST(PreparedPlan, PlaceholdersBecomeTypedDynamicParameters) {
+    absl::StatusOr<pink_perilla::PreparedPlan> prepared = pink_perilla::Prepare(
+        "INSERT INTO users (id, name) VALUES (?, ?)", kTables);
+
+    ASSERT_TRUE(prepared.ok()) << prepared.status();
+    EXPECT_EQ(prepared->parameter_count(), 2);
+    ProtoEqual(prepared->plan_template(),
+        R"pb(relations {
+               root {
+                 input {
+                   write {
+                     named_table { names: "users" }
+                     input {
+                       read {
+                         base_schema { names: "id" names: "name" }
+                         virtual_table {
+                           expressions {
+                             fields {
+                               dynamic_parameter {
+                                 type { i64 { nullability: NULLABILITY_NULLABLE } }
+                                 parameter_reference: 0
+                               }
+                             }
+                             fields {
+                               dynamic_parameter {
+                                 type { string { nullability: NULLABILITY_NULLABLE } }
+                                 parameter_reference: 1
+                               }
+                             }
+                           }
+                         }
+                       }
+                     }
+                   }
+                 }
+               }
+             }
+        )pb");
+}
+
+TEST(PreparedPlan, BindReplacesPlaceholdersWithLiterals) {
+    absl::StatusOr<pink_perilla::PreparedPlan> prepared =
+        pink_perilla::Prepare("SELECT name FROM users WHERE age > $1", kTables);
+    ASSERT_TRUE(prepared.ok()) << prepared.status();
+
+    absl::StatusOr<substrait::Plan> plan = prepared->Bind({int64_t{30}});
+    ASSERT_TRUE(plan.ok()) << plan.status();
+    absl::StatusOr<substrait::Plan> expected =
+        pink_perilla::Parse("SELECT name FROM users WHERE age > 30", kTables);
+    ASSERT_TRUE(expected.ok());
+    std::string expected_text;
+    google::protobuf::TextFormat::PrintToString(*expected, &expected_text);
+    ProtoEqual(*plan, expected_text);
+}
+
+TEST(PreparedPlan, BindOnArena) {
+    absl::StatusOr<pink_perilla::PreparedPlan> prepared =
+        pink_perilla::Prepare("SELECT name FROM users WHERE id = ?", kTables);
+    ASSERT_TRUE(prepared.ok()) << prepared.status();
+
+    google::protobuf::Arena arena;
+    absl::StatusOr<substrait::Plan*> plan =
+        prepared->Bind({int64_t{5000000000}}, &arena);
+    ASSERT_TRUE(plan.ok()) << plan.status();
+    EXPECT_EQ((*plan)->GetArena(), &arena);
+    const substrait::Expression& condition =
+        (*plan)->relations(0).root().input().project().input().filter()
+            .condition();
+    EXPECT_EQ(condition.scalar_function().arguments(1).value().literal().i64(),
+              5000000000);
+}
+
+TEST(PreparedPlan, BatchInsertAddsOneRowPerBatchRow) {
+    absl::StatusOr<pink_perilla::PreparedPlan> prepared = pink_perilla::Prepare(
+        "INSERT INTO users (id, name) VALUES (?, ?)", kTables);
+    ASSERT_TRUE(prepared.ok()) << prepared.status();
+
+    absl::StatusOr<substrait::Plan> plan = prepared->BindBatch(
+        {{int64_t{1}, int64_t{2}}, {std::string("Alice"), std::monostate{}}});
+    ASSERT_TRUE(plan.ok()) << plan.status();
+    ProtoEqual(*plan,
+        R"pb(relations {
+               root {
+                 input {
+                   write {
+                     named_table { names: "users" }
+                     input {
+                       read {
+                         base_schema { names: "id" names: "name" }
+                         virtual_table {
+                           expressions {
+                             fields { literal { i64: 1 } }
+                             fields { literal { string: "Alice" } }
+                           }
+                           expressions {
+                             fields { literal { i64: 2 } }
+                             fields {
+                               literal {
+                                 null { string { nullability: NULLABILITY_NULLABLE } }
+                               }
+                             }
+                           }
+                         }
+                       }
+                     }
+                   }
+                 }
+               }
+             }
+        )pb");
+}
+
+TEST(PreparedPlan, BatchUpdateAddsOneRelationPerBatchRow) {
+    absl::StatusOr<pink_perilla::PreparedPlan> prepared = pink_perilla::Prepare(
+        "UPDATE users SET age = $2 WHERE id = $1", kTables);
+    ASSERT_TRUE(prepared.ok()) << prepared.status();
+    EXPECT_EQ(prepared->parameter_count(), 2);
+
+    absl::StatusOr<substrait::Plan> plan = prepared->BindBatch(
+        {{int64_t{1}, int64_t{2}, int64_t{3}},
+         {int64_t{20}, int64_t{30}, int64_t{40}}});
+    ASSERT_TRUE(plan.ok()) << plan.status();
+    ASSERT_EQ(plan->relations_size(), 3);
+    for (int row = 0; row < 3; ++row) {
+        const substrait::UpdateRel& update =
+            plan->relations(row).root().input().update();
+        EXPECT_EQ(update.condition().scalar_function().arguments(1).value()
+                      .literal().i64(),
+                  row + 1);
+        EXPECT_EQ(update.transformations(0).transformation().literal().i32(),
+                  20 + 10 * row);
+    }
+}
+
+TEST(PreparedPlan, RejectsBadBindings) {
+    absl::StatusOr<pink_perilla::PreparedPlan> prepared = pink_perilla::Prepare(
+        "UPDATE users SET age = ? WHERE name = ?", kTables);
+    ASSERT_TRUE(prepared.ok()) << prepared.status();
+
+    EXPECT_EQ(prepared->Bind({int64_t{1}}).status().code(),
+              absl::StatusCode::kInvalidArgument);
+    EXPECT_EQ(prepared->Bind({std::string("x"), std::string("y")})
+                  .status()
+                  .code(),
+              absl::StatusCode::kInvalidArgument);
+    EXPECT_EQ(prepared->Bind({int64_t{1} << 40, std::string("y")})
+                  .status()
+                  .code(),
+              absl::StatusCode::kOutOfRange);
+    EXPECT_EQ(prepared
+                  ->BindBatch({{int64_t{1}, int64_t{2}}, {std::string("y")}})
+                  .status()
+                  .code(),
+              absl::StatusCode::kInvalidArgument);
+}
+
+TEST(PreparedPlan, DecimalPlaceholdersBindLikeLiterals) {
+    const std::vector<pink_perilla::TableDefinition> tables = {
+        {"prices", {{"d", pink_perilla::DataType::kDecimal}}}};
+    absl::StatusOr<pink_perilla::PreparedPlan> prepared =
+        pink_perilla::Prepare("INSERT INTO prices (d) VALUES (?)", tables);
+    ASSERT_TRUE(prepared.ok()) << prepared.status();
+
+    const std::pair<ParameterValue, const char*> cases[] = {
+        {std::string("1.5"), "1.5"},
+        {std::string("-2.25"), "-2.25"},
+        {int64_t{7}, "7"},
+        {std::monostate{}, "NULL"},
+    };
+    for (const auto& [value, literal] : cases) {
+        absl::StatusOr<substrait::Plan> plan = prepared->Bind({value});
+        ASSERT_TRUE(plan.ok()) << literal << ": " << plan.status();
+        absl::StatusOr<substrait::Plan> expected = pink_perilla::Parse(
+            std::string("INSERT INTO prices (d) VALUES (") + literal + ")",
+            tables);
+        ASSERT_TRUE(expected.ok()) << expected.status();
+        std::string expected_text;
+        google::protobuf::TextFormat::PrintToString(*expected, &expected_text);
+        ProtoEqual(*plan, expected_text);
+    }
+
+    EXPECT_EQ(prepared->Bind({std::string("1e3")}).status().code(),
+              absl::StatusCode::kInvalidArgument);
+    EXPECT_EQ(prepared->Bind({1.5}).status().code(),
+              absl::StatusCode::kInvalidArgument);
+}
+
+TEST(PreparedPlan, RejectsMixedPlaceholderStyles) {
+    EXPECT_FALSE(
+        pink_perilla::Prepare("SELECT * FROM users WHERE id = ? OR id = $1",
+                              kTables)
+            .ok());
+    EXPECT_FALSE(
+        pink_perilla::Prepare("SELECT * FROM users WHERE id = $0", kTables)
+            .ok());
+}
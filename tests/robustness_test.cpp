@@ -1,6 +1,8 @@
 #include <google/protobuf/text_format.h>
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include "absl/status/statusor.h"
 #include "pink_perilla.hpp"
 #include "proto_tools.h"
@@ -57,9 +59,25 @@ TEST(Robustness, Mixed) {
                       root {
                         input {
                           project {
-                            input { read { named_table { names: "my_table" } } }
-                            expressions { literal { string: "col1" } }
-                            expressions { literal { string: "col2" } }
+                            common { emit { output_mapping: 2 output_mapping: 3 } }
+                            input {
+                              read {
+                                base_schema { names: "col1" names: "col2" }
+                                named_table { names: "my_table" }
+                              }
+                            }
+                            expressions {
+                              selection {
+                                direct_reference { struct_field { field: 0 } }
+                                root_reference {}
+                              }
+                            }
+                            expressions {
+                              selection {
+                                direct_reference { struct_field { field: 1 } }
+                                root_reference {}
+                              }
+                            }
                           }
                         }
                       }
@@ -80,28 +98,93 @@ TEST(Robustness, MultiLines) {
     ASSERT_TRUE(plan.ok());
     ProtoEqual(
         *plan,
-        R"pb(relations {
+        R"pb(extension_uris {
+               extension_uri_anchor: 1
+               uri: "https://github.com/substrait-io/substrait/blob/main/extensions/functions_comparison.yaml"
+             }
+             extensions {
+               extension_function {
+                 extension_uri_reference: 1
+                 function_anchor: 1
+                 name: "gt:any_any"
+               }
+             }
+             relations {
                root {
                  input {
                    project {
+                     common { emit { output_mapping: 2 } }
                      input {
                        filter {
                          input {
-                           read { named_table { names: "my_table" } }
+                           read {
+                             base_schema { names: "c2" names: "c1" }
+                             named_table { names: "my_table" }
+                           }
                          }
                          condition {
                            scalar_function {
+                             function_reference: 1
                              arguments {
-                               value { literal { string: "c2 > 10" } }
+                               value {
+                                 selection {
+                                   direct_reference { struct_field { field: 0 } }
+                                   root_reference {}
+                                 }
+                               }
                              }
+                             arguments { value { literal { i32: 10 } } }
+                             output_type { bool { nullability: NULLABILITY_NULLABLE } }
                            }
                          }
                        }
                      }
-                     expressions { literal { string: "c1" } }
+                     expressions {
+                       selection {
+                         direct_reference { struct_field { field: 1 } }
+                         root_reference {}
+                       }
+                     }
                    }
                  }
                }
              }
         )pb");
 }
+
+TEST(Robustness, DeepNestingIsRejected) {
+    const std::string parentheses =
+        "SELECT " + std::string(300, '(') + "a" + std::string(300, ')') +
+        " FROM t";
+    EXPECT_EQ(pink_perilla::Parse(parentheses).status().code(),
+              absl::StatusCode::kResourceExhausted);
+
+    std::string subqueries = "SELECT a FROM ";
+    for (int i = 0; i < 300; ++i) {
+        subqueries += "(SELECT * FROM ";
+    }
+    subqueries += "t" + std::string(300, ')');
+    EXPECT_EQ(pink_perilla::Parse(subqueries).status().code(),
+              absl::StatusCode::kResourceExhausted);
+}
+
+TEST(Robustness, LongOrChainIsOneCall) {
+    // An OR chain is flat, however long, so it never reaches the depth limit.
+    std::string sql = "SELECT a FROM t WHERE a = 0";
+    for (int i = 1; i < 10000; ++i) {
+        sql += " OR a = " + std::to_string(i);
+    }
+    absl::StatusOr<substrait::Plan> plan = pink_perilla::Parse(sql);
+
+    ASSERT_TRUE(plan.ok()) << plan.status();
+    EXPECT_EQ(plan->relations(0)
+                  .root()
+                  .input()
+                  .project()
+                  .input()
+                  .filter()
+                  .condition()
+                  .scalar_function()
+                  .arguments_size(),
+              10000);
+}
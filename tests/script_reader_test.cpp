@@ -0,0 +1,140 @@
+#include <google/protobuf/text_format.h>
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "catalog.hpp"
+#include "pink_perilla.hpp"
+#include "script_reader.hpp"
+#include "substrait/plan.pb.h"
+
+namespace {
+
+const char kScript[] =
+    "-- seed data; not applied yet\n"
+    "INSERT INTO users (id, name) VALUES (1, 'a;b');\n"
+    "  ;;\n"
+    "/* a block; comment */ SELECT \"odd;name\" FROM users;\n"
+    "SELECT name FROM users WHERE name = 'it''s; fine'\n"
+    "  AND id IN (1, 2);\n"
+    "DELETE FROM users WHERE id = 3";
+
+const std::vector<std::string> kStatements = {
+    "-- seed data; not applied yet\n"
+    "INSERT INTO users (id, name) VALUES (1, 'a;b')",
+    "/* a block; comment */ SELECT \"odd;name\" FROM users",
+    "SELECT name FROM users WHERE name = 'it''s; fine'\n  AND id IN (1, 2)",
+    "DELETE FROM users WHERE id = 3",
+};
+
+std::vector<std::string> Split(pink_perilla::ScriptReader& reader) {
+    std::vector<std::string> statements;
+    while (std::optional<pink_perilla::ScriptStatement> statement =
+               reader.Next()) {
+        statements.emplace_back(statement->sql);
+    }
+    return statements;
+}
+
+}  // namespace
+
+TEST(ScriptReader, SplitsOnTopLevelSemicolons) {
+    pink_perilla::ScriptReader reader{std::string_view(kScript)};
+    EXPECT_EQ(Split(reader), kStatements);
+    EXPECT_TRUE(reader.status().ok());
+}
+
+TEST(ScriptReader, ReportsOffsets) {
+    const std::string_view script(kScript);
+    pink_perilla::ScriptReader reader(script);
+    while (std::optional<pink_perilla::ScriptStatement> statement =
+               reader.Next()) {
+        EXPECT_EQ(script.substr(statement->offset, statement->sql.size()),
+                  statement->sql);
+    }
+}
+
+TEST(ScriptReader, StreamMatchesInPlaceAtAnyChunkSize) {
+    // Small chunks split quotes, comments and `--`, `/*` and `*/` across
+    // reads.
+    for (size_t chunk_size : {2, 3, 5, 16, 1 << 20}) {
+        std::istringstream input(kScript);
+        pink_perilla::ScriptReader reader(input, chunk_size);
+        std::vector<std::string> statements;
+        while (std::optional<pink_perilla::ScriptStatement> statement =
+                   reader.Next()) {
+            statements.emplace_back(statement->sql);
+            EXPECT_EQ(std::string_view(kScript).substr(statement->offset,
+                                                       statement->sql.size()),
+                      statement->sql);
+        }
+        EXPECT_EQ(statements, kStatements) << "chunk_size=" << chunk_size;
+    }
+}
+
+TEST(ScriptReader, SkipsEmptyAndCommentOnlyStatements) {
+    pink_perilla::ScriptReader reader{
+        std::string_view(" ; -- nothing\n; /* still nothing */ ;\n")};
+    EXPECT_FALSE(reader.Next().has_value());
+    EXPECT_FALSE(reader.Next().has_value());
+}
+
+TEST(ScriptReader, MapsFiles) {
+    char path[] = "/tmp/script_reader_testXXXXXX";
+    const int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    close(fd);
+    std::ofstream(path) << kScript;
+
+    absl::StatusOr<std::unique_ptr<pink_perilla::ScriptReader>> reader =
+        pink_perilla::ScriptReader::Open(path);
+    ASSERT_TRUE(reader.ok()) << reader.status();
+    EXPECT_EQ(Split(**reader), kStatements);
+
+    std::ofstream(path, std::ios::trunc).close();
+    reader = pink_perilla::ScriptReader::Open(path);
+    ASSERT_TRUE(reader.ok()) << reader.status();
+    EXPECT_FALSE((*reader)->Next().has_value());
+    unlink(path);
+
+    EXPECT_EQ(pink_perilla::ScriptReader::Open(path).status().code(),
+              absl::StatusCode::kNotFound);
+}
+
+TEST(ScriptPlanner, PlansEachStatementLazily) {
+    const pink_perilla::Catalog catalog({
+        {"users",
+         {{"id", pink_perilla::DataType::kI64, false},
+          {"name", pink_perilla::DataType::kString}}},
+    });
+    pink_perilla::ScriptReader reader{std::string_view(
+        "SELECT name FROM users WHERE id = 1;\nSELEC oops;\n"
+        "SELECT name FROM users WHERE id = 1")};
+    pink_perilla::ScriptPlanner planner(reader, catalog);
+
+    std::optional<absl::StatusOr<substrait::Plan>> first = planner.Next();
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(first->ok()) << first->status();
+    EXPECT_EQ(planner.statement().offset, 0u);
+
+    std::optional<absl::StatusOr<substrait::Plan>> second = planner.Next();
+    ASSERT_TRUE(second.has_value());
+    EXPECT_FALSE(second->ok());
+    EXPECT_EQ(planner.statement().sql, "SELEC oops");
+    EXPECT_EQ(planner.statement().offset, 37u);
+
+    std::optional<absl::StatusOr<substrait::Plan>> third = planner.Next();
+    ASSERT_TRUE(third.has_value());
+    ASSERT_TRUE(third->ok()) << third->status();
+    EXPECT_EQ((*third)->SerializeAsString(), (*first)->SerializeAsString());
+
+    EXPECT_FALSE(planner.Next().has_value());
+}
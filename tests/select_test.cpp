@@ -13,26 +13,59 @@ TEST(Select, SelectWithWhere) {
 
     ASSERT_TRUE(plan.ok());
     ProtoEqual(*plan,
-        R"pb(relations {
+        R"pb(extension_uris {
+               extension_uri_anchor: 1
+               uri: "https://github.com/substrait-io/substrait/blob/main/extensions/functions_comparison.yaml"
+             }
+             extensions {
+               extension_function {
+                 extension_uri_reference: 1
+                 function_anchor: 1
+                 name: "gt:any_any"
+               }
+             }
+             relations {
                root {
                  input {
                    project {
+                     common { emit { output_mapping: 3 output_mapping: 4 } }
                      input {
                        filter {
                          input {
-                           read { named_table { names: "table" } }
+                           read {
+                             base_schema { names: "x" names: "a" names: "b" }
+                             named_table { names: "table" }
+                           }
                          }
                          condition {
                            scalar_function {
+                             function_reference: 1
                              arguments {
-                               value { literal { string: "x > 0" } }
+                               value {
+                                 selection {
+                                   direct_reference { struct_field { field: 0 } }
+                                   root_reference {}
+                                 }
+                               }
                              }
+                             arguments { value { literal { i32: 0 } } }
+                             output_type { bool { nullability: NULLABILITY_NULLABLE } }
                            }
                          }
                        }
                      }
-                     expressions { literal { string: "a" } }
-                     expressions { literal { string: "b" } }
+                     expressions {
+                       selection {
+                         direct_reference { struct_field { field: 1 } }
+                         root_reference {}
+                       }
+                     }
+                     expressions {
+                       selection {
+                         direct_reference { struct_field { field: 2 } }
+                         root_reference {}
+                       }
+                     }
                    }
                  }
                }
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+
+#include "detail/structural_index.hpp"
+
+using pink_perilla::lexer::ScanKernel;
+using pink_perilla::lexer::StructuralIndex;
+
+namespace {
+
+// Collects, for every position, the answers of all three queries so indexes
+// built by different kernels can be compared wholesale.
+std::vector<size_t> Probe(const StructuralIndex &index, std::string_view sql) {
+    std::vector<size_t> result;
+    for (size_t i = 0; i <= sql.size(); ++i) {
+        result.push_back(index.NextSignificant(i));
+        result.push_back(index.WordEnd(i));
+        if (i < sql.size() && (sql[i] == '\'' || sql[i] == '"')) {
+            result.push_back(index.QuoteEnd(i));
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(StructuralIndex, SkipsWhitespaceAndComments) {
+    const std::string sql = "  a -- x 'y'\n /* 'z' */ b";
+    auto index = StructuralIndex::Build(sql);
+    ASSERT_TRUE(index.ok());
+    EXPECT_EQ(index->NextSignificant(0), 2);
+    EXPECT_EQ(index->NextSignificant(3), sql.find('b'));
+}
+
+TEST(StructuralIndex, QuoteSpansHonourEscapes) {
+    const std::string sql = "('it''s, ok', \"a\"\"b\")";
+    auto index = StructuralIndex::Build(sql);
+    ASSERT_TRUE(index.ok());
+    EXPECT_EQ(index->QuoteEnd(1), sql.find("',") + 1);
+    EXPECT_EQ(index->QuoteEnd(sql.find('"')), sql.size() - 1);
+}
+
+TEST(StructuralIndex, AdjacentQuotesEndAtTheirOwnClose) {
+    const std::string sql = "'x'\"y\"'a''b'";
+    auto index = StructuralIndex::Build(sql);
+    ASSERT_TRUE(index.ok());
+    EXPECT_EQ(index->QuoteEnd(0), 3);
+    EXPECT_EQ(index->QuoteEnd(3), 6);
+    EXPECT_EQ(index->QuoteEnd(6), sql.size());
+}
+
+TEST(StructuralIndex, CommentMarkersInsideQuotesAreLiteral) {
+    const std::string sql = "'--' x '/*' y";
+    auto index = StructuralIndex::Build(sql);
+    ASSERT_TRUE(index.ok());
+    EXPECT_EQ(index->NextSignificant(4), sql.find('x'));
+    EXPECT_EQ(index->NextSignificant(11), sql.find('y'));
+}
+
+TEST(StructuralIndex, UnclosedCommentRunsToEnd) {
+    auto index = StructuralIndex::Build("a /* never closed");
+    ASSERT_TRUE(index.ok());
+    EXPECT_EQ(index->NextSignificant(1), index->size());
+}
+
+TEST(StructuralIndex, CommentClosingAcrossBlocks) {
+    // The "*/" straddles the boundary between the first and second block.
+    const std::string sql = "a /*" + std::string(59, ' ') + "*/ b";
+    ASSERT_EQ(sql.find("*/"), 63u);
+    auto index = StructuralIndex::Build(sql);
+    ASSERT_TRUE(index.ok());
+    EXPECT_EQ(index->NextSignificant(1), sql.find('b'));
+}
+
+TEST(StructuralIndex, RejectsUnterminatedQuote) {
+    auto index = StructuralIndex::Build("SELECT 'abc");
+    ASSERT_FALSE(index.ok());
+    EXPECT_EQ(index.status().code(), absl::StatusCode::kInvalidArgument);
+}
+
+TEST(StructuralIndex, KernelsAgree) {
+    const std::string alphabet = "ab_Z09 \t\n'\"-/*(),;";
+    std::mt19937 rng(42);
+    for (int round = 0; round < 500; ++round) {
+        std::string sql;
+        const size_t length = rng() % 300;
+        for (size_t i = 0; i < length; ++i) {
+            sql += alphabet[rng() % alphabet.size()];
+        }
+        auto scalar = StructuralIndex::Build(sql, ScanKernel::kScalar);
+        for (ScanKernel kernel : {ScanKernel::kSse2, ScanKernel::kAvx2}) {
+            auto simd = StructuralIndex::Build(sql, kernel);
+            ASSERT_EQ(scalar.ok(), simd.ok()) << sql;
+            if (scalar.ok()) {
+                EXPECT_EQ(Probe(*scalar, sql), Probe(*simd, sql)) << sql;
+            }
+        }
+    }
+}
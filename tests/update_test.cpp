@@ -13,19 +13,40 @@ TEST(Update, BasicUpdate) {
     ASSERT_TRUE(plan.ok());
     ProtoEqual(
         *plan,
-        R"pb(relations {
+        R"pb(extension_uris {
+               extension_uri_anchor: 1
+               uri: "https://github.com/substrait-io/substrait/blob/main/extensions/functions_comparison.yaml"
+             }
+             extensions {
+               extension_function {
+                 extension_uri_reference: 1
+                 function_anchor: 1
+                 name: "equal:any_any"
+               }
+             }
+             relations {
                root {
                  input {
                    update {
                      named_table { names: "users" }
+                     table_schema { names: "name" names: "id" }
                      condition {
                        scalar_function {
+                         function_reference: 1
                          arguments {
-                           value { literal { string: "id = 101" } }
+                           value {
+                             selection {
+                               direct_reference { struct_field { field: 1 } }
+                               root_reference {}
+                             }
+                           }
                          }
+                         arguments { value { literal { i32: 101 } } }
+                         output_type { bool { nullability: NULLABILITY_NULLABLE } }
                        }
                      }
                      transformations {
+                       column_target: 0
                        transformation { literal { string: "Bob" } }
                      }
                    }